@@ -12,6 +12,7 @@
 #include <baregl/types/EBlendingFactor.h>
 #include <baregl/types/EComparaisonAlgorithm.h>
 #include <baregl/types/ECullFace.h>
+#include <baregl/types/EDataType.h>
 #include <baregl/types/EGetParameter.h>
 #include <baregl/types/EMemoryBarrierFlags.h>
 #include <baregl/types/EOperation.h>
@@ -74,16 +75,18 @@ namespace baregl
 		* Renders primitives from array data.
 		* @param p_primitiveMode Specifies the kind of primitives to render.
 		* @param p_indexCount The number of elements to render.
+		* @param p_indexType The type of the indices (UNSIGNED_BYTE, UNSIGNED_SHORT or UNSIGNED_INT).
 		*/
-		void DrawElements(types::EPrimitiveMode p_primitiveMode, uint32_t p_indexCount);
+		void DrawElements(types::EPrimitiveMode p_primitiveMode, uint32_t p_indexCount, types::EDataType p_indexType = types::EDataType::UNSIGNED_INT);
 
 		/**
 		* Renders multiple instances of a set of elements.
 		* @param p_primitiveMode Specifies the kind of primitives to render.
 		* @param p_indexCount The number of elements to render.
 		* @param p_instances The number of instances to render.
+		* @param p_indexType The type of the indices (UNSIGNED_BYTE, UNSIGNED_SHORT or UNSIGNED_INT).
 		*/
-		void DrawElementsInstanced(types::EPrimitiveMode p_primitiveMode, uint32_t p_indexCount, uint32_t p_instances);
+		void DrawElementsInstanced(types::EPrimitiveMode p_primitiveMode, uint32_t p_indexCount, uint32_t p_instances, types::EDataType p_indexType = types::EDataType::UNSIGNED_INT);
 
 		/**
 		* Renders primitives from array data without indexing.
@@ -83,8 +83,17 @@ namespace baregl
 		* @param p_data Pointer to the data to upload.
 		* @param p_format Format of the data.
 		* @param p_type Type of the pixel data.
+		* @param p_level Mipmap level to upload (Mutable textures only have the level 0).
 		*/
-		void Upload(const void* p_data, types::EFormat p_format, types::EPixelDataType p_type);
+		void Upload(const void* p_data, types::EFormat p_format, types::EPixelDataType p_type, uint32_t p_level = 0);
+
+		/**
+		* Uploads block-compressed data to a 2D texture allocated with a compressed internal format.
+		* @param p_data Pointer to the compressed blocks to upload.
+		* @param p_size Size of the compressed data, in bytes.
+		* @param p_level Mipmap level to upload.
+		*/
+		void UploadCompressed(const void* p_data, uint32_t p_size, uint32_t p_level = 0);
 
 		/**
 		* Resizes the texture.
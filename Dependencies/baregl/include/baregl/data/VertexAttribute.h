@@ -41,6 +41,14 @@ namespace baregl::data
 		uint8_t count = 4;
 	};
 
-	using VertexAttribute = std::variant<FloatVertexAttribute, IntegerVertexAttribute, DoubleVertexAttribute>;
+	/**
+	* Reserves an attribute location without providing any data for it.
+	* The attribute stays disabled, so shaders read its current generic value (0, 0, 0, 1 by default).
+	*/
+	struct UnusedVertexAttribute
+	{
+	};
+
+	using VertexAttribute = std::variant<FloatVertexAttribute, IntegerVertexAttribute, DoubleVertexAttribute, UnusedVertexAttribute>;
 	using VertexAttributeLayout = std::initializer_list<VertexAttribute>;
 }
@@ -22,6 +22,8 @@ namespace baregl::types
 		INT,
 		UNSIGNED_INT,
 		FLOAT,
-		DOUBLE
+		DOUBLE,
+		HALF_FLOAT,
+		INT_2_10_10_10_REV // Packed in 32 bits, only valid for 4-component attributes
 	};
 }
\ No newline at end of file
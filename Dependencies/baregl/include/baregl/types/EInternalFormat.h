@@ -113,6 +113,8 @@ namespace baregl::types
 		COMPRESSED_R11_EAC,
 		COMPRESSED_SIGNED_R11_EAC,
 		COMPRESSED_RG11_EAC,
-		COMPRESSED_SIGNED_RG11_EAC
+		COMPRESSED_SIGNED_RG11_EAC,
+		COMPRESSED_RGB_S3TC_DXT1,
+		COMPRESSED_RGBA_S3TC_DXT5
 	};
 }
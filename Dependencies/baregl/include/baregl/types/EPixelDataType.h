@@ -34,6 +34,7 @@ namespace baregl::types
 		UNSIGNED_INT_8_8_8_8,
 		UNSIGNED_INT_8_8_8_8_REV,
 		UNSIGNED_INT_10_10_10_2,
-		UNSIGNED_INT_2_10_10_10_REV
+		UNSIGNED_INT_2_10_10_10_REV,
+		HALF_FLOAT
 	};
 }
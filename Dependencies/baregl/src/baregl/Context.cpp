@@ -328,14 +328,14 @@ namespace baregl
 		}
 	}
 
-	void Context::DrawElements(types::EPrimitiveMode p_primitiveMode, uint32_t p_indexCount)
+	void Context::DrawElements(types::EPrimitiveMode p_primitiveMode, uint32_t p_indexCount, types::EDataType p_indexType)
 	{
-		glDrawElements(utils::EnumToValue<GLenum>(p_primitiveMode), p_indexCount, GL_UNSIGNED_INT, nullptr);
+		glDrawElements(utils::EnumToValue<GLenum>(p_primitiveMode), p_indexCount, utils::EnumToValue<GLenum>(p_indexType), nullptr);
 	}
 
-	void Context::DrawElementsInstanced(types::EPrimitiveMode p_primitiveMode, uint32_t p_indexCount, uint32_t p_instances)
+	void Context::DrawElementsInstanced(types::EPrimitiveMode p_primitiveMode, uint32_t p_indexCount, uint32_t p_instances, types::EDataType p_indexType)
 	{
-		glDrawElementsInstanced(utils::EnumToValue<GLenum>(p_primitiveMode), p_indexCount, GL_UNSIGNED_INT, nullptr, p_instances);
+		glDrawElementsInstanced(utils::EnumToValue<GLenum>(p_primitiveMode), p_indexCount, utils::EnumToValue<GLenum>(p_indexType), nullptr, p_instances);
 	}
 
 	void Context::DrawArrays(types::EPrimitiveMode p_primitiveMode, uint32_t p_vertexCount)
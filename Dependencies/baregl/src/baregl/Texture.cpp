@@ -150,30 +150,34 @@ namespace baregl
 		return m_desc.mutableDesc.has_value();
 	}
 
-	void Texture::Upload(const void* p_data, types::EFormat p_format, types::EPixelDataType p_type)
+	void Texture::Upload(const void* p_data, types::EFormat p_format, types::EPixelDataType p_type, uint32_t p_level)
 	{
 		BAREGL_ASSERT(IsValid(), "Cannot upload data to a texture before it has been allocated");
 		BAREGL_ASSERT(p_data, "Cannot upload texture data from a null pointer");
 
 		if (IsMutable())
 		{
+			BAREGL_ASSERT(p_level == 0, "Mutable textures only have a single mipmap level");
 			m_desc.mutableDesc.value().data = p_data;
 			Allocate(m_desc);
 		}
 		else
 		{
+			const uint32_t width = std::max(1u, m_desc.width >> p_level);
+			const uint32_t height = std::max(1u, m_desc.height >> p_level);
+
 			if (m_type == GL_TEXTURE_CUBE_MAP)
 			{
 				for (uint32_t i = 0; i < 6; ++i)
 				{
 					glTextureSubImage3D(
 						m_id,
-						0,
+						p_level,
 						0,
 						0,
 						i,
-						m_desc.width,
-						m_desc.height,
+						width,
+						height,
 						1,
 						utils::EnumToValue<GLenum>(p_format),
 						utils::EnumToValue<GLenum>(p_type),
@@ -185,11 +189,11 @@ namespace baregl
 			{
 				glTextureSubImage2D(
 					m_id,
+					p_level,
 					0,
 					0,
-					0,
-					m_desc.width,
-					m_desc.height,
+					width,
+					height,
 					utils::EnumToValue<GLenum>(p_format),
 					utils::EnumToValue<GLenum>(p_type),
 					p_data
@@ -198,6 +202,26 @@ namespace baregl
 		}
 	}
 
+	void Texture::UploadCompressed(const void* p_data, uint32_t p_size, uint32_t p_level)
+	{
+		BAREGL_ASSERT(IsValid(), "Cannot upload data to a texture before it has been allocated");
+		BAREGL_ASSERT(p_data, "Cannot upload texture data from a null pointer");
+		BAREGL_ASSERT(!IsMutable(), "Cannot upload compressed data to a mutable texture");
+		BAREGL_ASSERT(m_type == GL_TEXTURE_2D, "Compressed uploads are only supported for 2D textures");
+
+		glCompressedTextureSubImage2D(
+			m_id,
+			p_level,
+			0,
+			0,
+			std::max(1u, m_desc.width >> p_level),
+			std::max(1u, m_desc.height >> p_level),
+			utils::EnumToValue<GLenum>(m_desc.internalFormat),
+			p_size,
+			p_data
+		);
+	}
+
 	void Texture::Resize(uint32_t p_width, uint32_t p_height)
 	{
 		BAREGL_ASSERT(IsValid(), "Cannot resize a texture before it has been allocated");
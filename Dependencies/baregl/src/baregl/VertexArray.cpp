@@ -25,6 +25,7 @@ namespace
 		case baregl::types::EDataType::UNSIGNED_INT: return sizeof(GLuint);
 		case baregl::types::EDataType::FLOAT: return sizeof(GLfloat);
 		case baregl::types::EDataType::DOUBLE: return sizeof(GLdouble);
+		case baregl::types::EDataType::HALF_FLOAT: return sizeof(GLhalf);
 		default: return 0;
 		}
 	}
@@ -37,6 +38,17 @@ namespace
 			{
 				return sizeof(GLdouble) * attr.count;
 			}
+			else if constexpr (std::is_same_v<T, baregl::data::UnusedVertexAttribute>)
+			{
+				return 0;
+			}
+			else if constexpr (std::is_same_v<T, baregl::data::FloatVertexAttribute>)
+			{
+				// The four components of a packed type share a single 32-bit value
+				return attr.type == baregl::types::EDataType::INT_2_10_10_10_REV ?
+					sizeof(GLuint) :
+					GetDataTypeSizeInBytes(attr.type) * attr.count;
+			}
 			else
 			{
 				return GetDataTypeSizeInBytes(attr.type) * attr.count;
@@ -65,6 +77,11 @@ namespace
 		void operator()(const baregl::data::FloatVertexAttribute& attr) const
 		{
 			BAREGL_ASSERT(attr.count >= 1 && attr.count <= 4, "Attribute count must be between 1 and 4");
+			BAREGL_ASSERT(
+				attr.type != baregl::types::EDataType::INT_2_10_10_10_REV || attr.count == 4,
+				"Packed 2_10_10_10 attributes must have 4 components"
+			);
+			glEnableVertexAttribArray(index);
 			glVertexAttribPointer(
 				index,
 				static_cast<GLint>(attr.count),
@@ -87,6 +104,7 @@ namespace
 				attr.type == baregl::types::EDataType::UNSIGNED_INT,
 				"glVertexAttribIPointer requires an integer data type"
 			);
+			glEnableVertexAttribArray(index);
 			glVertexAttribIPointer(
 				index,
 				static_cast<GLint>(attr.count),
@@ -99,6 +117,7 @@ namespace
 		void operator()(const baregl::data::DoubleVertexAttribute& attr) const
 		{
 			BAREGL_ASSERT(attr.count >= 1 && attr.count <= 4, "Attribute count must be between 1 and 4");
+			glEnableVertexAttribArray(index);
 			glVertexAttribLPointer(
 				index,
 				static_cast<GLint>(attr.count),
@@ -107,6 +126,11 @@ namespace
 				offset
 			);
 		}
+
+		void operator()(const baregl::data::UnusedVertexAttribute&) const
+		{
+			glDisableVertexAttribArray(index);
+		}
 	};
 }
 
@@ -148,8 +172,6 @@ namespace baregl
 
 		for (const auto& attribute : p_attributes)
 		{
-			glEnableVertexAttribArray(attributeIndex);
-
 			std::visit(VertexAttribSetter{
 				static_cast<GLuint>(attributeIndex),
 				totalSize,
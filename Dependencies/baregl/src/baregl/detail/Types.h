@@ -39,6 +39,16 @@
 #include <baregl/types/EUniformType.h>
 #include <baregl/utils/EnumMapper.h>
 
+// S3TC (BC1-BC3) comes from EXT_texture_compression_s3tc, which isn't part of the core profile glad has been
+// generated for, but is exposed by every desktop driver
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#endif
+
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+
 template <>
 struct baregl::utils::MappingFor<baregl::types::EComparaisonAlgorithm, GLenum>
 {
@@ -341,7 +351,8 @@ struct baregl::utils::MappingFor<baregl::types::EPixelDataType, GLenum>
 		EnumValuePair<EnumType::UNSIGNED_INT_8_8_8_8, GL_UNSIGNED_INT_8_8_8_8>,
 		EnumValuePair<EnumType::UNSIGNED_INT_8_8_8_8_REV, GL_UNSIGNED_INT_8_8_8_8_REV>,
 		EnumValuePair<EnumType::UNSIGNED_INT_10_10_10_2, GL_UNSIGNED_INT_10_10_10_2>,
-		EnumValuePair<EnumType::UNSIGNED_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV>
+		EnumValuePair<EnumType::UNSIGNED_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV>,
+		EnumValuePair<EnumType::HALF_FLOAT, GL_HALF_FLOAT>
 	>;
 };
 
@@ -357,7 +368,9 @@ struct baregl::utils::MappingFor<baregl::types::EDataType, GLenum>
 		EnumValuePair<EnumType::INT, GL_INT>,
 		EnumValuePair<EnumType::UNSIGNED_INT, GL_UNSIGNED_INT>,
 		EnumValuePair<EnumType::FLOAT, GL_FLOAT>,
-		EnumValuePair<EnumType::DOUBLE, GL_DOUBLE>
+		EnumValuePair<EnumType::DOUBLE, GL_DOUBLE>,
+		EnumValuePair<EnumType::HALF_FLOAT, GL_HALF_FLOAT>,
+		EnumValuePair<EnumType::INT_2_10_10_10_REV, GL_INT_2_10_10_10_REV>
 	>;
 };
 
@@ -506,7 +519,9 @@ struct baregl::utils::MappingFor<baregl::types::EInternalFormat, GLenum>
 		EnumValuePair<EnumType::COMPRESSED_R11_EAC, GL_COMPRESSED_R11_EAC>,
 		EnumValuePair<EnumType::COMPRESSED_SIGNED_R11_EAC, GL_COMPRESSED_SIGNED_R11_EAC>,
 		EnumValuePair<EnumType::COMPRESSED_RG11_EAC, GL_COMPRESSED_RG11_EAC>,
-		EnumValuePair<EnumType::COMPRESSED_SIGNED_RG11_EAC, GL_COMPRESSED_SIGNED_RG11_EAC>
+		EnumValuePair<EnumType::COMPRESSED_SIGNED_RG11_EAC, GL_COMPRESSED_SIGNED_RG11_EAC>,
+		EnumValuePair<EnumType::COMPRESSED_RGB_S3TC_DXT1, GL_COMPRESSED_RGB_S3TC_DXT1_EXT>,
+		EnumValuePair<EnumType::COMPRESSED_RGBA_S3TC_DXT5, GL_COMPRESSED_RGBA_S3TC_DXT5_EXT>
 	>;
 };
 
@@ -21,6 +21,7 @@ project "bullet3"
 	defines {
 		"B3_USE_CLEW",
 		"BT_USE_SSE_IN_API",
+		"BT_THREADSAFE=1",
 	}
 
 	filter { "configurations:Debug" }
@@ -52,6 +52,14 @@ function AudioSource:IsSpatial() end
 ---@return number
 function AudioSource:GetAttenuationThreshold() end
 
+--- Returns the audio source priority (0 = Highest, 255 = Lowest)
+---@return integer
+function AudioSource:GetPriority() end
+
+--- Returns true if the audio source is playing without being mixed (Out of voices or inaudible)
+---@return boolean
+function AudioSource:IsVirtual() end
+
 --- Defines the sound to play on the audio source
 ---@param sound Sound
 function AudioSource:SetSound(sound) end
@@ -79,3 +87,7 @@ function AudioSource:SetSpatial(spatial) end
 --- Defines the audio source attenuation threshold (Minimum distance before applying sound attenuation)
 ---@param threshold number
 function AudioSource:SetAttenuationThreshold(threshold) end
+
+--- Defines the audio source priority (0 = Highest, 255 = Lowest). Higher priority audio sources keep their voice first when too many sounds are playing
+---@param priority integer
+function AudioSource:SetPriority(priority) end
@@ -55,3 +55,7 @@ function Behaviour:OnTriggerStay(triggeredBy) end
 --- Called when the owner exits a trigger volume
 ---@param triggeredBy PhysicalObject
 function Behaviour:OnTriggerExit(triggeredBy) end
+
+--- Called once the scene of the behaviour, loaded with Scenes.LoadAsync, started playing
+---@param sceneName string
+function Behaviour:OnSceneLoaded(sceneName) end
@@ -23,3 +23,11 @@ function ModelRenderer:GetFrustumBehaviour() end
 --- Sets a bounding mode
 ---@param behaviour FrustumBehaviour
 function ModelRenderer:SetFrustumBehaviour(behaviour) end
+
+--- Returns the level of detail bias (Above 1 keeps the detailed levels longer, below 1 switches to the simplified ones sooner)
+---@return number
+function ModelRenderer:GetLODBias() end
+
+--- Sets the level of detail bias (Above 1 keeps the detailed levels longer, below 1 switches to the simplified ones sooner)
+---@param bias number
+function ModelRenderer:SetLODBias(bias) end
@@ -0,0 +1,13 @@
+---@meta
+
+--- PhysicalObject with a convex hull shape generated from a model
+---@class PhysicalConvex : PhysicalObject
+PhysicalConvex = {}
+
+--- Returns the model the collision shape is generated from
+---@return Model|nil
+function PhysicalConvex:GetModel() end
+
+--- Defines the model the collision shape is generated from
+---@param model Model
+function PhysicalConvex:SetModel(model) end
@@ -0,0 +1,13 @@
+---@meta
+
+--- Static PhysicalObject with a triangle mesh shape generated from a model
+---@class PhysicalMesh : PhysicalObject
+PhysicalMesh = {}
+
+--- Returns the model the collision shape is generated from
+---@return Model|nil
+function PhysicalMesh:GetModel() end
+
+--- Defines the model the collision shape is generated from
+---@param model Model
+function PhysicalMesh:SetModel(model) end
@@ -94,3 +94,11 @@ function PhysicalObject:GetCollisionMode() end
 --- Defines if the physical object should be kinematic or not
 ---@param kinematic boolean
 function PhysicalObject:SetKinematic(kinematic) end
+
+--- Returns the layer (from 0 to 31) of the physical object
+---@return integer
+function PhysicalObject:GetLayer() end
+
+--- Defines the layer (from 0 to 31) of the physical object. Physics queries only consider objects whose layer is in their layer mask
+---@param layer integer
+function PhysicalObject:SetLayer(layer) end
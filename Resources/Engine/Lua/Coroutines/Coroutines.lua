@@ -0,0 +1,34 @@
+---@meta
+
+--- Starts a coroutine running the given function with the given arguments, and returns its identifier.
+--- The function runs right away, until it calls one of the wait functions, and is then resumed by the engine.
+--- A coroutine started by a behaviour callback (e.g. OnStart) stops when the behaviour is destroyed
+---@param func function
+---@param ... any
+---@return integer
+function StartCoroutine(func, ...) end
+
+--- Stops the given coroutine, which won't be resumed anymore
+---@param coroutineID integer
+function StopCoroutine(coroutineID) end
+
+--- Returns true if the given coroutine is waiting or running, false once it has finished or has been stopped
+---@param coroutineID integer
+---@return boolean
+function IsCoroutineRunning(coroutineID) end
+
+--- Suspends the current coroutine for the given number of seconds
+---@param seconds number
+function WaitForSeconds(seconds) end
+
+--- Suspends the current coroutine for the given number of frames (At least 1).
+--- Calling coroutine.yield() without arguments waits for the next frame
+---@param frames integer
+function WaitForFrames(frames) end
+
+--- Suspends the current coroutine until the next physics frame
+function WaitForFixedUpdate() end
+
+--- Suspends the current coroutine until the given function returns true (It is called once per frame)
+---@param condition fun(): boolean
+function WaitUntil(condition) end
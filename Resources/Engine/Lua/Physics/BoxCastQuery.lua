@@ -0,0 +1,15 @@
+---@meta
+
+--- Oriented box to sweep against the physical world
+---@class BoxCastQuery
+---@field origin Vector3
+---@field rotation Quaternion
+---@field halfExtents Vector3
+---@field direction Vector3
+---@field distance number
+---@field layerMask integer Bitmask of the layers to consider (all layers by default)
+BoxCastQuery = {}
+
+--- Creates an instance of BoxCastQuery
+---@return BoxCastQuery
+function BoxCastQuery.new() end
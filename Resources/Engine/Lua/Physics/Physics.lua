@@ -10,3 +10,36 @@ Physics = {}
 ---@param distance number
 ---@return RaycastHit
 function Physics.Raycast(origin, direction, distance) end
+
+--- Casts every given ray and returns the closest hit of each one (result[i] is the hit of rays[i])
+---@param rays RayQuery[]
+---@param parallel? boolean Distribute the queries over the physics worker threads (only if multithreaded physics is enabled)
+---@return QueryHit[]
+function Physics.RaycastBatch(rays, parallel) end
+
+--- Sweeps every given sphere and returns the closest hit of each one (result[i] is the hit of queries[i])
+---@param queries SphereCastQuery[]
+---@param parallel? boolean Distribute the queries over the physics worker threads (only if multithreaded physics is enabled)
+---@return QueryHit[]
+function Physics.SphereCastBatch(queries, parallel) end
+
+--- Sweeps every given box and returns the closest hit of each one (result[i] is the hit of queries[i])
+---@param queries BoxCastQuery[]
+---@param parallel? boolean Distribute the queries over the physics worker threads (only if multithreaded physics is enabled)
+---@return QueryHit[]
+function Physics.BoxCastBatch(queries, parallel) end
+
+--- Returns the physical objects overlapping the given sphere
+---@param center Vector3
+---@param radius number
+---@param layerMask? integer
+---@return PhysicalObject[]
+function Physics.OverlapSphere(center, radius, layerMask) end
+
+--- Returns the physical objects overlapping the given box
+---@param center Vector3
+---@param rotation Quaternion
+---@param halfExtents Vector3
+---@param layerMask? integer
+---@return PhysicalObject[]
+function Physics.OverlapBox(center, rotation, halfExtents, layerMask) end
@@ -0,0 +1,9 @@
+---@meta
+
+--- Contains the closest hit of a ray or shape cast query
+---@class QueryHit
+---@field Object PhysicalObject|nil The physical object that has been hit (nil if nothing has been hit)
+---@field Point Vector3 World position of the hit
+---@field Normal Vector3 World normal of the hit surface
+---@field Distance number Distance travelled before the hit
+QueryHit = {}
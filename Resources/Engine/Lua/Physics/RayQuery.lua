@@ -0,0 +1,13 @@
+---@meta
+
+--- Ray to cast against the physical world
+---@class RayQuery
+---@field origin Vector3
+---@field direction Vector3
+---@field distance number
+---@field layerMask integer Bitmask of the layers to consider (all layers by default)
+RayQuery = {}
+
+--- Creates an instance of RayQuery
+---@return RayQuery
+function RayQuery.new() end
@@ -0,0 +1,14 @@
+---@meta
+
+--- Sphere to sweep against the physical world
+---@class SphereCastQuery
+---@field origin Vector3
+---@field direction Vector3
+---@field distance number
+---@field radius number
+---@field layerMask integer Bitmask of the layers to consider (all layers by default)
+SphereCastQuery = {}
+
+--- Creates an instance of SphereCastQuery
+---@return SphereCastQuery
+function SphereCastQuery.new() end
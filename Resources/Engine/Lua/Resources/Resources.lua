@@ -4,27 +4,38 @@
 ---@class Resources
 Resources = {}
 
+--- Returns the ID of the given resource path. Getting a resource from its ID is faster than from its path,
+--- but doesn't load it if it isn't loaded yet
+---@param path string
+---@return integer
+function Resources.GetID(path) end
+
 --- Loads (If not already loaded) and returns the Model identified by the given path. Returns nil on failure
 ---@param path string
 ---@return Model|nil
+---@overload fun(id: integer): Model|nil
 function Resources.GetModel(path) end
 
 --- Loads (If not already loaded) and returns the Shader identified by the given path. Returns nil on failure
 ---@param path string
 ---@return Shader|nil
+---@overload fun(id: integer): Shader|nil
 function Resources.GetShader(path) end
 
 --- Loads (If not already loaded) and returns the Texture identified by the given path. Returns nil on failure
 ---@param path string
 ---@return Texture|nil
+---@overload fun(id: integer): Texture|nil
 function Resources.GetTexture(path) end
 
 --- Loads (If not already loaded) and returns the Material identified by the given path. Returns nil on failure
 ---@param path string
 ---@return Material|nil
+---@overload fun(id: integer): Material|nil
 function Resources.GetMaterial(path) end
 
 --- Loads (If not already loaded) and returns the Sound identified by the given path. Returns nil on failure
 ---@param path string
 ---@return Sound|nil
+---@overload fun(id: integer): Sound|nil
 function Resources.GetSound(path) end
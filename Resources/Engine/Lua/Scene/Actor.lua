@@ -90,6 +90,14 @@ function Actor:GetPhysicalSphere() end
 ---@return PhysicalCapsule|nil
 function Actor:GetPhysicalCapsule() end
 
+--- Returns the PhysicalMesh attached to this actor (If any)
+---@return PhysicalMesh|nil
+function Actor:GetPhysicalMesh() end
+
+--- Returns the PhysicalConvex attached to this actor (If any)
+---@return PhysicalConvex|nil
+function Actor:GetPhysicalConvex() end
+
 --- Returns the Camera attached to this actor (If any)
 ---@return Camera|nil
 function Actor:GetCamera() end
@@ -171,6 +179,14 @@ function Actor:AddPhysicalSphere() end
 ---@return PhysicalCapsule
 function Actor:AddPhysicalCapsule() end
 
+--- Adds a PhysicalMesh component to the actor and returns it
+---@return PhysicalMesh
+function Actor:AddPhysicalMesh() end
+
+--- Adds a PhysicalConvex component to the actor and returns it
+---@return PhysicalConvex
+function Actor:AddPhysicalConvex() end
+
 --- Adds a Camera component to the actor and returns it
 ---@return Camera
 function Actor:AddCamera() end
@@ -227,6 +243,10 @@ function Actor:RemovePhysicalBox() end
 function Actor:RemovePhysicalSphere() end
 --- Removes the PhysicalCapsule component from the actor
 function Actor:RemovePhysicalCapsule() end
+--- Removes the PhysicalMesh component from the actor
+function Actor:RemovePhysicalMesh() end
+--- Removes the PhysicalConvex component from the actor
+function Actor:RemovePhysicalConvex() end
 --- Removes the Camera component from the actor
 function Actor:RemoveCamera() end
 --- Removes the PointLight component from the actor
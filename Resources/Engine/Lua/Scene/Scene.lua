@@ -36,3 +36,12 @@ function Scene:CreateActor(...) end
 ---@overload fun(self: Scene, prefab: Prefab, parent: Actor): Actor|nil
 ---@return Actor|nil
 function Scene:InstantiatePrefab(...) end
+
+--- Deactivates the given prefab instance and keeps it for the next instantiation of its prefab, instead of destroying it.
+--- The reused instance keeps its state (e.g. position), which can be reset in OnEnable. Returns false if the actor isn't the root of a prefab instance
+---@param actor Actor
+---@return boolean
+function Scene:ReleaseToPool(actor) end
+
+--- Destroys every prefab instance kept by ReleaseToPool
+function Scene:ClearPools() end
@@ -11,3 +11,52 @@ function Scenes.GetCurrentScene() end
 --- Loads the scene identified by the given path and returns it
 ---@param path string
 function Scenes.Load(path) end
+
+--- Loads the scene identified by the given path in the background, while the current scene keeps running.
+--- The new scene replaces the current one, and starts playing, once all of its actors are created.
+--- Its behaviours then receive OnAwake and OnStart, followed by OnSceneLoaded, which marks the end of the load
+---@param path string
+function Scenes.LoadAsync(path) end
+
+--- Cancels the scene load started by Scenes.LoadAsync, if any. The current scene is kept
+function Scenes.CancelLoadAsync() end
+
+--- Returns true if a scene is being loaded by Scenes.LoadAsync
+---@return boolean
+function Scenes.IsLoading() end
+
+--- Returns the progress of the scene load started by Scenes.LoadAsync, between 0 and 1
+---@return number
+function Scenes.GetLoadProgress() end
+
+--- Loads the actors of the given scene into the current scene, next to its own actors. Returns false on failure,
+--- or if the scene is already loaded additively. Additive scenes are unloaded with the current scene
+---@param path string
+---@return boolean
+function Scenes.LoadAdditive(path) end
+
+--- Destroys the actors created by Scenes.LoadAdditive for the given scene. Returns false if it isn't loaded additively
+---@param path string
+---@return boolean
+function Scenes.UnloadAdditive(path) end
+
+--- Returns true if the given scene is loaded additively in the current scene
+---@param path string
+---@return boolean
+function Scenes.IsLoadedAdditive(path) end
+
+--- Streams the given scene additively: it is loaded when the streaming anchor gets within the load distance of the
+--- given center, and unloaded once the anchor is further than the unload distance (Defaults to the load distance)
+---@param path string
+---@param center Vector3
+---@param loadDistance number
+---@param unloadDistance? number
+function Scenes.AddStreamingChunk(path, center, loadDistance, unloadDistance) end
+
+--- Stops streaming the given scene, and unloads it if it is loaded
+---@param path string
+function Scenes.RemoveStreamingChunk(path) end
+
+--- Defines the position streaming distances are measured from. Without anchor (nil), the main camera position is used
+---@param position? Vector3
+function Scenes.SetStreamingAnchor(position) end
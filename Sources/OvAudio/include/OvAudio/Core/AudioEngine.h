@@ -6,16 +6,21 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <optional>
 #include <vector>
 
+#include <OvAudio/Data/AudioStats.h>
 #include <OvAudio/Data/SoundHandle.h>
 #include <OvAudio/Entities/AudioSource.h>
 #include <OvAudio/Entities/AudioListener.h>
+#include <OvAudio/Settings/AudioSettings.h>
 
 namespace SoLoud
 {
 	class Soloud;
+	class Bus;
 }
 
 namespace OvAudio::Core
@@ -23,14 +28,19 @@ namespace OvAudio::Core
 	/**
 	* AudioEngine is the main class of the audio system.
 	* It's responsible for initializing the audio backend and managing the audio sources and listeners.
+	* Each update, playing audio sources are ranked by priority and audibility: the first ones (Up to the
+	* maximum number of voices) are mixed, the others are virtualized.
 	*/
 	class AudioEngine
 	{
+		friend class Entities::AudioSource;
+
 	public:
 		/**
 		* Constructor of the AudioEngine
+		* @param p_settings
 		*/
-		AudioEngine();
+		AudioEngine(const Settings::AudioSettings& p_settings = {});
 
 		/**
 		* Destructor of the AudioEngine
@@ -43,10 +53,37 @@ namespace OvAudio::Core
 		bool IsValid() const;
 
 		/**
-		* Update AudioSources and AudioListeners
+		* Update AudioSources and AudioListeners, and distribute voices between playing AudioSources
 		*/
 		void Update();
 
+		/**
+		* Defines the maximum number of audio sources that can be mixed at the same time
+		* @param p_maxVoices
+		*/
+		void SetMaxVoices(uint32_t p_maxVoices);
+
+		/**
+		* Returns the maximum number of audio sources that can be mixed at the same time
+		*/
+		uint32_t GetMaxVoices() const;
+
+		/**
+		* Defines the estimated volume under which audio sources are virtualized
+		* @param p_volume
+		*/
+		void SetVirtualizationVolume(float p_volume);
+
+		/**
+		* Returns the estimated volume under which audio sources are virtualized
+		*/
+		float GetVirtualizationVolume() const;
+
+		/**
+		* Returns the voice usage and mixing cost measured during the last update
+		*/
+		const Data::AudioStats& GetStats() const;
+
 		/**
 		* Suspend every sounds. Keeps every sound state (Pause and play) to Unsuspend them correctly
 		*/
@@ -110,8 +147,24 @@ namespace OvAudio::Core
 		void Unconsider(Entities::AudioSource& p_audioSource);
 		void Unconsider(Entities::AudioListener& p_audioListener);
 
+		void StopAudioSources(const Resources::Sound& p_sound);
+
+		void UpdateVoices(const OvMaths::FVector3& p_listenerPosition, double p_deltaTime);
+
+		/**
+		* Returns true if the given audio source, about to play, wins a voice against the playing ones.
+		* If every voice is taken, the weakest audio source losing against it is virtualized to free its voice
+		* @param p_audioSource
+		*/
+		bool RequestVoice(Entities::AudioSource& p_audioSource);
+
 	private:
 		bool m_suspended = false;
+		Settings::AudioSettings m_settings;
+		Data::AudioStats m_stats;
+		std::optional<std::chrono::steady_clock::time_point> m_lastUpdateTime;
+		std::atomic<uint64_t> m_mixTime = 0; // Nanoseconds, accumulated by the mixing thread
+		std::vector<std::pair<float, std::reference_wrapper<Entities::AudioSource>>> m_voiceCandidates;
 
 		std::vector<std::reference_wrapper<Entities::AudioSource>> m_audioSources;
 		std::vector<std::reference_wrapper<Entities::AudioSource>> m_suspendedAudioSources;
@@ -120,7 +173,9 @@ namespace OvAudio::Core
 		std::optional<OvTools::Eventing::ListenerID> m_audioSourceDestroyedListenerID;
 		std::optional<OvTools::Eventing::ListenerID> m_audioListenerCreatedListenerID;
 		std::optional<OvTools::Eventing::ListenerID> m_audioListenerDestroyedListenerID;
+		std::optional<OvTools::Eventing::ListenerID> m_soundReleasedListenerID;
 
 		std::unique_ptr<SoLoud::Soloud> m_backend;
+		std::unique_ptr<SoLoud::Bus> m_mixBus;
 	};
 }
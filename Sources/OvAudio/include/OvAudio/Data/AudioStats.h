@@ -0,0 +1,22 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+
+namespace OvAudio::Data
+{
+	/**
+	* Voice usage and mixing cost measured by the AudioEngine over the last update
+	*/
+	struct AudioStats
+	{
+		uint32_t activeVoices = 0;
+		uint32_t virtualVoices = 0;
+		float mixTime = 0.0f; // Time (In milliseconds) spent mixing voices since the previous update
+	};
+}
@@ -79,6 +79,17 @@ namespace OvAudio::Data
 			const OvMaths::FVector3& p_velocity
 		) const;
 
+		/**
+		* Moves the playback cursor of the sound instance
+		* @param p_position (In seconds)
+		*/
+		void SetPlaybackPosition(double p_position);
+
+		/**
+		* Returns the playback cursor of the sound instance (In seconds)
+		*/
+		double GetPlaybackPosition() const;
+
 		/**
 		* Plays the sound instance
 		*/
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <optional>
 
@@ -24,9 +25,13 @@ namespace OvAudio::Entities
 {
 	/**
 	* An audio source is an entity that can play a sound in a 3D space.
+	* When the AudioEngine runs out of voices, or when the audio source becomes inaudible, the audio source
+	* is virtualized: its voice is released but its playback position keeps advancing until it gets a voice back
 	*/
 	class AudioSource
 	{
+		friend class Core::AudioEngine;
+
 	public:
 		/**
 		* AudioSource constructor (Internal transform management)
@@ -68,6 +73,11 @@ namespace OvAudio::Entities
 		*/
 		bool IsPaused() const;
 
+		/**
+		* Returns true if the audio source is playing without an actual voice (Not mixed)
+		*/
+		bool IsVirtual() const;
+
 		/**
 		* Returns the currently tracked sound if any, or nullptr
 		*/
@@ -109,6 +119,13 @@ namespace OvAudio::Entities
 		*/
 		void SetAttenuationThreshold(float p_distance);
 
+		/**
+		* Defines the audio source priority (0 = Highest, 255 = Lowest).
+		* Higher priority audio sources get a voice first when the AudioEngine runs out of voices
+		* @param p_priority
+		*/
+		void SetPriority(uint8_t p_priority);
+
 		/**
 		* Returns the audio source volume
 		*/
@@ -140,7 +157,13 @@ namespace OvAudio::Entities
 		float GetAttenuationThreshold() const;
 
 		/**
-		* Play the given sound
+		* Returns the audio source priority (0 = Highest, 255 = Lowest)
+		*/
+		uint8_t GetPriority() const;
+
+		/**
+		* Play the given sound. The audio source starts virtual if it loses against the audio sources
+		* currently holding a voice (See AudioEngine)
 		* @param p_sound
 		*/
 		void Play(const Resources::Sound& p_sound);
@@ -169,6 +192,14 @@ namespace OvAudio::Entities
 		static OvTools::Eventing::Event<AudioSource&> CreatedEvent;
 		static OvTools::Eventing::Event<AudioSource&> DestroyedEvent;
 
+	private:
+		bool HasVoice() const;
+		void StartVoice(double p_position, bool p_paused);
+		float GetAudibility(const OvMaths::FVector3& p_listenerPosition);
+		void Virtualize();
+		void Devirtualize();
+		void AdvanceVirtualPlayback(double p_deltaTime);
+
 	private:
 		Core::AudioEngine& m_engine;
 		OvTools::Utils::ReferenceOrValue<OvMaths::FTransform> m_transform;
@@ -181,5 +212,12 @@ namespace OvAudio::Entities
 		bool m_looped = false;
 		float m_pitch = 1.0f;
 		float m_attenuationThreshold = 1.0f;
+		uint8_t m_priority = 128;
+
+		// Virtualization state
+		const Resources::Sound* m_sound = nullptr;
+		bool m_virtual = false;
+		bool m_virtualPaused = false;
+		double m_virtualPosition = 0.0;
 	};
 }
\ No newline at end of file
@@ -9,6 +9,7 @@
 #include <string>
 
 #include "OvAudio/Resources/Sound.h"
+#include "OvAudio/Settings/ESoundLoadMode.h"
 
 namespace OvAudio::Resources::Loaders
 {
@@ -26,15 +27,17 @@ namespace OvAudio::Resources::Loaders
 		/**
 		* Create a sound
 		* @param p_filepath
+		* @param p_loadMode (AUTO streams sounds that are long or stored in large files)
 		*/
-		static Sound* Create(const std::string& p_filepath);
+		static Sound* Create(const std::string& p_filepath, Settings::ESoundLoadMode p_loadMode = Settings::ESoundLoadMode::AUTO);
 
 		/**
 		* Reload a sound
 		* @param p_sound
 		* @param p_path
+		* @param p_loadMode
 		*/
-		static void Reload(Sound& p_sound, const std::string& p_path);
+		static void Reload(Sound& p_sound, const std::string& p_path, Settings::ESoundLoadMode p_loadMode = Settings::ESoundLoadMode::AUTO);
 
 		/**
 		* Destroy a sound
@@ -42,4 +45,4 @@ namespace OvAudio::Resources::Loaders
 		*/
 		static bool Destroy(Sound*& p_soundInstance);
 	};
-}
\ No newline at end of file
+}
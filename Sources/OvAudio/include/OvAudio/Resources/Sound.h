@@ -6,12 +6,15 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <memory>
 
+#include <OvTools/Eventing/Event.h>
+
 namespace SoLoud
 {
-	class Wav;
+	class AudioSource;
 }
 
 namespace OvAudio::Resources
@@ -26,11 +29,36 @@ namespace OvAudio::Resources
 		friend class Loaders::SoundLoader;
 
 	private:
-		Sound(const std::string& p_path, std::unique_ptr<SoLoud::Wav>&& p_audioData);
-		virtual ~Sound() = default;
+		Sound(const std::string& p_path, std::unique_ptr<SoLoud::AudioSource>&& p_audioData, bool p_streamed);
+		virtual ~Sound();
+
+	public:
+		/**
+		* Returns true if the sound is decoded progressively while playing, instead of being fully decoded in memory
+		*/
+		bool IsStreamed() const;
+
+		/**
+		* Returns the size (In bytes) of the decoded audio data kept in memory (0 for streamed sounds)
+		*/
+		uint64_t GetDecodedSize() const;
+
+		/**
+		* Returns the duration of the sound (In seconds)
+		*/
+		double GetDuration() const;
 
 	public:
 		const std::string path;
-		std::unique_ptr<SoLoud::Wav> audioData;
+		std::unique_ptr<SoLoud::AudioSource> audioData;
+
+		/**
+		* Invoked when the audio data of a sound is about to be released (The sound is destroyed or reloaded),
+		* so that nothing keeps playing or referencing it
+		*/
+		static OvTools::Eventing::Event<const Sound&> AudioDataReleasedEvent;
+
+	private:
+		bool m_streamed;
 	};
-}
\ No newline at end of file
+}
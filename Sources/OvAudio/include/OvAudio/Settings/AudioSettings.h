@@ -0,0 +1,29 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+
+namespace OvAudio::Settings
+{
+	/**
+	* Data structure to give to the AudioEngine constructor to setup its settings
+	*/
+	struct AudioSettings
+	{
+		/**
+		* Maximum number of audio sources that can be mixed at the same time (Clamped to [1, 254]).
+		* Playing audio sources beyond this limit are virtualized, starting with the lowest priority ones
+		*/
+		uint32_t maxVoices = 32;
+
+		/**
+		* Audio sources whose estimated volume (After attenuation) is below this value are virtualized
+		*/
+		float virtualizationVolume = 0.001f;
+	};
+}
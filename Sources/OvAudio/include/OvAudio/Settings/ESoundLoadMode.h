@@ -0,0 +1,22 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+
+namespace OvAudio::Settings
+{
+	/**
+	* Defines how a sound file is turned into playable audio data
+	*/
+	enum class ESoundLoadMode : uint8_t
+	{
+		AUTO,		// Stream long/large sounds, decompress the others
+		DECOMPRESS,	// Decode the whole file in memory at load time
+		STREAM		// Decode the file progressively while playing
+	};
+}
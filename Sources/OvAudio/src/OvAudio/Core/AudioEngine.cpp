@@ -9,13 +9,76 @@
 #include <ranges>
 
 #include <soloud.h>
-#include <soloud_wav.h>
+#include <soloud_bus.h>
 
 #include <OvAudio/Core/AudioEngine.h>
 #include <OvDebug/Assertion.h>
 #include <OvDebug/Logger.h>
 
-OvAudio::Core::AudioEngine::AudioEngine()
+namespace
+{
+	/**
+	* Bus measuring the time spent mixing the voices playing through it.
+	* SoLoud mixes on the audio device thread, so the time is accumulated in an atomic counter
+	*/
+	class ProfiledBus : public SoLoud::Bus
+	{
+	public:
+		ProfiledBus(std::atomic<uint64_t>& p_mixTime) : m_mixTime(p_mixTime)
+		{
+		}
+
+		SoLoud::BusInstance* createInstance() override
+		{
+			if (mChannelHandle)
+			{
+				stop();
+				mChannelHandle = 0;
+				mInstance = nullptr;
+			}
+
+			mInstance = new Instance(*this);
+			return mInstance;
+		}
+
+	private:
+		class Instance : public SoLoud::BusInstance
+		{
+		public:
+			Instance(ProfiledBus& p_parent) : SoLoud::BusInstance(&p_parent), m_mixTime(p_parent.m_mixTime)
+			{
+			}
+
+			unsigned int getAudio(float* p_buffer, unsigned int p_samplesToRead, unsigned int p_bufferSize) override
+			{
+				const auto start = std::chrono::steady_clock::now();
+				const auto result = SoLoud::BusInstance::getAudio(p_buffer, p_samplesToRead, p_bufferSize);
+				const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+				m_mixTime.fetch_add(static_cast<uint64_t>(elapsed.count()), std::memory_order_relaxed);
+				return result;
+			}
+
+		private:
+			std::atomic<uint64_t>& m_mixTime;
+		};
+
+		std::atomic<uint64_t>& m_mixTime;
+	};
+
+	/**
+	* Returns true if the first audio source should get a voice before the second one:
+	* audio sources are ranked by priority, then by audibility
+	*/
+	bool HasPrecedence(uint8_t p_priority, float p_audibility, uint8_t p_otherPriority, float p_otherAudibility)
+	{
+		return p_priority != p_otherPriority ? p_priority < p_otherPriority : p_audibility > p_otherAudibility;
+	}
+
+	constexpr uint32_t kMaxVoicesLimit = 254; // SoLoud supports up to 255 active voices, one of them is used by the mix bus
+}
+
+OvAudio::Core::AudioEngine::AudioEngine(const Settings::AudioSettings& p_settings) :
+	m_settings(p_settings)
 {
 	m_backend = std::make_unique<SoLoud::Soloud>();
 
@@ -27,6 +90,11 @@ OvAudio::Core::AudioEngine::AudioEngine()
 		return;
 	}
 
+	// Every voice is played through the mix bus, so that mixing can be profiled
+	m_mixBus = std::make_unique<ProfiledBus>(m_mixTime);
+	m_backend->play(*m_mixBus);
+	SetMaxVoices(m_settings.maxVoices);
+
 	using AudioSourceReceiver = void(AudioEngine::*)(OvAudio::Entities::AudioSource&);
 	using AudioListenerReceiver = void(AudioEngine::*)(OvAudio::Entities::AudioListener&);
 
@@ -38,6 +106,8 @@ OvAudio::Core::AudioEngine::AudioEngine()
 		std::bind(static_cast<AudioListenerReceiver>(&AudioEngine::Consider), this, std::placeholders::_1);
 	m_audioListenerDestroyedListenerID = Entities::AudioListener::DestroyedEvent +=
 		std::bind(static_cast<AudioListenerReceiver>(&AudioEngine::Unconsider), this, std::placeholders::_1);
+	m_soundReleasedListenerID = Resources::Sound::AudioDataReleasedEvent +=
+		std::bind(&AudioEngine::StopAudioSources, this, std::placeholders::_1);
 }
 
 OvAudio::Core::AudioEngine::~AudioEngine()
@@ -62,8 +132,14 @@ OvAudio::Core::AudioEngine::~AudioEngine()
 		Entities::AudioListener::DestroyedEvent.RemoveListener(m_audioListenerDestroyedListenerID.value());
 	}
 
+	if (m_soundReleasedListenerID.has_value())
+	{
+		Resources::Sound::AudioDataReleasedEvent.RemoveListener(m_soundReleasedListenerID.value());
+	}
+
 	if (IsValid())
 	{
+		m_mixBus.reset();
 		m_backend->deinit();
 	}
 }
@@ -80,6 +156,10 @@ void OvAudio::Core::AudioEngine::Update()
 		return;
 	}
 
+	const auto now = std::chrono::steady_clock::now();
+	const double deltaTime = m_lastUpdateTime ? std::chrono::duration<double>(now - m_lastUpdateTime.value()).count() : 0.0;
+	m_lastUpdateTime = now;
+
 	for (const auto& source : m_audioSources)
 	{
 		source.get().Update();
@@ -87,6 +167,7 @@ void OvAudio::Core::AudioEngine::Update()
 
 	// Defines the listener position using the last listener created (If any)
 	const auto listener = FindMainListener();
+	auto listenerPosition = OvMaths::FVector3::Zero;
 
 	if (listener.has_value())
 	{
@@ -95,6 +176,7 @@ void OvAudio::Core::AudioEngine::Update()
 		const auto at = transform.GetWorldForward() * -1.0f;
 		m_backend->set3dListenerPosition(pos.x, pos.y, pos.z);
 		m_backend->set3dListenerAt(at.x, at.y, at.z);
+		listenerPosition = pos;
 	}
 	else
 	{
@@ -102,7 +184,43 @@ void OvAudio::Core::AudioEngine::Update()
 		m_backend->set3dListenerAt(0.0f, 0.0f, -1.0f);
 	}
 
+	UpdateVoices(listenerPosition, deltaTime);
+
 	m_backend->update3dAudio();
+
+	const uint32_t activeVoices = m_backend->getActiveVoiceCount();
+	m_stats.activeVoices = activeVoices > 0 ? activeVoices - 1 : 0; // Excludes the mix bus
+	m_stats.mixTime = static_cast<float>(m_mixTime.exchange(0, std::memory_order_relaxed)) / 1000000.0f;
+}
+
+void OvAudio::Core::AudioEngine::SetMaxVoices(uint32_t p_maxVoices)
+{
+	m_settings.maxVoices = std::clamp(p_maxVoices, 1u, kMaxVoicesLimit);
+
+	if (IsValid())
+	{
+		m_backend->setMaxActiveVoiceCount(m_settings.maxVoices + 1);
+	}
+}
+
+uint32_t OvAudio::Core::AudioEngine::GetMaxVoices() const
+{
+	return m_settings.maxVoices;
+}
+
+void OvAudio::Core::AudioEngine::SetVirtualizationVolume(float p_volume)
+{
+	m_settings.virtualizationVolume = p_volume;
+}
+
+float OvAudio::Core::AudioEngine::GetVirtualizationVolume() const
+{
+	return m_settings.virtualizationVolume;
+}
+
+const OvAudio::Data::AudioStats& OvAudio::Core::AudioEngine::GetStats() const
+{
+	return m_stats;
 }
 
 void OvAudio::Core::AudioEngine::Suspend()
@@ -148,7 +266,7 @@ std::shared_ptr<OvAudio::Data::SoundInstance> OvAudio::Core::AudioEngine::Play2D
 		return {};
 	}
 
-	const auto handle = m_backend->play(
+	const auto handle = m_mixBus->play(
 		*p_sound.audioData,
 		p_volume.value_or(-1.0f),
 		p_pan,
@@ -176,7 +294,7 @@ std::shared_ptr<OvAudio::Data::SoundInstance> OvAudio::Core::AudioEngine::Play3D
 		return {};
 	}
 
-	const auto handle = m_backend->play3d(
+	const auto handle = m_mixBus->play3d(
 		*p_sound.audioData,
 		p_position.x, p_position.y, p_position.z,
 		p_velocity.x, p_velocity.y, p_velocity.z,
@@ -210,6 +328,120 @@ SoLoud::Soloud& OvAudio::Core::AudioEngine::GetBackend() const
 	return *m_backend;
 }
 
+void OvAudio::Core::AudioEngine::UpdateVoices(const OvMaths::FVector3& p_listenerPosition, double p_deltaTime)
+{
+	m_voiceCandidates.clear();
+	m_stats.virtualVoices = 0;
+
+	for (auto& sourceRef : m_audioSources)
+	{
+		auto& source = sourceRef.get();
+
+		source.AdvanceVirtualPlayback(p_deltaTime);
+
+		if (!source.HasSound())
+		{
+			continue;
+		}
+
+		// Paused audio sources keep their current state, they don't compete for voices
+		if (source.IsPaused())
+		{
+			m_stats.virtualVoices += source.IsVirtual();
+			continue;
+		}
+
+		m_voiceCandidates.emplace_back(source.GetAudibility(p_listenerPosition), sourceRef);
+	}
+
+	std::sort(m_voiceCandidates.begin(), m_voiceCandidates.end(), [](const auto& p_left, const auto& p_right)
+	{
+		return HasPrecedence(p_left.second.get().GetPriority(), p_left.first, p_right.second.get().GetPriority(), p_right.first);
+	});
+
+	uint32_t availableVoices = m_settings.maxVoices;
+
+	for (auto& [audibility, sourceRef] : m_voiceCandidates)
+	{
+		auto& source = sourceRef.get();
+
+		if (availableVoices > 0 && audibility >= m_settings.virtualizationVolume)
+		{
+			--availableVoices;
+
+			if (source.IsVirtual())
+			{
+				source.Devirtualize();
+			}
+		}
+		else
+		{
+			if (!source.IsVirtual())
+			{
+				source.Virtualize();
+			}
+
+			++m_stats.virtualVoices;
+		}
+	}
+}
+
+bool OvAudio::Core::AudioEngine::RequestVoice(Entities::AudioSource& p_audioSource)
+{
+	// Play2D and Play3D report the invalid engine
+	if (!IsValid())
+	{
+		return true;
+	}
+
+	const auto listener = FindMainListener();
+	const auto listenerPosition = listener.has_value() ? listener->GetTransform().GetWorldPosition() : OvMaths::FVector3::Zero;
+	const float audibility = p_audioSource.GetAudibility(listenerPosition);
+
+	if (audibility < m_settings.virtualizationVolume)
+	{
+		return false;
+	}
+
+	// Same candidates as UpdateVoices: paused audio sources don't compete for voices
+	uint32_t usedVoices = 0;
+	Entities::AudioSource* weakest = nullptr;
+	float weakestAudibility = 0.0f;
+
+	for (auto& sourceRef : m_audioSources)
+	{
+		auto& source = sourceRef.get();
+
+		if (&source == &p_audioSource || !source.HasVoice() || source.IsPaused())
+		{
+			continue;
+		}
+
+		++usedVoices;
+
+		const float sourceAudibility = source.GetAudibility(listenerPosition);
+
+		if (!weakest || HasPrecedence(weakest->GetPriority(), weakestAudibility, source.GetPriority(), sourceAudibility))
+		{
+			weakest = &source;
+			weakestAudibility = sourceAudibility;
+		}
+	}
+
+	if (usedVoices < m_settings.maxVoices)
+	{
+		return true;
+	}
+
+	if (weakest && HasPrecedence(p_audioSource.GetPriority(), audibility, weakest->GetPriority(), weakestAudibility))
+	{
+		weakest->Virtualize();
+		return true;
+	}
+
+	return false;
+}
+
 void OvAudio::Core::AudioEngine::Consider(OvAudio::Entities::AudioSource & p_audioSource)
 {
 	m_audioSources.push_back(std::ref(p_audioSource));
@@ -252,3 +484,15 @@ void OvAudio::Core::AudioEngine::Unconsider(OvAudio::Entities::AudioListener & p
 	if (found != m_audioListeners.end())
 		m_audioListeners.erase(found);
 }
+
+void OvAudio::Core::AudioEngine::StopAudioSources(const Resources::Sound& p_sound)
+{
+	// Virtual audio sources only keep a pointer to their sound, which would dangle once it is released
+	for (auto& audioSource : m_audioSources)
+	{
+		if (audioSource.get().m_sound == &p_sound)
+		{
+			audioSource.get().Stop();
+		}
+	}
+}
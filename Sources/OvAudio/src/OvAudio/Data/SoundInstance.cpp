@@ -112,6 +112,18 @@ void OvAudio::Data::SoundInstance::SetSpatialParameters(
 	}
 }
 
+void OvAudio::Data::SoundInstance::SetPlaybackPosition(double p_position)
+{
+	Validate();
+	m_backend.seek(m_handle, p_position);
+}
+
+double OvAudio::Data::SoundInstance::GetPlaybackPosition() const
+{
+	Validate();
+	return m_backend.getStreamPosition(m_handle);
+}
+
 void OvAudio::Data::SoundInstance::Play()
 {
 	Validate();
@@ -4,8 +4,9 @@
 * @licence: MIT
 */
 
+#include <cmath>
+
 #include <soloud.h>
-#include <soloud_wav.h>
 
 #include <OvAudio/Core/AudioEngine.h>
 #include <OvAudio/Entities/AudioSource.h>
@@ -34,6 +35,9 @@ const OvMaths::FTransform& OvAudio::Entities::AudioSource::GetTransform()
 
 void OvAudio::Entities::AudioSource::ApplySourceSettingsToTrackedSound()
 {
+	if (!HasVoice())
+		return;
+
 	m_instance->SetVolume(m_volume);
 	m_instance->SetPan(m_pan);
 	m_instance->SetLooped(m_looped);
@@ -43,7 +47,7 @@ void OvAudio::Entities::AudioSource::ApplySourceSettingsToTrackedSound()
 
 bool OvAudio::Entities::AudioSource::HasSound() const
 {
-	return m_instance && m_instance->IsValid();
+	return m_virtual || HasVoice();
 }
 
 bool OvAudio::Entities::AudioSource::IsPlaying() const
@@ -61,7 +65,7 @@ void OvAudio::Entities::AudioSource::SetAttenuationThreshold(float p_distance)
 {
 	m_attenuationThreshold = p_distance;
 
-	if (HasSound())
+	if (HasVoice())
 	{
 		m_instance->SetAttenuationThreshold(m_attenuationThreshold);
 	}
@@ -71,7 +75,7 @@ void OvAudio::Entities::AudioSource::SetVolume(float p_volume)
 {
 	m_volume = p_volume;
 
-	if (HasSound())
+	if (HasVoice())
 	{
 		m_instance->SetVolume(m_volume);
 	}
@@ -81,7 +85,7 @@ void OvAudio::Entities::AudioSource::SetPan(float p_pan)
 {
 	m_pan = p_pan;
 
-	if (HasSound())
+	if (HasVoice())
 	{
 		m_instance->SetPan(m_pan);
 	}
@@ -91,7 +95,7 @@ void OvAudio::Entities::AudioSource::SetLooped(bool p_looped)
 {
 	m_looped = p_looped;
 
-	if (HasSound())
+	if (HasVoice())
 	{
 		m_instance->SetLooped(p_looped);
 	}
@@ -101,7 +105,7 @@ void OvAudio::Entities::AudioSource::SetPitch(float p_pitch)
 {
 	m_pitch = p_pitch;
 
-	if (HasSound())
+	if (HasVoice())
 	{
 		m_instance->SetPitch(p_pitch);
 	}
@@ -110,7 +114,22 @@ void OvAudio::Entities::AudioSource::SetPitch(float p_pitch)
 bool OvAudio::Entities::AudioSource::IsPaused() const
 {
 	OVASSERT(HasSound(), "Cannot check if the sound is paused if no sound is currently being tracked");
-	return m_instance->IsPaused();
+	return m_virtual ? m_virtualPaused : m_instance->IsPaused();
+}
+
+bool OvAudio::Entities::AudioSource::IsVirtual() const
+{
+	return m_virtual;
+}
+
+void OvAudio::Entities::AudioSource::SetPriority(uint8_t p_priority)
+{
+	m_priority = p_priority;
+}
+
+uint8_t OvAudio::Entities::AudioSource::GetPriority() const
+{
+	return m_priority;
 }
 
 std::weak_ptr<OvAudio::Data::SoundInstance> OvAudio::Entities::AudioSource::GetSoundInstance() const
@@ -152,10 +171,78 @@ void OvAudio::Entities::AudioSource::Play(const Resources::Sound& p_sound)
 {
 	Stop();
 
+	m_sound = &p_sound;
+
+	if (m_engine.RequestVoice(*this))
+	{
+		StartVoice(0.0, false);
+	}
+	else
+	{
+		// Would lose its voice on the next update anyway, starts virtual instead of stealing one
+		m_virtual = true;
+		m_virtualPaused = false;
+		m_virtualPosition = 0.0;
+	}
+}
+
+void OvAudio::Entities::AudioSource::Resume()
+{
+	if (m_virtual)
+	{
+		m_virtualPaused = false;
+	}
+	else if (HasVoice())
+	{
+		m_instance->Play();
+	}
+}
+
+void OvAudio::Entities::AudioSource::Pause()
+{
+	if (m_virtual)
+	{
+		m_virtualPaused = true;
+	}
+	else if (HasVoice())
+	{
+		m_instance->Pause();
+	}
+}
+
+void OvAudio::Entities::AudioSource::Stop()
+{
+	if (HasVoice())
+	{
+		m_instance->Stop();
+	}
+
+	m_virtual = false;
+	m_sound = nullptr;
+}
+
+void OvAudio::Entities::AudioSource::Update()
+{
+	if (HasVoice() && m_instance->IsSpatial())
+	{
+		m_instance->SetSpatialParameters(
+			m_transform->GetWorldPosition(),
+			OvMaths::FVector3::Zero // TODO: Add support for non-zero velocity
+		);
+	}
+}
+
+bool OvAudio::Entities::AudioSource::HasVoice() const
+{
+	return m_instance && m_instance->IsValid();
+}
+
+void OvAudio::Entities::AudioSource::StartVoice(double p_position, bool p_paused)
+{
 	if (m_spatial)
 	{
 		m_instance = m_engine.Play3D(
-			p_sound,
+			*m_sound,
 			m_transform->GetWorldPosition(),
 			OvMaths::FVector3::Zero, // TODO: Add support for non-zero velocity
 			m_volume,
@@ -177,48 +264,76 @@ void OvAudio::Entities::AudioSource::Play(const Resources::Sound& p_sound)
 	}
 	else
 	{
-		m_instance = m_engine.Play2D(p_sound, m_pan, m_volume, true);
+		m_instance = m_engine.Play2D(*m_sound, m_pan, m_volume, true);
 	}
 
 	if (m_instance)
 	{
 		m_instance->SetLooped(m_looped);
 		m_instance->SetPitch(m_pitch);
-		m_instance->Play();
+
+		if (p_position > 0.0)
+		{
+			m_instance->SetPlaybackPosition(p_position);
+		}
+
+		if (!p_paused)
+		{
+			m_instance->Play();
+		}
 	}
 }
 
-void OvAudio::Entities::AudioSource::Resume()
+float OvAudio::Entities::AudioSource::GetAudibility(const OvMaths::FVector3& p_listenerPosition)
 {
-	if (HasSound())
+	if (!m_spatial)
 	{
-		m_instance->Play();
+		return m_volume;
 	}
+
+	// Matches the exponential distance attenuation (With a rolloff factor of 1) applied to spatial sound instances
+	const float distance = OvMaths::FVector3::Distance(p_listenerPosition, m_transform->GetWorldPosition());
+	return distance <= m_attenuationThreshold ? m_volume : m_volume * m_attenuationThreshold / distance;
 }
 
-void OvAudio::Entities::AudioSource::Pause()
+void OvAudio::Entities::AudioSource::Virtualize()
 {
-	if (HasSound())
-	{
-		m_instance->Pause();
-	}
+	OVASSERT(HasVoice(), "Cannot virtualize an audio source without voice");
+
+	m_virtualPosition = m_instance->GetPlaybackPosition();
+	m_virtualPaused = m_instance->IsPaused();
+	m_instance->Stop();
+	m_virtual = true;
 }
 
-void OvAudio::Entities::AudioSource::Stop()
+void OvAudio::Entities::AudioSource::Devirtualize()
 {
-	if (HasSound())
-	{
-		m_instance->Stop();
-	}
+	OVASSERT(m_virtual, "Cannot devirtualize an audio source that isn't virtual");
+
+	m_virtual = false;
+	StartVoice(m_virtualPosition, m_virtualPaused);
 }
 
-void OvAudio::Entities::AudioSource::Update()
+void OvAudio::Entities::AudioSource::AdvanceVirtualPlayback(double p_deltaTime)
 {
-	if (HasSound() && m_instance->IsSpatial())
+	if (!m_virtual || m_virtualPaused)
 	{
-		m_instance->SetSpatialParameters(
-			m_transform->GetWorldPosition(),
-			OvMaths::FVector3::Zero // TODO: Add support for non-zero velocity
-		);
+		return;
+	}
+
+	m_virtualPosition += p_deltaTime * m_pitch;
+
+	if (const double duration = m_sound->GetDuration(); m_virtualPosition >= duration)
+	{
+		if (m_looped && duration > 0.0)
+		{
+			m_virtualPosition = std::fmod(m_virtualPosition, duration);
+		}
+		else
+		{
+			// The sound would have ended while virtual
+			m_virtual = false;
+			m_sound = nullptr;
+		}
 	}
 }
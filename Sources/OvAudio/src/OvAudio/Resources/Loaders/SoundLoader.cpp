@@ -4,21 +4,65 @@
 * @licence: MIT
 */
 
+#include <filesystem>
+#include <format>
+
 #include <soloud_wav.h>
+#include <soloud_wavstream.h>
 
 #include <OvAudio/Resources/Loaders/SoundLoader.h>
+#include <OvDebug/Logger.h>
+
+namespace
+{
+	// In AUTO mode, sounds reaching any of these thresholds are streamed
+	constexpr double kStreamingMinDuration = 10.0; // ~3.5MB once decoded (Stereo, 44.1kHz)
+	constexpr uintmax_t kStreamingMinFileSize = 4 * 1024 * 1024;
+
+	std::pair<std::unique_ptr<SoLoud::AudioSource>, bool> LoadAudioData(const std::string& p_filepath, OvAudio::Settings::ESoundLoadMode p_loadMode)
+	{
+		using enum OvAudio::Settings::ESoundLoadMode;
+
+		if (p_loadMode != DECOMPRESS)
+		{
+			// Opening a stream only reads the file header, which is enough to decide whether the sound should be streamed
+			auto stream = std::make_unique<SoLoud::WavStream>();
 
-OvAudio::Resources::Sound* OvAudio::Resources::Loaders::SoundLoader::Create(const std::string& p_filepath)
+			if (stream->load(p_filepath.c_str()) == SoLoud::SO_NO_ERROR)
+			{
+				std::error_code error;
+				const auto fileSize = std::filesystem::file_size(p_filepath, error);
+
+				if (p_loadMode == STREAM || stream->getLength() >= kStreamingMinDuration || (!error && fileSize >= kStreamingMinFileSize))
+					return { std::move(stream), true };
+			}
+			else if (p_loadMode == STREAM)
+			{
+				OVLOG_WARNING(std::format("Unable to stream {}, falling back to a full decode", p_filepath));
+			}
+		}
+
+		auto wav = std::make_unique<SoLoud::Wav>();
+		wav->load(p_filepath.c_str());
+		return { std::move(wav), false };
+	}
+}
+
+OvAudio::Resources::Sound* OvAudio::Resources::Loaders::SoundLoader::Create(const std::string& p_filepath, Settings::ESoundLoadMode p_loadMode)
 {
-	std::unique_ptr<SoLoud::Wav> wav = std::make_unique<SoLoud::Wav>();
-	wav->load(p_filepath.c_str());
-	return new Sound(p_filepath, std::move(wav));
+	auto [audioData, streamed] = LoadAudioData(p_filepath, p_loadMode);
+	return new Sound(p_filepath, std::move(audioData), streamed);
 }
 
-void OvAudio::Resources::Loaders::SoundLoader::Reload(Sound& p_sound, const std::string& p_path)
+void OvAudio::Resources::Loaders::SoundLoader::Reload(Sound& p_sound, const std::string& p_path, Settings::ESoundLoadMode p_loadMode)
 {
 	*const_cast<std::string*>(&p_sound.path) = p_path;
-	p_sound.audioData->load(p_path.c_str());
+
+	// Replacing the audio source stops the instances that are playing it, audio sources are stopped as well
+	auto [audioData, streamed] = LoadAudioData(p_path, p_loadMode);
+	Sound::AudioDataReleasedEvent.Invoke(p_sound);
+	p_sound.audioData = std::move(audioData);
+	p_sound.m_streamed = streamed;
 }
 
 bool OvAudio::Resources::Loaders::SoundLoader::Destroy(Sound*& p_soundInstance)
@@ -7,9 +7,39 @@
 #include <OvAudio/Resources/Sound.h>
 
 #include <soloud_wav.h>
+#include <soloud_wavstream.h>
 
-OvAudio::Resources::Sound::Sound(const std::string& p_path, std::unique_ptr<SoLoud::Wav>&& p_audioData) :
+OvTools::Eventing::Event<const OvAudio::Resources::Sound&> OvAudio::Resources::Sound::AudioDataReleasedEvent;
+
+OvAudio::Resources::Sound::Sound(const std::string& p_path, std::unique_ptr<SoLoud::AudioSource>&& p_audioData, bool p_streamed) :
 	path(p_path),
-	audioData(std::move(p_audioData))
+	audioData(std::move(p_audioData)),
+	m_streamed(p_streamed)
+{
+}
+
+OvAudio::Resources::Sound::~Sound()
+{
+	AudioDataReleasedEvent.Invoke(*this);
+}
+
+bool OvAudio::Resources::Sound::IsStreamed() const
+{
+	return m_streamed;
+}
+
+uint64_t OvAudio::Resources::Sound::GetDecodedSize() const
+{
+	if (m_streamed)
+		return 0;
+
+	const auto& wav = static_cast<const SoLoud::Wav&>(*audioData);
+	return static_cast<uint64_t>(wav.mSampleCount) * wav.mChannels * sizeof(float);
+}
+
+double OvAudio::Resources::Sound::GetDuration() const
 {
+	return m_streamed ?
+		static_cast<SoLoud::WavStream&>(*audioData).getLength() :
+		static_cast<SoLoud::Wav&>(*audioData).getLength();
 }
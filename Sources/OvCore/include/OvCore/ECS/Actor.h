@@ -297,6 +297,12 @@ namespace OvCore::ECS
 		*/
 		void OnTriggerExit(Components::CPhysicalObject& p_otherObject);
 
+		/**
+		* Called when the scene of the actor has been loaded asynchronously, once it started playing
+		* @param p_sceneName
+		*/
+		void OnSceneLoaded(const std::string& p_sceneName);
+
 		/**
 		* Add a component to the actor (Or return the component if already existing)
 		* @param p_args (Parameter pack forwared to the component constructor)
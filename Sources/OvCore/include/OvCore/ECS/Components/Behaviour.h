@@ -63,6 +63,12 @@ namespace OvCore::ECS::Components
 		*/
 		void RemoveScript();
 
+		/**
+		* Returns true if the script associated with this behaviour implements the given callback
+		* @param p_callback
+		*/
+		bool HasScriptCallback(Scripting::EScriptCallback p_callback) const;
+
 		/**
 		* Called when the scene start right before OnStart
 		* It allows you to apply prioritized game logic on scene start
@@ -144,6 +150,12 @@ namespace OvCore::ECS::Components
 		*/
 		virtual void OnTriggerExit(Components::CPhysicalObject& p_otherObject) override;
 
+		/**
+		* Called when the scene of this behaviour has been loaded asynchronously, once it started playing
+		* @param p_sceneName
+		*/
+		void OnSceneLoaded(const std::string& p_sceneName);
+
 		/**
 		* Serialize the behaviour
 		* @param p_doc
@@ -84,6 +84,13 @@ namespace OvCore::ECS::Components
 		*/
 		void SetAttenuationThreshold(float p_distance);
 
+		/**
+		* Defines the audio source priority (0 = Highest, 255 = Lowest).
+		* Higher priority audio sources keep their voice first when too many sounds are playing
+		* @param p_priority
+		*/
+		void SetPriority(uint8_t p_priority);
+
 		/**
 		* Returns the sound attached to the audio source
 		*/
@@ -129,6 +136,16 @@ namespace OvCore::ECS::Components
 		*/
 		float GetAttenuationThreshold() const;
 
+		/**
+		* Returns the audio source priority (0 = Highest, 255 = Lowest)
+		*/
+		uint8_t GetPriority() const;
+
+		/**
+		* Returns true if the audio source is playing without being mixed (Out of voices or inaudible)
+		*/
+		bool IsVirtual() const;
+
 		/**
 		* Play the audio source attached sound
 		*/
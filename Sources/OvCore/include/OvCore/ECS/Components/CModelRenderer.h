@@ -6,6 +6,9 @@
 
 #pragma once
 
+#include <span>
+#include <vector>
+
 #include <OvRendering/Geometry/Vertex.h>
 #include <OvRendering/Resources/Model.h>
 
@@ -81,6 +84,23 @@ namespace OvCore::ECS::Components
 		*/
 		void SetCustomBoundingSphere(const OvRendering::Geometry::BoundingSphere& p_boundingSphere);
 
+		/**
+		* Sets the level of detail bias, which scales the screen size the levels of detail are selected from
+		* (Above 1 keeps the detailed levels longer, below 1 switches to the simplified ones sooner)
+		* @param p_bias
+		*/
+		void SetLODBias(float p_bias);
+
+		/**
+		* Returns the level of detail bias
+		*/
+		float GetLODBias() const;
+
+		/**
+		* Returns the level of detail currently selected for each mesh of the model (Updated by the scene renderer)
+		*/
+		std::span<uint8_t> GetLODLevels();
+
 		/**
 		* Serialize the component
 		* @param p_doc
@@ -106,6 +126,8 @@ namespace OvCore::ECS::Components
 		OvTools::Eventing::Event<> m_modelChangedEvent;
 		OvRendering::Geometry::BoundingSphere m_customBoundingSphere = { {}, 1.0f };
 		EFrustumBehaviour m_frustumBehaviour = EFrustumBehaviour::MESH_BOUNDS;
+		float m_lodBias = 1.0f;
+		std::vector<uint8_t> m_lodLevels;
 	};
 
 	template<>
@@ -0,0 +1,83 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <OvRendering/Resources/Model.h>
+
+#include "OvCore/ECS/Components/CPhysicalObject.h"
+
+namespace OvCore::ECS { class Actor; }
+
+namespace OvCore::ECS::Components
+{
+	/**
+	* Represent a static physical object with a triangle mesh shape generated from a model
+	*/
+	class CPhysicalMesh : public CPhysicalObject
+	{
+	public:
+		/**
+		* Constructor
+		* @param p_owner
+		*/
+		CPhysicalMesh(ECS::Actor& p_owner);
+
+		/**
+		* Returns the name of the component
+		*/
+		std::string GetName() override;
+
+		/**
+		* Returns the type name of the component
+		*/
+		virtual std::string GetTypeName() override;
+
+		/**
+		* Defines the model the collision shape is generated from
+		* @param p_model
+		*/
+		void SetModel(OvRendering::Resources::Model* p_model);
+
+		/**
+		* Returns the model the collision shape is generated from
+		*/
+		OvRendering::Resources::Model* GetModel() const;
+
+		/**
+		* Serialize the component
+		* @param p_doc
+		* @param p_node
+		*/
+		virtual void OnSerialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node) override;
+
+		/**
+		* Deserialize the component
+		* @param p_doc
+		* @param p_node
+		*/
+		virtual void OnDeserialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node) override;
+
+		/**
+		* Defines how the component should be drawn in the inspector
+		* @param p_root
+		*/
+		virtual void OnInspector(OvUI::Internal::WidgetContainer& p_root) override;
+
+	private:
+		void UpdateShape();
+
+	private:
+		OvRendering::Resources::Model* m_model = nullptr;
+		OvTools::Eventing::Event<> m_modelChangedEvent;
+	};
+
+	template<>
+	struct ComponentTraits<OvCore::ECS::Components::CPhysicalMesh>
+	{
+		static constexpr std::string_view Name = "class OvCore::ECS::Components::CPhysicalMesh";
+	};
+}
@@ -98,6 +98,11 @@ namespace OvCore::ECS::Components
 		*/
 		OvPhysics::Entities::PhysicalObject::EActivationState GetActivationState() const;
 
+		/**
+		* Returns the layer (From 0 to 31) of the physical object
+		*/
+		uint8_t GetLayer() const;
+
 		/**
 		* Defines a new mass for the physical object
 		* @param p_mass
@@ -164,6 +169,12 @@ namespace OvCore::ECS::Components
 		*/
 		void SetActivationState(OvPhysics::Entities::PhysicalObject::EActivationState p_activationState);
 
+		/**
+		* Defines the layer (From 0 to 31) of the physical object. Physics queries only consider objects whose layer is in their layer mask
+		* @param p_layer
+		*/
+		void SetLayer(uint8_t p_layer);
+
 		/**
 		* Serialize the component
 		* @param p_doc
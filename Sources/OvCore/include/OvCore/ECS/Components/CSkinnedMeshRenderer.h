@@ -277,6 +277,7 @@ namespace OvCore::ECS::Components
 		const OvRendering::Resources::Model* m_model = nullptr;
 		OvRendering::Resources::Model* m_animationSourceModel = nullptr;
 		OvTools::Eventing::Event<> m_animationSourceChangedEvent;
+		bool m_waitingForModelLoad = false; // Runtime data is rebuilt once the models finish loading in the background
 
 		bool m_playing = true;
 		bool m_looping = true;
@@ -7,8 +7,10 @@
 #pragma once
 
 #include <optional>
+#include <span>
 #include <vector>
 
+#include <OvPhysics/Entities/PhysicsQuery.h>
 #include <OvPhysics/Entities/RaycastHit.h>
 
 #include <OvMaths/FVector3.h>
@@ -37,5 +39,54 @@ namespace OvCore::ECS
 		 * @param p_end
 		 */
 		static std::optional<RaycastHit> Raycast(OvMaths::FVector3 p_origin, OvMaths::FVector3 p_direction, float p_distance);
+
+		/**
+		* Simple data structure that wraps the physics QueryHit with physics components
+		*/
+		struct QueryHit
+		{
+			Components::CPhysicalObject* Object = nullptr;
+			OvMaths::FVector3 Point;
+			OvMaths::FVector3 Normal;
+			float Distance = 0.0f;
+		};
+
+		/**
+		* Casts every given ray and writes the closest hit of each one into the result buffer (p_results[i] is the result of p_queries[i])
+		* @param p_queries
+		* @param p_results
+		* @param p_parallel
+		*/
+		static void RaycastBatch(std::span<const OvPhysics::Entities::RayQuery> p_queries, std::span<QueryHit> p_results, bool p_parallel = false);
+
+		/**
+		* Sweeps every given sphere and writes the closest hit of each one into the result buffer (p_results[i] is the result of p_queries[i])
+		* @param p_queries
+		* @param p_results
+		* @param p_parallel
+		*/
+		static void SphereCastBatch(std::span<const OvPhysics::Entities::SphereCastQuery> p_queries, std::span<QueryHit> p_results, bool p_parallel = false);
+
+		/**
+		* Sweeps every given box and writes the closest hit of each one into the result buffer (p_results[i] is the result of p_queries[i])
+		* @param p_queries
+		* @param p_results
+		* @param p_parallel
+		*/
+		static void BoxCastBatch(std::span<const OvPhysics::Entities::BoxCastQuery> p_queries, std::span<QueryHit> p_results, bool p_parallel = false);
+
+		/**
+		* Returns the physical objects overlapping the given sphere (At most p_maxResults)
+		* @param p_query
+		* @param p_maxResults
+		*/
+		static std::vector<Components::CPhysicalObject*> OverlapSphere(const OvPhysics::Entities::SphereOverlapQuery& p_query, uint32_t p_maxResults = 64);
+
+		/**
+		* Returns the physical objects overlapping the given box (At most p_maxResults)
+		* @param p_query
+		* @param p_maxResults
+		*/
+		static std::vector<Components::CPhysicalObject*> OverlapBox(const OvPhysics::Entities::BoxOverlapQuery& p_query, uint32_t p_maxResults = 64);
 	};
 }
\ No newline at end of file
@@ -109,6 +109,9 @@ namespace OvCore::Rendering
 			OvCore::ECS::Actor& actor;
 			EVisibilityFlags visibilityFlags = EVisibilityFlags::NONE;
 			std::optional<OvRendering::Geometry::BoundingSphere> bounds;
+			OvTools::Utils::OptRef<OvRendering::Resources::Mesh> lodSource; // Full detail mesh, when the drawable mesh has levels of detail
+			OvTools::Utils::OptRef<uint8_t> lodLevel; // Level of detail currently selected for this drawable, persisting across frames
+			float lodBias = 1.0f;
 		};
 
 		/**
@@ -131,6 +134,8 @@ namespace OvCore::Rendering
 			bool includeUI = true; // Whether to include UI drawables in the filtering
 			bool includeTransparent = true; // Whether to include transparent drawables in the filtering
 			bool includeOpaque = true; // Whether to include opaque drawables in the filtering
+			bool reportTextureUsage = false; // Whether to report the on-screen footprint of the kept drawables textures to the texture streamer
+			bool updateLODs = false; // Whether to select the levels of detail from this camera (Otherwise the last selected levels are used)
 		};
 
 		/**
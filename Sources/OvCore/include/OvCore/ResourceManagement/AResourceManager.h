@@ -7,11 +7,29 @@
 #pragma once
 
 #include <any>
+#include <chrono>
 #include <filesystem>
+#include <functional>
+#include <future>
 #include <unordered_map>
+#include <unordered_set>
+
+#include <OvCore/ResourceManagement/ResourceID.h>
+#include <OvTools/Utils/ThreadPool.h>
 
 namespace OvCore::ResourceManagement
 {
+	/**
+	* Memory held by the resources of a resource manager
+	*/
+	struct ResourceMemoryReport
+	{
+		uint32_t resourceCount = 0;
+		uint64_t memoryUsage = 0; // In bytes, estimated from the resource data (0 for resource types without estimation)
+		uint32_t unloadedResourceCount = 0; // Unloaded because unused, since startup
+		uint64_t unloadedMemory = 0; // In bytes, unloaded because unused, since startup
+	};
+
 	/**
 	* Handle the management of various resources of variable type
 	*/
@@ -25,6 +43,40 @@ namespace OvCore::ResourceManagement
 		*/
 		T* LoadResource(const std::filesystem::path& p_path);
 
+		/**
+		* Register the resource right away and load it in the background.
+		* The returned pointer is a handle that stays valid once the load completes: it is a placeholder
+		* (e.g. an empty model or a 1x1 texture) until ProcessAsyncLoads fills it on the main thread.
+		* Resource types without async support, or managers without thread pool, load synchronously
+		* @param p_path
+		*/
+		T* LoadResourceAsync(const std::filesystem::path& p_path);
+
+		/**
+		* Return true if the resource is registered but still being loaded in the background
+		* @param p_path
+		*/
+		bool IsResourceLoading(const std::filesystem::path& p_path) const;
+
+		/**
+		* Block until the background load of the given resource is done and complete it immediately
+		* (Nothing happens if the resource isn't being loaded)
+		* @param p_path
+		*/
+		void WaitForResource(const std::filesystem::path& p_path);
+
+		/**
+		* Complete the background loads that are ready (GPU uploads), until the given deadline is reached.
+		* Must be called from the main thread. Returns the number of completed loads
+		* @param p_deadline
+		*/
+		uint32_t ProcessAsyncLoads(std::chrono::steady_clock::time_point p_deadline);
+
+		/**
+		* Return true if some resources are still being loaded in the background
+		*/
+		bool HasPendingLoads() const;
+
 		/**
 		* Handle the destruction of a resource and unregister it
 		* @param p_path
@@ -50,11 +102,30 @@ namespace OvCore::ResourceManagement
 		*/
 		bool IsResourceRegistered(const std::filesystem::path& p_path);
 
+		/**
+		* Return true if the resource exists (= Is registered)
+		* @param p_id
+		*/
+		bool IsResourceRegistered(ResourceID p_id) const;
+
 		/**
 		* Destroy and unregister every resources
 		*/
 		void UnloadResources();
 
+		/**
+		* Destroy and unregister the resources registered before the given time that aren't part of the given used resources.
+		* Engine resources (":" prefixed paths) and resources being loaded are kept. Returns the number of unloaded resources
+		* @param p_usedResources
+		* @param p_registeredBefore
+		*/
+		uint32_t UnloadUnusedResources(const std::unordered_set<const T*>& p_usedResources, std::chrono::steady_clock::time_point p_registeredBefore);
+
+		/**
+		* Returns the memory held by the registered resources, and the memory released by UnloadUnusedResources so far
+		*/
+		ResourceMemoryReport GetMemoryReport() const;
+
 		/**
 		* Register a resource and associate it with a given path.
 		* After this method is called, the memory managment of the resource
@@ -79,6 +150,13 @@ namespace OvCore::ResourceManagement
 		*/
 		T* GetResource(const std::filesystem::path& p_path, bool p_tryToLoadIfNotFound = true);
 
+		/**
+		* Return the instance linked to the given ID (See GetResourceID), or nullptr if not registered.
+		* Unlike the path overload, the key isn't normalized again and the resource is never loaded
+		* @param p_id
+		*/
+		T* GetResource(ResourceID p_id) const;
+
 		/**
 		* Operator overload to get an instance linked to the given path.
 		* @note See GetResource for more informations
@@ -97,22 +175,63 @@ namespace OvCore::ResourceManagement
 			const std::filesystem::path& p_engineAssetsPath
 		);
 
+		/**
+		* Provide the thread pool used by LoadResourceAsync (nullptr disables async loading)
+		* @param p_threadPool
+		*/
+		static void ProvideThreadPool(OvTools::Utils::ThreadPool* p_threadPool);
+
 		/**
 		* Returns the resource map
 		*/
 		std::unordered_map<std::filesystem::path, T*>& GetResources();
 
 	protected:
+		/**
+		* Main-thread step of an async load, applied to the placeholder once the background step is done
+		*/
+		using AsyncFinalizer = std::function<void(T&)>;
+
+		/**
+		* Background step of an async load (File I/O, parsing, decoding). It runs on a worker thread,
+		* so it must only use what it captured, and never touch the manager, the GPU or the logger (Messages are reported by the finalizer)
+		*/
+		using AsyncTask = std::function<AsyncFinalizer()>;
+
 		virtual T* CreateResource(const std::filesystem::path& p_path) = 0;
 		virtual void DestroyResource(T* p_resource) = 0;
 		virtual void ReloadResource(T* p_resource, const std::filesystem::path& p_path) = 0;
+
+		/**
+		* Returns an estimation of the memory (In bytes) held by the given resource, CPU and GPU side
+		* @param p_resource
+		*/
+		virtual uint64_t GetResourceMemoryUsage(const T& p_resource) const;
+
+		/**
+		* Create the placeholder of an async load and its background task.
+		* Return nullptr if the resource can't be loaded asynchronously (LoadResourceAsync then loads it synchronously)
+		* @param p_path
+		* @param p_task
+		*/
+		virtual T* CreateAsyncResource(const std::filesystem::path& p_path, AsyncTask& p_task);
+
 		std::filesystem::path GetRealPath(const std::filesystem::path& p_path) const;
 
+	private:
+		void FinalizeAsyncLoad(ResourceID p_id, std::future<AsyncFinalizer>& p_result);
+
 	private:
 		inline static std::filesystem::path __PROJECT_ASSETS_PATH;
 		inline static std::filesystem::path __ENGINE_ASSETS_PATH;
+		inline static OvTools::Utils::ThreadPool* __THREAD_POOL = nullptr;
 
 		std::unordered_map<std::filesystem::path, T*> m_resources;
+		std::unordered_map<ResourceID, T*> m_resourcesByID;
+		std::unordered_map<ResourceID, std::future<AsyncFinalizer>> m_pendingLoads;
+		std::unordered_map<ResourceID, std::chrono::steady_clock::time_point> m_registrationTimes;
+		uint32_t m_unloadedResourceCount = 0;
+		uint64_t m_unloadedMemory = 0;
 	};
 }
 
@@ -7,23 +7,11 @@
 #pragma once
 
 #include <algorithm>
+#include <exception>
+#include <vector>
 
 #include "OvCore/ResourceManagement/AResourceManager.h"
 
-namespace
-{
-	// Normalize a path for consistent key usage across platforms.
-	// - Treat backslashes as separators (important on POSIX where '\\' isn't a separator)
-	// - Apply lexically_normal to collapse '.' and '..'
-	inline std::filesystem::path NormalizeKey(const std::filesystem::path& p)
-	{
-		std::string s = p.string();
-		std::replace(s.begin(), s.end(), '\\', '/');
-		std::filesystem::path norm = std::filesystem::path{s}.lexically_normal();
-		return norm;
-	}
-}
-
 namespace OvCore::ResourceManagement
 {
 	template<typename T>
@@ -41,6 +29,98 @@ namespace OvCore::ResourceManagement
 		}
 	}
 
+	template<typename T>
+	inline T* AResourceManager<T>::LoadResourceAsync(const std::filesystem::path& p_path)
+	{
+		if (auto resource = GetResource(p_path, false); resource)
+			return resource;
+
+		AsyncTask task;
+		T* placeholder = __THREAD_POOL ? CreateAsyncResource(p_path, task) : nullptr;
+
+		if (!placeholder || !task)
+		{
+			if (placeholder)
+				DestroyResource(placeholder);
+
+			return LoadResource(p_path);
+		}
+
+		RegisterResource(p_path, placeholder);
+		m_pendingLoads[GetResourceID(p_path)] = __THREAD_POOL->Submit(std::move(task));
+		return placeholder;
+	}
+
+	template<typename T>
+	inline bool AResourceManager<T>::IsResourceLoading(const std::filesystem::path& p_path) const
+	{
+		return !m_pendingLoads.empty() && m_pendingLoads.contains(GetResourceID(p_path));
+	}
+
+	template<typename T>
+	inline void AResourceManager<T>::WaitForResource(const std::filesystem::path& p_path)
+	{
+		if (m_pendingLoads.empty())
+			return;
+
+		if (auto pending = m_pendingLoads.find(GetResourceID(p_path)); pending != m_pendingLoads.end())
+		{
+			const auto id = pending->first;
+			auto result = std::move(pending->second);
+			m_pendingLoads.erase(pending);
+			FinalizeAsyncLoad(id, result);
+		}
+	}
+
+	template<typename T>
+	inline uint32_t AResourceManager<T>::ProcessAsyncLoads(std::chrono::steady_clock::time_point p_deadline)
+	{
+		uint32_t completed = 0;
+
+		for (auto it = m_pendingLoads.begin(); it != m_pendingLoads.end() && std::chrono::steady_clock::now() < p_deadline;)
+		{
+			if (it->second.wait_for(std::chrono::seconds::zero()) != std::future_status::ready)
+			{
+				++it;
+				continue;
+			}
+
+			const auto id = it->first;
+			auto result = std::move(it->second);
+			it = m_pendingLoads.erase(it);
+			FinalizeAsyncLoad(id, result);
+			++completed;
+		}
+
+		return completed;
+	}
+
+	template<typename T>
+	inline bool AResourceManager<T>::HasPendingLoads() const
+	{
+		return !m_pendingLoads.empty();
+	}
+
+	template<typename T>
+	inline void AResourceManager<T>::FinalizeAsyncLoad(ResourceID p_id, std::future<AsyncFinalizer>& p_result)
+	{
+		AsyncFinalizer finalizer;
+
+		try
+		{
+			finalizer = p_result.get();
+		}
+		catch (const std::exception&)
+		{
+			// The task has been discarded (Thread pool destroyed) or has thrown, the placeholder stays as-is
+		}
+
+		if (auto resource = m_resourcesByID.find(p_id); resource != m_resourcesByID.end() && finalizer)
+		{
+			finalizer(*resource->second);
+		}
+	}
+
 	template<typename T>
 	inline void AResourceManager<T>::UnloadResource(const std::filesystem::path & p_path)
 	{
@@ -56,8 +136,21 @@ namespace OvCore::ResourceManagement
 	{
 		if (auto toMove = GetResource(p_previousPath, false); toMove && !IsResourceRegistered(p_newPath))
 		{
+			std::future<AsyncFinalizer> pendingLoad;
+
+			if (auto pending = m_pendingLoads.find(GetResourceID(p_previousPath)); pending != m_pendingLoads.end())
+			{
+				pendingLoad = std::move(pending->second);
+			}
+
 			RegisterResource(p_newPath, toMove);
 			UnregisterResource(p_previousPath);
+
+			if (pendingLoad.valid())
+			{
+				m_pendingLoads[GetResourceID(p_newPath)] = std::move(pendingLoad);
+			}
+
 			return true;
 		}
 
@@ -69,6 +162,8 @@ namespace OvCore::ResourceManagement
 	{
 		if (auto resource = GetResource(p_path, false); resource)
 		{
+			// The pending result would otherwise override the reloaded data
+			WaitForResource(p_path);
 			ReloadResource(resource, p_path);
 		}
 	}
@@ -76,7 +171,13 @@ namespace OvCore::ResourceManagement
 	template<typename T>
 	inline bool AResourceManager<T>::IsResourceRegistered(const std::filesystem::path & p_path)
 	{
-		return m_resources.find(NormalizeKey(p_path)) != m_resources.end();
+		return IsResourceRegistered(GetResourceID(p_path));
+	}
+
+	template<typename T>
+	inline bool AResourceManager<T>::IsResourceRegistered(ResourceID p_id) const
+	{
+		return m_resourcesByID.contains(p_id);
 	}
 
 	template<typename T>
@@ -86,19 +187,71 @@ namespace OvCore::ResourceManagement
 			DestroyResource(value);
 
 		m_resources.clear();
+		m_resourcesByID.clear();
+		m_pendingLoads.clear();
+		m_registrationTimes.clear();
+	}
+
+	template<typename T>
+	inline uint32_t AResourceManager<T>::UnloadUnusedResources(const std::unordered_set<const T*>& p_usedResources, std::chrono::steady_clock::time_point p_registeredBefore)
+	{
+		std::vector<std::filesystem::path> unusedResources;
+
+		for (const auto& [key, resource] : m_resources)
+		{
+			const auto id = GetResourceID(key);
+
+			// Engine resources are also used by the engine itself (Default materials, gizmos...)
+			if (key.string().starts_with(':') || m_pendingLoads.contains(id) || p_usedResources.contains(resource))
+				continue;
+
+			// Resources registered since are likely to be used soon
+			if (auto registrationTime = m_registrationTimes.find(id); registrationTime != m_registrationTimes.end() && registrationTime->second < p_registeredBefore)
+				unusedResources.push_back(key);
+		}
+
+		for (const auto& key : unusedResources)
+		{
+			m_unloadedMemory += GetResourceMemoryUsage(*m_resources.at(key));
+			UnloadResource(key);
+		}
+
+		m_unloadedResourceCount += static_cast<uint32_t>(unusedResources.size());
+
+		return static_cast<uint32_t>(unusedResources.size());
+	}
+
+	template<typename T>
+	inline ResourceMemoryReport AResourceManager<T>::GetMemoryReport() const
+	{
+		ResourceMemoryReport report{
+			.resourceCount = static_cast<uint32_t>(m_resources.size()),
+			.unloadedResourceCount = m_unloadedResourceCount,
+			.unloadedMemory = m_unloadedMemory
+		};
+
+		for (const auto& [key, resource] : m_resources)
+			report.memoryUsage += GetResourceMemoryUsage(*resource);
+
+		return report;
 	}
 
 	template<typename T>
 	inline T* AResourceManager<T>::RegisterResource(const std::filesystem::path& p_path, T* p_instance)
 	{
-		auto key = NormalizeKey(p_path);
+		const auto key = NormalizeResourcePath(p_path);
+		const auto id = GetResourceID(key);
 
-		if (auto resource = GetResource(p_path, false); resource)
+		if (auto resource = GetResource(id); resource)
 		{
 			DestroyResource(resource);
 		}
 
+		m_pendingLoads.erase(id);
+
 		m_resources[key] = p_instance;
+		m_resourcesByID[id] = p_instance;
+		m_registrationTimes[id] = std::chrono::steady_clock::now();
 
 		return p_instance;
 	}
@@ -106,17 +259,21 @@ namespace OvCore::ResourceManagement
 	template<typename T>
 	inline void AResourceManager<T>::UnregisterResource(const std::filesystem::path & p_path)
 	{
-		m_resources.erase(NormalizeKey(p_path));
+		const auto key = NormalizeResourcePath(p_path);
+		const auto id = GetResourceID(key);
+
+		m_resources.erase(key);
+		m_resourcesByID.erase(id);
+		m_pendingLoads.erase(id);
+		m_registrationTimes.erase(id);
 	}
 
 	template<typename T>
 	inline T* AResourceManager<T>::GetResource(const std::filesystem::path& p_path, bool p_tryToLoadIfNotFound)
 	{
-		auto key = NormalizeKey(p_path);
-		
-		if (auto resource = m_resources.find(key); resource != m_resources.end())
+		if (auto resource = GetResource(GetResourceID(p_path)); resource)
 		{
-			return resource->second;
+			return resource;
 		}
 		else if (p_tryToLoadIfNotFound)
 		{
@@ -126,6 +283,17 @@ namespace OvCore::ResourceManagement
 		return nullptr;
 	}
 
+	template<typename T>
+	inline T* AResourceManager<T>::GetResource(ResourceID p_id) const
+	{
+		if (auto resource = m_resourcesByID.find(p_id); resource != m_resourcesByID.end())
+		{
+			return resource->second;
+		}
+
+		return nullptr;
+	}
+
 	template<typename T>
 	inline T* AResourceManager<T>::operator[](const std::filesystem::path & p_path)
 	{
@@ -142,12 +310,30 @@ namespace OvCore::ResourceManagement
 		__ENGINE_ASSETS_PATH = p_engineAssetsPath;
 	}
 
+	template<typename T>
+	inline void AResourceManager<T>::ProvideThreadPool(OvTools::Utils::ThreadPool* p_threadPool)
+	{
+		__THREAD_POOL = p_threadPool;
+	}
+
 	template<typename T>
 	inline std::unordered_map<std::filesystem::path, T*>& AResourceManager<T>::GetResources()
 	{
 		return m_resources;
 	}
 
+	template<typename T>
+	inline T* AResourceManager<T>::CreateAsyncResource(const std::filesystem::path&, AsyncTask&)
+	{
+		return nullptr;
+	}
+
+	template<typename T>
+	inline uint64_t AResourceManager<T>::GetResourceMemoryUsage(const T&) const
+	{
+		return 0;
+	}
+
 	template<typename T>
 	inline std::filesystem::path AResourceManager<T>::GetRealPath(const std::filesystem::path& p_path) const
 	{
@@ -6,6 +6,11 @@
 
 #pragma once
 
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <OvPhysics/Entities/TriangleMesh.h>
 #include <OvRendering/Resources/Loaders/ModelLoader.h>
 
 #include "OvCore/ResourceManagement/AResourceManager.h"
@@ -19,11 +24,19 @@ namespace OvCore::ResourceManagement
 	{
 	public:
 		/**
-		* Create the resource identified by the given path
+		* Create the resource identified by the given path.
+		* Models are loaded from their cooked file ("<model>.ovmesh") when it is up-to-date, and cooked otherwise
 		* @param p_path
 		*/
 		virtual OvRendering::Resources::Model* CreateResource(const std::filesystem::path & p_path) override;
 
+		/**
+		* Create an empty model, filled once its file has been read on a worker thread
+		* @param p_path
+		* @param p_task
+		*/
+		virtual OvRendering::Resources::Model* CreateAsyncResource(const std::filesystem::path& p_path, AsyncTask& p_task) override;
+
 		/**
 		* Destroy the given resource
 		* @param p_resource
@@ -36,5 +49,38 @@ namespace OvCore::ResourceManagement
 		* @param p_path
 		*/
 		virtual void ReloadResource(OvRendering::Resources::Model* p_resource, const std::filesystem::path& p_path) override;
+
+		/**
+		* Returns the size of the GPU buffers of the given model meshes
+		* @param p_resource
+		*/
+		virtual uint64_t GetResourceMemoryUsage(const OvRendering::Resources::Model& p_resource) const override;
+
+		/**
+		* Generate the cooked file of the given model if it is missing or outdated, without loading the model.
+		* Return true if the cooked file is up-to-date
+		* @param p_path
+		*/
+		bool CookModel(const std::filesystem::path& p_path) const;
+
+		/**
+		* Returns the triangle mesh collision shape of the given model, shared by every caller.
+		* The shape is read from its cooked cache file ("<model>.trimesh.ovcol") when it is up-to-date, and cooked otherwise.
+		* Returns nullptr if the model has no triangle
+		* @param p_model
+		*/
+		std::shared_ptr<const OvPhysics::Entities::TriangleMesh> GetCollisionMesh(const OvRendering::Resources::Model& p_model);
+
+		/**
+		* Returns the simplified convex hull of the given model, shared by every caller.
+		* The hull is read from its cooked cache file ("<model>.hull.ovcol") when it is up-to-date, and cooked otherwise.
+		* Returns nullptr if the model has no triangle
+		* @param p_model
+		*/
+		std::shared_ptr<const std::vector<OvMaths::FVector3>> GetCollisionHull(const OvRendering::Resources::Model& p_model);
+
+	private:
+		std::unordered_map<std::string, std::weak_ptr<const OvPhysics::Entities::TriangleMesh>> m_collisionMeshes;
+		std::unordered_map<std::string, std::weak_ptr<const std::vector<OvMaths::FVector3>>> m_collisionHulls;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,32 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+
+namespace OvCore::ResourceManagement
+{
+	/**
+	* Identifier of a resource, hashed once from its normalized path. Paths that only differ by their separators
+	* or by "." and ".." components share the same ID, so an ID can be stored and used for O(1) lookups
+	*/
+	using ResourceID = uint64_t;
+
+	/**
+	* Returns the given resource path with '/' separators and "." and ".." components collapsed,
+	* which is the form resource managers use as key
+	* @param p_path
+	*/
+	std::filesystem::path NormalizeResourcePath(const std::filesystem::path& p_path);
+
+	/**
+	* Returns the ID of the given resource path (64-bit FNV-1a hash of its normalized form)
+	* @param p_path
+	*/
+	ResourceID GetResourceID(const std::filesystem::path& p_path);
+}
@@ -0,0 +1,36 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <unordered_set>
+
+#include <OvAudio/Resources/Sound.h>
+#include <OvCore/Resources/Material.h>
+#include <OvRendering/Resources/Model.h>
+#include <OvRendering/Resources/Shader.h>
+#include <OvRendering/Resources/Texture.h>
+
+namespace OvCore::ResourceManagement
+{
+	/**
+	* Set of the resources referenced by something (e.g. a scene), used to find the resources nothing needs anymore
+	*/
+	struct ResourceUsage
+	{
+		std::unordered_set<const OvRendering::Resources::Model*> models;
+		std::unordered_set<const OvRendering::Resources::Texture*> textures;
+		std::unordered_set<const OvRendering::Resources::Shader*> shaders;
+		std::unordered_set<const OvCore::Resources::Material*> materials;
+		std::unordered_set<const OvAudio::Resources::Sound*> sounds;
+
+		/**
+		* Add the given material, along with its shader and textures
+		* @param p_material
+		*/
+		void AddMaterial(OvCore::Resources::Material& p_material);
+	};
+}
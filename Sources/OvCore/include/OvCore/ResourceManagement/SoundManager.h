@@ -36,5 +36,11 @@ namespace OvCore::ResourceManagement
 		* @param p_path
 		*/
 		virtual void ReloadResource(OvAudio::Resources::Sound* p_resource, const std::filesystem::path& p_path) override;
+
+		/**
+		* Returns the size of the decoded audio data of the given sound (0 for streamed sounds)
+		* @param p_resource
+		*/
+		virtual uint64_t GetResourceMemoryUsage(const OvAudio::Resources::Sound& p_resource) const override;
 	};
 }
\ No newline at end of file
@@ -9,6 +9,7 @@
 #include <OvRendering/Resources/Loaders/TextureLoader.h>
 
 #include "OvCore/ResourceManagement/AResourceManager.h"
+#include "OvCore/ResourceManagement/TextureStreamer.h"
 
 namespace OvCore::ResourceManagement
 {
@@ -19,11 +20,21 @@ namespace OvCore::ResourceManagement
 	{
 	public:
 		/**
-		* Create the resource identified by the given path
+		* Create the resource identified by the given path.
+		* Compressed textures are loaded from their cooked file ("<texture>.ovtex") when it is up-to-date, and cooked otherwise.
+		* When texture streaming is enabled, compressed textures with mipmaps are created with their smallest levels only,
+		* and handed to the texture streamer
 		* @param p_path
 		*/
 		virtual OvRendering::Resources::Texture* CreateResource(const std::filesystem::path & p_path) override;
 
+		/**
+		* Create a 1x1 white placeholder texture, replaced once the image has been decoded (or its cooked file read) on a worker thread
+		* @param p_path
+		* @param p_task
+		*/
+		virtual OvRendering::Resources::Texture* CreateAsyncResource(const std::filesystem::path& p_path, AsyncTask& p_task) override;
+
 		/**
 		* Destroy the given resource
 		* @param p_resource
@@ -36,5 +47,26 @@ namespace OvCore::ResourceManagement
 		* @param p_path
 		*/
 		virtual void ReloadResource(OvRendering::Resources::Texture* p_resource, const std::filesystem::path& p_path) override;
+
+		/**
+		* Returns an estimation of the GPU memory held by the given texture, from its format and resident mipmap levels
+		* @param p_resource
+		*/
+		virtual uint64_t GetResourceMemoryUsage(const OvRendering::Resources::Texture& p_resource) const override;
+
+		/**
+		* Generate the cooked file of the given texture if it is compressed and its cooked file is missing or outdated,
+		* without loading the texture. Return false if the texture can't be cooked
+		* @param p_path
+		*/
+		bool CookTexture(const std::filesystem::path& p_path) const;
+
+		/**
+		* Returns the streamer keeping the needed mipmap levels of the streamed textures resident
+		*/
+		TextureStreamer& GetStreamer();
+
+	private:
+		TextureStreamer m_streamer;
 	};
 }
\ No newline at end of file
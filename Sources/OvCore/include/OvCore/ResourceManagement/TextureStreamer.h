@@ -0,0 +1,149 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+
+#include <OvRendering/Resources/Parsers/TextureData.h>
+#include <OvRendering/Resources/Texture.h>
+#include <OvTools/Utils/ThreadPool.h>
+
+namespace OvCore::ResourceManagement
+{
+	/**
+	* Keeps resident only the mipmap levels of the compressed textures that are needed on screen, within a memory budget.
+	* Streamed textures are created with their smallest levels only, larger levels are read from their cooked file in
+	* the background once rendered geometry needs them, and the least recently used textures are brought back to their
+	* smallest levels when the budget is exceeded
+	*/
+	class TextureStreamer
+	{
+	public:
+		/**
+		* Largest level (In texels) a streamed texture is created with
+		*/
+		static constexpr uint32_t kMinResidentLevelSize = 64;
+
+		/**
+		* Default memory budget of the streamed textures, in megabytes
+		*/
+		static constexpr uint32_t kDefaultBudgetInMegabytes = 512;
+
+		/**
+		* Description of a streamed texture
+		*/
+		struct StreamedTextureDesc
+		{
+			std::filesystem::path cookedPath;
+			OvRendering::Settings::ETextureCompression compression = OvRendering::Settings::ETextureCompression::NONE;
+			uint32_t width = 0; // Of the complete mipmap chain first level
+			uint32_t height = 0;
+			uint32_t levelCount = 0; // Of the complete mipmap chain
+			uint32_t residentLevel = 0; // First level allocated when registering, also the smallest level set the texture can be brought back to
+			baregl::types::ETextureFilteringMode minFilter = baregl::types::ETextureFilteringMode::LINEAR_MIPMAP_LINEAR;
+			baregl::types::ETextureFilteringMode magFilter = baregl::types::ETextureFilteringMode::LINEAR;
+			baregl::types::ETextureWrapMode horizontalWrap = baregl::types::ETextureWrapMode::REPEAT;
+			baregl::types::ETextureWrapMode verticalWrap = baregl::types::ETextureWrapMode::REPEAT;
+		};
+
+		/**
+		* Provide the thread pool used to read the streamed levels (nullptr reads them synchronously)
+		* @param p_threadPool
+		*/
+		void ProvideThreadPool(OvTools::Utils::ThreadPool* p_threadPool);
+
+		/**
+		* Defines whether textures loaded from now on should be streamed (Already streamed textures keep being streamed)
+		* @param p_enabled
+		*/
+		void SetEnabled(bool p_enabled);
+
+		/**
+		* Returns true if textures loaded from now on should be streamed
+		*/
+		bool IsEnabled() const;
+
+		/**
+		* Defines the memory budget of the streamed textures, in bytes
+		* @param p_budget
+		*/
+		void SetBudget(uint64_t p_budget);
+
+		/**
+		* Returns the memory budget of the streamed textures, in bytes
+		*/
+		uint64_t GetBudget() const;
+
+		/**
+		* Start streaming the given texture, which must currently hold the levels of its description from residentLevel
+		* @param p_texture
+		* @param p_desc
+		*/
+		void RegisterTexture(OvRendering::Resources::Texture& p_texture, const StreamedTextureDesc& p_desc);
+
+		/**
+		* Stop streaming the given texture (Nothing happens if it isn't streamed)
+		* @param p_texture
+		*/
+		void UnregisterTexture(const OvRendering::Resources::Texture& p_texture);
+
+		/**
+		* Returns true if at least one texture is streamed
+		*/
+		bool HasStreamedTextures() const;
+
+		/**
+		* Declare that the given texture has been rendered with the given footprint: the UV distance covered by a screen pixel.
+		* The smallest footprint of a frame decides the level the texture should have (Nothing happens if it isn't streamed)
+		* @param p_texture
+		* @param p_uvPerPixel
+		*/
+		void ReportUsage(const OvRendering::Resources::Texture& p_texture, float p_uvPerPixel);
+
+		/**
+		* Upload the levels read in the background until the given deadline is reached, evict the least recently used
+		* levels if the budget is exceeded, and request the levels needed by the usage reported since the last update.
+		* Must be called from the main thread, once per frame
+		* @param p_deadline
+		*/
+		void Update(std::chrono::steady_clock::time_point p_deadline);
+
+	private:
+		using LevelsLoad = std::future<std::shared_ptr<OvRendering::Resources::Parsers::TextureData>>;
+
+		struct StreamedTexture
+		{
+			OvRendering::Resources::Texture& texture;
+			StreamedTextureDesc desc;
+			uint32_t residentLevel = 0;
+			uint32_t requestedLevel = 0;
+			uint64_t lastUsedFrame = 0;
+			std::optional<uint32_t> pendingLevel;
+			LevelsLoad pendingLoad;
+		};
+
+		uint64_t GetLevelsSize(const StreamedTexture& p_texture, uint32_t p_firstLevel) const;
+		void RequestLevels(StreamedTexture& p_texture, uint32_t p_firstLevel);
+		bool EvictLeastRecentlyUsed(uint64_t p_requiredSize);
+		void ApplyLevels(StreamedTexture& p_texture, const OvRendering::Resources::Parsers::TextureData& p_data);
+		void ReportStats() const;
+
+	private:
+		OvTools::Utils::ThreadPool* m_threadPool = nullptr;
+		bool m_enabled = false;
+		uint64_t m_budget = 0;
+		uint64_t m_frame = 1;
+		uint64_t m_residentSize = 0;
+		uint64_t m_evictionCount = 0;
+		std::unordered_map<const OvRendering::Resources::Texture*, StreamedTexture> m_textures;
+	};
+}
@@ -0,0 +1,68 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace tinyxml2
+{
+	class XMLDocument;
+}
+
+namespace OvCore::SceneSystem
+{
+	/**
+	* Compact binary encoding of serialized scenes, meant for builds.
+	* A file is made of versioned chunks: a string table, where every element name and value is stored once,
+	* an asset reference table, listing the strings that are asset paths so they can be loaded before the scene,
+	* and the element tree itself, made of string table indices.
+	* Scenes are still serialized to XML, which is converted to and from this encoding.
+	*/
+	class BinarySceneFormat
+	{
+	public:
+		/**
+		* Disabled constructor
+		*/
+		BinarySceneFormat() = delete;
+
+		/**
+		* Returns true if the given file starts with the binary scene header
+		* @param p_path
+		*/
+		static bool IsBinaryScene(const std::filesystem::path& p_path);
+
+		/**
+		* Encode the given document and write it to the given file
+		* @param p_document
+		* @param p_path
+		*/
+		static bool Save(const tinyxml2::XMLDocument& p_document, const std::filesystem::path& p_path);
+
+		/**
+		* Decode the given binary scene file into the given document (Which is cleared first).
+		* The asset paths referenced by the scene are appended to p_assetReferences if provided.
+		* Returns false if the file is missing, corrupted or incompatible. Doesn't log, so it can be called from any thread
+		* @param p_path
+		* @param p_document
+		* @param p_assetReferences (Optional)
+		*/
+		static bool Load(
+			const std::filesystem::path& p_path,
+			tinyxml2::XMLDocument& p_document,
+			std::vector<std::string>* p_assetReferences = nullptr
+		);
+
+		/**
+		* Replace the given XML scene file by its binary encoding
+		* @param p_path
+		*/
+		static bool ConvertToBinary(const std::filesystem::path& p_path);
+	};
+}
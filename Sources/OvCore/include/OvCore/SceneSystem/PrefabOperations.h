@@ -47,6 +47,8 @@ namespace OvCore::SceneSystem
 
 		/**
 		* Instantiate a prefab file using the provided actor factory.
+		* The parsed file is cached, so the following instantiations don't read and parse it again until it changes.
+		* The file is checked for modifications at most once between two RevalidateCache calls.
 		* @param p_prefabPath
 		* @param p_createActor
 		*/
@@ -54,5 +56,21 @@ namespace OvCore::SceneSystem
 			const std::filesystem::path& p_prefabPath,
 			const std::function<OvCore::ECS::Actor&(void)>& p_createActor
 		);
+
+		/**
+		* Discard the cached data of the given prefab file, so that its next instantiation reads it again
+		* @param p_prefabPath
+		*/
+		static void InvalidateCache(const std::filesystem::path& p_prefabPath);
+
+		/**
+		* Check the cached prefab files for modifications again on their next instantiation (Called once per frame)
+		*/
+		static void RevalidateCache();
+
+		/**
+		* Discard the cached data of every prefab file
+		*/
+		static void ClearCache();
 	};
 }
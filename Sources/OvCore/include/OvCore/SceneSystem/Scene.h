@@ -9,6 +9,8 @@
 #include <filesystem>
 #include <functional>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include <OvCore/API/ISerializable.h>
@@ -20,6 +22,16 @@
 #include <OvCore/ECS/Components/CReflectionProbe.h>
 #include <OvTools/Utils/OptRef.h>
 
+namespace tinyxml2
+{
+	class XMLElement;
+}
+
+namespace OvCore::ResourceManagement
+{
+	struct ResourceUsage;
+}
+
 namespace OvCore::SceneSystem
 {
 	/**
@@ -137,6 +149,26 @@ namespace OvCore::SceneSystem
 		*/
 		ECS::Actor* InstantiatePrefab(const std::string& p_prefabPath, ECS::Actor& p_parent);
 
+		/**
+		* Deactivate the given prefab instance and keep it in the pool of its prefab instead of destroying it.
+		* The next instantiation of that prefab reuses it, skipping the prefab deserialization. A reused instance is
+		* reactivated and reparented, but keeps the rest of its state (e.g. transform), which scripts can reset in OnEnable.
+		* Returns false if the given actor isn't the root of a prefab instance
+		* @param p_actor
+		*/
+		bool ReleaseToPool(ECS::Actor& p_actor);
+
+		/**
+		* Destroy every actor kept by ReleaseToPool
+		*/
+		void ClearPools();
+
+		/**
+		* Return the number of instances of the given prefab kept by ReleaseToPool
+		* @param p_prefabPath
+		*/
+		size_t GetPooledInstanceCount(const std::string& p_prefabPath) const;
+
 		/**
 		* Destroy and actor and return true on success
 		* @param p_target (The actor to remove from the scene)
@@ -211,6 +243,13 @@ namespace OvCore::SceneSystem
 		*/
 		const FastAccessComponents& GetFastAccessComponents() const;
 
+		/**
+		* Add the resources referenced by the components of the scene (Models, materials and their textures/shaders, sounds)
+		* to the given resource usage
+		* @param p_usage
+		*/
+		void CollectResourceUsage(ResourceManagement::ResourceUsage& p_usage) const;
+
 		/**
 		* Serialize the scene
 		* @param p_doc
@@ -225,17 +264,44 @@ namespace OvCore::SceneSystem
 		*/
 		virtual void OnDeserialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_root) override;
 
+		/**
+		* Create an actor from the given serialized actor node. Its parent isn't attached until LinkDeserializedActors is called,
+		* which allows a scene to be deserialized a few actors at a time
+		* @param p_doc
+		* @param p_actorNode
+		*/
+		ECS::Actor& DeserializeActor(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLElement* p_actorNode);
+
+		/**
+		* Attach the deserialized actors to their parents and make sure new actors won't reuse their IDs
+		*/
+		void LinkDeserializedActors();
+
+		/**
+		* Add the actors of the given serialized scene next to the actors of this scene and return them.
+		* They get new IDs, so that they don't collide with the existing ones, and are attached to their parents accordingly.
+		* Their GUIDs are kept, which keeps references made by GUID (e.g. from scripts) valid across scenes.
+		* If the scene is playing, the new actors start once they are all created
+		* @param p_doc
+		* @param p_root
+		*/
+		std::vector<ECS::Actor*> DeserializeAdditive(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_root);
+
 	private:
 		std::filesystem::path GetRealAssetPath(const std::string& p_path) const;
 		void BeginBatchActorCreation();
 		void EndBatchActorCreation(bool p_startCreatedActors);
 		ECS::Actor* InstantiatePrefabInternal(const std::string& p_prefabPath, OvTools::Utils::OptRef<ECS::Actor> p_parent);
+		bool IsPooled(const ECS::Actor& p_actor) const;
+		void RemoveFromPool(ECS::Actor& p_actor);
 
 		int64_t m_availableID = 1;
 		bool m_isPlaying = false;
 		bool m_batchActorCreation = false;
 		std::vector<ECS::Actor*> m_actors;
 		std::vector<std::reference_wrapper<ECS::Actor>> m_batchCreatedActors;
+		std::unordered_map<std::string, std::vector<ECS::Actor*>> m_prefabPools;
+		std::unordered_set<const ECS::Actor*> m_pooledActors;
 
 		FastAccessComponents m_fastAccessComponents;
 		std::filesystem::path m_projectAssetsPath;
@@ -6,11 +6,20 @@
 
 #pragma once
 
+#include <chrono>
+#include <filesystem>
 #include <functional>
+#include <future>
 #include <memory>
+#include <optional>
 #include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <OvTools/Utils/ThreadPool.h>
 
 #include "OvCore/SceneSystem/Scene.h"
+#include "OvCore/SceneSystem/SceneStreamer.h"
 
 namespace OvCore::SceneSystem
 {
@@ -20,6 +29,16 @@ namespace OvCore::SceneSystem
 	class SceneManager
 	{
 	public:
+		/**
+		* Default delay (In seconds) after a scene change at which the unused resources are unloaded, in builds
+		*/
+		static constexpr float kDefaultResourceReleaseDelay = 10.0f;
+
+		/**
+		* Default time (In milliseconds) spent each frame creating the actors of a scene loaded with LoadSceneAsync
+		*/
+		static constexpr float kDefaultSceneActivationBudget = 4.0f;
+
 
 		/**
 		* Default constructor
@@ -71,6 +90,87 @@ namespace OvCore::SceneSystem
 		*/
 		bool LoadSceneFromMemory(tinyxml2::XMLDocument& p_doc);
 
+		/**
+		* Load a scene in the background while the current scene keeps running. The file is read and parsed on a worker thread,
+		* then the resources it references are requested and its actors are created on the main thread, within the activation
+		* budget of each frame. The new scene replaces the current one once all of its actors are created.
+		* Starting a new load (Synchronous or not) cancels the pending one. SceneLoadAsyncCompletedEvent is invoked when the load ends
+		* @param p_path
+		* @param p_play (If true, the scene starts playing once loaded)
+		* @param p_absolute
+		*/
+		void LoadSceneAsync(const std::string& p_path, bool p_play = true, bool p_absolute = false);
+
+		/**
+		* Cancel the pending LoadSceneAsync call, if any. The current scene is kept
+		*/
+		void CancelSceneLoadAsync();
+
+		/**
+		* Return true if a scene is being loaded with LoadSceneAsync
+		*/
+		bool IsLoadingSceneAsync() const;
+
+		/**
+		* Return the progress of the pending LoadSceneAsync call, between 0 (Parsing the file) and 1 (All actors created)
+		*/
+		float GetSceneLoadProgress() const;
+
+		/**
+		* Defines the time (In milliseconds) spent each frame creating the actors of a scene loaded with LoadSceneAsync.
+		* At least one actor is created per frame
+		* @param p_budget
+		*/
+		void SetSceneActivationBudget(float p_budget);
+
+		/**
+		* Returns the time (In milliseconds) spent each frame creating the actors of a scene loaded with LoadSceneAsync
+		*/
+		float GetSceneActivationBudget() const;
+
+		/**
+		* Provide the thread pool used to parse the scenes loaded with LoadSceneAsync (nullptr uses a dedicated thread)
+		* @param p_threadPool
+		*/
+		void ProvideThreadPool(OvTools::Utils::ThreadPool* p_threadPool);
+
+		/**
+		* Load the actors of the given scene file into the current scene, next to its own actors (See Scene::DeserializeAdditive).
+		* A scene can't be loaded additively twice, and additive scenes are forgotten when the current scene is replaced
+		* @param p_path
+		* @param p_absolute
+		*/
+		bool LoadSceneAdditive(const std::string& p_path, bool p_absolute = false);
+
+		/**
+		* Destroy the actors created by loading the given scene additively (Except the ones already destroyed).
+		* Returns false if the scene isn't loaded additively
+		* @param p_path
+		* @param p_absolute
+		*/
+		bool UnloadSceneAdditive(const std::string& p_path, bool p_absolute = false);
+
+		/**
+		* Return true if the given scene is loaded additively in the current scene
+		* @param p_path
+		* @param p_absolute
+		*/
+		bool IsSceneLoadedAdditive(const std::string& p_path, bool p_absolute = false) const;
+
+		/**
+		* Return the streamer deciding which scenes are loaded additively from their distance to the streaming anchor.
+		* Its requests are applied by Update while it has chunks. Its chunks are removed when the current scene is replaced
+		* @note Chunk paths are relative to the scene root folder, as with LoadSceneAdditive
+		*/
+		SceneStreamer& GetStreamer();
+
+		/**
+		* Defines the position the streamed chunks distances are measured from.
+		* Until an anchor is set, the main camera of the current scene is used
+		* @param p_anchor
+		*/
+		void SetStreamingAnchor(const std::optional<OvMaths::FVector3>& p_anchor);
+
 		/**
 		* Destroy current scene from memory
 		*/
@@ -107,11 +207,67 @@ namespace OvCore::SceneSystem
 		*/
 		void ForgetCurrentSceneSourcePath();
 
+		/**
+		* Defines the delay (In seconds) after a scene change at which the resources loaded before the change and not used
+		* by the new scene are unloaded. A negative delay disables the unloading (Default)
+		* @param p_delay
+		*/
+		void SetResourceReleaseDelay(float p_delay);
+
+		/**
+		* Returns the delay (In seconds) after a scene change at which the unused resources are unloaded (Negative if disabled)
+		*/
+		float GetResourceReleaseDelay() const;
+
+		/**
+		* Unload the resources registered before the given time that aren't used by the current scene (Or by the scene being
+		* loaded asynchronously), from every resource manager, and log their memory report. Resources only referenced outside of the scene components (e.g. by a script
+		* variable) must be loaded again after this call
+		* @param p_registeredBefore
+		*/
+		void ReleaseUnusedResources(std::chrono::steady_clock::time_point p_registeredBefore);
+
 	public:
 		OvTools::Eventing::Event<> SceneLoadEvent;
 		OvTools::Eventing::Event<> SceneUnloadEvent;
 		OvTools::Eventing::Event<const std::string&> CurrentSceneSourcePathChangedEvent;
 
+		/**
+		* Invoked when a LoadSceneAsync call ends, with false if the scene failed to load or the load got cancelled
+		*/
+		OvTools::Eventing::Event<bool> SceneLoadAsyncCompletedEvent;
+
+	private:
+		/**
+		* Scene file read and parsed by a worker thread
+		*/
+		struct ParsedScene
+		{
+			std::unique_ptr<tinyxml2::XMLDocument> document;
+			std::vector<std::string> assetReferences;
+			bool succeeded = false;
+		};
+
+		/**
+		* State of a LoadSceneAsync call
+		*/
+		struct PendingSceneLoad
+		{
+			std::string path;
+			bool play = true;
+			std::future<ParsedScene> parsing;
+			ParsedScene parsed;
+			std::unique_ptr<Scene> scene;
+			tinyxml2::XMLElement* nextActor = nullptr;
+			uint32_t actorCount = 0;
+			uint32_t createdActorCount = 0;
+		};
+
+		std::filesystem::path GetScenePath(const std::string& p_path, bool p_absolute) const;
+		void UpdateSceneLoadAsync();
+		void CompleteSceneLoadAsync();
+		void UpdateStreaming();
+
 	private:
 		const std::string m_sceneRootFolder;
 		const std::string m_engineAssetsFolder;
@@ -121,5 +277,17 @@ namespace OvCore::SceneSystem
 		std::string m_currentSceneSourcePath = "";
 
 		std::function<void()> m_delayedLoadCall;
+
+		float m_resourceReleaseDelay = -1.0f;
+		std::optional<std::chrono::steady_clock::time_point> m_sceneChangeTime;
+
+		std::unique_ptr<PendingSceneLoad> m_pendingSceneLoad;
+		float m_sceneActivationBudget = kDefaultSceneActivationBudget;
+		OvTools::Utils::ThreadPool* m_threadPool = nullptr;
+
+		// Actors created by each additive scene, by ID, as gameplay can destroy some of them before the scene is unloaded
+		std::unordered_map<std::string, std::vector<int64_t>> m_additiveScenes;
+		SceneStreamer m_streamer;
+		std::optional<OvMaths::FVector3> m_streamingAnchor;
 	};
 }
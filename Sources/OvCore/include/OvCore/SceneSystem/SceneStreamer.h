@@ -0,0 +1,119 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <OvMaths/FVector3.h>
+
+namespace OvCore::SceneSystem
+{
+	/**
+	* Decides which sub-scenes (Chunks) should be loaded next to the persistent scene, from their distance to a streaming
+	* anchor (Usually the camera or the player). A chunk is requested when the anchor gets within its load distance, and
+	* released once the anchor is further than its unload distance, which avoids reloading chunks on their border.
+	* Only computes requests, applying them is left to the caller (See SceneManager), so it can run without any scene
+	*/
+	class SceneStreamer
+	{
+	public:
+		/**
+		* Default number of chunk loads requested by a single update
+		*/
+		static constexpr uint32_t kDefaultMaxLoadsPerUpdate = 1;
+
+		/**
+		* Sub-scene streamed around its center
+		*/
+		struct Chunk
+		{
+			OvMaths::FVector3 center;
+			float loadDistance = 0.0f;
+			float unloadDistance = 0.0f; // Clamped to be at least the load distance
+		};
+
+		/**
+		* Chunk loads and unloads to apply, the closest chunks are loaded first
+		*/
+		struct Requests
+		{
+			std::vector<std::string> toLoad;
+			std::vector<std::string> toUnload;
+		};
+
+		/**
+		* Register a chunk, or update it if the given scene is already registered (A chunk that failed to load is requested again)
+		* @param p_scenePath
+		* @param p_chunk
+		*/
+		void AddChunk(const std::string& p_scenePath, const Chunk& p_chunk);
+
+		/**
+		* Stop streaming the given chunk. Returns true if it was loaded, in which case unloading it is up to the caller
+		* @param p_scenePath
+		*/
+		bool RemoveChunk(const std::string& p_scenePath);
+
+		/**
+		* Remove every chunk (Their loaded state is forgotten, nothing gets unloaded)
+		*/
+		void Clear();
+
+		/**
+		* Returns true if at least one chunk is registered
+		*/
+		bool HasChunks() const;
+
+		/**
+		* Returns true if the given chunk has been loaded (See SetChunkLoadResult), and not requested to unload since
+		* @param p_scenePath
+		*/
+		bool IsChunkLoaded(const std::string& p_scenePath) const;
+
+		/**
+		* Report the result of a requested chunk load. A chunk that failed to load isn't requested again until
+		* the anchor gets further than its unload distance, so a missing scene doesn't get loaded every update
+		* @param p_scenePath
+		* @param p_loaded
+		*/
+		void SetChunkLoadResult(const std::string& p_scenePath, bool p_loaded);
+
+		/**
+		* Defines the maximum number of chunk loads requested by a single update, so that loads are spread over frames
+		* (0 = unlimited). Unloads aren't limited
+		* @param p_maxLoadsPerUpdate
+		*/
+		void SetMaxLoadsPerUpdate(uint32_t p_maxLoadsPerUpdate);
+
+		/**
+		* Returns the maximum number of chunk loads requested by a single update (0 = unlimited)
+		*/
+		uint32_t GetMaxLoadsPerUpdate() const;
+
+		/**
+		* Compare the chunks to the given anchor position and return the loads and unloads to apply.
+		* The returned unloads are considered applied from now on, while loads must be reported with SetChunkLoadResult
+		* (Until then, the chunk is requested again by the next updates)
+		* @param p_anchor
+		*/
+		Requests Update(const OvMaths::FVector3& p_anchor);
+
+	private:
+		struct ChunkState
+		{
+			Chunk chunk;
+			bool loaded = false;
+			bool failed = false;
+		};
+
+	private:
+		std::unordered_map<std::string, ChunkState> m_chunks;
+		uint32_t m_maxLoadsPerUpdate = kDefaultMaxLoadsPerUpdate;
+	};
+}
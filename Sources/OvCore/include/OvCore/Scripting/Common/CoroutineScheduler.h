@@ -0,0 +1,156 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+
+namespace OvCore::Scripting
+{
+	/**
+	* Decides when suspended script tasks (Coroutines) should be resumed. Tasks waiting for a delay or a number of frames
+	* are kept in time-ordered heaps, so dormant tasks cost nothing per frame, only conditions are polled every frame.
+	* The scheduler has its own clock, advanced by the given delta times, which makes it deterministic.
+	* It doesn't resume anything itself, resuming the returned tasks (And making them wait again) is up to the caller
+	*/
+	class CoroutineScheduler
+	{
+	public:
+		using TaskID = uint64_t;
+
+		/**
+		* Register a new task, which doesn't wait for anything until one of the Wait methods is called
+		* @param p_owner (Optional, allows to remove every task of an owner at once)
+		*/
+		TaskID AddTask(const void* p_owner = nullptr);
+
+		/**
+		* Remove the given task. Returns false if it doesn't exist
+		* @param p_task
+		*/
+		bool RemoveTask(TaskID p_task);
+
+		/**
+		* Remove every task of the given owner and return them
+		* @param p_owner
+		*/
+		std::vector<TaskID> RemoveTasks(const void* p_owner);
+
+		/**
+		* Remove every task. The clock isn't reset
+		*/
+		void Clear();
+
+		/**
+		* Returns true if the given task exists
+		* @param p_task
+		*/
+		bool HasTask(TaskID p_task) const;
+
+		/**
+		* Returns the owner of the given task (nullptr if it has none or doesn't exist)
+		* @param p_task
+		*/
+		const void* GetOwner(TaskID p_task) const;
+
+		/**
+		* Returns the number of tasks
+		*/
+		size_t GetTaskCount() const;
+
+		/**
+		* Resume the given task once the clock has advanced by the given duration
+		* @param p_task
+		* @param p_seconds
+		*/
+		void WaitForSeconds(TaskID p_task, double p_seconds);
+
+		/**
+		* Resume the given task after the given number of updates (At least 1)
+		* @param p_task
+		* @param p_frames
+		*/
+		void WaitForFrames(TaskID p_task, uint32_t p_frames);
+
+		/**
+		* Resume the given task on the next fixed update
+		* @param p_task
+		*/
+		void WaitForFixedUpdate(TaskID p_task);
+
+		/**
+		* Resume the given task on the first update where the given condition returns true
+		* @param p_task
+		* @param p_condition
+		*/
+		void WaitUntil(TaskID p_task, std::function<bool()> p_condition);
+
+		/**
+		* Advance the clock and return the tasks to resume, which stop waiting.
+		* Expired delays come first (Earliest first), then elapsed frames, then fulfilled conditions.
+		* Tasks that started waiting at the same time are returned in the order they started waiting.
+		* Resuming a task can remove others, so each task should be checked with HasTask before being resumed
+		* @param p_deltaTime
+		*/
+		std::vector<TaskID> Update(double p_deltaTime);
+
+		/**
+		* Return the tasks waiting for a fixed update, which stop waiting
+		*/
+		std::vector<TaskID> FixedUpdate();
+
+		/**
+		* Returns the time accumulated by the updates
+		*/
+		double GetTime() const;
+
+		/**
+		* Returns the number of updates
+		*/
+		uint64_t GetFrame() const;
+
+	private:
+		struct Task
+		{
+			const void* owner = nullptr;
+			uint64_t waitSequence = 0; // Identifies the current wait, older heap entries are ignored
+			std::function<bool()> condition;
+		};
+
+		template<typename T>
+		struct Wakeup
+		{
+			T wakeAt;
+			uint64_t sequence;
+			TaskID task;
+
+			bool operator>(const Wakeup& p_other) const
+			{
+				return wakeAt != p_other.wakeAt ? wakeAt > p_other.wakeAt : sequence > p_other.sequence;
+			}
+		};
+
+		template<typename T>
+		using WakeupHeap = std::priority_queue<Wakeup<T>, std::vector<Wakeup<T>>, std::greater<Wakeup<T>>>;
+
+		Task* BeginWait(TaskID p_task);
+
+	private:
+		std::unordered_map<TaskID, Task> m_tasks;
+		WakeupHeap<double> m_timers;
+		WakeupHeap<uint64_t> m_frameWaits;
+		std::vector<std::pair<uint64_t, TaskID>> m_fixedUpdateWaits;
+		std::vector<std::pair<uint64_t, TaskID>> m_conditionWaits;
+		TaskID m_nextTaskID = 1;
+		uint64_t m_nextSequence = 1;
+		double m_time = 0.0;
+		uint64_t m_frame = 0;
+	};
+}
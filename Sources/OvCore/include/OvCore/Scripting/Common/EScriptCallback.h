@@ -0,0 +1,35 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+
+namespace OvCore::Scripting
+{
+	/**
+	* Callbacks a script can implement
+	*/
+	enum class EScriptCallback : uint8_t
+	{
+		ON_AWAKE,
+		ON_START,
+		ON_ENABLE,
+		ON_DISABLE,
+		ON_DESTROY,
+		ON_UPDATE,
+		ON_FIXED_UPDATE,
+		ON_LATE_UPDATE,
+		ON_COLLISION_ENTER,
+		ON_COLLISION_STAY,
+		ON_COLLISION_EXIT,
+		ON_TRIGGER_ENTER,
+		ON_TRIGGER_STAY,
+		ON_TRIGGER_EXIT,
+		ON_SCENE_LOADED,
+		COUNT
+	};
+}
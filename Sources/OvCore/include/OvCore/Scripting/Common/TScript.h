@@ -10,6 +10,7 @@
 #include <optional>
 #include <string>
 
+#include <OvCore/Scripting/Common/EScriptCallback.h>
 #include <OvCore/Scripting/Common/EScriptingLanguage.h>
 #include <OvCore/Scripting/Common/ScriptPropertyValue.h>
 
@@ -40,6 +41,13 @@ namespace OvCore::Scripting
 		*/
 		bool IsValid() const;
 
+		/**
+		* Checks if the script implements the given callback.
+		* Callbacks are resolved once, when the script is created, so callers can skip scripts that don't implement them.
+		* @param p_callback
+		*/
+		bool HasCallback(EScriptCallback p_callback) const;
+
 		/**
 		* Return the context of the script
 		*/
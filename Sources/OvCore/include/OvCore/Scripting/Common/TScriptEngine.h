@@ -67,6 +67,13 @@ namespace OvCore::Scripting
 		*/
 		std::string GetDefaultExtension();
 
+		/**
+		* Precompiles the given script next to it, so that builds can skip its parsing.
+		* @param p_scriptPath
+		* @return True if the script has been precompiled, false on failure or if the language doesn't support it.
+		*/
+		bool CompileScript(const std::filesystem::path& p_scriptPath);
+
 		/**
 		* Adds a behaviour to the scripting engine.
 		* @param p_toAdd The behaviour to add.
@@ -84,6 +91,19 @@ namespace OvCore::Scripting
 		*/
 		void Reload();
 
+		/**
+		* Resumes the coroutines waiting for a delay, a number of frames or a condition.
+		* Should be called once per frame, after the behaviours update.
+		* @param p_deltaTime The time elapsed since the last frame.
+		*/
+		void UpdateCoroutines(float p_deltaTime);
+
+		/**
+		* Resumes the coroutines waiting for a fixed update.
+		* Should be called after every physics frame.
+		*/
+		void FixedUpdateCoroutines();
+
 		/**
 		* Checks if the scripting engine is in a good state.
 		* @return True if the engine is okay, false otherwise.
@@ -183,6 +203,13 @@ namespace OvCore::Scripting
 		*/
 		void OnTriggerExit(OvCore::ECS::Components::Behaviour& p_target, OvCore::ECS::Components::CPhysicalObject& p_otherObject);
 
+		/**
+		* Called when the scene of a behaviour has been loaded asynchronously, once it started playing.
+		* @param p_target The target behaviour.
+		* @param p_sceneName The name of the loaded scene (Its file name, without extension).
+		*/
+		void OnSceneLoaded(OvCore::ECS::Components::Behaviour& p_target, const std::string& p_sceneName);
+
 	protected:
 		Context m_context;
 	};
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 
 #include <OvCore/Scripting/Common/TScript.h>
@@ -26,6 +27,10 @@ namespace sol
 	template <bool b>
 	using table_core = basic_table_core<b, reference>;
 	using table = table_core<false>;
+
+	template <typename, bool, typename>
+	class basic_protected_function;
+	using protected_function = basic_protected_function<reference, false, reference>;
 }
 
 namespace OvCore::Scripting
@@ -36,6 +41,8 @@ namespace OvCore::Scripting
 	struct LuaScriptContext
 	{
 		std::unique_ptr<sol::table> table;
+		std::array<std::unique_ptr<sol::protected_function>, static_cast<size_t>(EScriptCallback::COUNT)> callbacks;
+		uint32_t callbackMask = 0;
 	};
 
 	using LuaScriptBase = TScript<EScriptingLanguage::LUA, LuaScriptContext>;
@@ -47,7 +54,7 @@ namespace OvCore::Scripting
 	{
 	public:
 		/**
-		* Constructor of the Lua script
+		* Constructor of the Lua script, resolves the callbacks implemented by the given table
 		* @param p_table
 		*/
 		LuaScript(sol::table p_table);
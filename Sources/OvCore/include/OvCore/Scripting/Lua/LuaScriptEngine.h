@@ -10,6 +10,7 @@
 #include <memory>
 #include <vector>
 
+#include <OvCore/Scripting/Common/CoroutineScheduler.h>
 #include <OvCore/Scripting/Common/TScriptEngine.h>
 
 namespace OvCore::ECS::Components
@@ -34,6 +35,9 @@ namespace OvCore::Scripting
 		std::filesystem::path engineAssetsPath;
 		std::vector<std::reference_wrapper<OvCore::ECS::Components::Behaviour>> behaviours;
 		uint32_t errorCount;
+		CoroutineScheduler coroutineScheduler;
+		std::vector<CoroutineScheduler::TaskID> runningCoroutines; // Coroutines being resumed, innermost last
+		const OvCore::ECS::Components::Behaviour* runningBehaviour = nullptr; // Owner of the coroutines started now
 	};
 
 	using LuaScriptEngineBase = TScriptEngine<EScriptingLanguage::LUA, LuaScriptEngineContext>;
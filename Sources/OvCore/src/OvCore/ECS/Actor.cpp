@@ -19,6 +19,8 @@
 #include <OvCore/ECS/Components/CModelRenderer.h>
 #include <OvCore/ECS/Components/CPhysicalBox.h>
 #include <OvCore/ECS/Components/CPhysicalCapsule.h>
+#include <OvCore/ECS/Components/CPhysicalConvex.h>
+#include <OvCore/ECS/Components/CPhysicalMesh.h>
 #include <OvCore/ECS/Components/CPhysicalSphere.h>
 #include <OvCore/ECS/Components/CPointLight.h>
 #include <OvCore/ECS/Components/CPostProcessStack.h>
@@ -326,7 +328,11 @@ void OvCore::ECS::Actor::OnUpdate(float p_deltaTime)
 	if (IsActive())
 	{
 		std::for_each(m_components.begin(), m_components.end(), [&](auto element) { element->OnUpdate(p_deltaTime); });
-		std::for_each(m_behaviours.begin(), m_behaviours.end(), [&](auto & element) { element.second.OnUpdate(p_deltaTime); });
+		std::for_each(m_behaviours.begin(), m_behaviours.end(), [&](auto & element)
+		{
+			if (element.second.HasScriptCallback(Scripting::EScriptCallback::ON_UPDATE))
+				element.second.OnUpdate(p_deltaTime);
+		});
 	}
 }
 
@@ -335,7 +341,11 @@ void OvCore::ECS::Actor::OnFixedUpdate(float p_deltaTime)
 	if (IsActive())
 	{
 		std::for_each(m_components.begin(), m_components.end(), [&](auto element) { element->OnFixedUpdate(p_deltaTime); });
-		std::for_each(m_behaviours.begin(), m_behaviours.end(), [&](auto & element) { element.second.OnFixedUpdate(p_deltaTime); });
+		std::for_each(m_behaviours.begin(), m_behaviours.end(), [&](auto & element)
+		{
+			if (element.second.HasScriptCallback(Scripting::EScriptCallback::ON_FIXED_UPDATE))
+				element.second.OnFixedUpdate(p_deltaTime);
+		});
 	}
 }
 
@@ -344,7 +354,11 @@ void OvCore::ECS::Actor::OnLateUpdate(float p_deltaTime)
 	if (IsActive())
 	{
 		std::for_each(m_components.begin(), m_components.end(), [&](auto element) { element->OnLateUpdate(p_deltaTime); });
-		std::for_each(m_behaviours.begin(), m_behaviours.end(), [&](auto & element) { element.second.OnLateUpdate(p_deltaTime); });
+		std::for_each(m_behaviours.begin(), m_behaviours.end(), [&](auto & element)
+		{
+			if (element.second.HasScriptCallback(Scripting::EScriptCallback::ON_LATE_UPDATE))
+				element.second.OnLateUpdate(p_deltaTime);
+		});
 	}
 }
 
@@ -384,6 +398,18 @@ void OvCore::ECS::Actor::OnTriggerExit(Components::CPhysicalObject& p_otherObjec
 	std::for_each(m_behaviours.begin(), m_behaviours.end(), [&](auto & element) { element.second.OnTriggerExit(p_otherObject); });
 }
 
+void OvCore::ECS::Actor::OnSceneLoaded(const std::string& p_sceneName)
+{
+	if (IsActive())
+	{
+		std::for_each(m_behaviours.begin(), m_behaviours.end(), [&](auto & element)
+		{
+			if (element.second.HasScriptCallback(Scripting::EScriptCallback::ON_SCENE_LOADED))
+				element.second.OnSceneLoaded(p_sceneName);
+		});
+	}
+}
+
 bool OvCore::ECS::Actor::RemoveComponent(OvCore::ECS::Components::AComponent& p_component)
 {
 	for (auto it = m_components.begin(); it != m_components.end(); ++it)
@@ -593,6 +619,8 @@ void OvCore::ECS::Actor::OnDeserialize(tinyxml2::XMLDocument & p_doc, tinyxml2::
 				else if (IsType<CPhysicalBox>(componentType)) component = &AddComponent<CPhysicalBox>();
 				else if (IsType<CPhysicalSphere>(componentType)) component = &AddComponent<CPhysicalSphere>();
 				else if (IsType<CPhysicalCapsule>(componentType)) component = &AddComponent<CPhysicalCapsule>();
+				else if (IsType<CPhysicalMesh>(componentType)) component = &AddComponent<CPhysicalMesh>();
+				else if (IsType<CPhysicalConvex>(componentType)) component = &AddComponent<CPhysicalConvex>();
 				else if (IsType<CModelRenderer>(componentType)) component = &AddComponent<CModelRenderer>();
 				else if (IsType<CCamera>(componentType)) component = &AddComponent<CCamera>();
 				else if (IsType<CMaterialRenderer>(componentType)) component = &AddComponent<CMaterialRenderer>();
@@ -105,6 +105,11 @@ void OvCore::ECS::Components::Behaviour::RemoveScript()
 	m_script.reset();
 }
 
+bool OvCore::ECS::Components::Behaviour::HasScriptCallback(Scripting::EScriptCallback p_callback) const
+{
+	return m_script && m_script->HasCallback(p_callback);
+}
+
 void OvCore::ECS::Components::Behaviour::OnAwake()
 {
 	OVSERVICE(Scripting::ScriptEngine).OnAwake(*this);
@@ -175,6 +180,11 @@ void OvCore::ECS::Components::Behaviour::OnTriggerExit(Components::CPhysicalObje
 	OVSERVICE(Scripting::ScriptEngine).OnTriggerExit(*this, p_otherObject);
 }
 
+void OvCore::ECS::Components::Behaviour::OnSceneLoaded(const std::string& p_sceneName)
+{
+	OVSERVICE(Scripting::ScriptEngine).OnSceneLoaded(*this, p_sceneName);
+}
+
 void OvCore::ECS::Components::Behaviour::OnSerialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_node)
 {
 	if (m_unlockedProperties.empty()) return;
@@ -4,6 +4,8 @@
 * @licence: MIT
 */
 
+#include <algorithm>
+
 #include <OvAudio/Core/AudioEngine.h>
 
 #include <OvCore/ECS/Components/CAudioSource.h>
@@ -70,6 +72,11 @@ void OvCore::ECS::Components::CAudioSource::SetAttenuationThreshold(float p_dist
 	m_audioSource.SetAttenuationThreshold(p_distance);
 }
 
+void OvCore::ECS::Components::CAudioSource::SetPriority(uint8_t p_priority)
+{
+	m_audioSource.SetPriority(p_priority);
+}
+
 OvAudio::Resources::Sound* OvCore::ECS::Components::CAudioSource::GetSound() const
 {
 	return m_sound;
@@ -115,6 +122,16 @@ float OvCore::ECS::Components::CAudioSource::GetAttenuationThreshold() const
 	return m_audioSource.GetAttenuationThreshold();
 }
 
+uint8_t OvCore::ECS::Components::CAudioSource::GetPriority() const
+{
+	return m_audioSource.GetPriority();
+}
+
+bool OvCore::ECS::Components::CAudioSource::IsVirtual() const
+{
+	return m_audioSource.IsVirtual();
+}
+
 void OvCore::ECS::Components::CAudioSource::Play()
 {
 	if (owner.IsActive() && m_sound)
@@ -150,6 +167,7 @@ void OvCore::ECS::Components::CAudioSource::OnSerialize(tinyxml2::XMLDocument& p
 	Serializer::SerializeBoolean(p_doc, p_node, "looped", IsLooped());
 	Serializer::SerializeFloat(p_doc, p_node, "pitch", GetPitch());
 	Serializer::SerializeFloat(p_doc, p_node, "attenuation_threshold", GetAttenuationThreshold());
+	Serializer::SerializeInt(p_doc, p_node, "priority", GetPriority());
 	Serializer::SerializeSound(p_doc, p_node, "audio_clip", m_sound);
 }
 
@@ -164,6 +182,10 @@ void OvCore::ECS::Components::CAudioSource::OnDeserialize(tinyxml2::XMLDocument&
 	SetLooped(Serializer::DeserializeBoolean(p_doc, p_node, "looped"));
 	SetPitch(Serializer::DeserializeFloat(p_doc, p_node, "pitch"));
 	SetAttenuationThreshold(Serializer::DeserializeFloat(p_doc, p_node, "attenuation_threshold"));
+
+	int priority = GetPriority();
+	Serializer::DeserializeInt(p_doc, p_node, "priority", priority);
+	SetPriority(static_cast<uint8_t>(std::clamp(priority, 0, 255)));
 	Serializer::DeserializeSound(p_doc, p_node, "audio_clip", m_sound);
 }
 
@@ -180,6 +202,7 @@ void OvCore::ECS::Components::CAudioSource::OnInspector(OvUI::Internal::WidgetCo
 	GUIDrawer::DrawScalar<float>(p_root, "Pitch", std::bind(&CAudioSource::GetPitch, this), std::bind(&CAudioSource::SetPitch, this, std::placeholders::_1), 0.01f, 0.01f, 10000.0f);
 	GUIDrawer::DrawBoolean(p_root, "Spatial", std::bind(&CAudioSource::IsSpatial, this), std::bind(&CAudioSource::SetSpatial, this, std::placeholders::_1));
 	GUIDrawer::DrawScalar<float>(p_root, "Attenuation threshold", std::bind(&CAudioSource::GetAttenuationThreshold, this), std::bind(&CAudioSource::SetAttenuationThreshold, this, std::placeholders::_1), 0.5f);
+	GUIDrawer::DrawScalar<uint8_t>(p_root, "Priority", std::bind(&CAudioSource::GetPriority, this), std::bind(&CAudioSource::SetPriority, this, std::placeholders::_1), 1.0f, 0, 255);
 
 	GUIDrawer::CreateTitle(p_root, "Spatial graph");
 	auto& graph = p_root.CreateWidget<OvUI::Widgets::Plots::PlotLines>(std::vector<float>(), -0.1f, 1.1f);
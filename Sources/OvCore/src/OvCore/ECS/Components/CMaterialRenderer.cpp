@@ -14,6 +14,7 @@
 #include <OvCore/Global/ServiceLocator.h>
 #include <OvCore/Helpers/GUIDrawer.h>
 #include <OvCore/ResourceManagement/MaterialManager.h>
+#include <OvCore/ResourceManagement/ModelManager.h>
 #include <OvRendering/Resources/Parsers/EmbeddedAssetPath.h>
 
 #include <OvUI/Widgets/InputFields/AssetField.h>
@@ -141,6 +142,13 @@ void OvCore::ECS::Components::CMaterialRenderer::OnSerialize(tinyxml2::XMLDocume
 	p_node->InsertEndChild(materialsNode);
 
 	auto modelRenderer = owner.GetComponent<CModelRenderer>();
+
+	if (modelRenderer->GetModel())
+	{
+		// The material count comes from the model, which must be fully loaded to be known
+		OVSERVICE(OvCore::ResourceManagement::ModelManager).WaitForResource(modelRenderer->GetModel()->path);
+	}
+
 	uint8_t elementsToSerialize = modelRenderer->GetModel() ? (uint8_t)std::min(modelRenderer->GetModel()->GetMaterialNames().size(), (size_t)kMaxMaterialCount) : 0;
 
 	for (uint8_t i = 0; i < elementsToSerialize; ++i)
@@ -0,0 +1,77 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <OvCore/ECS/Actor.h>
+#include <OvCore/ECS/Components/CPhysicalConvex.h>
+#include <OvCore/Global/ServiceLocator.h>
+#include <OvCore/ResourceManagement/ModelManager.h>
+
+#include <OvPhysics/Entities/PhysicalConvex.h>
+
+using namespace OvPhysics::Entities;
+
+OvCore::ECS::Components::CPhysicalConvex::CPhysicalConvex(ECS::Actor & p_owner) :
+	CPhysicalObject(p_owner)
+{
+	m_physicalObject = std::make_unique<OvPhysics::Entities::PhysicalConvex>(p_owner.transform.GetFTransform());
+
+	m_physicalObject->SetUserData<std::reference_wrapper<CPhysicalObject>>(*this);
+
+	BindListener();
+	Init();
+
+	m_modelChangedEvent += std::bind(&CPhysicalConvex::UpdateShape, this);
+}
+
+std::string OvCore::ECS::Components::CPhysicalConvex::GetName()
+{
+	return "Physical Convex";
+}
+
+std::string OvCore::ECS::Components::CPhysicalConvex::GetTypeName()
+{
+	return std::string{ComponentTraits<CPhysicalConvex>::Name};
+}
+
+void OvCore::ECS::Components::CPhysicalConvex::SetModel(OvRendering::Resources::Model* p_model)
+{
+	m_model = p_model;
+	m_modelChangedEvent.Invoke();
+}
+
+OvRendering::Resources::Model* OvCore::ECS::Components::CPhysicalConvex::GetModel() const
+{
+	return m_model;
+}
+
+void OvCore::ECS::Components::CPhysicalConvex::OnSerialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_node)
+{
+	CPhysicalObject::OnSerialize(p_doc, p_node);
+
+	Helpers::Serializer::SerializeModel(p_doc, p_node, "model", m_model);
+}
+
+void OvCore::ECS::Components::CPhysicalConvex::OnDeserialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_node)
+{
+	CPhysicalObject::OnDeserialize(p_doc, p_node);
+
+	OvRendering::Resources::Model* model = nullptr;
+	Helpers::Serializer::DeserializeModel(p_doc, p_node, "model", model);
+	SetModel(model);
+}
+
+void OvCore::ECS::Components::CPhysicalConvex::OnInspector(OvUI::Internal::WidgetContainer & p_root)
+{
+	CPhysicalObject::OnInspector(p_root);
+
+	Helpers::GUIDrawer::DrawMesh(p_root, "Model", m_model, &m_modelChangedEvent);
+}
+
+void OvCore::ECS::Components::CPhysicalConvex::UpdateShape()
+{
+	const auto hull = m_model ? OVSERVICE(OvCore::ResourceManagement::ModelManager).GetCollisionHull(*m_model) : nullptr;
+	GetPhysicalObjectAs<PhysicalConvex>().SetPoints(hull ? std::span(*hull) : std::span<const OvMaths::FVector3>{});
+}
@@ -0,0 +1,78 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <OvCore/ECS/Actor.h>
+#include <OvCore/ECS/Components/CPhysicalMesh.h>
+#include <OvCore/Global/ServiceLocator.h>
+#include <OvCore/ResourceManagement/ModelManager.h>
+
+#include <OvPhysics/Entities/PhysicalMesh.h>
+
+using namespace OvPhysics::Entities;
+
+OvCore::ECS::Components::CPhysicalMesh::CPhysicalMesh(ECS::Actor & p_owner) :
+	CPhysicalObject(p_owner)
+{
+	m_physicalObject = std::make_unique<OvPhysics::Entities::PhysicalMesh>(p_owner.transform.GetFTransform());
+
+	m_physicalObject->SetUserData<std::reference_wrapper<CPhysicalObject>>(*this);
+
+	BindListener();
+	Init();
+
+	m_modelChangedEvent += std::bind(&CPhysicalMesh::UpdateShape, this);
+}
+
+std::string OvCore::ECS::Components::CPhysicalMesh::GetName()
+{
+	return "Physical Mesh";
+}
+
+std::string OvCore::ECS::Components::CPhysicalMesh::GetTypeName()
+{
+	return std::string{ComponentTraits<CPhysicalMesh>::Name};
+}
+
+void OvCore::ECS::Components::CPhysicalMesh::SetModel(OvRendering::Resources::Model* p_model)
+{
+	m_model = p_model;
+	m_modelChangedEvent.Invoke();
+}
+
+OvRendering::Resources::Model* OvCore::ECS::Components::CPhysicalMesh::GetModel() const
+{
+	return m_model;
+}
+
+void OvCore::ECS::Components::CPhysicalMesh::OnSerialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_node)
+{
+	CPhysicalObject::OnSerialize(p_doc, p_node);
+
+	Helpers::Serializer::SerializeModel(p_doc, p_node, "model", m_model);
+}
+
+void OvCore::ECS::Components::CPhysicalMesh::OnDeserialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_node)
+{
+	CPhysicalObject::OnDeserialize(p_doc, p_node);
+
+	OvRendering::Resources::Model* model = nullptr;
+	Helpers::Serializer::DeserializeModel(p_doc, p_node, "model", model);
+	SetModel(model);
+}
+
+void OvCore::ECS::Components::CPhysicalMesh::OnInspector(OvUI::Internal::WidgetContainer & p_root)
+{
+	CPhysicalObject::OnInspector(p_root);
+
+	Helpers::GUIDrawer::DrawMesh(p_root, "Model", m_model, &m_modelChangedEvent);
+}
+
+void OvCore::ECS::Components::CPhysicalMesh::UpdateShape()
+{
+	GetPhysicalObjectAs<PhysicalMesh>().SetMesh(
+		m_model ? OVSERVICE(OvCore::ResourceManagement::ModelManager).GetCollisionMesh(*m_model) : nullptr
+	);
+}
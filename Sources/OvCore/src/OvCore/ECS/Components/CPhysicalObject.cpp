@@ -8,9 +8,11 @@
 
 #include <OvCore/ECS/Actor.h>
 #include <OvCore/ECS/Components/CPhysicalObject.h>
+#include <OvCore/Global/ServiceLocator.h>
 
 #include <OvDebug/Logger.h>
 
+#include <OvPhysics/Core/PhysicsEngine.h>
 #include <OvPhysics/Entities/PhysicalObject.h>
 
 #include <OvUI/Widgets/Drags/DragFloat.h>
@@ -96,6 +98,11 @@ OvPhysics::Entities::PhysicalObject::EActivationState OvCore::ECS::Components::C
 	return m_physicalObject->GetActivationState();
 }
 
+uint8_t OvCore::ECS::Components::CPhysicalObject::GetLayer() const
+{
+	return m_physicalObject->GetLayer();
+}
+
 void OvCore::ECS::Components::CPhysicalObject::SetMass(float p_mass)
 {
 	m_physicalObject->SetMass(p_mass);
@@ -146,6 +153,11 @@ void OvCore::ECS::Components::CPhysicalObject::SetActivationState(OvPhysics::Ent
 	m_physicalObject->SetActivationState(p_state);
 }
 
+void OvCore::ECS::Components::CPhysicalObject::SetLayer(uint8_t p_layer)
+{
+	m_physicalObject->SetLayer(p_layer);
+}
+
 void OvCore::ECS::Components::CPhysicalObject::OnSerialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_node)
 {
 	Helpers::Serializer::SerializeBoolean(p_doc, p_node, "is_trigger", IsTrigger());
@@ -156,6 +168,7 @@ void OvCore::ECS::Components::CPhysicalObject::OnSerialize(tinyxml2::XMLDocument
 	Helpers::Serializer::SerializeVec3(p_doc, p_node, "linear_factor", GetLinearFactor());
 	Helpers::Serializer::SerializeVec3(p_doc, p_node, "angular_factor", GetAngularFactor());
 	Helpers::Serializer::SerializeInt(p_doc, p_node, "collision_mode", static_cast<int>(GetCollisionDetectionMode()));
+	Helpers::Serializer::SerializeInt(p_doc, p_node, "layer", static_cast<int>(GetLayer()));
 }
 
 void OvCore::ECS::Components::CPhysicalObject::OnDeserialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_node)
@@ -168,6 +181,10 @@ void OvCore::ECS::Components::CPhysicalObject::OnDeserialize(tinyxml2::XMLDocume
 	SetLinearFactor(Helpers::Serializer::DeserializeVec3(p_doc, p_node, "linear_factor"));
 	SetAngularFactor(Helpers::Serializer::DeserializeVec3(p_doc, p_node, "angular_factor"));
 	SetCollisionDetectionMode(static_cast<OvPhysics::Entities::PhysicalObject::ECollisionDetectionMode>(Helpers::Serializer::DeserializeInt(p_doc, p_node, "collision_mode")));
+
+	int layer = 0;
+	Helpers::Serializer::DeserializeInt(p_doc, p_node, "layer", layer);
+	SetLayer(static_cast<uint8_t>(layer));
 }
 
 void OvCore::ECS::Components::CPhysicalObject::OnInspector(OvUI::Internal::WidgetContainer & p_root)
@@ -179,6 +196,7 @@ void OvCore::ECS::Components::CPhysicalObject::OnInspector(OvUI::Internal::Widge
 	Helpers::GUIDrawer::DrawScalar<float>(p_root, "Friction", std::bind(&CPhysicalObject::GetFriction, this), std::bind(&CPhysicalObject::SetFriction, this, std::placeholders::_1), 0.1f, 0.f, 1.f);
 	Helpers::GUIDrawer::DrawVec3(p_root, "Linear Factor", std::bind(&CPhysicalObject::GetLinearFactor, this), std::bind(&CPhysicalObject::SetLinearFactor, this, std::placeholders::_1), 0.1f, 0.f, 1.f);
 	Helpers::GUIDrawer::DrawVec3(p_root, "Angular Factor", std::bind(&CPhysicalObject::GetAngularFactor, this), std::bind(&CPhysicalObject::SetAngularFactor, this, std::placeholders::_1), 0.1f, 0.f, 1.f);
+	Helpers::GUIDrawer::DrawScalar<uint8_t>(p_root, "Layer", std::bind(&CPhysicalObject::GetLayer, this), std::bind(&CPhysicalObject::SetLayer, this, std::placeholders::_1), 1.f, 0, 31);
 	
 	Helpers::GUIDrawer::CreateTitle(p_root, "Collision Mode");
 	auto& collisionMode = p_root.CreateWidget<OvUI::Widgets::Selection::ComboBox>(static_cast<int>(GetCollisionDetectionMode()));
@@ -193,6 +211,7 @@ void OvCore::ECS::Components::CPhysicalObject::OnInspector(OvUI::Internal::Widge
 void OvCore::ECS::Components::CPhysicalObject::Init()
 {
 	m_physicalObject->SetEnabled(false);
+	OVSERVICE(OvPhysics::Core::PhysicsEngine).AddPhysicalObject(*m_physicalObject);
 }
 
 void OvCore::ECS::Components::CPhysicalObject::BindListener()
@@ -15,6 +15,8 @@
 #include <OvCore/ECS/Actor.h>
 #include <OvCore/ECS/Components/CModelRenderer.h>
 #include <OvCore/ECS/Components/CSkinnedMeshRenderer.h>
+#include <OvCore/Global/ServiceLocator.h>
+#include <OvCore/ResourceManagement/ModelManager.h>
 #include <OvCore/Helpers/GUIDrawer.h>
 #include <OvCore/Helpers/Serializer.h>
 #include <OvDebug/Logger.h>
@@ -836,13 +838,28 @@ void OvCore::ECS::Components::CSkinnedMeshRenderer::SyncWithModel()
 {
 	const auto modelRenderer = owner.GetComponent<CModelRenderer>();
 	const auto model = modelRenderer ? modelRenderer->GetModel() : nullptr;
+	const bool modelChanged = m_model != model;
 
-	if (m_model == model)
+	if (!modelChanged && !m_waitingForModelLoad)
+	{
+		return;
+	}
+
+	auto& modelManager = OVSERVICE(OvCore::ResourceManagement::ModelManager);
+	const auto isLoading = [&modelManager](const OvRendering::Resources::Model* p_model)
+	{
+		return p_model && modelManager.IsResourceLoading(p_model->path);
+	};
+
+	const bool loading = isLoading(model) || isLoading(m_animationSourceModel);
+
+	if (!modelChanged && loading)
 	{
 		return;
 	}
 
 	m_model = model;
+	m_waitingForModelLoad = loading;
 	RebuildRuntimeData();
 }
 
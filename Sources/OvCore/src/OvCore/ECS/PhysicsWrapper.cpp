@@ -4,24 +4,93 @@
 * @licence: MIT
 */
 
+#include <algorithm>
+
 #include "OvCore/ECS/PhysicsWrapper.h"
 
 #include "OvCore/Global/ServiceLocator.h"
 
 #include <OvPhysics/Core/PhysicsEngine.h>
 
+namespace
+{
+	OvCore::ECS::Components::CPhysicalObject* ToComponent(OvPhysics::Entities::PhysicalObject* p_object)
+	{
+		return p_object ? std::addressof(p_object->GetUserData<std::reference_wrapper<OvCore::ECS::Components::CPhysicalObject>>().get()) : nullptr;
+	}
+
+	template<typename TQuery, typename TBatchFunction>
+	void ExecuteBatch(std::span<const TQuery> p_queries, std::span<OvCore::ECS::PhysicsWrapper::QueryHit> p_results, bool p_parallel, TBatchFunction p_batchFunction)
+	{
+		// Scratch buffer reused between calls to avoid per-batch allocations
+		thread_local std::vector<OvPhysics::Entities::QueryHit> physicsHits;
+		physicsHits.resize(p_queries.size());
+
+		(OVSERVICE(OvPhysics::Core::PhysicsEngine).*p_batchFunction)(p_queries, physicsHits, p_parallel);
+
+		for (size_t i = 0; i < p_queries.size(); ++i)
+		{
+			p_results[i] = {
+				ToComponent(physicsHits[i].object),
+				physicsHits[i].point,
+				physicsHits[i].normal,
+				physicsHits[i].distance
+			};
+		}
+	}
+
+	template<typename TQuery, typename TBatchFunction>
+	std::vector<OvCore::ECS::Components::CPhysicalObject*> ExecuteOverlap(const TQuery& p_query, uint32_t p_maxResults, TBatchFunction p_batchFunction)
+	{
+		thread_local std::vector<OvPhysics::Entities::PhysicalObject*> physicsResults;
+		physicsResults.resize(p_maxResults);
+		uint32_t count = 0;
+
+		(OVSERVICE(OvPhysics::Core::PhysicsEngine).*p_batchFunction)({ &p_query, 1 }, physicsResults, { &count, 1 });
+
+		std::vector<OvCore::ECS::Components::CPhysicalObject*> result(count);
+		std::transform(physicsResults.begin(), physicsResults.begin() + count, result.begin(), ToComponent);
+		return result;
+	}
+}
+
 std::optional<OvCore::ECS::PhysicsWrapper::RaycastHit> OvCore::ECS::PhysicsWrapper::Raycast(OvMaths::FVector3 p_origin, OvMaths::FVector3 p_direction, float p_distance)
 {
 	if (auto result = OVSERVICE(OvPhysics::Core::PhysicsEngine).Raycast(p_origin, p_direction, p_distance))
 	{
 		RaycastHit finalResult;
 
-		finalResult.FirstResultObject = std::addressof(result.value().FirstResultObject->GetUserData<std::reference_wrapper<Components::CPhysicalObject>>().get());
+		finalResult.FirstResultObject = ToComponent(result.value().FirstResultObject);
 		for (auto object : result.value().ResultObjects)
-			finalResult.ResultObjects.push_back(std::addressof(object->GetUserData<std::reference_wrapper<Components::CPhysicalObject>>().get()));
+			finalResult.ResultObjects.push_back(ToComponent(object));
 
 		return finalResult;
 	}
 	else
 		return {};
 }
+
+void OvCore::ECS::PhysicsWrapper::RaycastBatch(std::span<const OvPhysics::Entities::RayQuery> p_queries, std::span<QueryHit> p_results, bool p_parallel)
+{
+	ExecuteBatch(p_queries, p_results, p_parallel, &OvPhysics::Core::PhysicsEngine::RaycastBatch);
+}
+
+void OvCore::ECS::PhysicsWrapper::SphereCastBatch(std::span<const OvPhysics::Entities::SphereCastQuery> p_queries, std::span<QueryHit> p_results, bool p_parallel)
+{
+	ExecuteBatch(p_queries, p_results, p_parallel, &OvPhysics::Core::PhysicsEngine::SphereCastBatch);
+}
+
+void OvCore::ECS::PhysicsWrapper::BoxCastBatch(std::span<const OvPhysics::Entities::BoxCastQuery> p_queries, std::span<QueryHit> p_results, bool p_parallel)
+{
+	ExecuteBatch(p_queries, p_results, p_parallel, &OvPhysics::Core::PhysicsEngine::BoxCastBatch);
+}
+
+std::vector<OvCore::ECS::Components::CPhysicalObject*> OvCore::ECS::PhysicsWrapper::OverlapSphere(const OvPhysics::Entities::SphereOverlapQuery& p_query, uint32_t p_maxResults)
+{
+	return ExecuteOverlap(p_query, p_maxResults, &OvPhysics::Core::PhysicsEngine::OverlapSphereBatch);
+}
+
+std::vector<OvCore::ECS::Components::CPhysicalObject*> OvCore::ECS::PhysicsWrapper::OverlapBox(const OvPhysics::Entities::BoxOverlapQuery& p_query, uint32_t p_maxResults)
+{
+	return ExecuteOverlap(p_query, p_maxResults, &OvPhysics::Core::PhysicsEngine::OverlapBoxBatch);
+}
@@ -356,7 +356,7 @@ void OvCore::Helpers::Serializer::DeserializeColor(tinyxml2::XMLDocument & p_doc
 void OvCore::Helpers::Serializer::DeserializeModel(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_node, const std::string & p_name, OvRendering::Resources::Model *& p_out)
 {
 	if (std::string path = DeserializeString(p_doc, p_node, p_name.c_str()); path != "?" && path != "")
-		p_out = OvCore::Global::ServiceLocator::Get<OvCore::ResourceManagement::ModelManager>().GetResource(path);
+		p_out = OvCore::Global::ServiceLocator::Get<OvCore::ResourceManagement::ModelManager>().LoadResourceAsync(path);
 	else
 		p_out = nullptr;
 }
@@ -364,7 +364,7 @@ void OvCore::Helpers::Serializer::DeserializeModel(tinyxml2::XMLDocument & p_doc
 void OvCore::Helpers::Serializer::DeserializeTexture(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_node, const std::string & p_name, OvRendering::Resources::Texture *& p_out)
 {
 	if (std::string path = DeserializeString(p_doc, p_node, p_name.c_str()); path != "?" && path != "")
-		p_out = OvCore::Global::ServiceLocator::Get<OvCore::ResourceManagement::TextureManager>().GetResource(path);
+		p_out = OvCore::Global::ServiceLocator::Get<OvCore::ResourceManagement::TextureManager>().LoadResourceAsync(path);
 	else
 		p_out = nullptr;
 }
@@ -4,6 +4,10 @@
 * @licence: MIT
 */
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numbers>
 #include <ranges>
 #include <string>
 #include <tracy/Tracy.hpp>
@@ -24,6 +28,7 @@
 #include <OvCore/Rendering/SkinningRenderFeature.h>
 #include <OvCore/Rendering/SkinningUtils.h>
 #include <OvCore/ResourceManagement/ShaderManager.h>
+#include <OvCore/ResourceManagement/TextureManager.h>
 #include <OvRendering/Data/Frustum.h>
 #include <OvRendering/Features/LightingRenderFeature.h>
 #include <OvRendering/Resources/Loaders/ShaderLoader.h>
@@ -34,6 +39,98 @@ namespace
 	using namespace OvCore::Rendering;
 	const std::string kSkinningFeatureName{ SkinningUtils::kFeatureName };
 
+	/**
+	* Returns the UV distance covered by a screen pixel on the given drawable, from its distance to the camera
+	* and the texture coordinates density of its mesh (The smaller, the more texture detail is visible)
+	*/
+	float CalculateUVPerPixel(
+		const OvRendering::Entities::Camera& p_camera,
+		uint16_t p_renderHeight,
+		const OvRendering::Resources::IMesh& p_mesh,
+		const SceneRenderer::SceneDrawableDescriptor& p_descriptor,
+		float p_distanceToCamera
+	)
+	{
+		const auto& scale = p_descriptor.actor.transform.GetWorldScale();
+		const float maxScale = std::max({ std::abs(scale.x), std::abs(scale.y), std::abs(scale.z) });
+
+		if (p_renderHeight == 0 || maxScale <= 0.0f)
+		{
+			return 0.0f;
+		}
+
+		float worldUnitsPerPixel = 0.0f;
+
+		if (p_camera.GetProjectionMode() == OvRendering::Settings::EProjectionMode::ORTHOGRAPHIC)
+		{
+			worldUnitsPerPixel = 2.0f * p_camera.GetSize() / p_renderHeight;
+		}
+		else
+		{
+			// The closest point of the drawable decides, as it is where the texture is magnified the most
+			const float radius = p_descriptor.bounds ? p_descriptor.bounds->radius * maxScale : 0.0f;
+			const float distance = std::max(p_distanceToCamera - radius, p_camera.GetNear());
+			worldUnitsPerPixel = 2.0f * distance * std::tan(p_camera.GetFov() * 0.5f * std::numbers::pi_v<float> / 180.0f) / p_renderHeight;
+		}
+
+		return p_mesh.GetUVDensity() / maxScale * worldUnitsPerPixel;
+	}
+
+	/**
+	* Returns the screen coverage of the given drawable: its bounding sphere diameter over the screen height
+	*/
+	float CalculateScreenSize(
+		const OvRendering::Entities::Camera& p_camera,
+		const SceneRenderer::SceneDrawableDescriptor& p_descriptor,
+		float p_boundsScale
+	)
+	{
+		if (!p_descriptor.bounds)
+		{
+			return std::numeric_limits<float>::max();
+		}
+
+		const auto& transform = p_descriptor.actor.transform;
+		const auto& scale = transform.GetWorldScale();
+		const float maxScale = std::max({ std::abs(scale.x), std::abs(scale.y), std::abs(scale.z) });
+		const float radius = p_descriptor.bounds->radius * p_boundsScale * maxScale;
+
+		if (p_camera.GetProjectionMode() == OvRendering::Settings::EProjectionMode::ORTHOGRAPHIC)
+		{
+			return p_camera.GetSize() > 0.0f ? radius / p_camera.GetSize() : std::numeric_limits<float>::max();
+		}
+
+		const auto center =
+			transform.GetWorldPosition() +
+			OvMaths::FQuaternion::RotatePoint(p_descriptor.bounds->position, transform.GetWorldRotation()) * maxScale;
+
+		const float distance = OvMaths::FVector3::Distance(center, p_camera.GetPosition());
+
+		// The camera is inside the bounds, the full detail is needed
+		if (distance <= radius)
+		{
+			return std::numeric_limits<float>::max();
+		}
+
+		const float halfHeight = distance * std::tan(p_camera.GetFov() * 0.5f * std::numbers::pi_v<float> / 180.0f);
+		return radius / halfHeight;
+	}
+
+	void ReportTextureUsage(
+		OvCore::ResourceManagement::TextureStreamer& p_streamer,
+		OvRendering::Data::Material& p_material,
+		float p_uvPerPixel
+	)
+	{
+		for (const auto& [name, property] : p_material.GetProperties())
+		{
+			if (const auto texture = std::get_if<OvRendering::Resources::Texture*>(&property.value); texture && *texture)
+			{
+				p_streamer.ReportUsage(**texture, p_uvPerPixel);
+			}
+		}
+	}
+
 	class SceneRenderPass : public OvRendering::Core::ARenderPass
 	{
 	public:
@@ -231,7 +328,9 @@ void OvCore::Rendering::SceneRenderer::BeginFrame(const OvRendering::Data::Frame
 				.frustumOverride = sceneDescriptor.frustumOverride,
 				.overrideMaterial = sceneDescriptor.overrideMaterial,
 				.fallbackMaterial = sceneDescriptor.fallbackMaterial,
-				.requiredVisibilityFlags = EVisibilityFlags::GEOMETRY
+				.requiredVisibilityFlags = EVisibilityFlags::GEOMETRY,
+				.reportTextureUsage = true,
+				.updateLODs = true
 			}
 		)
 	});
@@ -284,8 +383,13 @@ SceneRenderer::SceneDrawablesDescriptor OvCore::Rendering::SceneRenderer::ParseS
 		const auto& transform = owner.transform.GetFTransform();
 		const auto& materials = materialRenderer->GetMaterials();
 
-		for (auto& mesh : model->GetMeshes())
+		const auto lodLevels = modelRenderer->GetLODLevels();
+
+		for (size_t meshIndex = 0; meshIndex < model->GetMeshes().size(); ++meshIndex)
 		{
+			auto* mesh = model->GetMeshes()[meshIndex];
+			const bool hasLODs = mesh->GetLODCount() > 1;
+
 			OvTools::Utils::OptRef<OvRendering::Data::Material> material;
 
 			if (mesh->GetMaterialIndex() < kMaxMaterialCount)
@@ -294,7 +398,7 @@ SceneRenderer::SceneDrawablesDescriptor OvCore::Rendering::SceneRenderer::ParseS
 			}
 
 			OvRendering::Entities::Drawable drawable{
-				.mesh = *mesh,
+				.mesh = hasLODs ? mesh->GetLOD(lodLevels[meshIndex]) : *mesh,
 				.material = material,
 				.stateMask = material.has_value() ? material->GenerateStateMask() : OvRendering::Data::StateMask{},
 			};
@@ -314,7 +418,10 @@ SceneRenderer::SceneDrawablesDescriptor OvCore::Rendering::SceneRenderer::ParseS
 			drawable.AddDescriptor<SceneDrawableDescriptor>({
 				.actor = modelRenderer->owner,
 				.visibilityFlags = materialRenderer->GetVisibilityFlags(),
-				.bounds = bounds
+				.bounds = bounds,
+				.lodSource = hasLODs ? OvTools::Utils::OptRef<OvRendering::Resources::Mesh>(*mesh) : std::nullopt,
+				.lodLevel = hasLODs ? OvTools::Utils::OptRef<uint8_t>(lodLevels[meshIndex]) : std::nullopt,
+				.lodBias = modelRenderer->GetLODBias()
 			});
 			
 			drawable.AddDescriptor<EngineDrawableDescriptor>({
@@ -348,6 +455,10 @@ SceneRenderer::SceneFilteredDrawablesDescriptor OvCore::Rendering::SceneRenderer
 	const auto& camera = p_filteringInput.camera;
 	const auto& frustumOverride = p_filteringInput.frustumOverride;
 
+	// Only the streamed textures care about their on-screen usage
+	auto& textureStreamer = OVSERVICE(OvCore::ResourceManagement::TextureManager).GetStreamer();
+	const bool reportTextureUsage = p_filteringInput.reportTextureUsage && textureStreamer.HasStreamedTextures();
+
 	// Determine if we should use frustum culling
 	OvTools::Utils::OptRef<const OvRendering::Data::Frustum> frustum;
 	if (camera.HasFrustumGeometryCulling())
@@ -409,6 +520,17 @@ SceneRenderer::SceneFilteredDrawablesDescriptor OvCore::Rendering::SceneRenderer
 			camera.GetPosition()
 		);
 
+		if (reportTextureUsage)
+		{
+			ZoneScopedN("Texture Usage");
+
+			ReportTextureUsage(
+				textureStreamer,
+				targetMaterial.value(),
+				CalculateUVPerPixel(camera, m_frameDescriptor.renderHeight, drawable.mesh.value(), desc, distanceToCamera)
+			);
+		}
+
 		// At this point we want to copy the drawable to avoid modifying the original one.
 		// The copy will use the updated material.
 		// At this point, the filtered drawable should be guaranteed to have a valid material.
@@ -416,6 +538,17 @@ SceneRenderer::SceneFilteredDrawablesDescriptor OvCore::Rendering::SceneRenderer
 		drawableCopy.material = targetMaterial;
 		drawableCopy.stateMask = targetMaterial->GenerateStateMask();
 
+		if (desc.lodSource && desc.lodLevel)
+		{
+			if (p_filteringInput.updateLODs)
+			{
+				const float screenSize = CalculateScreenSize(camera, desc, hasSkinningDescriptor ? skinningDescriptor->boundsScale : 1.0f);
+				desc.lodLevel.value() = static_cast<uint8_t>(desc.lodSource->SelectLOD(screenSize * desc.lodBias, desc.lodLevel.value()));
+			}
+
+			drawableCopy.mesh = desc.lodSource->GetLOD(desc.lodLevel.value());
+		}
+
 		if (
 			hasSkinningDescriptor &&
 			targetMaterial->HasShader() &&
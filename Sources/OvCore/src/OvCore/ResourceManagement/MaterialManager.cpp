@@ -43,7 +43,9 @@ namespace
 			return std::nullopt;
 		}
 
-		auto* model = OvCore::Global::ServiceLocator::Get<OvCore::ResourceManagement::ModelManager>().GetResource(embeddedAssetPath->modelPath);
+		auto& modelManager = OvCore::Global::ServiceLocator::Get<OvCore::ResourceManagement::ModelManager>();
+		auto* model = modelManager.GetResource(embeddedAssetPath->modelPath);
+		modelManager.WaitForResource(embeddedAssetPath->modelPath); // Embedded data is only available once the model is loaded
 		if (!model)
 		{
 			return std::nullopt;
@@ -111,7 +113,7 @@ namespace
 		{
 			if (const auto linkedTexturePath = ResolveLinkedTextureResourcePath(p_context.modelPath, textureData.sourcePath))
 			{
-				if (auto* linkedTexture = textureManager.GetResource(linkedTexturePath.value()))
+				if (auto* linkedTexture = textureManager.LoadResourceAsync(linkedTexturePath.value()))
 				{
 					p_material.TrySetProperty(std::string{ p_uniformName }, linkedTexture);
 					return true;
@@ -128,7 +130,7 @@ namespace
 			extension
 		);
 
-		if (auto* texture = textureManager.GetResource(texturePath))
+		if (auto* texture = textureManager.LoadResourceAsync(texturePath))
 		{
 			p_material.TrySetProperty(std::string{ p_uniformName }, texture);
 			return true;
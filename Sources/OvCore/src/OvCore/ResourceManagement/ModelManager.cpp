@@ -6,10 +6,15 @@
 
 #include "OvCore/ResourceManagement/ModelManager.h"
 
+#include <algorithm>
+
 #include <OvCore/Global/ServiceLocator.h>
 #include <OvCore/ResourceManagement/MaterialManager.h>
 #include <OvCore/ResourceManagement/TextureManager.h>
+#include <OvDebug/Logger.h>
+#include <OvPhysics/Tools/CollisionCache.h>
 #include <OvRendering/Resources/Parsers/EmbeddedAssetPath.h>
+#include <OvTools/Filesystem/CookedAssetStamp.h>
 #include <OvTools/Filesystem/IniFile.h>
 #include <OvTools/Utils/PathParser.h>
 
@@ -19,6 +24,8 @@ namespace
 	{
 		OvRendering::Resources::Parsers::EModelParserFlags parserFlags = OvRendering::Resources::Parsers::EModelParserFlags::NONE;
 		bool generateEmbeddedAssets = true;
+		OvRendering::Settings::EVertexFormat vertexFormat = OvRendering::Settings::EVertexFormat::STANDARD;
+		OvRendering::Settings::LODSettings lodSettings;
 	};
 
 	ModelMetadata GetAssetMetadata(const std::string& p_path)
@@ -59,6 +66,9 @@ namespace
 		if (metaFile.GetOrDefault("GEN_BOUNDING_BOXES",			false))	modelMetadata.parserFlags |= OvRendering::Resources::Parsers::EModelParserFlags::GEN_BOUNDING_BOXES;
 
 		modelMetadata.generateEmbeddedAssets = metaFile.GetOrDefault("GENERATE_EMBEDDED_ASSETS", true);
+		modelMetadata.vertexFormat = static_cast<OvRendering::Settings::EVertexFormat>(metaFile.GetOrDefault("VERTEX_FORMAT", static_cast<int>(modelMetadata.vertexFormat)));
+		modelMetadata.lodSettings.levelCount = static_cast<uint32_t>(std::max(metaFile.GetOrDefault("LOD_COUNT", 0), 0));
+		modelMetadata.lodSettings.reduction = metaFile.GetOrDefault("LOD_REDUCTION", modelMetadata.lodSettings.reduction);
 
 		return modelMetadata;
 	}
@@ -93,6 +103,28 @@ namespace
 		}
 	}
 
+	uint64_t GetCollisionSettingsHash(const ModelMetadata& p_metadata)
+	{
+		// Only the import flags change the collision geometry
+		return static_cast<uint64_t>(p_metadata.parserFlags);
+	}
+
+	bool LoadCollisionGeometry(const std::string& p_realPath, const ModelMetadata& p_metadata, std::vector<OvMaths::FVector3>& p_positions, std::vector<uint32_t>& p_indices)
+	{
+		if (!OvRendering::Resources::Loaders::ModelLoader::LoadCollisionGeometry(p_realPath, p_positions, p_indices, p_metadata.parserFlags))
+		{
+			OVLOG_WARNING("ModelManager: Unable to load collision geometry from \"" + p_realPath + "\"");
+			return false;
+		}
+
+		return true;
+	}
+
+	std::filesystem::path GetCookedModelPath(const std::string& p_realPath)
+	{
+		return p_realPath + ".ovmesh";
+	}
+
 	void ReloadEmbeddedModelResources(const std::string& p_modelPath)
 	{
 		ReloadEmbeddedResourcesForModelByType(
@@ -116,7 +148,10 @@ OvRendering::Resources::Model* OvCore::ResourceManagement::ModelManager::CreateR
 	auto model = OvRendering::Resources::Loaders::ModelLoader::Create(
 		realPath,
 		metadata.parserFlags,
-		metadata.generateEmbeddedAssets
+		metadata.generateEmbeddedAssets,
+		GetCookedModelPath(realPath),
+		metadata.vertexFormat,
+		metadata.lodSettings
 	);
 	if (model)
 	{
@@ -126,11 +161,60 @@ OvRendering::Resources::Model* OvCore::ResourceManagement::ModelManager::CreateR
 	return model;
 }
 
+OvRendering::Resources::Model* OvCore::ResourceManagement::ModelManager::CreateAsyncResource(const std::filesystem::path& p_path, AsyncTask& p_task)
+{
+	const std::string realPath = GetRealPath(p_path).string();
+
+	p_task = [realPath, metadata = GetAssetMetadata(realPath)]() -> AsyncFinalizer
+	{
+		auto data = std::make_shared<OvRendering::Resources::Parsers::ModelData>();
+		std::vector<std::string> messages;
+
+		if (!OvRendering::Resources::Loaders::ModelLoader::LoadData(
+			realPath,
+			*data,
+			metadata.parserFlags,
+			metadata.generateEmbeddedAssets,
+			GetCookedModelPath(realPath),
+			metadata.lodSettings,
+			&messages
+		))
+		{
+			// Reported by the finalizer, as the logger must only be used from the main thread
+			return [realPath](OvRendering::Resources::Model&) { OVLOG_WARNING("ModelManager: Unable to load \"" + realPath + "\""); };
+		}
+
+		return [data, messages = std::move(messages), vertexFormat = metadata.vertexFormat](OvRendering::Resources::Model& p_model)
+		{
+			for (const auto& message : messages)
+			{
+				OVLOG_INFO(message);
+			}
+
+			OvRendering::Resources::Loaders::ModelLoader::Upload(p_model, std::move(*data), vertexFormat);
+		};
+	};
+
+	return OvRendering::Resources::Loaders::ModelLoader::CreateEmpty(p_path.string());
+}
+
 void OvCore::ResourceManagement::ModelManager::DestroyResource(OvRendering::Resources::Model* p_resource)
 {
 	OvRendering::Resources::Loaders::ModelLoader::Destroy(p_resource);
 }
 
+uint64_t OvCore::ResourceManagement::ModelManager::GetResourceMemoryUsage(const OvRendering::Resources::Model& p_resource) const
+{
+	uint64_t memoryUsage = 0;
+
+	for (const auto mesh : p_resource.GetMeshes())
+	{
+		memoryUsage += mesh->GetMemoryUsage();
+	}
+
+	return memoryUsage;
+}
+
 void OvCore::ResourceManagement::ModelManager::ReloadResource(OvRendering::Resources::Model* p_resource, const std::filesystem::path& p_path)
 {
 	std::string realPath = GetRealPath(p_path).string();
@@ -139,8 +223,87 @@ void OvCore::ResourceManagement::ModelManager::ReloadResource(OvRendering::Resou
 		*p_resource,
 		realPath,
 		metadata.parserFlags,
-		metadata.generateEmbeddedAssets
+		metadata.generateEmbeddedAssets,
+		GetCookedModelPath(realPath),
+		metadata.vertexFormat,
+		metadata.lodSettings
 	);
 
 	ReloadEmbeddedModelResources(p_path.string());
+
+	// Objects already using the previous collision data keep it, new requests will re-validate the cache
+	m_collisionMeshes.erase(p_path.string());
+	m_collisionHulls.erase(p_path.string());
+}
+
+bool OvCore::ResourceManagement::ModelManager::CookModel(const std::filesystem::path& p_path) const
+{
+	const std::string realPath = GetRealPath(p_path).string();
+	const auto metadata = GetAssetMetadata(realPath);
+
+	return OvRendering::Resources::Loaders::ModelLoader::Cook(
+		realPath,
+		GetCookedModelPath(realPath),
+		metadata.parserFlags,
+		metadata.generateEmbeddedAssets,
+		metadata.lodSettings
+	);
+}
+
+std::shared_ptr<const OvPhysics::Entities::TriangleMesh> OvCore::ResourceManagement::ModelManager::GetCollisionMesh(const OvRendering::Resources::Model& p_model)
+{
+	if (auto shared = m_collisionMeshes[p_model.path].lock())
+		return shared;
+
+	const std::string realPath = GetRealPath(p_model.path).string();
+	const std::string cachePath = realPath + ".trimesh.ovcol";
+	const auto metadata = GetAssetMetadata(realPath);
+	const uint64_t settingsHash = GetCollisionSettingsHash(metadata);
+
+	std::shared_ptr<const OvPhysics::Entities::TriangleMesh> result = OvPhysics::Tools::CollisionCache::LoadTriangleMesh(cachePath, realPath, settingsHash);
+
+	if (!result)
+	{
+		std::vector<OvMaths::FVector3> positions;
+		std::vector<uint32_t> indices;
+
+		if (!LoadCollisionGeometry(realPath, metadata, positions, indices))
+			return nullptr;
+
+		auto cooked = std::make_shared<OvPhysics::Entities::TriangleMesh>(std::move(positions), std::move(indices));
+		OvPhysics::Tools::CollisionCache::SaveTriangleMesh(cachePath, OvTools::Filesystem::ComputeCookedAssetStamp(realPath, settingsHash), *cooked);
+		result = std::move(cooked);
+	}
+
+	m_collisionMeshes[p_model.path] = result;
+	return result;
+}
+
+std::shared_ptr<const std::vector<OvMaths::FVector3>> OvCore::ResourceManagement::ModelManager::GetCollisionHull(const OvRendering::Resources::Model& p_model)
+{
+	if (auto shared = m_collisionHulls[p_model.path].lock())
+		return shared;
+
+	const std::string realPath = GetRealPath(p_model.path).string();
+	const std::string cachePath = realPath + ".hull.ovcol";
+	const auto metadata = GetAssetMetadata(realPath);
+	const uint64_t settingsHash = GetCollisionSettingsHash(metadata);
+
+	auto points = OvPhysics::Tools::CollisionCache::LoadConvexHull(cachePath, realPath, settingsHash);
+
+	if (!points)
+	{
+		std::vector<OvMaths::FVector3> positions;
+		std::vector<uint32_t> indices;
+
+		if (!LoadCollisionGeometry(realPath, metadata, positions, indices))
+			return nullptr;
+
+		points = OvPhysics::Tools::CollisionCache::CookConvexHull(positions);
+		OvPhysics::Tools::CollisionCache::SaveConvexHull(cachePath, OvTools::Filesystem::ComputeCookedAssetStamp(realPath, settingsHash), *points);
+	}
+
+	auto result = std::make_shared<const std::vector<OvMaths::FVector3>>(std::move(*points));
+	m_collisionHulls[p_model.path] = result;
+	return result;
 }
@@ -0,0 +1,67 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+#include <string_view>
+
+#include <OvCore/ResourceManagement/ResourceID.h>
+
+namespace
+{
+	constexpr uint64_t kFNVOffsetBasis = 14695981039346656037ull;
+	constexpr uint64_t kFNVPrime = 1099511628211ull;
+
+	OvCore::ResourceManagement::ResourceID HashPath(std::string_view p_path)
+	{
+		uint64_t hash = kFNVOffsetBasis;
+
+		for (const char c : p_path)
+		{
+			hash ^= static_cast<uint8_t>(c);
+			hash *= kFNVPrime;
+		}
+
+		return hash;
+	}
+
+	// True if lexically_normal wouldn't change the given '/' separated path, which is the case of
+	// most paths stored in scenes and materials. Conservative: some normal paths are rejected
+	bool IsNormalized(std::string_view p_path)
+	{
+		if (p_path.find('\\') != std::string_view::npos || p_path.find("//") != std::string_view::npos)
+			return false;
+
+		for (size_t dot = p_path.find('.'); dot != std::string_view::npos; dot = p_path.find('.', dot + 1))
+		{
+			// "." and ".." components
+			const bool componentStart = dot == 0 || p_path[dot - 1] == '/' || p_path[dot - 1] == '.';
+			const bool componentEnd = dot + 1 == p_path.size() || p_path[dot + 1] == '/';
+
+			if (componentStart && componentEnd)
+				return false;
+		}
+
+		return true;
+	}
+}
+
+std::filesystem::path OvCore::ResourceManagement::NormalizeResourcePath(const std::filesystem::path& p_path)
+{
+	// Backslashes are treated as separators, as '\\' isn't one on POSIX
+	std::string path = p_path.string();
+	std::replace(path.begin(), path.end(), '\\', '/');
+	return std::filesystem::path{ path }.lexically_normal();
+}
+
+OvCore::ResourceManagement::ResourceID OvCore::ResourceManagement::GetResourceID(const std::filesystem::path& p_path)
+{
+	if (const std::string path = p_path.generic_string(); IsNormalized(path))
+	{
+		return HashPath(path);
+	}
+
+	return HashPath(NormalizeResourcePath(p_path).generic_string());
+}
@@ -0,0 +1,30 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <variant>
+
+#include <OvCore/ResourceManagement/ResourceUsage.h>
+
+void OvCore::ResourceManagement::ResourceUsage::AddMaterial(OvCore::Resources::Material& p_material)
+{
+	if (!materials.insert(&p_material).second)
+	{
+		return;
+	}
+
+	if (const auto shader = p_material.GetShader())
+	{
+		shaders.insert(shader);
+	}
+
+	for (const auto& [name, property] : p_material.GetProperties())
+	{
+		if (const auto texture = std::get_if<OvRendering::Resources::Texture*>(&property.value); texture && *texture)
+		{
+			textures.insert(*texture);
+		}
+	}
+}
@@ -4,12 +4,25 @@
 * @licence: MIT
 */
 
+#include <format>
+
 #include "OvCore/ResourceManagement/SoundManager.h"
 
+#include <OvTools/Filesystem/IniFile.h>
+
+namespace
+{
+	OvAudio::Settings::ESoundLoadMode LoadSoundLoadMode(const std::string_view p_filePath)
+	{
+		const auto metaFile = OvTools::Filesystem::IniFile(std::format("{}.meta", p_filePath));
+		return static_cast<OvAudio::Settings::ESoundLoadMode>(metaFile.GetOrDefault("LOAD_MODE", static_cast<int>(OvAudio::Settings::ESoundLoadMode::AUTO)));
+	}
+}
+
 OvAudio::Resources::Sound* OvCore::ResourceManagement::SoundManager::CreateResource(const std::filesystem::path& p_path)
 {
 	std::string realPath = GetRealPath(p_path).string();
-	OvAudio::Resources::Sound* sound = OvAudio::Resources::Loaders::SoundLoader::Create(realPath);
+	OvAudio::Resources::Sound* sound = OvAudio::Resources::Loaders::SoundLoader::Create(realPath, LoadSoundLoadMode(realPath));
 	if (sound)
 	{
 		const_cast<std::string&>(sound->path) = p_path.string(); // Force the resource path to fit the given path
@@ -25,4 +38,12 @@ void OvCore::ResourceManagement::SoundManager::DestroyResource(OvAudio::Resource
 
 void OvCore::ResourceManagement::SoundManager::ReloadResource(OvAudio::Resources::Sound* p_resource, const std::filesystem::path& p_path)
 {
+	std::string realPath = GetRealPath(p_path).string();
+	OvAudio::Resources::Loaders::SoundLoader::Reload(*p_resource, realPath, LoadSoundLoadMode(realPath));
+	const_cast<std::string&>(p_resource->path) = p_path.string();
+}
+
+uint64_t OvCore::ResourceManagement::SoundManager::GetResourceMemoryUsage(const OvAudio::Resources::Sound& p_resource) const
+{
+	return p_resource.GetDecodedSize();
 }
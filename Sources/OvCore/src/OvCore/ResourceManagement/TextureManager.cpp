@@ -4,11 +4,14 @@
 * @licence: MIT
 */
 
+#include <algorithm>
 #include <filesystem>
 #include <format>
 #include <optional>
+#include <utility>
 
 #include <OvDebug/Assertion.h>
+#include <OvDebug/Logger.h>
 #include <OvCore/Global/ServiceLocator.h>
 #include <OvCore/ResourceManagement/ModelManager.h>
 #include <OvCore/ResourceManagement/TextureManager.h>
@@ -26,6 +29,7 @@ namespace
 		baregl::types::ETextureWrapMode horizontalWrap = baregl::types::ETextureWrapMode::REPEAT;
 		baregl::types::ETextureWrapMode verticalWrap = baregl::types::ETextureWrapMode::REPEAT;
 		bool generateMipmap = true;
+		OvRendering::Settings::ETextureCompression compression = OvRendering::Settings::ETextureCompression::NONE;
 	};
 
 	TextureMetadata LoadTextureMetadata(const std::string_view p_filePath)
@@ -38,10 +42,100 @@ namespace
 		metadata.horizontalWrap = static_cast<baregl::types::ETextureWrapMode>(metaFile.GetOrDefault("HORIZONTAL_WRAP", static_cast<int>(metadata.horizontalWrap)));
 		metadata.verticalWrap = static_cast<baregl::types::ETextureWrapMode>(metaFile.GetOrDefault("VERTICAL_WRAP", static_cast<int>(metadata.verticalWrap)));
 		metadata.generateMipmap = metaFile.GetOrDefault("ENABLE_MIPMAPPING", metadata.generateMipmap);
+		metadata.compression = static_cast<OvRendering::Settings::ETextureCompression>(metaFile.GetOrDefault("COMPRESSION", static_cast<int>(metadata.compression)));
 
 		return metadata;
 	}
 
+	std::filesystem::path GetCookedTexturePath(const std::string& p_realPath)
+	{
+		return p_realPath + ".ovtex";
+	}
+
+	/**
+	* Returns the size in bytes of a block of texels of the given format, and the size of the block (1 for uncompressed formats)
+	*/
+	std::pair<uint32_t, uint32_t> GetTexelBlockInfo(baregl::types::EInternalFormat p_format)
+	{
+		using enum baregl::types::EInternalFormat;
+
+		switch (p_format)
+		{
+		case COMPRESSED_RGB_S3TC_DXT1:
+		case COMPRESSED_RED_RGTC1:
+		case COMPRESSED_SIGNED_RED_RGTC1:
+			return { 8, 4 };
+		case COMPRESSED_RGBA_S3TC_DXT5:
+		case COMPRESSED_RG_RGTC2:
+		case COMPRESSED_SIGNED_RG_RGTC2:
+		case COMPRESSED_RGBA_BPTC_UNORM:
+		case COMPRESSED_SRGB_ALPHA_BPTC_UNORM:
+		case COMPRESSED_RGB_BPTC_SIGNED_FLOAT:
+		case COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT:
+			return { 16, 4 };
+		case RED: case R8: case R8_SNORM: case R8I: case R8UI:
+			return { 1, 1 };
+		case RG: case RG8: case RG8_SNORM: case R16: case R16_SNORM: case R16F: case R16I: case R16UI: case DEPTH_COMPONENT:
+			return { 2, 1 };
+		case RGB: case RGB8: case SRGB8:
+			return { 3, 1 };
+		case RGB16F: case RGB16I: case RGB16UI: case RGB16_SNORM:
+			return { 6, 1 };
+		case RGBA16: case RGBA16F: case RGBA16I: case RGBA16UI: case RG32F: case RG32I: case RG32UI:
+			return { 8, 1 };
+		case RGB32F: case RGB32I: case RGB32UI:
+			return { 12, 1 };
+		case RGBA32F: case RGBA32I: case RGBA32UI:
+			return { 16, 1 };
+		default:
+			return { 4, 1 };
+		}
+	}
+
+	/**
+	* Returns the largest level to load a texture with (0 loads every level)
+	*/
+	uint32_t GetMaxLevelSize(const OvCore::ResourceManagement::TextureStreamer& p_streamer, const TextureMetadata& p_metadata)
+	{
+		const bool streamable =
+			p_streamer.IsEnabled() &&
+			p_metadata.compression != OvRendering::Settings::ETextureCompression::NONE &&
+			p_metadata.generateMipmap;
+
+		return streamable ? OvCore::ResourceManagement::TextureStreamer::kMinResidentLevelSize : 0;
+	}
+
+	/**
+	* Hand a texture created without its largest levels to the streamer
+	*/
+	void StreamTexture(
+		OvCore::ResourceManagement::TextureStreamer& p_streamer,
+		OvRendering::Resources::Texture& p_texture,
+		const OvRendering::Resources::Parsers::TextureData& p_data,
+		const TextureMetadata& p_metadata,
+		const std::filesystem::path& p_cookedPath
+	)
+	{
+		// Small textures are already complete, and the levels can only be streamed from a cooked file
+		if (p_data.firstLevel == 0 || !std::filesystem::exists(p_cookedPath))
+		{
+			return;
+		}
+
+		p_streamer.RegisterTexture(p_texture, {
+			.cookedPath = p_cookedPath,
+			.compression = p_data.compression,
+			.width = p_data.width,
+			.height = p_data.height,
+			.levelCount = p_data.firstLevel + static_cast<uint32_t>(p_data.levels.size()),
+			.residentLevel = p_data.firstLevel,
+			.minFilter = p_metadata.minFilter,
+			.magFilter = p_metadata.magFilter,
+			.horizontalWrap = p_metadata.horizontalWrap,
+			.verticalWrap = p_metadata.verticalWrap
+		});
+	}
+
 	struct EmbeddedTextureContext
 	{
 		const OvRendering::Resources::EmbeddedTextureData& textureData;
@@ -63,7 +157,9 @@ namespace
 			return std::nullopt;
 		}
 
-		auto* model = OvCore::Global::ServiceLocator::Get<OvCore::ResourceManagement::ModelManager>().GetResource(embeddedAssetPath->modelPath);
+		auto& modelManager = OvCore::Global::ServiceLocator::Get<OvCore::ResourceManagement::ModelManager>();
+		auto* model = modelManager.GetResource(embeddedAssetPath->modelPath);
+		modelManager.WaitForResource(embeddedAssetPath->modelPath); // Embedded data is only available once the model is loaded
 		if (!model)
 		{
 			return std::nullopt;
@@ -199,14 +295,47 @@ OvRendering::Resources::Texture* OvCore::ResourceManagement::TextureManager::Cre
 
 	const auto metadata = LoadTextureMetadata(realPath);
 
-	OvRendering::Resources::Texture* texture = OvRendering::Resources::Loaders::TextureLoader::Create(
-		realPath,
-		metadata.minFilter,
-		metadata.magFilter,
-		metadata.horizontalWrap,
-		metadata.verticalWrap,
-		metadata.generateMipmap
-	);
+	OvRendering::Resources::Texture* texture = nullptr;
+
+	if (const uint32_t maxLevelSize = GetMaxLevelSize(m_streamer, metadata); maxLevelSize > 0)
+	{
+		if (OvRendering::Resources::Parsers::TextureData data; OvRendering::Resources::Loaders::TextureLoader::LoadData(
+			realPath,
+			metadata.compression,
+			metadata.generateMipmap,
+			data,
+			GetCookedTexturePath(realPath),
+			maxLevelSize
+		))
+		{
+			texture = OvRendering::Resources::Loaders::TextureLoader::CreateFromData(
+				realPath,
+				data,
+				metadata.minFilter,
+				metadata.magFilter,
+				metadata.horizontalWrap,
+				metadata.verticalWrap
+			);
+
+			if (texture)
+			{
+				StreamTexture(m_streamer, *texture, data, metadata, GetCookedTexturePath(realPath));
+			}
+		}
+	}
+	else
+	{
+		texture = OvRendering::Resources::Loaders::TextureLoader::Create(
+			realPath,
+			metadata.minFilter,
+			metadata.magFilter,
+			metadata.horizontalWrap,
+			metadata.verticalWrap,
+			metadata.generateMipmap,
+			metadata.compression,
+			GetCookedTexturePath(realPath)
+		);
+	}
 
 	if (texture)
 	{
@@ -216,8 +345,127 @@ OvRendering::Resources::Texture* OvCore::ResourceManagement::TextureManager::Cre
 	return texture;
 }
 
+OvRendering::Resources::Texture* OvCore::ResourceManagement::TextureManager::CreateAsyncResource(const std::filesystem::path& p_path, AsyncTask& p_task)
+{
+	if (OvRendering::Resources::Parsers::ParseEmbeddedAssetPath(p_path.string()))
+	{
+		using SourceType = OvRendering::Resources::EmbeddedTextureData::ESourceType;
+
+		// Only the compressed embedded textures (PNG, JPEG...) are worth decoding in the background, the raw ones are uploaded as-is
+		const auto context = ResolveEmbeddedTextureContext(p_path);
+		if (!context || context->textureData.sourceType != SourceType::EMBEDDED_COMPRESSED || context->textureData.compressedData.empty())
+		{
+			return nullptr;
+		}
+
+		// Copied, as the model can be reloaded or unloaded before the task runs
+		p_task = [compressedData = context->textureData.compressedData]() -> AsyncFinalizer
+		{
+			auto image = std::make_shared<OvRendering::Data::Image>(compressedData.data(), compressedData.size());
+
+			if (!image->IsValid())
+			{
+				return {};
+			}
+
+			return [image](OvRendering::Resources::Texture& p_texture)
+			{
+				const auto settings = TextureMetadata{};
+
+				OvRendering::Resources::Loaders::TextureLoader::ReloadFromImage(
+					p_texture,
+					*image,
+					settings.minFilter,
+					settings.magFilter,
+					settings.horizontalWrap,
+					settings.verticalWrap,
+					settings.generateMipmap
+				);
+			};
+		};
+	}
+	else
+	{
+		const std::string realPath = GetRealPath(p_path).string();
+		const auto metadata = LoadTextureMetadata(realPath);
+
+		// The streamer is only used by the finalizer, which runs on the main thread
+		p_task = [realPath, metadata, maxLevelSize = GetMaxLevelSize(m_streamer, metadata), streamer = &m_streamer]() -> AsyncFinalizer
+		{
+			if (metadata.compression != OvRendering::Settings::ETextureCompression::NONE)
+			{
+				auto data = std::make_shared<OvRendering::Resources::Parsers::TextureData>();
+				std::optional<OvRendering::Resources::Loaders::TextureEncodeReport> encodeReport;
+
+				if (!OvRendering::Resources::Loaders::TextureLoader::LoadData(
+					realPath,
+					metadata.compression,
+					metadata.generateMipmap,
+					*data,
+					GetCookedTexturePath(realPath),
+					maxLevelSize,
+					&encodeReport
+				))
+				{
+					// Reported by the finalizer, as the logger must only be used from the main thread
+					return [realPath](OvRendering::Resources::Texture&) { OVLOG_WARNING("TextureManager: Unable to load \"" + realPath + "\""); };
+				}
+
+				return [data, metadata, realPath, streamer, encodeReport](OvRendering::Resources::Texture& p_texture)
+				{
+					if (encodeReport)
+					{
+						OvRendering::Resources::Loaders::TextureLoader::LogEncodeReport(realPath, encodeReport.value());
+					}
+
+					OvRendering::Resources::Loaders::TextureLoader::ReloadFromData(
+						p_texture,
+						*data,
+						metadata.minFilter,
+						metadata.magFilter,
+						metadata.horizontalWrap,
+						metadata.verticalWrap
+					);
+
+					StreamTexture(*streamer, p_texture, *data, metadata, GetCookedTexturePath(realPath));
+				};
+			}
+
+			auto image = std::make_shared<OvRendering::Data::Image>(realPath);
+
+			if (!image->IsValid())
+			{
+				return [realPath](OvRendering::Resources::Texture&) { OVLOG_WARNING("TextureManager: Unable to load \"" + realPath + "\""); };
+			}
+
+			return [image, metadata](OvRendering::Resources::Texture& p_texture)
+			{
+				OvRendering::Resources::Loaders::TextureLoader::ReloadFromImage(
+					p_texture,
+					*image,
+					metadata.minFilter,
+					metadata.magFilter,
+					metadata.horizontalWrap,
+					metadata.verticalWrap,
+					metadata.generateMipmap
+				);
+			};
+		};
+	}
+
+	// Rendered until the image is decoded and uploaded
+	auto placeholder = OvRendering::Resources::Loaders::TextureLoader::CreatePixel(255, 255, 255, 255);
+	const_cast<std::string&>(placeholder->path) = p_path.string();
+	return placeholder;
+}
+
 void OvCore::ResourceManagement::TextureManager::DestroyResource(OvRendering::Resources::Texture* p_resource)
 {
+	if (p_resource)
+	{
+		m_streamer.UnregisterTexture(*p_resource);
+	}
+
 	OvRendering::Resources::Loaders::TextureLoader::Destroy(p_resource);
 }
 
@@ -233,6 +481,34 @@ void OvCore::ResourceManagement::TextureManager::ReloadResource(OvRendering::Res
 
 	const auto metadata = LoadTextureMetadata(realPath);
 
+	m_streamer.UnregisterTexture(*p_resource);
+
+	if (const uint32_t maxLevelSize = GetMaxLevelSize(m_streamer, metadata); maxLevelSize > 0)
+	{
+		if (OvRendering::Resources::Parsers::TextureData data; OvRendering::Resources::Loaders::TextureLoader::LoadData(
+			realPath,
+			metadata.compression,
+			metadata.generateMipmap,
+			data,
+			GetCookedTexturePath(realPath),
+			maxLevelSize
+		))
+		{
+			OvRendering::Resources::Loaders::TextureLoader::ReloadFromData(
+				*p_resource,
+				data,
+				metadata.minFilter,
+				metadata.magFilter,
+				metadata.horizontalWrap,
+				metadata.verticalWrap
+			);
+
+			StreamTexture(m_streamer, *p_resource, data, metadata, GetCookedTexturePath(realPath));
+		}
+
+		return;
+	}
+
 	OvRendering::Resources::Loaders::TextureLoader::Reload(
 		*p_resource,
 		realPath,
@@ -240,6 +516,53 @@ void OvCore::ResourceManagement::TextureManager::ReloadResource(OvRendering::Res
 		metadata.magFilter,
 		metadata.horizontalWrap,
 		metadata.verticalWrap,
+		metadata.generateMipmap,
+		metadata.compression,
+		GetCookedTexturePath(realPath)
+	);
+}
+
+bool OvCore::ResourceManagement::TextureManager::CookTexture(const std::filesystem::path& p_path) const
+{
+	const std::string realPath = GetRealPath(p_path).string();
+	const auto metadata = LoadTextureMetadata(realPath);
+
+	return OvRendering::Resources::Loaders::TextureLoader::Cook(
+		realPath,
+		GetCookedTexturePath(realPath),
+		metadata.compression,
 		metadata.generateMipmap
 	);
 }
+
+OvCore::ResourceManagement::TextureStreamer& OvCore::ResourceManagement::TextureManager::GetStreamer()
+{
+	return m_streamer;
+}
+
+uint64_t OvCore::ResourceManagement::TextureManager::GetResourceMemoryUsage(const OvRendering::Resources::Texture& p_resource) const
+{
+	const auto& desc = p_resource.GetTexture().GetDesc();
+	const auto [blockSize, blockDimension] = GetTexelBlockInfo(desc.internalFormat);
+
+	uint64_t memoryUsage = 0;
+	uint32_t width = desc.width;
+	uint32_t height = desc.height;
+
+	while (width > 0 && height > 0)
+	{
+		const uint64_t blocksX = (width + blockDimension - 1) / blockDimension;
+		const uint64_t blocksY = (height + blockDimension - 1) / blockDimension;
+		memoryUsage += blocksX * blocksY * blockSize;
+
+		if (!desc.useMipMaps || (width == 1 && height == 1))
+		{
+			break;
+		}
+
+		width = std::max(1u, width / 2);
+		height = std::max(1u, height / 2);
+	}
+
+	return memoryUsage;
+}
@@ -0,0 +1,354 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <tracy/Tracy.hpp>
+
+#include <OvCore/ResourceManagement/TextureStreamer.h>
+#include <OvDebug/Logger.h>
+#include <OvRendering/Resources/Loaders/TextureLoader.h>
+#include <OvRendering/Resources/Parsers/CookedTextureParser.h>
+#include <OvRendering/Utils/ResourceTracking.h>
+#include <OvRendering/Utils/TextureCompression.h>
+
+namespace
+{
+	// Textures rendered during the last frames are never evicted, so a texture can't be evicted by the frame it is used in
+	constexpr uint64_t kEvictionGracePeriod = 2;
+
+	// Level sets read at once, so that the streamed textures follow the camera without flooding the thread pool
+	constexpr uint32_t kMaxPendingLoads = 4;
+
+	std::shared_ptr<OvRendering::Resources::Parsers::TextureData> ReadLevels(const std::filesystem::path& p_cookedPath, uint32_t p_firstLevel)
+	{
+		auto data = std::make_shared<OvRendering::Resources::Parsers::TextureData>();
+
+		if (!OvRendering::Resources::Parsers::CookedTextureParser::LoadTextureLevels(p_cookedPath, p_firstLevel, *data))
+		{
+			return nullptr;
+		}
+
+		return data;
+	}
+}
+
+void OvCore::ResourceManagement::TextureStreamer::ProvideThreadPool(OvTools::Utils::ThreadPool* p_threadPool)
+{
+	m_threadPool = p_threadPool;
+}
+
+void OvCore::ResourceManagement::TextureStreamer::SetEnabled(bool p_enabled)
+{
+	m_enabled = p_enabled;
+}
+
+bool OvCore::ResourceManagement::TextureStreamer::IsEnabled() const
+{
+	return m_enabled;
+}
+
+void OvCore::ResourceManagement::TextureStreamer::SetBudget(uint64_t p_budget)
+{
+	m_budget = p_budget;
+}
+
+uint64_t OvCore::ResourceManagement::TextureStreamer::GetBudget() const
+{
+	return m_budget;
+}
+
+void OvCore::ResourceManagement::TextureStreamer::RegisterTexture(OvRendering::Resources::Texture& p_texture, const StreamedTextureDesc& p_desc)
+{
+	UnregisterTexture(p_texture);
+
+	StreamedTexture streamedTexture{
+		.texture = p_texture,
+		.desc = p_desc,
+		.residentLevel = p_desc.residentLevel,
+		.requestedLevel = p_desc.residentLevel
+	};
+
+	m_residentSize += GetLevelsSize(streamedTexture, streamedTexture.residentLevel);
+	m_textures.emplace(&p_texture, std::move(streamedTexture));
+}
+
+void OvCore::ResourceManagement::TextureStreamer::UnregisterTexture(const OvRendering::Resources::Texture& p_texture)
+{
+	// A pending load keeps running, its result is simply dropped
+	if (auto it = m_textures.find(&p_texture); it != m_textures.end())
+	{
+		m_residentSize -= GetLevelsSize(it->second, it->second.residentLevel);
+		m_textures.erase(it);
+	}
+}
+
+bool OvCore::ResourceManagement::TextureStreamer::HasStreamedTextures() const
+{
+	return !m_textures.empty();
+}
+
+void OvCore::ResourceManagement::TextureStreamer::ReportUsage(const OvRendering::Resources::Texture& p_texture, float p_uvPerPixel)
+{
+	if (auto it = m_textures.find(&p_texture); it != m_textures.end())
+	{
+		auto& streamedTexture = it->second;
+		const auto& desc = streamedTexture.desc;
+
+		// One level per doubling of the texels covered by a pixel, as the GPU selects it when sampling
+		const float texelsPerPixel = static_cast<float>(std::max(desc.width, desc.height)) * p_uvPerPixel;
+
+		const uint32_t level =
+			p_uvPerPixel <= 0.0f ? desc.residentLevel :
+			texelsPerPixel <= 1.0f ? 0 :
+			std::min(static_cast<uint32_t>(std::log2(texelsPerPixel)), desc.residentLevel);
+
+		streamedTexture.requestedLevel = streamedTexture.lastUsedFrame == m_frame ? std::min(streamedTexture.requestedLevel, level) : level;
+		streamedTexture.lastUsedFrame = m_frame;
+	}
+}
+
+void OvCore::ResourceManagement::TextureStreamer::Update(std::chrono::steady_clock::time_point p_deadline)
+{
+	ZoneScoped;
+
+	uint32_t pendingLoads = 0;
+	uint32_t appliedLoads = 0;
+
+	for (auto& [key, streamedTexture] : m_textures)
+	{
+		if (!streamedTexture.pendingLevel)
+		{
+			continue;
+		}
+
+		// At least one load is applied per update, so a busy frame never starves the streaming
+		if (
+			(appliedLoads > 0 && std::chrono::steady_clock::now() >= p_deadline) ||
+			streamedTexture.pendingLoad.wait_for(std::chrono::seconds::zero()) != std::future_status::ready
+		)
+		{
+			++pendingLoads;
+			continue;
+		}
+
+		std::shared_ptr<OvRendering::Resources::Parsers::TextureData> data;
+
+		try
+		{
+			data = streamedTexture.pendingLoad.get();
+		}
+		catch (const std::exception&)
+		{
+			// The task has been discarded (Thread pool destroyed), the texture keeps its current levels
+		}
+
+		if (data)
+		{
+			ApplyLevels(streamedTexture, *data);
+			++appliedLoads;
+		}
+		else
+		{
+			OVLOG_WARNING("TextureStreamer: Unable to stream \"" + streamedTexture.texture.path + "\"");
+		}
+
+		streamedTexture.pendingLevel.reset();
+	}
+
+	// The budget may have been lowered
+	if (m_residentSize > m_budget)
+	{
+		EvictLeastRecentlyUsed(m_residentSize - m_budget);
+	}
+
+	// Memory promised to the pending loads, so that they still fit once applied
+	uint64_t pendingSize = 0;
+
+	std::vector<StreamedTexture*> candidates;
+
+	for (auto& [key, streamedTexture] : m_textures)
+	{
+		if (streamedTexture.pendingLevel)
+		{
+			const uint64_t requestedSize = GetLevelsSize(streamedTexture, streamedTexture.pendingLevel.value());
+			const uint64_t residentSize = GetLevelsSize(streamedTexture, streamedTexture.residentLevel);
+			pendingSize += requestedSize > residentSize ? requestedSize - residentSize : 0;
+		}
+		else if (streamedTexture.lastUsedFrame == m_frame && streamedTexture.requestedLevel < streamedTexture.residentLevel)
+		{
+			candidates.push_back(&streamedTexture);
+		}
+	}
+
+	// The blurriest textures compared to what they need come first
+	std::ranges::sort(candidates, [](const StreamedTexture* p_left, const StreamedTexture* p_right) {
+		return p_left->residentLevel - p_left->requestedLevel > p_right->residentLevel - p_right->requestedLevel;
+	});
+
+	for (auto* candidate : candidates)
+	{
+		if (pendingLoads >= kMaxPendingLoads)
+		{
+			break;
+		}
+
+		const uint64_t residentSize = GetLevelsSize(*candidate, candidate->residentLevel);
+
+		// Fallback to a smaller level set when the requested one doesn't fit in the budget
+		for (uint32_t level = candidate->requestedLevel; level < candidate->residentLevel; ++level)
+		{
+			const uint64_t extraSize = GetLevelsSize(*candidate, level) - residentSize;
+			const uint64_t requiredSize = m_residentSize + pendingSize + extraSize;
+
+			if (requiredSize <= m_budget || EvictLeastRecentlyUsed(requiredSize - m_budget))
+			{
+				pendingSize += extraSize;
+				RequestLevels(*candidate, level);
+				++pendingLoads;
+				break;
+			}
+		}
+	}
+
+	++m_frame;
+	ReportStats();
+}
+
+uint64_t OvCore::ResourceManagement::TextureStreamer::GetLevelsSize(const StreamedTexture& p_texture, uint32_t p_firstLevel) const
+{
+	uint64_t size = 0;
+
+	for (uint32_t level = p_firstLevel; level < p_texture.desc.levelCount; ++level)
+	{
+		size += OvRendering::Utils::GetTextureLevelSize(
+			p_texture.desc.compression,
+			std::max(1u, p_texture.desc.width >> level),
+			std::max(1u, p_texture.desc.height >> level)
+		);
+	}
+
+	return size;
+}
+
+void OvCore::ResourceManagement::TextureStreamer::RequestLevels(StreamedTexture& p_texture, uint32_t p_firstLevel)
+{
+	p_texture.pendingLevel = p_firstLevel;
+
+	if (m_threadPool)
+	{
+		p_texture.pendingLoad = m_threadPool->Submit([cookedPath = p_texture.desc.cookedPath, p_firstLevel] {
+			return ReadLevels(cookedPath, p_firstLevel);
+		});
+	}
+	else
+	{
+		std::promise<std::shared_ptr<OvRendering::Resources::Parsers::TextureData>> promise;
+		promise.set_value(ReadLevels(p_texture.desc.cookedPath, p_firstLevel));
+		p_texture.pendingLoad = promise.get_future();
+	}
+}
+
+bool OvCore::ResourceManagement::TextureStreamer::EvictLeastRecentlyUsed(uint64_t p_requiredSize)
+{
+	std::vector<StreamedTexture*> victims;
+	uint64_t evictableSize = 0;
+
+	for (auto& [key, streamedTexture] : m_textures)
+	{
+		if (
+			!streamedTexture.pendingLevel &&
+			streamedTexture.residentLevel < streamedTexture.desc.residentLevel &&
+			streamedTexture.lastUsedFrame + kEvictionGracePeriod <= m_frame
+		)
+		{
+			victims.push_back(&streamedTexture);
+			evictableSize += GetLevelsSize(streamedTexture, streamedTexture.residentLevel) - GetLevelsSize(streamedTexture, streamedTexture.desc.residentLevel);
+		}
+	}
+
+	// Nothing is evicted if it wouldn't be enough anyway
+	if (evictableSize < p_requiredSize)
+	{
+		return false;
+	}
+
+	std::ranges::sort(victims, [](const StreamedTexture* p_left, const StreamedTexture* p_right) {
+		return p_left->lastUsedFrame < p_right->lastUsedFrame;
+	});
+
+	uint64_t freedSize = 0;
+
+	for (auto* victim : victims)
+	{
+		if (freedSize >= p_requiredSize)
+		{
+			break;
+		}
+
+		// The smallest levels are tiny, reading them synchronously frees the memory right away
+		if (const auto data = ReadLevels(victim->desc.cookedPath, victim->desc.residentLevel))
+		{
+			const uint64_t previousSize = GetLevelsSize(*victim, victim->residentLevel);
+			ApplyLevels(*victim, *data);
+			freedSize += previousSize - GetLevelsSize(*victim, victim->residentLevel);
+			++m_evictionCount;
+		}
+	}
+
+	return freedSize >= p_requiredSize;
+}
+
+void OvCore::ResourceManagement::TextureStreamer::ApplyLevels(StreamedTexture& p_texture, const OvRendering::Resources::Parsers::TextureData& p_data)
+{
+	const auto& desc = p_texture.desc;
+
+	// The cooked file may have been regenerated with different settings since the texture has been registered
+	if (
+		p_data.compression != desc.compression ||
+		p_data.width != desc.width ||
+		p_data.height != desc.height ||
+		p_data.firstLevel + p_data.levels.size() != desc.levelCount
+	)
+	{
+		OVLOG_WARNING("TextureStreamer: \"" + desc.cookedPath.string() + "\" doesn't match \"" + p_texture.texture.path + "\" anymore");
+		return;
+	}
+
+	m_residentSize -= GetLevelsSize(p_texture, p_texture.residentLevel);
+
+	OvRendering::Resources::Loaders::TextureLoader::ReloadFromData(
+		p_texture.texture,
+		p_data,
+		desc.minFilter,
+		desc.magFilter,
+		desc.horizontalWrap,
+		desc.verticalWrap
+	);
+
+	p_texture.residentLevel = p_data.firstLevel;
+	m_residentSize += GetLevelsSize(p_texture, p_texture.residentLevel);
+}
+
+void OvCore::ResourceManagement::TextureStreamer::ReportStats() const
+{
+	OvRendering::Utils::ResourceTracking::TextureStreamingStats stats{
+		.budget = m_budget,
+		.residentSize = m_residentSize,
+		.streamedTextureCount = static_cast<uint32_t>(m_textures.size()),
+		.evictionCount = m_evictionCount
+	};
+
+	for (const auto& [key, streamedTexture] : m_textures)
+	{
+		stats.requestedSize += GetLevelsSize(streamedTexture, streamedTexture.lastUsedFrame + 1 == m_frame ? streamedTexture.requestedLevel : streamedTexture.desc.residentLevel);
+		stats.pendingLoadCount += streamedTexture.pendingLevel.has_value() ? 1 : 0;
+	}
+
+	OvRendering::Utils::ResourceTracking::SetTextureStreamingStats(stats);
+}
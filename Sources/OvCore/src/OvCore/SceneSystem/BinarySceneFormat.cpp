@@ -0,0 +1,545 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <array>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+
+#include <tinyxml2.h>
+
+#include <OvCore/SceneSystem/BinarySceneFormat.h>
+#include <OvDebug/Logger.h>
+#include <OvTools/Filesystem/MappedFile.h>
+#include <OvTools/Utils/PathParser.h>
+
+namespace
+{
+	constexpr std::array<char, 4> kMagic = { 'O', 'V', 'S', 'C' };
+
+	// Bump whenever the layout of the header or of the chunk table changes
+	constexpr uint32_t kFormatVersion = 1;
+
+	// Every chunk is versioned on its own, so a reader can skip the chunks it doesn't know
+	constexpr std::array<char, 4> kStringTableChunk = { 'S', 'T', 'R', 'S' };
+	constexpr std::array<char, 4> kAssetTableChunk = { 'A', 'S', 'S', 'T' };
+	constexpr std::array<char, 4> kTreeChunk = { 'T', 'R', 'E', 'E' };
+	constexpr uint32_t kStringTableVersion = 1;
+	constexpr uint32_t kAssetTableVersion = 1;
+	constexpr uint32_t kTreeVersion = 1;
+
+	constexpr uint32_t kNoString = UINT32_MAX;
+
+	struct FileHeader
+	{
+		std::array<char, 4> magic = kMagic;
+		uint32_t formatVersion = kFormatVersion;
+		uint32_t isBigEndian = std::endian::native == std::endian::big ? 1 : 0;
+		uint32_t chunkCount = 0;
+	};
+
+	struct ChunkHeader
+	{
+		std::array<char, 4> id = {};
+		uint32_t version = 0;
+		uint64_t size = 0;
+	};
+
+	class BlobWriter
+	{
+	public:
+		template<typename T>
+		void Write(const T& p_value)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			WriteBytes(&p_value, sizeof(T));
+		}
+
+		void WriteBytes(const void* p_data, size_t p_size)
+		{
+			const auto* bytes = static_cast<const uint8_t*>(p_data);
+			m_bytes.insert(m_bytes.end(), bytes, bytes + p_size);
+		}
+
+		/**
+		* Append the given chunk, prefixed by its header
+		* @param p_id
+		* @param p_version
+		* @param p_chunk
+		*/
+		void WriteChunk(const std::array<char, 4>& p_id, uint32_t p_version, const BlobWriter& p_chunk)
+		{
+			Write(ChunkHeader{ p_id, p_version, p_chunk.m_bytes.size() });
+			WriteBytes(p_chunk.m_bytes.data(), p_chunk.m_bytes.size());
+		}
+
+		const std::vector<uint8_t>& GetBytes() const
+		{
+			return m_bytes;
+		}
+
+	private:
+		std::vector<uint8_t> m_bytes;
+	};
+
+	/**
+	* Bounds-checked reader, any out of range read invalidates the reader and returns zeroed values
+	*/
+	class BlobReader
+	{
+	public:
+		BlobReader(std::span<const uint8_t> p_data) : m_data(p_data) {}
+
+		template<typename T>
+		T Read()
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			T result{};
+			ReadBytes(&result, sizeof(T));
+			return result;
+		}
+
+		void ReadBytes(void* p_destination, size_t p_size)
+		{
+			if (!m_valid || p_size > m_data.size() - m_cursor)
+			{
+				m_valid = false;
+				return;
+			}
+
+			std::memcpy(p_destination, m_data.data() + m_cursor, p_size);
+			m_cursor += p_size;
+		}
+
+		/**
+		* Consume the given number of bytes and return them, or an empty span if they are out of range
+		* @param p_size
+		*/
+		std::span<const uint8_t> ReadSpan(uint64_t p_size)
+		{
+			if (!m_valid || p_size > m_data.size() - m_cursor)
+			{
+				m_valid = false;
+				return {};
+			}
+
+			const auto result = m_data.subspan(m_cursor, static_cast<size_t>(p_size));
+			m_cursor += static_cast<size_t>(p_size);
+			return result;
+		}
+
+		/**
+		* Read an element count, rejecting counts that can't fit in the remaining bytes
+		* @param p_minElementSize
+		*/
+		uint64_t ReadCount(size_t p_minElementSize)
+		{
+			const uint64_t count = Read<uint64_t>();
+
+			if (p_minElementSize > 0 && count > (m_data.size() - m_cursor) / p_minElementSize)
+			{
+				m_valid = false;
+				return 0;
+			}
+
+			return count;
+		}
+
+		bool IsValid() const
+		{
+			return m_valid;
+		}
+
+		bool IsAtEnd() const
+		{
+			return m_cursor == m_data.size();
+		}
+
+	private:
+		std::span<const uint8_t> m_data;
+		size_t m_cursor = 0;
+		bool m_valid = true;
+	};
+
+	/**
+	* Assign an index to every distinct string of the document
+	*/
+	class StringTable
+	{
+	public:
+		uint32_t Intern(std::string_view p_value)
+		{
+			if (auto found = m_indices.find(p_value); found != m_indices.end())
+			{
+				return found->second;
+			}
+
+			const auto index = static_cast<uint32_t>(m_offsets.size());
+			m_offsets.push_back(static_cast<uint32_t>(m_blob.size()));
+			m_blob.insert(m_blob.end(), p_value.begin(), p_value.end());
+			m_blob.push_back('\0');
+			m_indices.emplace(p_value, index);
+			return index;
+		}
+
+		/**
+		* Returns the indices of the strings that are paths to loadable assets
+		*/
+		std::vector<uint32_t> FindAssetReferences() const
+		{
+			using namespace OvTools::Utils;
+
+			std::vector<uint32_t> result;
+
+			for (uint32_t i = 0; i < m_offsets.size(); ++i)
+			{
+				switch (PathParser::GetFileType(m_blob.data() + m_offsets[i]))
+				{
+				case PathParser::EFileType::MODEL:
+				case PathParser::EFileType::TEXTURE:
+				case PathParser::EFileType::SHADER:
+				case PathParser::EFileType::MATERIAL:
+				case PathParser::EFileType::SOUND:
+					result.push_back(i);
+					break;
+				default:
+					break;
+				}
+			}
+
+			return result;
+		}
+
+		void Write(BlobWriter& p_writer) const
+		{
+			p_writer.Write(static_cast<uint64_t>(m_offsets.size()));
+			p_writer.WriteBytes(m_offsets.data(), m_offsets.size() * sizeof(uint32_t));
+			p_writer.Write(static_cast<uint64_t>(m_blob.size()));
+			p_writer.WriteBytes(m_blob.data(), m_blob.size());
+		}
+
+	private:
+		// Keys view the strings of the encoded document, which outlives the table
+		std::unordered_map<std::string_view, uint32_t> m_indices;
+		std::vector<uint32_t> m_offsets;
+		std::vector<char> m_blob;
+	};
+
+	/**
+	* Elements are written in pre-order: name, text, attributes, then the number of child elements that follow.
+	* Comments and other non-element nodes aren't kept
+	* @param p_element
+	* @param p_strings
+	* @param p_writer
+	*/
+	void WriteElement(const tinyxml2::XMLElement& p_element, StringTable& p_strings, BlobWriter& p_writer)
+	{
+		const char* text = p_element.GetText();
+
+		p_writer.Write(p_strings.Intern(p_element.Name()));
+		p_writer.Write(text ? p_strings.Intern(text) : kNoString);
+
+		uint32_t attributeCount = 0;
+		for (auto attribute = p_element.FirstAttribute(); attribute; attribute = attribute->Next())
+		{
+			++attributeCount;
+		}
+
+		p_writer.Write(attributeCount);
+		for (auto attribute = p_element.FirstAttribute(); attribute; attribute = attribute->Next())
+		{
+			p_writer.Write(p_strings.Intern(attribute->Name()));
+			p_writer.Write(p_strings.Intern(attribute->Value()));
+		}
+
+		uint32_t childCount = 0;
+		for (auto child = p_element.FirstChildElement(); child; child = child->NextSiblingElement())
+		{
+			++childCount;
+		}
+
+		p_writer.Write(childCount);
+		for (auto child = p_element.FirstChildElement(); child; child = child->NextSiblingElement())
+		{
+			WriteElement(*child, p_strings, p_writer);
+		}
+	}
+
+	std::vector<uint8_t> Encode(const tinyxml2::XMLDocument& p_document)
+	{
+		StringTable strings;
+		BlobWriter tree;
+
+		uint32_t rootCount = 0;
+		for (auto root = p_document.FirstChildElement(); root; root = root->NextSiblingElement())
+		{
+			++rootCount;
+		}
+
+		tree.Write(rootCount);
+		for (auto root = p_document.FirstChildElement(); root; root = root->NextSiblingElement())
+		{
+			WriteElement(*root, strings, tree);
+		}
+
+		BlobWriter stringTable;
+		strings.Write(stringTable);
+
+		const auto assetReferences = strings.FindAssetReferences();
+		BlobWriter assetTable;
+		assetTable.Write(static_cast<uint64_t>(assetReferences.size()));
+		assetTable.WriteBytes(assetReferences.data(), assetReferences.size() * sizeof(uint32_t));
+
+		FileHeader header;
+		header.chunkCount = 3;
+
+		BlobWriter file;
+		file.Write(header);
+		file.WriteChunk(kStringTableChunk, kStringTableVersion, stringTable);
+		file.WriteChunk(kAssetTableChunk, kAssetTableVersion, assetTable);
+		file.WriteChunk(kTreeChunk, kTreeVersion, tree);
+		return file.GetBytes();
+	}
+
+	bool IsHeaderCompatible(const FileHeader& p_header)
+	{
+		return
+			p_header.magic == kMagic &&
+			p_header.formatVersion == kFormatVersion &&
+			p_header.isBigEndian == (std::endian::native == std::endian::big ? 1u : 0u);
+	}
+
+	/**
+	* Returns the null-terminated strings of the table, pointing into the given data
+	* @param p_chunk
+	* @param p_strings
+	*/
+	bool ReadStringTable(std::span<const uint8_t> p_chunk, std::vector<const char*>& p_strings)
+	{
+		BlobReader reader(p_chunk);
+
+		std::vector<uint32_t> offsets(reader.ReadCount(sizeof(uint32_t)));
+		reader.ReadBytes(offsets.data(), offsets.size() * sizeof(uint32_t));
+		const auto blob = reader.ReadSpan(reader.ReadCount(1));
+
+		if (!reader.IsValid() || (!offsets.empty() && (blob.empty() || blob.back() != '\0')))
+		{
+			return false;
+		}
+
+		p_strings.resize(offsets.size());
+
+		for (size_t i = 0; i < offsets.size(); ++i)
+		{
+			if (offsets[i] >= blob.size())
+			{
+				return false;
+			}
+
+			p_strings[i] = reinterpret_cast<const char*>(blob.data() + offsets[i]);
+		}
+
+		return true;
+	}
+
+	bool ReadAssetTable(std::span<const uint8_t> p_chunk, const std::vector<const char*>& p_strings, std::vector<std::string>& p_assetReferences)
+	{
+		BlobReader reader(p_chunk);
+
+		const uint64_t count = reader.ReadCount(sizeof(uint32_t));
+		p_assetReferences.reserve(p_assetReferences.size() + count);
+
+		for (uint64_t i = 0; i < count && reader.IsValid(); ++i)
+		{
+			const uint32_t index = reader.Read<uint32_t>();
+
+			if (index >= p_strings.size())
+			{
+				return false;
+			}
+
+			p_assetReferences.emplace_back(p_strings[index]);
+		}
+
+		return reader.IsValid();
+	}
+
+	/**
+	* Rebuild the element tree. Iterative, so the depth of the tree can't overflow the stack
+	* @param p_chunk
+	* @param p_strings
+	* @param p_document
+	*/
+	bool ReadTree(std::span<const uint8_t> p_chunk, const std::vector<const char*>& p_strings, tinyxml2::XMLDocument& p_document)
+	{
+		struct PendingParent
+		{
+			tinyxml2::XMLNode* node;
+			uint32_t remainingChildren;
+		};
+
+		BlobReader reader(p_chunk);
+		std::vector<PendingParent> parents;
+
+		const auto getString = [&p_strings](uint32_t p_index) -> const char*
+		{
+			return p_index < p_strings.size() ? p_strings[p_index] : nullptr;
+		};
+
+		parents.push_back({ &p_document, reader.Read<uint32_t>() });
+
+		while (!parents.empty() && reader.IsValid())
+		{
+			if (parents.back().remainingChildren == 0)
+			{
+				parents.pop_back();
+				continue;
+			}
+
+			--parents.back().remainingChildren;
+
+			const char* name = getString(reader.Read<uint32_t>());
+			const uint32_t textIndex = reader.Read<uint32_t>();
+
+			if (!name || (textIndex != kNoString && !getString(textIndex)))
+			{
+				return false;
+			}
+
+			tinyxml2::XMLElement* element = p_document.NewElement(name);
+			parents.back().node->InsertEndChild(element);
+
+			if (textIndex != kNoString)
+			{
+				element->SetText(p_strings[textIndex]);
+			}
+
+			const uint32_t attributeCount = reader.Read<uint32_t>();
+			for (uint32_t i = 0; i < attributeCount && reader.IsValid(); ++i)
+			{
+				const char* attributeName = getString(reader.Read<uint32_t>());
+				const char* attributeValue = getString(reader.Read<uint32_t>());
+
+				if (!attributeName || !attributeValue)
+				{
+					return false;
+				}
+
+				element->SetAttribute(attributeName, attributeValue);
+			}
+
+			parents.push_back({ element, reader.Read<uint32_t>() });
+		}
+
+		return reader.IsValid() && parents.empty() && reader.IsAtEnd();
+	}
+
+	bool Decode(std::span<const uint8_t> p_data, tinyxml2::XMLDocument& p_document, std::vector<std::string>* p_assetReferences)
+	{
+		BlobReader reader(p_data);
+
+		const auto header = reader.Read<FileHeader>();
+
+		if (!reader.IsValid() || !IsHeaderCompatible(header))
+		{
+			return false;
+		}
+
+		std::span<const uint8_t> stringTableChunk;
+		std::span<const uint8_t> assetTableChunk;
+		std::span<const uint8_t> treeChunk;
+
+		for (uint32_t i = 0; i < header.chunkCount && reader.IsValid(); ++i)
+		{
+			const auto chunkHeader = reader.Read<ChunkHeader>();
+			const auto chunk = reader.ReadSpan(chunkHeader.size);
+
+			const auto match = [&chunkHeader](const std::array<char, 4>& p_id, uint32_t p_version)
+			{
+				return chunkHeader.id == p_id && chunkHeader.version == p_version;
+			};
+
+			if (match(kStringTableChunk, kStringTableVersion)) stringTableChunk = chunk;
+			else if (match(kAssetTableChunk, kAssetTableVersion)) assetTableChunk = chunk;
+			else if (match(kTreeChunk, kTreeVersion)) treeChunk = chunk;
+		}
+
+		std::vector<const char*> strings;
+
+		if (!reader.IsValid() || treeChunk.empty() || !ReadStringTable(stringTableChunk, strings))
+		{
+			return false;
+		}
+
+		// The asset table is only a loading hint, a scene without it (Or with a newer version of it) stays readable
+		if (p_assetReferences && !assetTableChunk.empty() && !ReadAssetTable(assetTableChunk, strings, *p_assetReferences))
+		{
+			return false;
+		}
+
+		return ReadTree(treeChunk, strings, p_document);
+	}
+}
+
+bool OvCore::SceneSystem::BinarySceneFormat::IsBinaryScene(const std::filesystem::path& p_path)
+{
+	std::ifstream file(p_path, std::ios::binary);
+	std::array<char, 4> magic = {};
+
+	return file.read(magic.data(), magic.size()) && magic == kMagic;
+}
+
+bool OvCore::SceneSystem::BinarySceneFormat::Save(const tinyxml2::XMLDocument& p_document, const std::filesystem::path& p_path)
+{
+	const auto bytes = Encode(p_document);
+
+	std::ofstream file(p_path, std::ios::binary | std::ios::trunc);
+	file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+
+	if (!file)
+	{
+		OVLOG_ERROR("Failed to write binary scene: " + p_path.string());
+		return false;
+	}
+
+	return true;
+}
+
+bool OvCore::SceneSystem::BinarySceneFormat::Load(
+	const std::filesystem::path& p_path,
+	tinyxml2::XMLDocument& p_document,
+	std::vector<std::string>* p_assetReferences
+)
+{
+	p_document.Clear();
+
+	const OvTools::Filesystem::MappedFile file(p_path);
+
+	if (!file.IsValid() || !Decode(file.GetData(), p_document, p_assetReferences))
+	{
+		p_document.Clear();
+		return false;
+	}
+
+	return true;
+}
+
+bool OvCore::SceneSystem::BinarySceneFormat::ConvertToBinary(const std::filesystem::path& p_path)
+{
+	tinyxml2::XMLDocument document;
+
+	if (document.LoadFile(p_path.string().c_str()) != tinyxml2::XMLError::XML_SUCCESS)
+	{
+		OVLOG_ERROR("Failed to convert scene to binary (Invalid XML): " + p_path.string());
+		return false;
+	}
+
+	return Save(document, p_path);
+}
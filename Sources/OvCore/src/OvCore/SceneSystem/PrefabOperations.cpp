@@ -5,6 +5,7 @@
 */
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -17,6 +18,75 @@
 
 namespace
 {
+	struct PrefabTemplate
+	{
+		std::filesystem::file_time_type lastWriteTime;
+		uint64_t checkedRevision = 0;
+		tinyxml2::XMLDocument document;
+		tinyxml2::XMLElement* actorsNode = nullptr;
+	};
+
+	// Incremented by RevalidateCache, a cached file is checked for modifications at most once per revision
+	uint64_t cacheRevision = 0;
+
+	// Parsed prefab files, keyed by their normalized path
+	std::unordered_map<std::string, std::unique_ptr<PrefabTemplate>>& GetPrefabTemplates()
+	{
+		static std::unordered_map<std::string, std::unique_ptr<PrefabTemplate>> templates;
+		return templates;
+	}
+
+	std::string GetTemplateKey(const std::filesystem::path& p_prefabPath)
+	{
+		return p_prefabPath.lexically_normal().generic_string();
+	}
+
+	// Returns the parsed prefab file, reading it only if it isn't cached or has been modified since
+	PrefabTemplate* LoadPrefabTemplate(const std::filesystem::path& p_prefabPath)
+	{
+		auto& prefabTemplate = GetPrefabTemplates()[GetTemplateKey(p_prefabPath)];
+
+		// Spawning many instances in a frame only queries the file system once
+		if (prefabTemplate && prefabTemplate->checkedRevision == cacheRevision)
+		{
+			return prefabTemplate.get();
+		}
+
+		std::error_code errorCode;
+		const auto lastWriteTime = std::filesystem::last_write_time(p_prefabPath, errorCode);
+
+		if (prefabTemplate && !errorCode && prefabTemplate->lastWriteTime == lastWriteTime)
+		{
+			prefabTemplate->checkedRevision = cacheRevision;
+			return prefabTemplate.get();
+		}
+
+		prefabTemplate = std::make_unique<PrefabTemplate>();
+		prefabTemplate->lastWriteTime = lastWriteTime;
+		prefabTemplate->checkedRevision = cacheRevision;
+
+		const auto loadResult = prefabTemplate->document.LoadFile(p_prefabPath.string().c_str());
+		if (loadResult != tinyxml2::XML_SUCCESS)
+		{
+			OVLOG_ERROR("Failed to instantiate prefab \"" + p_prefabPath.string() + "\": XML parsing failed (code " + std::to_string(loadResult) + ").");
+			GetPrefabTemplates().erase(GetTemplateKey(p_prefabPath));
+			return nullptr;
+		}
+
+		auto* rootNode = prefabTemplate->document.FirstChildElement("root");
+		auto* prefabNode = rootNode ? rootNode->FirstChildElement("prefab") : nullptr;
+		prefabTemplate->actorsNode = prefabNode ? prefabNode->FirstChildElement("actors") : nullptr;
+
+		if (!prefabTemplate->actorsNode)
+		{
+			OVLOG_ERROR("Failed to instantiate prefab \"" + p_prefabPath.string() + "\": missing <root>/<prefab>/<actors> node.");
+			GetPrefabTemplates().erase(GetTemplateKey(p_prefabPath));
+			return nullptr;
+		}
+
+		return prefabTemplate.get();
+	}
+
 	void NormalizePrefabSourcesRecursively(
 		OvCore::ECS::Actor& p_actor,
 		const std::string& p_inheritedPrefabSource)
@@ -73,7 +143,12 @@ bool OvCore::SceneSystem::PrefabOperations::SaveToFile(OvCore::ECS::Actor& p_roo
 
 	SerializeActorHierarchy(p_rootActor, doc, *actorsNode);
 
-	return doc.SaveFile(p_outputPath.string().c_str()) == tinyxml2::XML_SUCCESS;
+	const bool saved = doc.SaveFile(p_outputPath.string().c_str()) == tinyxml2::XML_SUCCESS;
+
+	// The modification time alone can miss saves happening within its resolution
+	InvalidateCache(p_outputPath);
+
+	return saved;
 }
 
 void OvCore::SceneSystem::PrefabOperations::SetRootPrefabSourceAndNormalizeChildren(
@@ -98,23 +173,14 @@ OvCore::ECS::Actor* OvCore::SceneSystem::PrefabOperations::InstantiateFromFile(
 		return nullptr;
 	}
 
-	tinyxml2::XMLDocument doc;
-	const auto loadResult = doc.LoadFile(p_prefabPath.string().c_str());
-	if (loadResult != tinyxml2::XML_SUCCESS)
+	auto* prefabTemplate = LoadPrefabTemplate(p_prefabPath);
+	if (!prefabTemplate)
 	{
-		OVLOG_ERROR("Failed to instantiate prefab \"" + p_prefabPath.string() + "\": XML parsing failed (code " + std::to_string(loadResult) + ").");
 		return nullptr;
 	}
 
-	auto* rootNode = doc.FirstChildElement("root");
-	auto* prefabNode = rootNode ? rootNode->FirstChildElement("prefab") : nullptr;
-	auto* actorsNode = prefabNode ? prefabNode->FirstChildElement("actors") : nullptr;
-
-	if (!actorsNode)
-	{
-		OVLOG_ERROR("Failed to instantiate prefab \"" + p_prefabPath.string() + "\": missing <root>/<prefab>/<actors> node.");
-		return nullptr;
-	}
+	auto& doc = prefabTemplate->document;
+	auto* actorsNode = prefabTemplate->actorsNode;
 
 	struct PendingAttachment
 	{
@@ -164,3 +230,18 @@ OvCore::ECS::Actor* OvCore::SceneSystem::PrefabOperations::InstantiateFromFile(
 
 	return instantiatedRoot;
 }
+
+void OvCore::SceneSystem::PrefabOperations::InvalidateCache(const std::filesystem::path& p_prefabPath)
+{
+	GetPrefabTemplates().erase(GetTemplateKey(p_prefabPath));
+}
+
+void OvCore::SceneSystem::PrefabOperations::RevalidateCache()
+{
+	++cacheRevision;
+}
+
+void OvCore::SceneSystem::PrefabOperations::ClearCache()
+{
+	GetPrefabTemplates().clear();
+}
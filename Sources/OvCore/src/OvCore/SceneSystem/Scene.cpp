@@ -14,13 +14,19 @@
 #include <OvDebug/Assertion.h>
 #include <OvDebug/Logger.h>
 #include <OvCore/ECS/Components/CAmbientSphereLight.h>
+#include <OvCore/ECS/Components/CAudioSource.h>
 #include <OvCore/ECS/Components/CDirectionalLight.h>
 #include <OvCore/ECS/Components/CMaterialRenderer.h>
+#include <OvCore/ECS/Components/CPhysicalConvex.h>
+#include <OvCore/ECS/Components/CPhysicalMesh.h>
+#include <OvCore/ECS/Components/CSkinnedMeshRenderer.h>
 #include <OvCore/Global/ServiceLocator.h>
 #include <OvCore/ResourceManagement/MaterialManager.h>
 #include <OvCore/ResourceManagement/ModelManager.h>
+#include <OvCore/ResourceManagement/ResourceUsage.h>
 #include <OvCore/SceneSystem/PrefabOperations.h>
 #include <OvCore/SceneSystem/Scene.h>
+#include <OvCore/Scripting/ScriptEngine.h>
 #include <OvTools/Utils/PathParser.h>
 
 OvCore::SceneSystem::Scene::Scene(
@@ -136,6 +142,9 @@ void OvCore::SceneSystem::Scene::Update(float p_deltaTime)
 	ZoneScoped;
 	auto actors = m_actors;
 	std::for_each(actors.begin(), actors.end(), std::bind(std::mem_fn(&ECS::Actor::OnUpdate), std::placeholders::_1, p_deltaTime));
+
+	// Coroutines resume after OnUpdate and before OnLateUpdate
+	OVSERVICE(OvCore::Scripting::ScriptEngine).UpdateCoroutines(p_deltaTime);
 }
 
 void OvCore::SceneSystem::Scene::FixedUpdate(float p_deltaTime)
@@ -143,6 +152,7 @@ void OvCore::SceneSystem::Scene::FixedUpdate(float p_deltaTime)
 	ZoneScoped;
 	auto actors = m_actors;
 	std::for_each(actors.begin(), actors.end(), std::bind(std::mem_fn(&ECS::Actor::OnFixedUpdate), std::placeholders::_1, p_deltaTime));
+	OVSERVICE(OvCore::Scripting::ScriptEngine).FixedUpdateCoroutines();
 }
 
 void OvCore::SceneSystem::Scene::LateUpdate(float p_deltaTime)
@@ -266,6 +276,32 @@ OvCore::ECS::Actor* OvCore::SceneSystem::Scene::InstantiatePrefabInternal(
 		return nullptr;
 	}
 
+	const std::string prefabSource = OvTools::Utils::PathParser::MakeNonWindowsStyle(std::filesystem::path{ p_prefabPath }.generic_string());
+
+	if (auto pool = m_prefabPools.find(prefabSource); pool != m_prefabPools.end())
+	{
+		while (!pool->second.empty())
+		{
+			auto* pooledInstance = pool->second.back();
+			pool->second.pop_back();
+			m_pooledActors.erase(pooledInstance);
+
+			// Destroyed by a script while in the pool, it will be collected at the end of the frame
+			if (!pooledInstance->IsAlive())
+			{
+				continue;
+			}
+
+			if (p_parent)
+			{
+				pooledInstance->SetParent(p_parent.value());
+			}
+
+			pooledInstance->SetActive(true);
+			return pooledInstance;
+		}
+	}
+
 	const std::filesystem::path realPath = GetRealAssetPath(p_prefabPath);
 	BeginBatchActorCreation();
 
@@ -284,10 +320,7 @@ OvCore::ECS::Actor* OvCore::SceneSystem::Scene::InstantiatePrefabInternal(
 		return nullptr;
 	}
 
-	PrefabOperations::SetRootPrefabSourceAndNormalizeChildren(
-		*instantiatedRoot,
-		OvTools::Utils::PathParser::MakeNonWindowsStyle(std::filesystem::path{ p_prefabPath }.generic_string())
-	);
+	PrefabOperations::SetRootPrefabSourceAndNormalizeChildren(*instantiatedRoot, prefabSource);
 
 	const std::string prefabName = realPath.stem().string();
 	if (!prefabName.empty())
@@ -305,6 +338,75 @@ OvCore::ECS::Actor* OvCore::SceneSystem::Scene::InstantiatePrefabInternal(
 	return instantiatedRoot;
 }
 
+bool OvCore::SceneSystem::Scene::ReleaseToPool(ECS::Actor& p_actor)
+{
+	// The children of a prefab instance have no prefab source, unless they are themselves nested prefab instances
+	if (!p_actor.HasPrefabSource() || !p_actor.IsAlive() || m_pooledActors.contains(&p_actor))
+	{
+		return false;
+	}
+
+	p_actor.SetActive(false);
+	p_actor.DetachFromParent();
+
+	m_prefabPools[p_actor.GetPrefabSource()].push_back(&p_actor);
+	m_pooledActors.insert(&p_actor);
+
+	return true;
+}
+
+void OvCore::SceneSystem::Scene::ClearPools()
+{
+	for (const auto& [prefabSource, pool] : m_prefabPools)
+	{
+		for (auto* pooledInstance : pool)
+		{
+			pooledInstance->MarkAsDestroy();
+		}
+	}
+
+	m_prefabPools.clear();
+	m_pooledActors.clear();
+}
+
+size_t OvCore::SceneSystem::Scene::GetPooledInstanceCount(const std::string& p_prefabPath) const
+{
+	const std::string prefabSource = OvTools::Utils::PathParser::MakeNonWindowsStyle(std::filesystem::path{ p_prefabPath }.generic_string());
+
+	if (auto pool = m_prefabPools.find(prefabSource); pool != m_prefabPools.end())
+	{
+		return pool->second.size();
+	}
+
+	return 0;
+}
+
+bool OvCore::SceneSystem::Scene::IsPooled(const ECS::Actor& p_actor) const
+{
+	if (m_pooledActors.empty())
+	{
+		return false;
+	}
+
+	for (const ECS::Actor* actor = &p_actor; actor; actor = actor->GetParent())
+	{
+		if (m_pooledActors.contains(actor))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void OvCore::SceneSystem::Scene::RemoveFromPool(ECS::Actor& p_actor)
+{
+	if (m_pooledActors.erase(&p_actor) > 0)
+	{
+		std::erase(m_prefabPools[p_actor.GetPrefabSource()], &p_actor);
+	}
+}
+
 bool OvCore::SceneSystem::Scene::DestroyActor(ECS::Actor& p_target)
 {
 	auto found = std::find_if(m_actors.begin(), m_actors.end(), [&p_target](OvCore::ECS::Actor* element)
@@ -314,6 +416,7 @@ bool OvCore::SceneSystem::Scene::DestroyActor(ECS::Actor& p_target)
 
 	if (found != m_actors.end())
 	{
+		RemoveFromPool(**found);
 		delete *found;
 		m_actors.erase(found);
 		return true;
@@ -331,6 +434,7 @@ void OvCore::SceneSystem::Scene::CollectGarbages()
 		bool isGarbage = !element->IsAlive();
 		if (isGarbage)
 		{
+			RemoveFromPool(*element);
 			delete element;
 		}
 		return isGarbage;
@@ -471,6 +575,56 @@ const OvCore::SceneSystem::Scene::FastAccessComponents& OvCore::SceneSystem::Sce
 	return m_fastAccessComponents;
 }
 
+void OvCore::SceneSystem::Scene::CollectResourceUsage(ResourceManagement::ResourceUsage& p_usage) const
+{
+	using namespace OvCore::ECS::Components;
+
+	const auto addModel = [&p_usage](const OvRendering::Resources::Model* p_model)
+	{
+		if (p_model)
+		{
+			p_usage.models.insert(p_model);
+		}
+	};
+
+	for (const auto actor : m_actors)
+	{
+		for (const auto& component : actor->GetComponents())
+		{
+			if (const auto modelRenderer = dynamic_cast<CModelRenderer*>(component.get()))
+			{
+				addModel(modelRenderer->GetModel());
+			}
+			else if (const auto materialRenderer = dynamic_cast<CMaterialRenderer*>(component.get()))
+			{
+				for (const auto material : materialRenderer->GetMaterials())
+				{
+					if (material)
+					{
+						p_usage.AddMaterial(*material);
+					}
+				}
+			}
+			else if (const auto skinnedMeshRenderer = dynamic_cast<CSkinnedMeshRenderer*>(component.get()))
+			{
+				addModel(skinnedMeshRenderer->GetAnimationSourceModel());
+			}
+			else if (const auto physicalMesh = dynamic_cast<CPhysicalMesh*>(component.get()))
+			{
+				addModel(physicalMesh->GetModel());
+			}
+			else if (const auto physicalConvex = dynamic_cast<CPhysicalConvex*>(component.get()))
+			{
+				addModel(physicalConvex->GetModel());
+			}
+			else if (const auto audioSource = dynamic_cast<CAudioSource*>(component.get()); audioSource && audioSource->GetSound())
+			{
+				p_usage.sounds.insert(audioSource->GetSound());
+			}
+		}
+	}
+}
+
 void OvCore::SceneSystem::Scene::OnSerialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_root)
 {
 	tinyxml2::XMLNode* sceneNode = p_doc.NewElement("scene");
@@ -481,7 +635,11 @@ void OvCore::SceneSystem::Scene::OnSerialize(tinyxml2::XMLDocument & p_doc, tiny
 
 	for (auto& actor : m_actors)
 	{
-		actor->OnSerialize(p_doc, actorsNode);
+		// Pooled instances are runtime leftovers, not part of the scene
+		if (!IsPooled(*actor))
+		{
+			actor->OnSerialize(p_doc, actorsNode);
+		}
 	}
 }
 
@@ -493,26 +651,88 @@ void OvCore::SceneSystem::Scene::OnDeserialize(tinyxml2::XMLDocument & p_doc, ti
 	{
 		tinyxml2::XMLElement* currentActor = actorsRoot->FirstChildElement("actor");
 
-		int64_t maxID = 1;
-
 		while (currentActor)
 		{
-			auto& actor = CreateActor();
-			actor.OnDeserialize(p_doc, currentActor);
-			maxID = std::max(actor.GetID() + 1, maxID);
+			DeserializeActor(p_doc, currentActor);
 			currentActor = currentActor->NextSiblingElement("actor");
 		}
 
-		m_availableID = maxID;
+		LinkDeserializedActors();
+	}
+}
 
-		/* We recreate the hierarchy of the scene by attaching children to their parents */
-		for (auto actor : m_actors)
+OvCore::ECS::Actor& OvCore::SceneSystem::Scene::DeserializeActor(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLElement* p_actorNode)
+{
+	auto& actor = CreateActor();
+	actor.OnDeserialize(p_doc, p_actorNode);
+	return actor;
+}
+
+void OvCore::SceneSystem::Scene::LinkDeserializedActors()
+{
+	int64_t maxID = 1;
+
+	// Actors indexed by ID, so that linking the hierarchy doesn't search the whole scene for each actor
+	std::unordered_map<int64_t, ECS::Actor*> actorsByID;
+	actorsByID.reserve(m_actors.size());
+
+	for (auto actor : m_actors)
+	{
+		actorsByID.emplace(actor->GetID(), actor);
+		maxID = std::max(actor->GetID() + 1, maxID);
+	}
+
+	m_availableID = maxID;
+
+	/* We recreate the hierarchy of the scene by attaching children to their parents */
+	for (auto actor : m_actors)
+	{
+		if (actor->GetParentID() > 0 && !actor->HasParent())
 		{
-			if (actor->GetParentID() > 0)
-			{
-				if (auto found = FindActorByID(actor->GetParentID()); found)
-					actor->SetParent(*found);
-			}
+			if (auto found = actorsByID.find(actor->GetParentID()); found != actorsByID.end())
+				actor->SetParent(*found->second);
+		}
+	}
+}
+
+std::vector<OvCore::ECS::Actor*> OvCore::SceneSystem::Scene::DeserializeAdditive(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_root)
+{
+	std::vector<ECS::Actor*> createdActors;
+
+	tinyxml2::XMLElement* actorsRoot = p_root->FirstChildElement("actors");
+
+	if (!actorsRoot)
+	{
+		return createdActors;
+	}
+
+	std::vector<int64_t> sourceParentIDs;
+	std::unordered_map<int64_t, ECS::Actor*> sourceToInstance;
+
+	BeginBatchActorCreation();
+
+	for (auto currentActor = actorsRoot->FirstChildElement("actor"); currentActor; currentActor = currentActor->NextSiblingElement("actor"))
+	{
+		auto& actor = CreateActor();
+		const int64_t generatedID = actor.GetID();
+
+		actor.OnDeserialize(p_doc, currentActor);
+		sourceToInstance.emplace(actor.GetID(), &actor);
+		sourceParentIDs.push_back(actor.GetParentID());
+		createdActors.push_back(&actor);
+
+		actor.SetID(generatedID);
+	}
+
+	for (size_t i = 0; i < createdActors.size(); ++i)
+	{
+		if (auto found = sourceToInstance.find(sourceParentIDs[i]); sourceParentIDs[i] > 0 && found != sourceToInstance.end())
+		{
+			createdActors[i]->SetParent(*found->second);
 		}
 	}
+
+	EndBatchActorCreation(true);
+
+	return createdActors;
 }
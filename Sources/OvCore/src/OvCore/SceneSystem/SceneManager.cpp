@@ -4,16 +4,137 @@
 * @licence: MIT
 */
 
+#include <format>
+
 #include <tinyxml2.h>
 
 #include <OvCore/SceneSystem/SceneManager.h>
 #include <OvCore/ECS/Components/CDirectionalLight.h>
 #include <OvCore/ECS/Components/CAmbientSphereLight.h>
 #include <OvCore/ECS/Components/CCamera.h>
+#include <OvCore/SceneSystem/BinarySceneFormat.h>
+#include <OvCore/SceneSystem/PrefabOperations.h>
+#include <OvCore/Global/ServiceLocator.h>
+#include <OvCore/ResourceManagement/MaterialManager.h>
+#include <OvCore/ResourceManagement/ModelManager.h>
+#include <OvCore/ResourceManagement/ResourceUsage.h>
+#include <OvCore/ResourceManagement/ShaderManager.h>
+#include <OvCore/ResourceManagement/SoundManager.h>
+#include <OvCore/ResourceManagement/TextureManager.h>
 #include <OvDebug/Logger.h>
 #include <OvTools/Utils/PathParser.h>
 #include <OvWindowing/Dialogs/MessageBox.h>
 
+namespace
+{
+	template<typename T>
+	void ReleaseUnusedResources(
+		OvCore::ResourceManagement::AResourceManager<T>& p_manager,
+		const std::unordered_set<const T*>& p_usedResources,
+		std::chrono::steady_clock::time_point p_registeredBefore,
+		std::string_view p_managerName
+	)
+	{
+		const uint32_t unloadedCount = p_manager.UnloadUnusedResources(p_usedResources, p_registeredBefore);
+		const auto report = p_manager.GetMemoryReport();
+
+		OVLOG_INFO(std::format(
+			"{}: {} unused resource(s) unloaded, {} resident ({:.2f} MB), {} unloaded since startup ({:.2f} MB)",
+			p_managerName,
+			unloadedCount,
+			report.resourceCount,
+			static_cast<double>(report.memoryUsage) / (1024.0 * 1024.0),
+			report.unloadedResourceCount,
+			static_cast<double>(report.unloadedMemory) / (1024.0 * 1024.0)
+		));
+	}
+
+	/**
+	* Collect the texts of the given document that are paths to models or textures
+	*/
+	void CollectAssetReferences(const tinyxml2::XMLDocument& p_document, std::vector<std::string>& p_assetReferences)
+	{
+		using namespace OvTools::Utils;
+
+		std::vector<const tinyxml2::XMLElement*> elements;
+
+		for (auto root = p_document.FirstChildElement(); root; root = root->NextSiblingElement())
+		{
+			elements.push_back(root);
+		}
+
+		while (!elements.empty())
+		{
+			const auto element = elements.back();
+			elements.pop_back();
+
+			if (const char* text = element->GetText())
+			{
+				const auto fileType = PathParser::GetFileType(text);
+
+				if (fileType == PathParser::EFileType::MODEL || fileType == PathParser::EFileType::TEXTURE)
+				{
+					p_assetReferences.emplace_back(text);
+				}
+			}
+
+			for (auto child = element->FirstChildElement(); child; child = child->NextSiblingElement())
+			{
+				elements.push_back(child);
+			}
+		}
+	}
+
+	/**
+	* Read the given scene file, binary or XML, into the given document. Doesn't log, so it can be called from any thread
+	*/
+	bool ParseSceneFile(
+		const std::filesystem::path& p_path,
+		tinyxml2::XMLDocument& p_document,
+		std::vector<std::string>& p_assetReferences
+	)
+	{
+		if (OvCore::SceneSystem::BinarySceneFormat::IsBinaryScene(p_path))
+		{
+			return OvCore::SceneSystem::BinarySceneFormat::Load(p_path, p_document, &p_assetReferences);
+		}
+
+		if (p_document.LoadFile(p_path.string().c_str()) != tinyxml2::XMLError::XML_SUCCESS)
+		{
+			return false;
+		}
+
+		CollectAssetReferences(p_document, p_assetReferences);
+		return true;
+	}
+
+	/**
+	* Start loading the models and textures referenced by a scene in the background,
+	* so that they load while the scene is being deserialized instead of one after the other
+	*/
+	void PrefetchSceneAssets(const std::vector<std::string>& p_assetReferences)
+	{
+		using namespace OvTools::Utils;
+
+		auto& modelManager = OVSERVICE(OvCore::ResourceManagement::ModelManager);
+		auto& textureManager = OVSERVICE(OvCore::ResourceManagement::TextureManager);
+
+		for (const auto& path : p_assetReferences)
+		{
+			const auto fileType = PathParser::GetFileType(path);
+
+			if (fileType == PathParser::EFileType::MODEL)
+			{
+				modelManager.LoadResourceAsync(path);
+			}
+			else if (fileType == PathParser::EFileType::TEXTURE)
+			{
+				textureManager.LoadResourceAsync(path);
+			}
+		}
+	}
+}
+
 OvCore::SceneSystem::SceneManager::SceneManager(
 	const std::string& p_sceneRootFolder,
 	const std::string& p_engineAssetsFolder
@@ -31,11 +152,27 @@ OvCore::SceneSystem::SceneManager::~SceneManager()
 
 void OvCore::SceneSystem::SceneManager::Update()
 {
+	PrefabOperations::RevalidateCache();
+
 	if (m_delayedLoadCall)
 	{
 		m_delayedLoadCall();
 		m_delayedLoadCall = 0;
 	}
+
+	UpdateSceneLoadAsync();
+	UpdateStreaming();
+
+	// Postponed while a scene loads asynchronously, as its actors already reference resources
+	if (
+		m_sceneChangeTime &&
+		!m_pendingSceneLoad &&
+		std::chrono::steady_clock::now() - m_sceneChangeTime.value() >= std::chrono::duration<float>(m_resourceReleaseDelay)
+	)
+	{
+		ReleaseUnusedResources(m_sceneChangeTime.value());
+		m_sceneChangeTime.reset();
+	}
 }
 
 void OvCore::SceneSystem::SceneManager::LoadAndPlayDelayed(const std::string& p_path, bool p_absolute)
@@ -51,14 +188,29 @@ void OvCore::SceneSystem::SceneManager::LoadAndPlayDelayed(const std::string& p_
 
 void OvCore::SceneSystem::SceneManager::LoadEmptyScene()
 {
+	CancelSceneLoadAsync();
 	UnloadCurrentScene();
+
+	// The previous scene resources are kept for a while, as the next scene is likely to use some of them
+	if (m_resourceReleaseDelay >= 0.0f)
+	{
+		m_sceneChangeTime = std::chrono::steady_clock::now();
+	}
+
 	m_currentScene.reset(new Scene(m_sceneRootFolder, m_engineAssetsFolder));
 	SceneLoadEvent.Invoke();
 }
 
 void OvCore::SceneSystem::SceneManager::LoadDefaultScene()
 {
+	CancelSceneLoadAsync();
 	UnloadCurrentScene();
+
+	if (m_resourceReleaseDelay >= 0.0f)
+	{
+		m_sceneChangeTime = std::chrono::steady_clock::now();
+	}
+
 	m_currentScene.reset(new Scene(m_sceneRootFolder, m_engineAssetsFolder));
 	m_currentScene->AddDefaultCamera();
 	m_currentScene->AddDefaultLights();
@@ -70,15 +222,23 @@ void OvCore::SceneSystem::SceneManager::LoadDefaultScene()
 
 bool OvCore::SceneSystem::SceneManager::LoadScene(const std::string& p_path, bool p_absolute)
 {
-	std::filesystem::path path = 
-		p_absolute ?
-		std::filesystem::current_path() :
-		std::filesystem::path{ m_sceneRootFolder };
-
-	path /= OvTools::Utils::PathParser::MakeNonWindowsStyle(p_path);
+	const std::filesystem::path path = GetScenePath(p_path, p_absolute);
 
 	tinyxml2::XMLDocument doc;
-	if (doc.LoadFile(path.string().c_str()) != tinyxml2::XMLError::XML_SUCCESS)
+
+	if (BinarySceneFormat::IsBinaryScene(path))
+	{
+		std::vector<std::string> assetReferences;
+
+		if (!BinarySceneFormat::Load(path, doc, &assetReferences))
+		{
+			OVLOG_ERROR(std::format("Failed to load scene (Corrupted or incompatible binary scene): {}", path.string()));
+			return false;
+		}
+
+		PrefetchSceneAssets(assetReferences);
+	}
+	else if (doc.LoadFile(path.string().c_str()) != tinyxml2::XMLError::XML_SUCCESS)
 	{
 		OVLOG_ERROR(std::format("Failed to load scene: {}", path.string()));
 		return false;
@@ -114,6 +274,311 @@ bool OvCore::SceneSystem::SceneManager::LoadSceneFromMemory(tinyxml2::XMLDocumen
 	return false;
 }
 
+void OvCore::SceneSystem::SceneManager::LoadSceneAsync(const std::string& p_path, bool p_play, bool p_absolute)
+{
+	CancelSceneLoadAsync();
+
+	auto load = std::make_unique<PendingSceneLoad>();
+	load->path = GetScenePath(p_path, p_absolute).string();
+	load->play = p_play;
+
+	auto parse = [path = std::filesystem::path{ load->path }]
+	{
+		ParsedScene result;
+		result.document = std::make_unique<tinyxml2::XMLDocument>();
+		result.succeeded = ParseSceneFile(path, *result.document, result.assetReferences);
+		return result;
+	};
+
+	load->parsing = m_threadPool ?
+		m_threadPool->Submit(std::move(parse)) :
+		std::async(std::launch::async, std::move(parse));
+
+	m_pendingSceneLoad = std::move(load);
+}
+
+void OvCore::SceneSystem::SceneManager::CancelSceneLoadAsync()
+{
+	if (m_pendingSceneLoad)
+	{
+		m_pendingSceneLoad.reset();
+		SceneLoadAsyncCompletedEvent.Invoke(false);
+	}
+}
+
+bool OvCore::SceneSystem::SceneManager::IsLoadingSceneAsync() const
+{
+	return m_pendingSceneLoad != nullptr;
+}
+
+float OvCore::SceneSystem::SceneManager::GetSceneLoadProgress() const
+{
+	if (!m_pendingSceneLoad || m_pendingSceneLoad->actorCount == 0)
+	{
+		return 0.0f;
+	}
+
+	return static_cast<float>(m_pendingSceneLoad->createdActorCount) / static_cast<float>(m_pendingSceneLoad->actorCount);
+}
+
+void OvCore::SceneSystem::SceneManager::SetSceneActivationBudget(float p_budget)
+{
+	m_sceneActivationBudget = p_budget;
+}
+
+float OvCore::SceneSystem::SceneManager::GetSceneActivationBudget() const
+{
+	return m_sceneActivationBudget;
+}
+
+void OvCore::SceneSystem::SceneManager::ProvideThreadPool(OvTools::Utils::ThreadPool* p_threadPool)
+{
+	m_threadPool = p_threadPool;
+}
+
+std::filesystem::path OvCore::SceneSystem::SceneManager::GetScenePath(const std::string& p_path, bool p_absolute) const
+{
+	std::filesystem::path path =
+		p_absolute ?
+		std::filesystem::current_path() :
+		std::filesystem::path{ m_sceneRootFolder };
+
+	path /= OvTools::Utils::PathParser::MakeNonWindowsStyle(p_path);
+	return path;
+}
+
+void OvCore::SceneSystem::SceneManager::UpdateSceneLoadAsync()
+{
+	if (!m_pendingSceneLoad)
+	{
+		return;
+	}
+
+	auto& load = *m_pendingSceneLoad;
+
+	if (!load.scene)
+	{
+		if (load.parsing.wait_for(std::chrono::seconds::zero()) != std::future_status::ready)
+		{
+			return;
+		}
+
+		try
+		{
+			load.parsed = load.parsing.get();
+		}
+		catch (const std::future_error&)
+		{
+			// The thread pool has been destroyed before parsing the scene, load.parsed reports the failure
+		}
+
+		tinyxml2::XMLElement* sceneNode = nullptr;
+
+		if (load.parsed.succeeded)
+		{
+			if (auto root = load.parsed.document->FirstChild())
+			{
+				sceneNode = root->FirstChildElement("scene");
+			}
+		}
+
+		if (!sceneNode)
+		{
+			OVLOG_ERROR(std::format("Failed to load scene: {}", load.path));
+			CancelSceneLoadAsync();
+			return;
+		}
+
+		// The resources are requested first, so that they load in the background while the actors get created
+		PrefetchSceneAssets(load.parsed.assetReferences);
+
+		load.scene = std::make_unique<Scene>(m_sceneRootFolder, m_engineAssetsFolder);
+
+		if (auto actorsNode = sceneNode->FirstChildElement("actors"))
+		{
+			load.nextActor = actorsNode->FirstChildElement("actor");
+		}
+
+		for (auto actor = load.nextActor; actor; actor = actor->NextSiblingElement("actor"))
+		{
+			++load.actorCount;
+		}
+	}
+
+	const auto activationStart = std::chrono::steady_clock::now();
+	const auto activationBudget = std::chrono::duration<float, std::milli>(m_sceneActivationBudget);
+
+	while (load.nextActor)
+	{
+		load.scene->DeserializeActor(*load.parsed.document, load.nextActor);
+		load.nextActor = load.nextActor->NextSiblingElement("actor");
+		++load.createdActorCount;
+
+		if (std::chrono::steady_clock::now() - activationStart >= activationBudget)
+		{
+			break;
+		}
+	}
+
+	if (!load.nextActor)
+	{
+		CompleteSceneLoadAsync();
+	}
+}
+
+void OvCore::SceneSystem::SceneManager::CompleteSceneLoadAsync()
+{
+	const auto load = std::move(m_pendingSceneLoad);
+	load->scene->LinkDeserializedActors();
+
+	// Like LoadAndPlayDelayed, a scene loaded to be played keeps the source path of the scene it replaces
+	const std::string sourcePath = load->play ? GetCurrentSceneSourcePath() : load->path;
+
+	UnloadCurrentScene();
+
+	if (m_resourceReleaseDelay >= 0.0f)
+	{
+		m_sceneChangeTime = std::chrono::steady_clock::now();
+	}
+
+	m_currentScene = std::move(load->scene);
+	StoreCurrentSceneSourcePath(sourcePath);
+	SceneLoadEvent.Invoke();
+
+	if (load->play)
+	{
+		m_currentScene->Play();
+
+		// Copied, as the callbacks can create or destroy actors
+		const std::string sceneName = std::filesystem::path{ load->path }.stem().string();
+		const auto actors = m_currentScene->GetActors();
+
+		for (auto actor : actors)
+		{
+			actor->OnSceneLoaded(sceneName);
+		}
+	}
+
+	SceneLoadAsyncCompletedEvent.Invoke(true);
+}
+
+bool OvCore::SceneSystem::SceneManager::LoadSceneAdditive(const std::string& p_path, bool p_absolute)
+{
+	const std::filesystem::path path = GetScenePath(p_path, p_absolute);
+	const std::string key = path.lexically_normal().generic_string();
+
+	if (!m_currentScene || m_additiveScenes.contains(key))
+	{
+		return false;
+	}
+
+	tinyxml2::XMLDocument doc;
+	std::vector<std::string> assetReferences;
+
+	if (!ParseSceneFile(path, doc, assetReferences))
+	{
+		OVLOG_ERROR(std::format("Failed to load scene additively: {}", path.string()));
+		return false;
+	}
+
+	tinyxml2::XMLElement* sceneNode = nullptr;
+
+	if (auto root = doc.FirstChild())
+	{
+		sceneNode = root->FirstChildElement("scene");
+	}
+
+	if (!sceneNode)
+	{
+		OVLOG_ERROR(std::format("Failed to load scene additively (No scene found): {}", path.string()));
+		return false;
+	}
+
+	PrefetchSceneAssets(assetReferences);
+
+	auto& actorIDs = m_additiveScenes[key];
+
+	for (const auto actor : m_currentScene->DeserializeAdditive(doc, sceneNode))
+	{
+		actorIDs.push_back(actor->GetID());
+	}
+
+	return true;
+}
+
+bool OvCore::SceneSystem::SceneManager::UnloadSceneAdditive(const std::string& p_path, bool p_absolute)
+{
+	const auto found = m_additiveScenes.find(GetScenePath(p_path, p_absolute).lexically_normal().generic_string());
+
+	if (found == m_additiveScenes.end())
+	{
+		return false;
+	}
+
+	const std::unordered_set<int64_t> actorIDs(found->second.begin(), found->second.end());
+	m_additiveScenes.erase(found);
+
+	// Marked actors are deleted by the next garbage collection of the scene, like actors destroyed by gameplay
+	for (const auto actor : m_currentScene->GetActors())
+	{
+		if (actor->IsAlive() && actorIDs.contains(actor->GetID()))
+		{
+			actor->MarkAsDestroy();
+		}
+	}
+
+	return true;
+}
+
+bool OvCore::SceneSystem::SceneManager::IsSceneLoadedAdditive(const std::string& p_path, bool p_absolute) const
+{
+	return m_additiveScenes.contains(GetScenePath(p_path, p_absolute).lexically_normal().generic_string());
+}
+
+OvCore::SceneSystem::SceneStreamer& OvCore::SceneSystem::SceneManager::GetStreamer()
+{
+	return m_streamer;
+}
+
+void OvCore::SceneSystem::SceneManager::SetStreamingAnchor(const std::optional<OvMaths::FVector3>& p_anchor)
+{
+	m_streamingAnchor = p_anchor;
+}
+
+void OvCore::SceneSystem::SceneManager::UpdateStreaming()
+{
+	if (!m_currentScene || !m_streamer.HasChunks())
+	{
+		return;
+	}
+
+	std::optional<OvMaths::FVector3> anchor = m_streamingAnchor;
+
+	if (!anchor)
+	{
+		if (auto camera = m_currentScene->FindMainCamera())
+		{
+			anchor = camera->owner.transform.GetWorldPosition();
+		}
+	}
+
+	if (anchor)
+	{
+		const auto requests = m_streamer.Update(anchor.value());
+
+		for (const auto& path : requests.toUnload)
+		{
+			UnloadSceneAdditive(path);
+		}
+
+		for (const auto& path : requests.toLoad)
+		{
+			// A chunk already loaded additively (e.g. by a script) is streamed from now on
+			m_streamer.SetChunkLoadResult(path, LoadSceneAdditive(path) || IsSceneLoadedAdditive(path));
+		}
+	}
+}
+
 void OvCore::SceneSystem::SceneManager::UnloadCurrentScene()
 {
 	if (m_currentScene)
@@ -122,6 +587,10 @@ void OvCore::SceneSystem::SceneManager::UnloadCurrentScene()
 		SceneUnloadEvent.Invoke();
 	}
 
+	// Additive scenes belong to the current scene, and so do the chunks streamed around it
+	m_additiveScenes.clear();
+	m_streamer.Clear();
+
 	ForgetCurrentSceneSourcePath();
 }
 
@@ -158,3 +627,47 @@ void OvCore::SceneSystem::SceneManager::ForgetCurrentSceneSourcePath()
 	m_currentSceneLoadedFromPath = false;
 	CurrentSceneSourcePathChangedEvent.Invoke(m_currentSceneSourcePath);
 }
+
+void OvCore::SceneSystem::SceneManager::SetResourceReleaseDelay(float p_delay)
+{
+	m_resourceReleaseDelay = p_delay;
+
+	if (m_resourceReleaseDelay < 0.0f)
+	{
+		m_sceneChangeTime.reset();
+	}
+}
+
+float OvCore::SceneSystem::SceneManager::GetResourceReleaseDelay() const
+{
+	return m_resourceReleaseDelay;
+}
+
+void OvCore::SceneSystem::SceneManager::ReleaseUnusedResources(std::chrono::steady_clock::time_point p_registeredBefore)
+{
+	ResourceManagement::ResourceUsage usage;
+
+	if (m_currentScene)
+	{
+		m_currentScene->CollectResourceUsage(usage);
+	}
+
+	if (m_pendingSceneLoad && m_pendingSceneLoad->scene)
+	{
+		m_pendingSceneLoad->scene->CollectResourceUsage(usage);
+	}
+
+	auto& materialManager = OVSERVICE(ResourceManagement::MaterialManager);
+	::ReleaseUnusedResources(materialManager, usage.materials, p_registeredBefore, "MaterialManager");
+
+	// The kept materials (e.g. engine ones) may reference project textures or shaders
+	for (const auto& [path, material] : materialManager.GetResources())
+	{
+		usage.AddMaterial(*material);
+	}
+
+	::ReleaseUnusedResources(OVSERVICE(ResourceManagement::ModelManager), usage.models, p_registeredBefore, "ModelManager");
+	::ReleaseUnusedResources(OVSERVICE(ResourceManagement::TextureManager), usage.textures, p_registeredBefore, "TextureManager");
+	::ReleaseUnusedResources(OVSERVICE(ResourceManagement::ShaderManager), usage.shaders, p_registeredBefore, "ShaderManager");
+	::ReleaseUnusedResources(OVSERVICE(ResourceManagement::SoundManager), usage.sounds, p_registeredBefore, "SoundManager");
+}
@@ -0,0 +1,126 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+
+#include <OvCore/SceneSystem/SceneStreamer.h>
+
+void OvCore::SceneSystem::SceneStreamer::AddChunk(const std::string& p_scenePath, const Chunk& p_chunk)
+{
+	auto& state = m_chunks[p_scenePath];
+	state.chunk = p_chunk;
+	state.chunk.unloadDistance = std::max(p_chunk.unloadDistance, p_chunk.loadDistance);
+	state.failed = false;
+}
+
+bool OvCore::SceneSystem::SceneStreamer::RemoveChunk(const std::string& p_scenePath)
+{
+	if (auto found = m_chunks.find(p_scenePath); found != m_chunks.end())
+	{
+		const bool loaded = found->second.loaded;
+		m_chunks.erase(found);
+		return loaded;
+	}
+
+	return false;
+}
+
+void OvCore::SceneSystem::SceneStreamer::Clear()
+{
+	m_chunks.clear();
+}
+
+bool OvCore::SceneSystem::SceneStreamer::HasChunks() const
+{
+	return !m_chunks.empty();
+}
+
+bool OvCore::SceneSystem::SceneStreamer::IsChunkLoaded(const std::string& p_scenePath) const
+{
+	if (auto found = m_chunks.find(p_scenePath); found != m_chunks.end())
+	{
+		return found->second.loaded;
+	}
+
+	return false;
+}
+
+void OvCore::SceneSystem::SceneStreamer::SetChunkLoadResult(const std::string& p_scenePath, bool p_loaded)
+{
+	if (auto found = m_chunks.find(p_scenePath); found != m_chunks.end())
+	{
+		found->second.loaded = p_loaded;
+		found->second.failed = !p_loaded;
+	}
+}
+
+void OvCore::SceneSystem::SceneStreamer::SetMaxLoadsPerUpdate(uint32_t p_maxLoadsPerUpdate)
+{
+	m_maxLoadsPerUpdate = p_maxLoadsPerUpdate;
+}
+
+uint32_t OvCore::SceneSystem::SceneStreamer::GetMaxLoadsPerUpdate() const
+{
+	return m_maxLoadsPerUpdate;
+}
+
+OvCore::SceneSystem::SceneStreamer::Requests OvCore::SceneSystem::SceneStreamer::Update(const OvMaths::FVector3& p_anchor)
+{
+	Requests requests;
+
+	// Squared distances are compared, there is no need for the square roots
+	const auto squaredDistanceTo = [&p_anchor](const OvMaths::FVector3& p_position)
+	{
+		const OvMaths::FVector3 offset = p_position - p_anchor;
+		return OvMaths::FVector3::Dot(offset, offset);
+	};
+
+	struct LoadCandidate
+	{
+		float squaredDistance;
+		const std::string* path;
+	};
+
+	std::vector<LoadCandidate> loadCandidates;
+
+	for (auto& [path, state] : m_chunks)
+	{
+		const float squaredDistance = squaredDistanceTo(state.chunk.center);
+		const bool beyondUnloadDistance = squaredDistance > state.chunk.unloadDistance * state.chunk.unloadDistance;
+
+		if (state.failed && beyondUnloadDistance)
+		{
+			// The load is attempted again the next time the anchor comes close
+			state.failed = false;
+		}
+		else if (state.loaded && beyondUnloadDistance)
+		{
+			state.loaded = false;
+			requests.toUnload.push_back(path);
+		}
+		else if (!state.loaded && !state.failed && squaredDistance <= state.chunk.loadDistance * state.chunk.loadDistance)
+		{
+			loadCandidates.push_back({ squaredDistance, &path });
+		}
+	}
+
+	std::sort(loadCandidates.begin(), loadCandidates.end(), [](const LoadCandidate& p_left, const LoadCandidate& p_right)
+	{
+		return p_left.squaredDistance < p_right.squaredDistance;
+	});
+
+	if (m_maxLoadsPerUpdate > 0 && loadCandidates.size() > m_maxLoadsPerUpdate)
+	{
+		loadCandidates.resize(m_maxLoadsPerUpdate);
+	}
+
+	for (const auto& candidate : loadCandidates)
+	{
+		requests.toLoad.push_back(*candidate.path);
+	}
+
+	return requests;
+}
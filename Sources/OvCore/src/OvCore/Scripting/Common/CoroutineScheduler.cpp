@@ -0,0 +1,220 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+#include <utility>
+
+#include <OvCore/Scripting/Common/CoroutineScheduler.h>
+
+OvCore::Scripting::CoroutineScheduler::TaskID OvCore::Scripting::CoroutineScheduler::AddTask(const void* p_owner)
+{
+	const TaskID task = m_nextTaskID++;
+	m_tasks[task].owner = p_owner;
+	return task;
+}
+
+bool OvCore::Scripting::CoroutineScheduler::RemoveTask(TaskID p_task)
+{
+	// Heap entries of removed tasks are skipped when they are reached
+	return m_tasks.erase(p_task) > 0;
+}
+
+std::vector<OvCore::Scripting::CoroutineScheduler::TaskID> OvCore::Scripting::CoroutineScheduler::RemoveTasks(const void* p_owner)
+{
+	std::vector<TaskID> removedTasks;
+
+	for (auto it = m_tasks.begin(); it != m_tasks.end();)
+	{
+		if (it->second.owner == p_owner)
+		{
+			removedTasks.push_back(it->first);
+			it = m_tasks.erase(it);
+		}
+		else
+		{
+			++it;
+		}
+	}
+
+	// Sorted so that callers process them in a deterministic order
+	std::sort(removedTasks.begin(), removedTasks.end());
+	return removedTasks;
+}
+
+void OvCore::Scripting::CoroutineScheduler::Clear()
+{
+	m_tasks.clear();
+	m_timers = {};
+	m_frameWaits = {};
+	m_fixedUpdateWaits.clear();
+	m_conditionWaits.clear();
+}
+
+bool OvCore::Scripting::CoroutineScheduler::HasTask(TaskID p_task) const
+{
+	return m_tasks.contains(p_task);
+}
+
+const void* OvCore::Scripting::CoroutineScheduler::GetOwner(TaskID p_task) const
+{
+	if (auto found = m_tasks.find(p_task); found != m_tasks.end())
+	{
+		return found->second.owner;
+	}
+
+	return nullptr;
+}
+
+size_t OvCore::Scripting::CoroutineScheduler::GetTaskCount() const
+{
+	return m_tasks.size();
+}
+
+void OvCore::Scripting::CoroutineScheduler::WaitForSeconds(TaskID p_task, double p_seconds)
+{
+	if (auto task = BeginWait(p_task))
+	{
+		m_timers.push({ m_time + std::max(p_seconds, 0.0), task->waitSequence, p_task });
+	}
+}
+
+void OvCore::Scripting::CoroutineScheduler::WaitForFrames(TaskID p_task, uint32_t p_frames)
+{
+	if (auto task = BeginWait(p_task))
+	{
+		m_frameWaits.push({ m_frame + std::max(p_frames, 1u), task->waitSequence, p_task });
+	}
+}
+
+void OvCore::Scripting::CoroutineScheduler::WaitForFixedUpdate(TaskID p_task)
+{
+	if (auto task = BeginWait(p_task))
+	{
+		m_fixedUpdateWaits.emplace_back(task->waitSequence, p_task);
+	}
+}
+
+void OvCore::Scripting::CoroutineScheduler::WaitUntil(TaskID p_task, std::function<bool()> p_condition)
+{
+	if (auto task = BeginWait(p_task))
+	{
+		task->condition = std::move(p_condition);
+		m_conditionWaits.emplace_back(task->waitSequence, p_task);
+	}
+}
+
+std::vector<OvCore::Scripting::CoroutineScheduler::TaskID> OvCore::Scripting::CoroutineScheduler::Update(double p_deltaTime)
+{
+	m_time += p_deltaTime;
+	++m_frame;
+
+	std::vector<TaskID> readyTasks;
+
+	const auto isCurrentWait = [this](TaskID p_task, uint64_t p_sequence)
+	{
+		const auto found = m_tasks.find(p_task);
+		return found != m_tasks.end() && found->second.waitSequence == p_sequence;
+	};
+
+	while (!m_timers.empty() && m_timers.top().wakeAt <= m_time)
+	{
+		if (isCurrentWait(m_timers.top().task, m_timers.top().sequence))
+		{
+			readyTasks.push_back(m_timers.top().task);
+		}
+
+		m_timers.pop();
+	}
+
+	while (!m_frameWaits.empty() && m_frameWaits.top().wakeAt <= m_frame)
+	{
+		if (isCurrentWait(m_frameWaits.top().task, m_frameWaits.top().sequence))
+		{
+			readyTasks.push_back(m_frameWaits.top().task);
+		}
+
+		m_frameWaits.pop();
+	}
+
+	// Conditions can add or remove tasks (e.g. by starting a coroutine), so the waits are taken out while they are polled
+	auto conditionWaits = std::exchange(m_conditionWaits, {});
+	std::vector<std::pair<uint64_t, TaskID>> pendingConditionWaits;
+
+	for (const auto& [sequence, taskID] : conditionWaits)
+	{
+		if (!isCurrentWait(taskID, sequence))
+			continue;
+
+		// Moved out, so that removing the task from its own condition doesn't destroy the condition while it runs
+		auto condition = std::move(m_tasks[taskID].condition);
+		const bool fulfilled = !condition || condition();
+
+		if (!isCurrentWait(taskID, sequence))
+			continue;
+
+		if (fulfilled)
+		{
+			readyTasks.push_back(taskID);
+		}
+		else
+		{
+			m_tasks[taskID].condition = std::move(condition);
+			pendingConditionWaits.emplace_back(sequence, taskID);
+		}
+	}
+
+	pendingConditionWaits.insert(pendingConditionWaits.end(), m_conditionWaits.begin(), m_conditionWaits.end());
+	m_conditionWaits = std::move(pendingConditionWaits);
+
+	// A condition may have removed a task that was already ready
+	std::erase_if(readyTasks, [this](TaskID p_task) { return !m_tasks.contains(p_task); });
+
+	for (const TaskID taskID : readyTasks)
+	{
+		m_tasks[taskID].waitSequence = 0;
+	}
+
+	return readyTasks;
+}
+
+std::vector<OvCore::Scripting::CoroutineScheduler::TaskID> OvCore::Scripting::CoroutineScheduler::FixedUpdate()
+{
+	std::vector<TaskID> readyTasks;
+
+	for (const auto& [sequence, taskID] : std::exchange(m_fixedUpdateWaits, {}))
+	{
+		if (auto found = m_tasks.find(taskID); found != m_tasks.end() && found->second.waitSequence == sequence)
+		{
+			found->second.waitSequence = 0;
+			readyTasks.push_back(taskID);
+		}
+	}
+
+	return readyTasks;
+}
+
+double OvCore::Scripting::CoroutineScheduler::GetTime() const
+{
+	return m_time;
+}
+
+uint64_t OvCore::Scripting::CoroutineScheduler::GetFrame() const
+{
+	return m_frame;
+}
+
+OvCore::Scripting::CoroutineScheduler::Task* OvCore::Scripting::CoroutineScheduler::BeginWait(TaskID p_task)
+{
+	if (auto found = m_tasks.find(p_task); found != m_tasks.end())
+	{
+		// A task waits for a single thing at a time, starting a new wait cancels the previous one
+		found->second.waitSequence = m_nextSequence++;
+		found->second.condition = nullptr;
+		return &found->second;
+	}
+
+	return nullptr;
+}
@@ -20,6 +20,8 @@
 #include <OvCore/ECS/Components/CModelRenderer.h>  
 #include <OvCore/ECS/Components/CPhysicalBox.h>  
 #include <OvCore/ECS/Components/CPhysicalCapsule.h>  
+#include <OvCore/ECS/Components/CPhysicalConvex.h>  
+#include <OvCore/ECS/Components/CPhysicalMesh.h>  
 #include <OvCore/ECS/Components/CPhysicalSphere.h>  
 #include <OvCore/ECS/Components/CPointLight.h>  
 #include <OvCore/ECS/Components/CPostProcessStack.h>  
@@ -58,6 +60,8 @@ void BindLuaActor(sol::state& p_luaState)
 		"GetPhysicalBox", &Actor::GetComponent<CPhysicalBox>,
 		"GetPhysicalSphere", &Actor::GetComponent<CPhysicalSphere>,
 		"GetPhysicalCapsule", &Actor::GetComponent<CPhysicalCapsule>,
+		"GetPhysicalMesh", &Actor::GetComponent<CPhysicalMesh>,
+		"GetPhysicalConvex", &Actor::GetComponent<CPhysicalConvex>,
 		"GetCamera", &Actor::GetComponent<CCamera>,
 		"GetLight", &Actor::GetComponent<CLight>,
 		"GetPointLight", &Actor::GetComponent<CPointLight>,
@@ -113,6 +117,8 @@ void BindLuaActor(sol::state& p_luaState)
 		"AddPhysicalBox", &Actor::AddComponent<CPhysicalBox>,
 		"AddPhysicalSphere", &Actor::AddComponent<CPhysicalSphere>,
 		"AddPhysicalCapsule", &Actor::AddComponent<CPhysicalCapsule>,
+		"AddPhysicalMesh", &Actor::AddComponent<CPhysicalMesh>,
+		"AddPhysicalConvex", &Actor::AddComponent<CPhysicalConvex>,
 		"AddCamera", &Actor::AddComponent<CCamera>,
 		"AddPointLight", &Actor::AddComponent<CPointLight>,
 		"AddSpotLight", &Actor::AddComponent<CSpotLight>,
@@ -131,6 +137,8 @@ void BindLuaActor(sol::state& p_luaState)
 		"RemovePhysicalBox", &Actor::RemoveComponent<CPhysicalBox>,
 		"RemovePhysicalSphere", &Actor::RemoveComponent<CPhysicalSphere>,
 		"RemovePhysicalCapsule", &Actor::RemoveComponent<CPhysicalCapsule>,
+		"RemovePhysicalMesh", &Actor::RemoveComponent<CPhysicalMesh>,
+		"RemovePhysicalConvex", &Actor::RemoveComponent<CPhysicalConvex>,
 		"RemoveCamera", &Actor::RemoveComponent<CCamera>,
 		"RemovePointLight", &Actor::RemoveComponent<CPointLight>,
 		"RemoveSpotLight", &Actor::RemoveComponent<CSpotLight>,
@@ -17,6 +17,8 @@
 #include <OvCore/ECS/Components/CModelRenderer.h>  
 #include <OvCore/ECS/Components/CPhysicalBox.h>  
 #include <OvCore/ECS/Components/CPhysicalCapsule.h>  
+#include <OvCore/ECS/Components/CPhysicalConvex.h>  
+#include <OvCore/ECS/Components/CPhysicalMesh.h>  
 #include <OvCore/ECS/Components/CPhysicalSphere.h>  
 #include <OvCore/ECS/Components/CPointLight.h>  
 #include <OvCore/ECS/Components/CPostProcessStack.h>  
@@ -81,7 +83,9 @@ void BindLuaComponents(sol::state& p_luaState)
 			p_this.SetModel(p_model);
 		},
 		"GetFrustumBehaviour", &CModelRenderer::GetFrustumBehaviour,
-		"SetFrustumBehaviour", &CModelRenderer::SetFrustumBehaviour
+		"SetFrustumBehaviour", &CModelRenderer::SetFrustumBehaviour,
+		"GetLODBias", &CModelRenderer::GetLODBias,
+		"SetLODBias", &CModelRenderer::SetLODBias
 	);
 
 	p_luaState.new_usertype<CMaterialRenderer>("MaterialRenderer",
@@ -155,7 +159,9 @@ void BindLuaComponents(sol::state& p_luaState)
 		"ClearForces", &CPhysicalObject::ClearForces,
 		"SetCollisionDetectionMode", &CPhysicalObject::SetCollisionDetectionMode,
 		"GetCollisionMode", &CPhysicalObject::GetCollisionDetectionMode,
-		"SetKinematic", &CPhysicalObject::SetKinematic
+		"SetKinematic", &CPhysicalObject::SetKinematic,
+		"GetLayer", &CPhysicalObject::GetLayer,
+		"SetLayer", &CPhysicalObject::SetLayer
 	);
 
 	p_luaState.new_usertype<CPhysicalBox>("PhysicalBox",
@@ -178,6 +184,24 @@ void BindLuaComponents(sol::state& p_luaState)
 		"SetHeight", &CPhysicalCapsule::SetHeight
 	);
 
+	p_luaState.new_usertype<CPhysicalMesh>("PhysicalMesh",
+		sol::base_classes, sol::bases<CPhysicalObject>(),
+		"GetModel", &CPhysicalMesh::GetModel,
+		"SetModel", [](CPhysicalMesh& p_this, OvRendering::Resources::Model* p_model)
+		{
+			p_this.SetModel(p_model);
+		}
+	);
+
+	p_luaState.new_usertype<CPhysicalConvex>("PhysicalConvex",
+		sol::base_classes, sol::bases<CPhysicalObject>(),
+		"GetModel", &CPhysicalConvex::GetModel,
+		"SetModel", [](CPhysicalConvex& p_this, OvRendering::Resources::Model* p_model)
+		{
+			p_this.SetModel(p_model);
+		}
+	);
+
 	p_luaState.new_enum<OvRendering::Settings::EProjectionMode>("ProjectionMode", {
 		{"ORTHOGRAPHIC", OvRendering::Settings::EProjectionMode::ORTHOGRAPHIC},
 		{"PERSPECTIVE", OvRendering::Settings::EProjectionMode::PERSPECTIVE}
@@ -273,13 +297,16 @@ void BindLuaComponents(sol::state& p_luaState)
 		"IsPlaying", &CAudioSource::IsPlaying,
 		"IsSpatial", &CAudioSource::IsSpatial,
 		"GetAttenuationThreshold", &CAudioSource::GetAttenuationThreshold,
+		"GetPriority", &CAudioSource::GetPriority,
+		"IsVirtual", &CAudioSource::IsVirtual,
 		"SetSound", &CAudioSource::SetSound,
 		"SetVolume", &CAudioSource::SetVolume,
 		"SetPan", &CAudioSource::SetPan,
 		"SetLooped", &CAudioSource::SetLooped,
 		"SetPitch", &CAudioSource::SetPitch,
 		"SetSpatial", &CAudioSource::SetSpatial,
-		"SetAttenuationThreshold", &CAudioSource::SetAttenuationThreshold
+		"SetAttenuationThreshold", &CAudioSource::SetAttenuationThreshold,
+		"SetPriority", &CAudioSource::SetPriority
 	);
 
 	p_luaState.new_usertype<CAudioListener>("AudioListener",
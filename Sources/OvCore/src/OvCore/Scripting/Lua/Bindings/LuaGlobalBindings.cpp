@@ -30,6 +30,37 @@
 
 #include <sol/sol.hpp>
 
+namespace
+{
+	template<typename TQuery>
+	auto ExecuteQueryBatch(
+		const sol::table& p_queries,
+		sol::optional<bool> p_parallel,
+		void(*p_batchFunction)(std::span<const TQuery>, std::span<OvCore::ECS::PhysicsWrapper::QueryHit>, bool)
+	)
+	{
+		std::vector<TQuery> queries;
+		queries.reserve(p_queries.size());
+
+		for (size_t i = 1; i <= p_queries.size(); ++i)
+			queries.push_back(p_queries.get<TQuery>(i));
+
+		std::vector<OvCore::ECS::PhysicsWrapper::QueryHit> results(queries.size());
+		p_batchFunction(queries, results, p_parallel.value_or(false));
+		return sol::as_table(std::move(results));
+	}
+
+	// Resource IDs are exposed as Lua integers, which are signed
+	template<typename TResourceManager>
+	auto BindGetResource()
+	{
+		return sol::overload(
+			[](int64_t p_id) { return OvCore::Global::ServiceLocator::Get<TResourceManager>().GetResource(static_cast<OvCore::ResourceManagement::ResourceID>(p_id)); },
+			[](const std::string& p_resPath) { return OvCore::Global::ServiceLocator::Get<TResourceManager>().GetResource(p_resPath); }
+		);
+	}
+}
+
 void BindLuaGlobal(sol::state& p_luaState)
 {
 	using namespace OvWindowing;
@@ -84,7 +115,9 @@ void BindLuaGlobal(sol::state& p_luaState)
 			[](Scene& p_scene, const AssetRef& p_prefab, Actor& p_parent) -> Actor*
 			{
 				return p_scene.InstantiatePrefab(p_prefab.path, p_parent);
-			})
+			}),
+		"ReleaseToPool", &Scene::ReleaseToPool,
+		"ClearPools", &Scene::ClearPools
 	);
 
 	p_luaState.new_enum<EKey>("Key", {
@@ -253,15 +286,40 @@ void BindLuaGlobal(sol::state& p_luaState)
 
 	p_luaState.create_named_table("Scenes",
 		"GetCurrentScene", []() -> Scene& { return *OVSERVICE(SceneManager).GetCurrentScene(); },
-		"Load", [](const std::string& p_path) { OVSERVICE(SceneManager).LoadAndPlayDelayed(p_path); }
+		"Load", [](const std::string& p_path) { OVSERVICE(SceneManager).LoadAndPlayDelayed(p_path); },
+		"LoadAsync", [](const std::string& p_path) { OVSERVICE(SceneManager).LoadSceneAsync(p_path); },
+		"CancelLoadAsync", []() { OVSERVICE(SceneManager).CancelSceneLoadAsync(); },
+		"IsLoading", []() { return OVSERVICE(SceneManager).IsLoadingSceneAsync(); },
+		"GetLoadProgress", []() { return OVSERVICE(SceneManager).GetSceneLoadProgress(); },
+		"LoadAdditive", [](const std::string& p_path) { return OVSERVICE(SceneManager).LoadSceneAdditive(p_path); },
+		"UnloadAdditive", [](const std::string& p_path) { return OVSERVICE(SceneManager).UnloadSceneAdditive(p_path); },
+		"IsLoadedAdditive", [](const std::string& p_path) { return OVSERVICE(SceneManager).IsSceneLoadedAdditive(p_path); },
+		"AddStreamingChunk", [](const std::string& p_path, const OvMaths::FVector3& p_center, float p_loadDistance, sol::optional<float> p_unloadDistance)
+		{
+			OVSERVICE(SceneManager).GetStreamer().AddChunk(p_path, { p_center, p_loadDistance, p_unloadDistance.value_or(p_loadDistance) });
+		},
+		"RemoveStreamingChunk", [](const std::string& p_path)
+		{
+			auto& sceneManager = OVSERVICE(SceneManager);
+
+			if (sceneManager.GetStreamer().RemoveChunk(p_path))
+			{
+				sceneManager.UnloadSceneAdditive(p_path);
+			}
+		},
+		"SetStreamingAnchor", [](sol::optional<OvMaths::FVector3> p_anchor)
+		{
+			OVSERVICE(SceneManager).SetStreamingAnchor(p_anchor ? std::optional<OvMaths::FVector3>{ p_anchor.value() } : std::nullopt);
+		}
 	);
 
 	p_luaState.create_named_table("Resources",
-		"GetModel", [](const std::string& p_resPath) { return OVSERVICE(ModelManager).GetResource(p_resPath); },
-		"GetShader", [](const std::string& p_resPath) { return OVSERVICE(ShaderManager).GetResource(p_resPath); },
-		"GetTexture", [](const std::string& p_resPath) { return OVSERVICE(TextureManager).GetResource(p_resPath); },
-		"GetMaterial", [](const std::string& p_resPath) { return OVSERVICE(MaterialManager).GetResource(p_resPath); },
-		"GetSound", [](const std::string& p_resPath) { return OVSERVICE(SoundManager).GetResource(p_resPath); }
+		"GetID", [](const std::string& p_resPath) { return static_cast<int64_t>(GetResourceID(p_resPath)); },
+		"GetModel", BindGetResource<ModelManager>(),
+		"GetShader", BindGetResource<ShaderManager>(),
+		"GetTexture", BindGetResource<TextureManager>(),
+		"GetMaterial", BindGetResource<MaterialManager>(),
+		"GetSound", BindGetResource<SoundManager>()
 	);
 
 	p_luaState.create_named_table("Math",
@@ -276,7 +334,52 @@ void BindLuaGlobal(sol::state& p_luaState)
 		"ResultObjects", &PhysicsWrapper::RaycastHit::ResultObjects
 	);
 
+	p_luaState.new_usertype<PhysicsWrapper::QueryHit>("QueryHit",
+		"Object", &PhysicsWrapper::QueryHit::Object,
+		"Point", &PhysicsWrapper::QueryHit::Point,
+		"Normal", &PhysicsWrapper::QueryHit::Normal,
+		"Distance", &PhysicsWrapper::QueryHit::Distance
+	);
+
+	p_luaState.new_usertype<OvPhysics::Entities::RayQuery>("RayQuery",
+		sol::constructors<OvPhysics::Entities::RayQuery()>(),
+		"origin", &OvPhysics::Entities::RayQuery::origin,
+		"direction", &OvPhysics::Entities::RayQuery::direction,
+		"distance", &OvPhysics::Entities::RayQuery::distance,
+		"layerMask", &OvPhysics::Entities::RayQuery::layerMask
+	);
+
+	p_luaState.new_usertype<OvPhysics::Entities::SphereCastQuery>("SphereCastQuery",
+		sol::constructors<OvPhysics::Entities::SphereCastQuery()>(),
+		"origin", &OvPhysics::Entities::SphereCastQuery::origin,
+		"direction", &OvPhysics::Entities::SphereCastQuery::direction,
+		"distance", &OvPhysics::Entities::SphereCastQuery::distance,
+		"radius", &OvPhysics::Entities::SphereCastQuery::radius,
+		"layerMask", &OvPhysics::Entities::SphereCastQuery::layerMask
+	);
+
+	p_luaState.new_usertype<OvPhysics::Entities::BoxCastQuery>("BoxCastQuery",
+		sol::constructors<OvPhysics::Entities::BoxCastQuery()>(),
+		"origin", &OvPhysics::Entities::BoxCastQuery::origin,
+		"rotation", &OvPhysics::Entities::BoxCastQuery::rotation,
+		"halfExtents", &OvPhysics::Entities::BoxCastQuery::halfExtents,
+		"direction", &OvPhysics::Entities::BoxCastQuery::direction,
+		"distance", &OvPhysics::Entities::BoxCastQuery::distance,
+		"layerMask", &OvPhysics::Entities::BoxCastQuery::layerMask
+	);
+
 	p_luaState.create_named_table("Physics",
-		"Raycast", [](const OvMaths::FVector3& p_origin, const OvMaths::FVector3& p_direction, float p_distance) { return PhysicsWrapper::Raycast(p_origin, p_direction, p_distance); }
+		"Raycast", [](const OvMaths::FVector3& p_origin, const OvMaths::FVector3& p_direction, float p_distance) { return PhysicsWrapper::Raycast(p_origin, p_direction, p_distance); },
+		"RaycastBatch", [](const sol::table& p_queries, sol::optional<bool> p_parallel) { return ExecuteQueryBatch(p_queries, p_parallel, &PhysicsWrapper::RaycastBatch); },
+		"SphereCastBatch", [](const sol::table& p_queries, sol::optional<bool> p_parallel) { return ExecuteQueryBatch(p_queries, p_parallel, &PhysicsWrapper::SphereCastBatch); },
+		"BoxCastBatch", [](const sol::table& p_queries, sol::optional<bool> p_parallel) { return ExecuteQueryBatch(p_queries, p_parallel, &PhysicsWrapper::BoxCastBatch); },
+		"OverlapSphere", [](const OvMaths::FVector3& p_center, float p_radius, sol::optional<uint32_t> p_layerMask)
+		{
+			return sol::as_table(PhysicsWrapper::OverlapSphere({ p_center, p_radius, p_layerMask.value_or(OvPhysics::Entities::kAllLayers) }));
+		},
+		"OverlapBox", [](const OvMaths::FVector3& p_center, const OvMaths::FQuaternion& p_rotation, const OvMaths::FVector3& p_halfExtents, sol::optional<uint32_t> p_layerMask)
+		{
+			return sol::as_table(PhysicsWrapper::OverlapBox({ p_center, p_rotation, p_halfExtents, p_layerMask.value_or(OvPhysics::Entities::kAllLayers) }));
+		}
 	);
 }
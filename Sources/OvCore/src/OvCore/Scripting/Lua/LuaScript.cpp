@@ -4,6 +4,8 @@
 * @licence: MIT
 */
 
+#include <array>
+
 #include <sol/sol.hpp>
 
 #include <OvDebug/Logger.h>
@@ -19,6 +21,27 @@
 #include <OvCore/SceneSystem/SceneManager.h>
 #include <OvCore/Scripting/Lua/LuaScript.h>
 
+namespace
+{
+	constexpr std::array<const char*, static_cast<size_t>(OvCore::Scripting::EScriptCallback::COUNT)> kCallbackNames = {
+		"OnAwake",
+		"OnStart",
+		"OnEnable",
+		"OnDisable",
+		"OnDestroy",
+		"OnUpdate",
+		"OnFixedUpdate",
+		"OnLateUpdate",
+		"OnCollisionEnter",
+		"OnCollisionStay",
+		"OnCollisionExit",
+		"OnTriggerEnter",
+		"OnTriggerStay",
+		"OnTriggerExit",
+		"OnSceneLoaded"
+	};
+}
+
 template<>
 OvCore::Scripting::LuaScriptBase::TScript() = default;
 
@@ -31,9 +54,30 @@ bool OvCore::Scripting::LuaScriptBase::IsValid() const
 	return m_context.table && m_context.table->valid();
 }
 
-OvCore::Scripting::LuaScript::LuaScript(sol::table table)
+template<>
+bool OvCore::Scripting::LuaScriptBase::HasCallback(EScriptCallback p_callback) const
+{
+	return m_context.callbackMask & (1u << static_cast<uint32_t>(p_callback));
+}
+
+OvCore::Scripting::LuaScript::LuaScript(sol::table p_table)
 {
-	m_context.table = std::make_unique<sol::table>(table);
+	m_context.table = std::make_unique<sol::table>(p_table);
+
+	if (!p_table.valid())
+	{
+		return;
+	}
+
+	// Resolved once, instead of looking the callbacks up by name every time they are called
+	for (size_t i = 0; i < kCallbackNames.size(); ++i)
+	{
+		if (const sol::object callback = p_table[kCallbackNames[i]]; callback.is<sol::protected_function>())
+		{
+			m_context.callbacks[i] = std::make_unique<sol::protected_function>(callback.as<sol::protected_function>());
+			m_context.callbackMask |= 1u << static_cast<uint32_t>(i);
+		}
+	}
 }
 
 void OvCore::Scripting::LuaScript::SetOwner(OvCore::ECS::Actor& p_owner)
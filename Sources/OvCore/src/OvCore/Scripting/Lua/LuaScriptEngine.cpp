@@ -6,9 +6,15 @@
 
 #include <OvCore/Scripting/Lua/LuaScriptEngine.h>
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
 #include <filesystem>
 #include <format>
 #include <fstream>
+#include <unordered_map>
+#include <utility>
 #include <sol/sol.hpp>
 #include <tracy/Tracy.hpp>
 
@@ -17,6 +23,8 @@
 #include <OvCore/Scripting/ScriptEngine.h>
 #include <OvCore/ECS/Components/Behaviour.h>
 #include <OvCore/ECS/Actor.h>
+#include <OvTools/Filesystem/CookedAssetStamp.h>
+#include <OvTools/Filesystem/MappedFile.h>
 #include <OvTools/Utils/String.h>
 
 void BindLuaActor(sol::state& p_state);
@@ -28,39 +36,453 @@ void BindLuaProfiler(sol::state& p_state);
 namespace
 {
 	template<typename... Args>
-	void ExecuteLuaFunction(OvCore::ECS::Components::Behaviour& p_behaviour, const std::string& p_functionName, Args&& ...p_args)
+	void ExecuteLuaFunction(
+		OvCore::Scripting::LuaScriptEngineContext& p_context,
+		OvCore::ECS::Components::Behaviour& p_behaviour,
+		OvCore::Scripting::EScriptCallback p_callback,
+		Args&& ...p_args
+	)
 	{
 		auto context = p_behaviour.GetScript();
 
 		OVASSERT(context.has_value(), "The given context is null");
 		OVASSERT(context->IsValid(), "The given context is invalid");
 
-		const sol::table& table = *static_cast<OvCore::Scripting::LuaScript&>(context.value()).GetContext().table;
+		if (!context->HasCallback(p_callback))
+		{
+			return;
+		}
+
+		const auto& scriptContext = static_cast<OvCore::Scripting::LuaScript&>(context.value()).GetContext();
+		const sol::protected_function& callback = *scriptContext.callbacks[static_cast<size_t>(p_callback)];
+
+		// Coroutines started by the callback belong to this behaviour
+		const auto previousBehaviour = std::exchange(p_context.runningBehaviour, &p_behaviour);
 
 		try
 		{
-			if (table[p_functionName].valid())
+			auto pfrResult = callback.call(*scriptContext.table, std::forward<Args>(p_args)...);
+			if (!pfrResult.valid())
+			{
+				sol::error err = pfrResult;
+				OVLOG_ERROR(err.what());
+			}
+		}
+		catch (const sol::error& p_error)
+		{
+			OVLOG_ERROR(p_error.what());
+		}
+
+		p_context.runningBehaviour = previousBehaviour;
+	}
+
+	using CoroutineTaskID = OvCore::Scripting::CoroutineScheduler::TaskID;
+
+	constexpr const char* kCoroutinesRegistryKey = "OvCoroutines";
+
+	/**
+	* Values yielded by the wait functions, telling the scheduler what a coroutine waits for
+	*/
+	enum class ECoroutineWait : lua_Integer
+	{
+		FRAMES,
+		SECONDS,
+		FIXED_UPDATE,
+		CONDITION
+	};
+
+	OvCore::Scripting::LuaScriptEngineContext& GetCoroutineContext(lua_State* p_luaState)
+	{
+		return *static_cast<OvCore::Scripting::LuaScriptEngineContext*>(lua_touserdata(p_luaState, lua_upvalueindex(1)));
+	}
+
+	bool IsCoroutineRunning(const OvCore::Scripting::LuaScriptEngineContext& p_context, CoroutineTaskID p_task)
+	{
+		return std::find(p_context.runningCoroutines.begin(), p_context.runningCoroutines.end(), p_task) != p_context.runningCoroutines.end();
+	}
+
+	/**
+	* Release the Lua thread of the given coroutine, unless it is being resumed (It is then released once it yields)
+	*/
+	void ReleaseCoroutine(OvCore::Scripting::LuaScriptEngineContext& p_context, CoroutineTaskID p_task)
+	{
+		if (IsCoroutineRunning(p_context, p_task))
+			return;
+
+		lua_State* luaState = p_context.luaState->lua_state();
+		lua_getfield(luaState, LUA_REGISTRYINDEX, kCoroutinesRegistryKey);
+		lua_pushnil(luaState);
+		lua_rawseti(luaState, -2, static_cast<lua_Integer>(p_task));
+		lua_pop(luaState, 1);
+	}
+
+	void StopCoroutine(OvCore::Scripting::LuaScriptEngineContext& p_context, CoroutineTaskID p_task)
+	{
+		if (p_context.coroutineScheduler.RemoveTask(p_task))
+		{
+			ReleaseCoroutine(p_context, p_task);
+		}
+	}
+
+	/**
+	* Schedule the given coroutine from the values it yielded (Found on top of its stack)
+	*/
+	void ScheduleCoroutine(OvCore::Scripting::LuaScriptEngineContext& p_context, CoroutineTaskID p_task, lua_State* p_coroutine, int p_resultCount)
+	{
+		auto& scheduler = p_context.coroutineScheduler;
+
+		// A plain coroutine.yield() waits for the next frame
+		if (p_resultCount < 2 || !lua_isinteger(p_coroutine, -p_resultCount))
+		{
+			scheduler.WaitForFrames(p_task, 1);
+			return;
+		}
+
+		const int valueIndex = lua_absindex(p_coroutine, -p_resultCount + 1);
+
+		switch (static_cast<ECoroutineWait>(lua_tointeger(p_coroutine, -p_resultCount)))
+		{
+		case ECoroutineWait::FRAMES:
+		{
+			const lua_Integer frames = lua_tointeger(p_coroutine, valueIndex);
+			scheduler.WaitForFrames(p_task, static_cast<uint32_t>(std::clamp<lua_Integer>(frames, 1, UINT32_MAX)));
+			break;
+		}
+		case ECoroutineWait::SECONDS:
+			scheduler.WaitForSeconds(p_task, lua_tonumber(p_coroutine, valueIndex));
+			break;
+		case ECoroutineWait::FIXED_UPDATE:
+			scheduler.WaitForFixedUpdate(p_task);
+			break;
+		case ECoroutineWait::CONDITION:
+		{
+			// Referenced from the main thread, the coroutine thread can't run anything while it is suspended
+			sol::main_protected_function condition(p_coroutine, valueIndex);
+
+			scheduler.WaitUntil(p_task, [&p_context, p_task, condition]()
 			{
-				sol::protected_function pfr = table[p_functionName];
-				auto pfrResult = pfr.call(table, std::forward<Args>(p_args)...);
-				if (!pfrResult.valid())
+				auto result = condition();
+
+				if (!result.valid())
 				{
-					sol::error err = pfrResult;
+					sol::error err = result;
 					OVLOG_ERROR(err.what());
+					StopCoroutine(p_context, p_task);
+					return false;
 				}
+
+				return result.return_count() > 0 && result.get<bool>();
+			});
+			break;
+		}
+		default:
+			scheduler.WaitForFrames(p_task, 1);
+			break;
+		}
+	}
+
+	/**
+	* Resume the given coroutine, with the given number of arguments pushed on its stack, and schedule it again if it yields
+	*/
+	void ResumeCoroutine(OvCore::Scripting::LuaScriptEngineContext& p_context, CoroutineTaskID p_task, int p_argumentCount, lua_State* p_from)
+	{
+		lua_State* luaState = p_context.luaState->lua_state();
+
+		lua_getfield(luaState, LUA_REGISTRYINDEX, kCoroutinesRegistryKey);
+		lua_rawgeti(luaState, -1, static_cast<lua_Integer>(p_task));
+		lua_State* coroutine = lua_tothread(luaState, -1);
+		lua_pop(luaState, 2); // Still referenced by the coroutines table
+
+		if (!coroutine)
+		{
+			p_context.coroutineScheduler.RemoveTask(p_task);
+			return;
+		}
+
+		const auto previousBehaviour = std::exchange(
+			p_context.runningBehaviour,
+			static_cast<const OvCore::ECS::Components::Behaviour*>(p_context.coroutineScheduler.GetOwner(p_task))
+		);
+
+		p_context.runningCoroutines.push_back(p_task);
+
+		int resultCount = 0;
+		const int status = lua_resume(coroutine, p_from, p_argumentCount, &resultCount);
+
+		p_context.runningCoroutines.pop_back();
+		p_context.runningBehaviour = previousBehaviour;
+
+		if (status == LUA_YIELD && p_context.coroutineScheduler.HasTask(p_task))
+		{
+			ScheduleCoroutine(p_context, p_task, coroutine, resultCount);
+			lua_pop(coroutine, resultCount);
+			return;
+		}
+
+		if (status != LUA_OK && status != LUA_YIELD)
+		{
+			luaL_traceback(luaState, coroutine, lua_tostring(coroutine, -1), 0);
+			OVLOG_ERROR(lua_tostring(luaState, -1));
+			lua_pop(luaState, 1);
+		}
+
+		// Finished, failed or stopped while it was running
+		p_context.coroutineScheduler.RemoveTask(p_task);
+		ReleaseCoroutine(p_context, p_task);
+	}
+
+	int LuaStartCoroutine(lua_State* p_luaState)
+	{
+		auto& context = GetCoroutineContext(p_luaState);
+		luaL_checktype(p_luaState, 1, LUA_TFUNCTION);
+		const int argumentCount = lua_gettop(p_luaState) - 1;
+
+		const CoroutineTaskID task = context.coroutineScheduler.AddTask(context.runningBehaviour);
+
+		lua_State* coroutine = lua_newthread(p_luaState);
+		lua_getfield(p_luaState, LUA_REGISTRYINDEX, kCoroutinesRegistryKey);
+		lua_pushvalue(p_luaState, -2);
+		lua_rawseti(p_luaState, -2, static_cast<lua_Integer>(task));
+		lua_pop(p_luaState, 2);
+
+		// The function and its arguments are moved to the coroutine, which runs until it first waits
+		lua_xmove(p_luaState, coroutine, argumentCount + 1);
+		ResumeCoroutine(context, task, argumentCount, p_luaState);
+
+		lua_pushinteger(p_luaState, static_cast<lua_Integer>(task));
+		return 1;
+	}
+
+	int LuaStopCoroutine(lua_State* p_luaState)
+	{
+		StopCoroutine(GetCoroutineContext(p_luaState), static_cast<CoroutineTaskID>(luaL_checkinteger(p_luaState, 1)));
+		return 0;
+	}
+
+	int LuaIsCoroutineRunning(lua_State* p_luaState)
+	{
+		const auto task = static_cast<CoroutineTaskID>(luaL_checkinteger(p_luaState, 1));
+		lua_pushboolean(p_luaState, GetCoroutineContext(p_luaState).coroutineScheduler.HasTask(task));
+		return 1;
+	}
+
+	int YieldCoroutineWait(lua_State* p_luaState, ECoroutineWait p_wait, const char* p_functionName)
+	{
+		if (!lua_isyieldable(p_luaState))
+		{
+			return luaL_error(p_luaState, "%s must be called from a coroutine (See StartCoroutine)", p_functionName);
+		}
+
+		lua_settop(p_luaState, 1);
+		lua_pushinteger(p_luaState, static_cast<lua_Integer>(p_wait));
+		lua_insert(p_luaState, 1);
+		return lua_yield(p_luaState, 2);
+	}
+
+	int LuaWaitForSeconds(lua_State* p_luaState)
+	{
+		luaL_checknumber(p_luaState, 1);
+		return YieldCoroutineWait(p_luaState, ECoroutineWait::SECONDS, "WaitForSeconds");
+	}
+
+	int LuaWaitForFrames(lua_State* p_luaState)
+	{
+		luaL_checkinteger(p_luaState, 1);
+		return YieldCoroutineWait(p_luaState, ECoroutineWait::FRAMES, "WaitForFrames");
+	}
+
+	int LuaWaitForFixedUpdate(lua_State* p_luaState)
+	{
+		return YieldCoroutineWait(p_luaState, ECoroutineWait::FIXED_UPDATE, "WaitForFixedUpdate");
+	}
+
+	int LuaWaitUntil(lua_State* p_luaState)
+	{
+		luaL_checktype(p_luaState, 1, LUA_TFUNCTION);
+		return YieldCoroutineWait(p_luaState, ECoroutineWait::CONDITION, "WaitUntil");
+	}
+
+	void BindCoroutines(sol::state& p_luaState, OvCore::Scripting::LuaScriptEngineContext& p_context)
+	{
+		lua_State* luaState = p_luaState.lua_state();
+
+		lua_newtable(luaState);
+		lua_setfield(luaState, LUA_REGISTRYINDEX, kCoroutinesRegistryKey);
+
+		// The scheduling functions find the engine context in their upvalue
+		const auto registerFunction = [&](const char* p_name, lua_CFunction p_function)
+		{
+			lua_pushlightuserdata(luaState, &p_context);
+			lua_pushcclosure(luaState, p_function, 1);
+			lua_setglobal(luaState, p_name);
+		};
+
+		registerFunction("StartCoroutine", &LuaStartCoroutine);
+		registerFunction("StopCoroutine", &LuaStopCoroutine);
+		registerFunction("IsCoroutineRunning", &LuaIsCoroutineRunning);
+		registerFunction("WaitForSeconds", &LuaWaitForSeconds);
+		registerFunction("WaitForFrames", &LuaWaitForFrames);
+		registerFunction("WaitForFixedUpdate", &LuaWaitForFixedUpdate);
+		registerFunction("WaitUntil", &LuaWaitUntil);
+	}
+
+	constexpr std::array<char, 4> kPrecompiledScriptMagic = { 'O', 'V', 'L', 'C' };
+
+	// Bump whenever the layout of the precompiled script file changes
+	constexpr uint32_t kPrecompiledScriptFormatVersion = 2;
+
+	// Bytecode is only compatible with the Lua version that produced it
+	constexpr uint64_t kPrecompiledScriptSettingsHash = LUA_VERSION_NUM;
+
+	constexpr const char* kLoadedChunksRegistryKey = "OvLoadedChunks";
+
+	struct PrecompiledScriptHeader
+	{
+		std::array<char, 4> magic = kPrecompiledScriptMagic;
+		uint32_t formatVersion = kPrecompiledScriptFormatVersion;
+		uint32_t isBigEndian = std::endian::native == std::endian::big ? 1 : 0;
+		uint32_t reserved = 0;
+		OvTools::Filesystem::CookedAssetStamp stamp;
+		uint64_t bytecodeHash = 0; // Lua doesn't verify binary chunks, a corrupted one could crash the interpreter
+	};
+
+	struct CompiledScript
+	{
+		std::filesystem::file_time_type sourceWriteTime;
+		sol::bytecode bytecode;
+	};
+
+	/**
+	* Bytecode of the scripts compiled so far. It outlives the Lua states, so reloading them doesn't reparse unchanged scripts
+	*/
+	std::unordered_map<std::string, CompiledScript>& GetCompiledScripts()
+	{
+		static std::unordered_map<std::string, CompiledScript> compiledScripts;
+		return compiledScripts;
+	}
+
+	std::filesystem::path GetPrecompiledScriptPath(const std::filesystem::path& p_scriptPath)
+	{
+		auto precompiledPath = p_scriptPath;
+		precompiledPath += ".ovluac";
+		return precompiledPath;
+	}
+
+	sol::bytecode ReadPrecompiledScript(const std::filesystem::path& p_scriptPath)
+	{
+		const OvTools::Filesystem::MappedFile file(GetPrecompiledScriptPath(p_scriptPath));
+
+		if (!file.IsValid() || file.GetData().size() <= sizeof(PrecompiledScriptHeader))
+			return {};
+
+		const auto bytes = file.GetData();
+		const PrecompiledScriptHeader expected;
+		PrecompiledScriptHeader header;
+		std::memcpy(&header, bytes.data(), sizeof(PrecompiledScriptHeader));
+
+		if (header.magic != expected.magic ||
+			header.formatVersion != expected.formatVersion ||
+			header.isBigEndian != expected.isBigEndian ||
+			!OvTools::Filesystem::IsCookedAssetUpToDate(header.stamp, p_scriptPath, kPrecompiledScriptSettingsHash))
+		{
+			return {};
+		}
+
+		const auto code = bytes.subspan(sizeof(PrecompiledScriptHeader));
+
+		if (OvTools::Filesystem::ComputeCookedAssetHash(code) != header.bytecodeHash)
+		{
+			OVLOG_WARNING("LuaScriptEngine: \"" + GetPrecompiledScriptPath(p_scriptPath).string() + "\" is corrupted, the script is compiled from its source instead");
+			return {};
+		}
+
+		const auto* begin = reinterpret_cast<const std::byte*>(code.data());
+		return sol::bytecode(begin, begin + code.size());
+	}
+
+	/**
+	* Returns the main function of the given script, compiled once per Lua state.
+	* The bytecode is reused as long as the script modification time doesn't change, and read from the precompiled
+	* script file (See CompileScript) when it is up-to-date and intact. Returns an invalid function on failure
+	*/
+	sol::protected_function GetScriptChunk(sol::state& p_luaState, const std::string& p_scriptName)
+	{
+		sol::table registry = p_luaState.registry();
+		auto loadedChunks = registry.get<sol::optional<sol::table>>(kLoadedChunksRegistryKey);
+
+		if (!loadedChunks)
+		{
+			loadedChunks = p_luaState.create_table();
+			registry[kLoadedChunksRegistryKey] = *loadedChunks;
+		}
+		else if (auto chunk = loadedChunks->get<sol::optional<sol::protected_function>>(p_scriptName))
+		{
+			return *chunk;
+		}
+
+		std::error_code error;
+		const auto writeTime = std::filesystem::last_write_time(p_scriptName, error);
+
+		auto& compiledScripts = GetCompiledScripts();
+		auto& compiledScript = compiledScripts[p_scriptName];
+
+		if (compiledScript.bytecode.empty() || compiledScript.sourceWriteTime != writeTime)
+		{
+			compiledScript.sourceWriteTime = writeTime;
+			compiledScript.bytecode = ReadPrecompiledScript(p_scriptName);
+		}
+
+		sol::protected_function chunk;
+
+		if (!compiledScript.bytecode.empty())
+		{
+			auto loaded = p_luaState.load_buffer(
+				compiledScript.bytecode.data(),
+				compiledScript.bytecode.size(),
+				"@" + p_scriptName,
+				sol::load_mode::binary
+			);
+
+			if (loaded.valid())
+			{
+				chunk = loaded;
 			}
 		}
-		catch (const sol::error& p_error)
+
+		// Not compiled yet, corrupted, or compiled by an incompatible Lua version
+		if (!chunk.valid())
 		{
-			OVLOG_ERROR(p_error.what());
+			auto loaded = p_luaState.load_file(p_scriptName);
+
+			if (!loaded.valid())
+			{
+				sol::error err = loaded;
+				OVLOG_ERROR(err.what());
+				compiledScripts.erase(p_scriptName);
+				return {};
+			}
+
+			chunk = loaded;
+			compiledScript.bytecode = chunk.dump(&sol::dump_pass_on_error);
 		}
+
+		(*loadedChunks)[p_scriptName] = chunk;
+		return chunk;
 	}
 
 	sol::table LoadScript(sol::state& p_luaState, const std::string& p_scriptName)
 	{
 		using namespace OvCore::Scripting;
 
-		const auto result = p_luaState.safe_script_file(p_scriptName, &sol::script_pass_on_error);
+		const auto chunk = GetScriptChunk(p_luaState, p_scriptName);
+
+		if (!chunk.valid())
+		{
+			return {};
+		}
+
+		// Every call of the chunk returns a new table, so behaviours sharing a script don't share their state
+		const auto result = chunk.call();
 
 		if (!result.valid())
 		{
@@ -117,7 +539,7 @@ namespace
 			"    \"io\": \"disable\",\n"
 			"    \"os\": \"disable\",\n"
 			"    \"package\": \"disable\",\n"
-			"    \"coroutine\": \"disable\"\n"
+			"    \"coroutine\": \"enable\"\n"
 			"  }}\n"
 			"}}\n",
 			absolutePath.string(),
@@ -191,6 +613,62 @@ std::string OvCore::Scripting::LuaScriptEngineBase::GetDefaultScriptContent(cons
 		"return " + scriptTableName;
 }
 
+template<>
+bool OvCore::Scripting::LuaScriptEngineBase::CompileScript(const std::filesystem::path& p_scriptPath)
+{
+	sol::state luaState;
+	auto loaded = luaState.load_file(p_scriptPath.string(), sol::load_mode::text);
+
+	if (!loaded.valid())
+	{
+		sol::error err = loaded;
+		OVLOG_WARNING(err.what());
+		return false;
+	}
+
+	sol::protected_function chunk = loaded;
+	const auto bytecode = chunk.dump(&sol::dump_pass_on_error);
+
+	if (bytecode.empty())
+	{
+		return false;
+	}
+
+	PrecompiledScriptHeader header;
+	header.stamp = OvTools::Filesystem::ComputeCookedAssetStamp(p_scriptPath, kPrecompiledScriptSettingsHash);
+	header.bytecodeHash = OvTools::Filesystem::ComputeCookedAssetHash({ reinterpret_cast<const uint8_t*>(bytecode.data()), bytecode.size() });
+
+	const auto precompiledPath = GetPrecompiledScriptPath(p_scriptPath);
+
+	// Written next to the destination then renamed, so that a failed write never leaves a truncated precompiled script
+	auto temporaryPath = precompiledPath;
+	temporaryPath += ".tmp";
+
+	{
+		std::ofstream stream(temporaryPath, std::ios::binary | std::ios::trunc);
+
+		if (!stream ||
+			!stream.write(reinterpret_cast<const char*>(&header), sizeof(PrecompiledScriptHeader)) ||
+			!stream.write(reinterpret_cast<const char*>(bytecode.data()), bytecode.size()))
+		{
+			OVLOG_WARNING("LuaScriptEngine: Unable to write \"" + temporaryPath.string() + "\"");
+			return false;
+		}
+	}
+
+	std::error_code error;
+	std::filesystem::rename(temporaryPath, precompiledPath, error);
+
+	if (error)
+	{
+		OVLOG_WARNING("LuaScriptEngine: Unable to write \"" + precompiledPath.string() + "\": " + error.message());
+		std::filesystem::remove(temporaryPath, error);
+		return false;
+	}
+
+	return true;
+}
+
 template<>
 void OvCore::Scripting::LuaScriptEngineBase::AddBehaviour(OvCore::ECS::Components::Behaviour& p_toAdd)
 {
@@ -216,22 +694,73 @@ void OvCore::Scripting::LuaScriptEngineBase::Reload()
 template<>
 void OvCore::Scripting::LuaScriptEngineBase::RemoveBehaviour(OvCore::ECS::Components::Behaviour& p_toRemove)
 {
+	const auto found = std::find_if(m_context.behaviours.begin(), m_context.behaviours.end(),
+		[&p_toRemove](std::reference_wrapper<OvCore::ECS::Components::Behaviour> behaviour) {
+			return &p_toRemove == &behaviour.get();
+		}
+	);
+
+	if (found == m_context.behaviours.end())
+	{
+		return;
+	}
+
+	m_context.behaviours.erase(found);
+
 	if (m_context.luaState)
 	{
+		if (auto script = p_toRemove.GetScript(); script.has_value() && script->IsValid())
+		{
+			// The table may still be referenced from Lua (e.g. stored by another script), it shouldn't reach the destroyed actor
+			auto& table = *static_cast<OvCore::Scripting::LuaScript&>(script.value()).GetContext().table;
+			table["owner"] = sol::lua_nil;
+		}
+		else if (m_context.errorCount > 0)
+		{
+			// This behaviour failed to register, it doesn't count as an error anymore
+			--m_context.errorCount;
+		}
+
+		// Coroutines started by the behaviour stop with it
+		for (const auto task : m_context.coroutineScheduler.RemoveTasks(&p_toRemove))
+		{
+			ReleaseCoroutine(m_context, task);
+		}
+
+		// Releasing the table reference is enough, the Lua garbage collector reclaims it along with the other scripts
 		p_toRemove.RemoveScript();
 	}
+}
 
-	m_context.behaviours.erase(
-		std::remove_if(m_context.behaviours.begin(), m_context.behaviours.end(),
-			[&p_toRemove](std::reference_wrapper< OvCore::ECS::Components::Behaviour> behaviour) {
-				return &p_toRemove == &behaviour.get();
-			}
-		)
-	);
+template<>
+void OvCore::Scripting::LuaScriptEngineBase::UpdateCoroutines(float p_deltaTime)
+{
+	if (!m_context.luaState)
+		return;
+
+	for (const auto task : m_context.coroutineScheduler.Update(p_deltaTime))
+	{
+		// A coroutine resumed before may have stopped this one
+		if (m_context.coroutineScheduler.HasTask(task))
+		{
+			ResumeCoroutine(m_context, task, 0, m_context.luaState->lua_state());
+		}
+	}
+}
 
-	// Unconsidering a script is impossible with Lua, we have to reparse every behaviours
-	// @note this might be costly, we should look into it more seriously.
-	Reload(); 
+template<>
+void OvCore::Scripting::LuaScriptEngineBase::FixedUpdateCoroutines()
+{
+	if (!m_context.luaState)
+		return;
+
+	for (const auto task : m_context.coroutineScheduler.FixedUpdate())
+	{
+		if (m_context.coroutineScheduler.HasTask(task))
+		{
+			ResumeCoroutine(m_context, task, 0, m_context.luaState->lua_state());
+		}
+	}
 }
 
 template<>
@@ -243,85 +772,91 @@ bool OvCore::Scripting::LuaScriptEngineBase::IsOk() const
 template<>
 void OvCore::Scripting::LuaScriptEngineBase::OnAwake(OvCore::ECS::Components::Behaviour& p_target)
 {
-	ExecuteLuaFunction(p_target, "OnAwake");
+	ExecuteLuaFunction(m_context, p_target, EScriptCallback::ON_AWAKE);
 }
 
 template<>
 void OvCore::Scripting::LuaScriptEngineBase::OnStart(OvCore::ECS::Components::Behaviour& p_target)
 {
-	ExecuteLuaFunction(p_target, "OnStart");
+	ExecuteLuaFunction(m_context, p_target, EScriptCallback::ON_START);
 }
 
 template<>
 void OvCore::Scripting::LuaScriptEngineBase::OnEnable(OvCore::ECS::Components::Behaviour& p_target)
 {
-	ExecuteLuaFunction(p_target, "OnEnable");
+	ExecuteLuaFunction(m_context, p_target, EScriptCallback::ON_ENABLE);
 }
 
 template<>
 void OvCore::Scripting::LuaScriptEngineBase::OnDisable(OvCore::ECS::Components::Behaviour& p_target)
 {
-	ExecuteLuaFunction(p_target, "OnDisable");
+	ExecuteLuaFunction(m_context, p_target, EScriptCallback::ON_DISABLE);
 }
 
 template<>
 void OvCore::Scripting::LuaScriptEngineBase::OnDestroy(OvCore::ECS::Components::Behaviour& p_target)
 {
-	ExecuteLuaFunction(p_target, "OnDestroy");
+	ExecuteLuaFunction(m_context, p_target, EScriptCallback::ON_DESTROY);
 }
 
 template<>
 void OvCore::Scripting::LuaScriptEngineBase::OnUpdate(OvCore::ECS::Components::Behaviour& p_target, float p_deltaTime)
 {
-	ExecuteLuaFunction(p_target, "OnUpdate", p_deltaTime);
+	ExecuteLuaFunction(m_context, p_target, EScriptCallback::ON_UPDATE, p_deltaTime);
 }
 
 template<>
 void OvCore::Scripting::LuaScriptEngineBase::OnFixedUpdate(OvCore::ECS::Components::Behaviour& p_target, float p_deltaTime)
 {
-	ExecuteLuaFunction(p_target, "OnFixedUpdate", p_deltaTime);
+	ExecuteLuaFunction(m_context, p_target, EScriptCallback::ON_FIXED_UPDATE, p_deltaTime);
 }
 
 template<>
 void OvCore::Scripting::LuaScriptEngineBase::OnLateUpdate(OvCore::ECS::Components::Behaviour& p_target, float p_deltaTime)
 {
-	ExecuteLuaFunction(p_target, "OnLateUpdate", p_deltaTime);
+	ExecuteLuaFunction(m_context, p_target, EScriptCallback::ON_LATE_UPDATE, p_deltaTime);
 }
 
 template<>
 void OvCore::Scripting::LuaScriptEngineBase::OnCollisionEnter(OvCore::ECS::Components::Behaviour& p_target, OvCore::ECS::Components::CPhysicalObject& p_otherObject)
 {
-	ExecuteLuaFunction(p_target, "OnCollisionEnter", p_otherObject);
+	ExecuteLuaFunction(m_context, p_target, EScriptCallback::ON_COLLISION_ENTER, p_otherObject);
 }
 
 template<>
 void OvCore::Scripting::LuaScriptEngineBase::OnCollisionStay(OvCore::ECS::Components::Behaviour& p_target, OvCore::ECS::Components::CPhysicalObject& p_otherObject)
 {
-	ExecuteLuaFunction(p_target, "OnCollisionStay", p_otherObject);
+	ExecuteLuaFunction(m_context, p_target, EScriptCallback::ON_COLLISION_STAY, p_otherObject);
 }
 
 template<>
 void OvCore::Scripting::LuaScriptEngineBase::OnCollisionExit(OvCore::ECS::Components::Behaviour& p_target, OvCore::ECS::Components::CPhysicalObject& p_otherObject)
 {
-	ExecuteLuaFunction(p_target, "OnCollisionExit", p_otherObject);
+	ExecuteLuaFunction(m_context, p_target, EScriptCallback::ON_COLLISION_EXIT, p_otherObject);
 }
 
 template<>
 void OvCore::Scripting::LuaScriptEngineBase::OnTriggerEnter(OvCore::ECS::Components::Behaviour& p_target, OvCore::ECS::Components::CPhysicalObject& p_otherObject)
 {
-	ExecuteLuaFunction(p_target, "OnTriggerEnter", p_otherObject);
+	ExecuteLuaFunction(m_context, p_target, EScriptCallback::ON_TRIGGER_ENTER, p_otherObject);
 }
 
 template<>
 void OvCore::Scripting::LuaScriptEngineBase::OnTriggerStay(OvCore::ECS::Components::Behaviour& p_target, OvCore::ECS::Components::CPhysicalObject& p_otherObject)
 {
-	ExecuteLuaFunction(p_target, "OnTriggerStay", p_otherObject);
+	ExecuteLuaFunction(m_context, p_target, EScriptCallback::ON_TRIGGER_STAY, p_otherObject);
 }
 
 template<>
 void OvCore::Scripting::LuaScriptEngineBase::OnTriggerExit(OvCore::ECS::Components::Behaviour& p_target, OvCore::ECS::Components::CPhysicalObject& p_otherObject)
 {
-	ExecuteLuaFunction(p_target, "OnTriggerExit", p_otherObject);
+	ExecuteLuaFunction(m_context, p_target, EScriptCallback::ON_TRIGGER_EXIT, p_otherObject);
+}
+
+template<>
+void OvCore::Scripting::LuaScriptEngineBase::OnSceneLoaded(OvCore::ECS::Components::Behaviour& p_target, const std::string& p_sceneName)
+{
+	ExecuteLuaFunction(m_context, p_target, EScriptCallback::ON_SCENE_LOADED, p_sceneName);
 }
 
 OvCore::Scripting::LuaScriptEngine::LuaScriptEngine(
@@ -345,13 +880,14 @@ void OvCore::Scripting::LuaScriptEngine::CreateContext()
 	OVASSERT(m_context.luaState == nullptr, "A Lua context already exists!");
 
 	m_context.luaState = std::make_unique<sol::state>();
-	m_context.luaState->open_libraries(sol::lib::base, sol::lib::math);
+	m_context.luaState->open_libraries(sol::lib::base, sol::lib::math, sol::lib::coroutine);
 
 	BindLuaActor(*m_context.luaState);
 	BindLuaComponents(*m_context.luaState);
 	BindLuaGlobal(*m_context.luaState);
 	BindLuaMath(*m_context.luaState);
 	BindLuaProfiler(*m_context.luaState);
+	BindCoroutines(*m_context.luaState, m_context);
 
 	m_context.errorCount = 0;
 
@@ -383,5 +919,9 @@ void OvCore::Scripting::LuaScriptEngine::DestroyContext()
 		}
 	);
 
+	// Coroutine conditions reference Lua functions, they must be released before the state
+	m_context.coroutineScheduler.Clear();
+	m_context.runningCoroutines.clear();
+
 	m_context.luaState.reset();
 }
@@ -15,6 +15,9 @@ OvCore::Scripting::NullScript::~TScript() {}
 template<>
 bool OvCore::Scripting::NullScript::IsValid() const { return true; }
 
+template<>
+bool OvCore::Scripting::NullScript::HasCallback(EScriptCallback) const { return false; }
+
 template<>
 std::map<std::string, OvCore::Scripting::ScriptPropertyValue> OvCore::Scripting::NullScript::GetDefaultProperties() const { return {}; }
 
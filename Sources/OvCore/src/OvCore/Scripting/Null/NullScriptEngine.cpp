@@ -39,6 +39,12 @@ std::string OvCore::Scripting::NullScriptEngineBase::GetDefaultScriptContent(con
 	return "class " + p_name + " {\n}";
 }
 
+template<>
+bool OvCore::Scripting::NullScriptEngineBase::CompileScript(const std::filesystem::path& p_scriptPath)
+{
+	return false;
+}
+
 template<>
 void OvCore::Scripting::NullScriptEngineBase::AddBehaviour(OvCore::ECS::Components::Behaviour& p_toAdd)
 {
@@ -54,6 +60,16 @@ void OvCore::Scripting::NullScriptEngineBase::Reload()
 {
 }
 
+template<>
+void OvCore::Scripting::NullScriptEngineBase::UpdateCoroutines(float p_deltaTime)
+{
+}
+
+template<>
+void OvCore::Scripting::NullScriptEngineBase::FixedUpdateCoroutines()
+{
+}
+
 template<>
 bool OvCore::Scripting::NullScriptEngineBase::IsOk() const
 {
@@ -129,3 +145,8 @@ template<>
 void OvCore::Scripting::NullScriptEngineBase::OnTriggerExit(OvCore::ECS::Components::Behaviour& p_target, OvCore::ECS::Components::CPhysicalObject& p_otherObject)
 {
 }
+
+template<>
+void OvCore::Scripting::NullScriptEngineBase::OnSceneLoaded(OvCore::ECS::Components::Behaviour& p_target, const std::string& p_sceneName)
+{
+}
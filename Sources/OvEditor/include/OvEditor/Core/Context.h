@@ -23,6 +23,7 @@
 #include <OvEditor/Core/EditorResources.h>
 #include <OvPhysics/Core/PhysicsEngine.h>
 #include <OvTools/Filesystem/IniFile.h>
+#include <OvTools/Utils/ThreadPool.h>
 #include <OvWindowing/Window.h>
 #include <OvUI/Core/UIManager.h>
 #include <OvWindowing/Context/Device.h>
@@ -65,6 +66,12 @@ namespace OvEditor::Core
 		*/
 		bool IsProjectSettingsIntegrityVerified();
 
+		/**
+		* Add the project settings that have been introduced after the project creation (Doesn't override existing keys).
+		* Returns true if at least one key has been added
+		*/
+		bool AddMissingOptionalProjectSettings();
+
 		/**
 		* Apply project settings to the ini file
 		*/
@@ -88,6 +95,8 @@ namespace OvEditor::Core
 
 		std::unique_ptr<OvCore::Scripting::ScriptEngine> scriptEngine;
 
+		std::unique_ptr<OvTools::Utils::ThreadPool> resourceLoadingPool;
+
 		OvCore::SceneSystem::SceneManager sceneManager;
 
 		OvCore::ResourceManagement::ModelManager modelManager;
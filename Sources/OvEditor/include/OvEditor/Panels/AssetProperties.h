@@ -63,6 +63,7 @@ namespace OvEditor::Panels
 		void CreateInfo();
 		void CreateModelSettings();
 		void CreateTextureSettings();
+		void CreateSoundSettings();
 		void Apply();
 
 	private:
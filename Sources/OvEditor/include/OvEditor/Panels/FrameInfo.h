@@ -56,5 +56,8 @@ namespace OvEditor::Panels
 		OvUI::Widgets::Texts::Text& m_instanceCountText;
 		OvUI::Widgets::Texts::Text& m_polyCountText;
 		OvUI::Widgets::Texts::Text& m_vertexCountText;
+		OvUI::Widgets::Visual::Separator& m_audioSeparator;
+		OvUI::Widgets::Texts::Text& m_voiceCountText;
+		OvUI::Widgets::Texts::Text& m_mixTimeText;
 	};
 }
\ No newline at end of file
@@ -79,6 +79,12 @@ namespace OvEditor::Panels
 		*/
 		void AddActorByInstance(OvCore::ECS::Actor& p_actor);
 
+		/**
+		* Add the widgets of the current scene actors that don't have one yet
+		* (A scene loaded in the background creates its actors before the previous scene is unloaded, which clears the hierarchy)
+		*/
+		void AddMissingActors();
+
 	public:
 		OvTools::Eventing::Event<OvCore::ECS::Actor&> ActorSelectedEvent;
 		OvTools::Eventing::Event<OvCore::ECS::Actor&> ActorUnselectedEvent;
@@ -4,6 +4,7 @@
 * @licence: MIT
 */
 
+#include <algorithm>
 #include <filesystem>
 
 #include <OvCore/Global/ServiceLocator.h>
@@ -80,6 +81,10 @@ OvEditor::Core::Context::Context(const std::filesystem::path& p_projectFolder) :
 		ResetProjectSettings();
 		projectSettings.Rewrite();
 	}
+	else if (AddMissingOptionalProjectSettings())
+	{
+		projectSettings.Rewrite();
+	}
 
 	ModelManager::ProvideAssetPaths(projectAssetsPath, engineAssetsPath);
 	TextureManager::ProvideAssetPaths(projectAssetsPath, engineAssetsPath);
@@ -87,6 +92,12 @@ OvEditor::Core::Context::Context(const std::filesystem::path& p_projectFolder) :
 	MaterialManager::ProvideAssetPaths(projectAssetsPath, engineAssetsPath);
 	SoundManager::ProvideAssetPaths(projectAssetsPath, engineAssetsPath);
 
+	resourceLoadingPool = std::make_unique<OvTools::Utils::ThreadPool>();
+	ModelManager::ProvideThreadPool(resourceLoadingPool.get());
+	TextureManager::ProvideThreadPool(resourceLoadingPool.get());
+	textureManager.GetStreamer().ProvideThreadPool(resourceLoadingPool.get());
+	sceneManager.ProvideThreadPool(resourceLoadingPool.get());
+
 	materialManager.ProvideStandardShaderDefinition({
 		.shaderPath = ":Shaders/Standard.ovfx"
 	});
@@ -139,13 +150,19 @@ OvEditor::Core::Context::Context(const std::filesystem::path& p_projectFolder) :
 	uiManager->EnableDocking(true);
 
 	/* Audio */
-	audioEngine = std::make_unique<OvAudio::Core::AudioEngine>();
+	OvAudio::Settings::AudioSettings audioSettings;
+	projectSettings.TryGet("audio_max_voices", audioSettings.maxVoices);
+	projectSettings.TryGet("audio_virtualization_volume", audioSettings.virtualizationVolume);
+	audioEngine = std::make_unique<OvAudio::Core::AudioEngine>(audioSettings);
 
 	/* Editor resources */
 	editorResources = std::make_unique<OvEditor::Core::EditorResources>(editorAssetsPath.string());
 
 	/* Physics engine */
-	physicsEngine = std::make_unique<OvPhysics::Core::PhysicsEngine>(OvPhysics::Settings::PhysicsSettings{ {0.0f, -9.81f, 0.0f } });
+	OvPhysics::Settings::PhysicsSettings physicsSettings;
+	projectSettings.TryGet("physics_multithreaded", physicsSettings.multithreaded);
+	projectSettings.TryGet("physics_worker_count", physicsSettings.workerCount);
+	physicsEngine = std::make_unique<OvPhysics::Core::PhysicsEngine>(physicsSettings);
 
 	/* Scripting */
 	scriptEngine = std::make_unique<OvCore::Scripting::ScriptEngine>(
@@ -184,6 +201,11 @@ OvEditor::Core::Context::~Context()
 	shaderManager.UnloadResources();
 	materialManager.UnloadResources();
 	soundManager.UnloadResources();
+
+	ModelManager::ProvideThreadPool(nullptr);
+	TextureManager::ProvideThreadPool(nullptr);
+	textureManager.GetStreamer().ProvideThreadPool(nullptr);
+	sceneManager.ProvideThreadPool(nullptr);
 }
 
 void OvEditor::Core::Context::ResetProjectSettings()
@@ -200,6 +222,27 @@ void OvEditor::Core::Context::ResetProjectSettings()
 	projectSettings.Add<int>("samples", 4);
 	projectSettings.Add<int>("build_type", 0);
 	projectSettings.Add<std::string>("window_icon", "");
+	AddMissingOptionalProjectSettings();
+}
+
+bool OvEditor::Core::Context::AddMissingOptionalProjectSettings()
+{
+	const OvPhysics::Settings::PhysicsSettings defaultPhysicsSettings;
+	const OvAudio::Settings::AudioSettings defaultAudioSettings;
+
+	bool added = false;
+	added |= projectSettings.Add<float>("physics_fixed_timestep", defaultPhysicsSettings.fixedTimestep);
+	added |= projectSettings.Add<bool>("physics_multithreaded", defaultPhysicsSettings.multithreaded);
+	added |= projectSettings.Add<int>("physics_worker_count", static_cast<int>(defaultPhysicsSettings.workerCount));
+	added |= projectSettings.Add<int>("audio_max_voices", static_cast<int>(defaultAudioSettings.maxVoices));
+	added |= projectSettings.Add<float>("audio_virtualization_volume", defaultAudioSettings.virtualizationVolume);
+	added |= projectSettings.Add<bool>("texture_streaming", true);
+	added |= projectSettings.Add<int>("texture_streaming_budget", static_cast<int>(OvCore::ResourceManagement::TextureStreamer::kDefaultBudgetInMegabytes));
+	added |= projectSettings.Add<float>("resource_release_delay", OvCore::SceneSystem::SceneManager::kDefaultResourceReleaseDelay);
+	added |= projectSettings.Add<float>("scene_activation_budget", OvCore::SceneSystem::SceneManager::kDefaultSceneActivationBudget);
+	added |= projectSettings.Add<bool>("binary_scenes", false);
+	added |= projectSettings.Add<bool>("precompiled_scripts", false);
+	return added;
 }
 
 bool OvEditor::Core::Context::IsProjectSettingsIntegrityVerified()
@@ -221,4 +264,9 @@ bool OvEditor::Core::Context::IsProjectSettingsIntegrityVerified()
 void OvEditor::Core::Context::ApplyProjectSettings()
 {
 	physicsEngine->SetGravity({ 0.0f, projectSettings.Get<float>("gravity"), 0.0f });
+	physicsEngine->SetFixedTimestep(projectSettings.GetOrDefault<float>("physics_fixed_timestep", OvPhysics::Settings::PhysicsSettings{}.fixedTimestep));
+	audioEngine->SetMaxVoices(static_cast<uint32_t>(projectSettings.GetOrDefault<int>("audio_max_voices", static_cast<int>(OvAudio::Settings::AudioSettings{}.maxVoices))));
+	audioEngine->SetVirtualizationVolume(projectSettings.GetOrDefault<float>("audio_virtualization_volume", OvAudio::Settings::AudioSettings{}.virtualizationVolume));
+	textureManager.GetStreamer().SetEnabled(projectSettings.GetOrDefault<bool>("texture_streaming", true));
+	textureManager.GetStreamer().SetBudget(static_cast<uint64_t>(std::max(projectSettings.GetOrDefault<int>("texture_streaming_budget", static_cast<int>(OvCore::ResourceManagement::TextureStreamer::kDefaultBudgetInMegabytes)), 0)) * 1024 * 1024);
 }
@@ -7,6 +7,7 @@
 #include "OvEditor/Core/EditorActions.h"
 #include <tracy/Tracy.hpp>
 
+#include <chrono>
 #include <filesystem>
 
 #include <OvCore/Helpers/GUIDrawer.h>
@@ -221,6 +222,16 @@ void OvEditor::Core::Editor::PreUpdate()
 {
 	ZoneScopedN("Editor Pre-Update");
 	m_context.device->PollEvents();
+
+	{
+		ZoneScopedN("Async Resource Uploads");
+
+		// Finalize the resources loaded in background, within a small per-frame budget to avoid hitches
+		const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(2);
+		m_context.textureManager.ProcessAsyncLoads(deadline);
+		m_context.modelManager.ProcessAsyncLoads(deadline);
+		m_context.textureManager.GetStreamer().Update(deadline);
+	}
 }
 
 void OvEditor::Core::Editor::Update(float p_deltaTime)
@@ -292,17 +303,14 @@ void OvEditor::Core::Editor::UpdateCurrentEditorMode(float p_deltaTime)
 void OvEditor::Core::Editor::UpdatePlayMode(float p_deltaTime)
 {
 	auto currentScene = m_context.sceneManager.GetCurrentScene();
-	bool simulationApplied = false;
 
 	{
 		ZoneScopedN("Physics Update");
-		simulationApplied = m_context.physicsEngine->Update(p_deltaTime);
-	}
-
-	if (simulationApplied)
-	{
-		ZoneScopedN("Fixed Update");
-		currentScene->FixedUpdate(p_deltaTime);
+		m_context.physicsEngine->Update(p_deltaTime, [currentScene](float p_fixedDeltaTime)
+		{
+			ZoneScopedN("Fixed Update");
+			currentScene->FixedUpdate(p_fixedDeltaTime);
+		});
 	}
 
 	{
@@ -43,6 +43,7 @@
 #include <OvEditor/Panels/SceneView.h>
 #include <OvEditor/Settings/EditorSettings.h>
 #include <OvEditor/Utils/FileSystem.h>
+#include <OvCore/SceneSystem/BinarySceneFormat.h>
 #include <OvCore/SceneSystem/PrefabOperations.h>
 
 #include <OvTools/Utils/PathParser.h>
@@ -59,6 +60,94 @@ namespace
 {
 	constexpr std::string_view kDefaultMaterialPath = ":Materials\\Default.ovmat";
 
+	void CookAssets(
+		OvCore::ResourceManagement::ModelManager& p_modelManager,
+		OvCore::ResourceManagement::TextureManager& p_textureManager,
+		const std::filesystem::path& p_folder
+	)
+	{
+		std::error_code error;
+
+		for (const auto& entry : std::filesystem::recursive_directory_iterator(p_folder, error))
+		{
+			if (!entry.is_regular_file())
+				continue;
+
+			switch (OvTools::Utils::PathParser::GetFileType(entry.path().string()))
+			{
+			case OvTools::Utils::PathParser::EFileType::MODEL: p_modelManager.CookModel(entry.path()); break;
+			case OvTools::Utils::PathParser::EFileType::TEXTURE: p_textureManager.CookTexture(entry.path()); break;
+			default: break;
+			}
+		}
+	}
+
+	/**
+	* Replace the XML scenes of the given folder by their binary encoding, which is smaller and faster to load
+	*/
+	uint32_t ConvertScenesToBinary(const std::filesystem::path& p_folder)
+	{
+		std::error_code error;
+		uint32_t convertedCount = 0;
+
+		for (const auto& entry : std::filesystem::recursive_directory_iterator(p_folder, error))
+		{
+			if (entry.is_regular_file() &&
+				OvTools::Utils::PathParser::GetFileType(entry.path().string()) == OvTools::Utils::PathParser::EFileType::SCENE &&
+				OvCore::SceneSystem::BinarySceneFormat::ConvertToBinary(entry.path()))
+			{
+				++convertedCount;
+			}
+		}
+
+		return convertedCount;
+	}
+
+	/**
+	* Give the copied files the write time of their source. Cooked assets are stamped with the write time of their
+	* source, which a copy changes, and the built game would otherwise hash every source file to validate them
+	*/
+	void CopyWriteTimes(const std::filesystem::path& p_sourceFolder, const std::filesystem::path& p_copyFolder)
+	{
+		std::error_code error;
+
+		for (const auto& entry : std::filesystem::recursive_directory_iterator(p_copyFolder, error))
+		{
+			if (!entry.is_regular_file())
+				continue;
+
+			std::error_code fileError;
+			const auto sourcePath = p_sourceFolder / std::filesystem::relative(entry.path(), p_copyFolder, fileError);
+			const auto sourceWriteTime = std::filesystem::last_write_time(sourcePath, fileError);
+
+			if (!fileError)
+			{
+				std::filesystem::last_write_time(entry.path(), sourceWriteTime, fileError);
+			}
+		}
+	}
+
+	/**
+	* Precompile the scripts of the given folder, so that the built game doesn't parse them
+	*/
+	uint32_t PrecompileScripts(OvCore::Scripting::ScriptEngine& p_scriptEngine, const std::filesystem::path& p_folder)
+	{
+		std::error_code error;
+		uint32_t compiledCount = 0;
+
+		for (const auto& entry : std::filesystem::recursive_directory_iterator(p_folder, error))
+		{
+			if (entry.is_regular_file() &&
+				OvTools::Utils::PathParser::GetFileType(entry.path().string()) == OvTools::Utils::PathParser::EFileType::SCRIPT &&
+				p_scriptEngine.CompileScript(entry.path()))
+			{
+				++compiledCount;
+			}
+		}
+
+		return compiledCount;
+	}
+
 	OvCore::ECS::Actor* ResolvePrefabInstanceRoot(OvCore::ECS::Actor& p_actor)
 	{
 		auto* resolvedRoot = &p_actor;
@@ -643,6 +732,11 @@ void OvEditor::Core::EditorActions::BuildAtLocation(
 
 	std::filesystem::remove_all(p_buildPath);
 
+	// Cooked models and textures are generated next to their source, so the asset copies below ship them
+	CookAssets(m_context.modelManager, m_context.textureManager, m_context.projectAssetsPath);
+	CookAssets(m_context.modelManager, m_context.textureManager, m_context.engineAssetsPath);
+	OVLOG_INFO("Assets cooked");
+
 	if (std::filesystem::create_directory(p_buildPath))
 	{
 		OVLOG_INFO("Build directory created");
@@ -692,6 +786,19 @@ void OvEditor::Core::EditorActions::BuildAtLocation(
 					if (!err)
 					{
 						OVLOG_INFO("Data/User/Assets/ directory copied");
+						CopyWriteTimes(m_context.projectAssetsPath, p_buildPath / "Data" / "User" / "Assets");
+
+						if (m_context.projectSettings.GetOrDefault("binary_scenes", false))
+						{
+							const uint32_t convertedCount = ConvertScenesToBinary(p_buildPath / "Data" / "User" / "Assets");
+							OVLOG_INFO(std::format("{} scene(s) converted to binary", convertedCount));
+						}
+
+						if (m_context.projectSettings.GetOrDefault("precompiled_scripts", false))
+						{
+							const uint32_t compiledCount = PrecompileScripts(*m_context.scriptEngine, p_buildPath / "Data" / "User" / "Assets");
+							OVLOG_INFO(std::format("{} script(s) precompiled", compiledCount));
+						}
 
 						std::filesystem::copy(
 							m_context.engineAssetsPath,
@@ -703,6 +810,7 @@ void OvEditor::Core::EditorActions::BuildAtLocation(
 						if (!err)
 						{
 							OVLOG_INFO("Data/Engine/ directory copied");
+							CopyWriteTimes(m_context.engineAssetsPath, p_buildPath / "Data" / "Engine");
 						}
 						else
 						{
@@ -10,6 +10,7 @@
 #include <OvCore/Global/ServiceLocator.h>
 #include <OvCore/Helpers/GUIDrawer.h>
 #include <OvCore/ResourceManagement/ModelManager.h>
+#include <OvCore/ResourceManagement/SoundManager.h>
 #include <OvCore/ResourceManagement/TextureManager.h>
 
 #include <OvEditor/Core/EditorActions.h>
@@ -206,6 +207,10 @@ void OvEditor::Panels::AssetProperties::CreateSettings()
 	{
 		CreateTextureSettings();
 	}
+	else if (fileType == OvTools::Utils::PathParser::EFileType::SOUND)
+	{
+		CreateSoundSettings();
+	}
 	else
 	{
 		m_settings->enabled = false;
@@ -231,6 +236,27 @@ void OvEditor::Panels::AssetProperties::CreateInfo()
 
 		OvCore::Helpers::GUIDrawer::CreateTitle(*m_infoColumns, "Metadata");
 		m_infoColumns->CreateWidget<OvUI::Widgets::Texts::Text>(std::filesystem::exists(realPath + ".meta") ? "Yes" : "No");
+
+		if (OvTools::Utils::PathParser::GetFileType(m_resource) == OvTools::Utils::PathParser::EFileType::SOUND)
+		{
+			const auto resourcePath = EDITOR_EXEC(GetResourcePath(m_resource));
+			auto& soundManager = OVSERVICE(OvCore::ResourceManagement::SoundManager);
+
+			OvCore::Helpers::GUIDrawer::CreateTitle(*m_infoColumns, "Decoded Memory");
+			if (!soundManager.IsResourceRegistered(resourcePath))
+			{
+				m_infoColumns->CreateWidget<OvUI::Widgets::Texts::Text>("Not loaded");
+			}
+			else if (const auto sound = soundManager.GetResource(resourcePath, false); sound->IsStreamed())
+			{
+				m_infoColumns->CreateWidget<OvUI::Widgets::Texts::Text>("Streamed");
+			}
+			else
+			{
+				const auto [decodedSize, decodedUnit] = OvTools::Utils::SizeConverter::ConvertToOptimalUnit(static_cast<float>(sound->GetDecodedSize()), OvTools::Utils::SizeConverter::ESizeUnit::BYTE);
+				m_infoColumns->CreateWidget<OvUI::Widgets::Texts::Text>(std::to_string(decodedSize) + " " + OvTools::Utils::SizeConverter::UnitToString(decodedUnit));
+			}
+		}
 	}
 	else
 	{
@@ -307,6 +333,49 @@ void OvEditor::Panels::AssetProperties::CreateModelSettings()
 	MODEL_FLAG_ENTRY("FORCE_GEN_NORMALS");
 	MODEL_FLAG_ENTRY("DROP_NORMALS");
 	MODEL_FLAG_ENTRY("GEN_BOUNDING_BOXES");
+
+	using namespace OvRendering::Settings;
+
+	const std::string kVertexFormat = "VERTEX_FORMAT";
+
+	m_metadata->Add(kVertexFormat, static_cast<int>(EVertexFormat::STANDARD));
+
+	OvCore::Helpers::GUIDrawer::CreateTitle(*m_settingsColumns, kVertexFormat);
+	auto& vertexFormat = m_settingsColumns->CreateWidget<OvUI::Widgets::Selection::ComboBox>(m_metadata->Get<int>(kVertexFormat));
+	vertexFormat.choices = std::map<int, std::string>{
+		{static_cast<int>(EVertexFormat::STANDARD), "STANDARD"},
+		{static_cast<int>(EVertexFormat::PACKED), "PACKED (UNORM16 WEIGHTS)"},
+		{static_cast<int>(EVertexFormat::PACKED_COMPACT), "PACKED (UNORM8 WEIGHTS)"}
+	};
+	vertexFormat.ValueChangedEvent += [this, kVertexFormat](int p_choice) {
+		m_metadata->Set(kVertexFormat, p_choice);
+	};
+
+	const std::string kLODCount = "LOD_COUNT";
+	const std::string kLODReduction = "LOD_REDUCTION";
+
+	m_metadata->Add(kLODCount, 0);
+	m_metadata->Add(kLODReduction, LODSettings{}.reduction);
+
+	OvCore::Helpers::GUIDrawer::DrawScalar<int>(*m_settingsColumns, kLODCount,
+		[this, kLODCount]() {
+			return m_metadata->Get<int>(kLODCount);
+		},
+		[this, kLODCount](int p_value) {
+			m_metadata->Set<int>(kLODCount, p_value);
+		},
+		1.0f, 0, static_cast<int>(LODSettings::kMaxLevelCount)
+	);
+
+	OvCore::Helpers::GUIDrawer::DrawScalar<float>(*m_settingsColumns, kLODReduction,
+		[this, kLODReduction]() {
+			return m_metadata->Get<float>(kLODReduction);
+		},
+		[this, kLODReduction](float p_value) {
+			m_metadata->Set<float>(kLODReduction, p_value);
+		},
+		0.01f, 0.01f, 0.99f
+	);
 };
 
 void OvEditor::Panels::AssetProperties::CreateTextureSettings()
@@ -319,12 +388,14 @@ void OvEditor::Panels::AssetProperties::CreateTextureSettings()
 	const std::string kHorizontalWrap = "HORIZONTAL_WRAP";
 	const std::string kVerticalWrap = "VERTICAL_WRAP";
 	const std::string kEnableMipmapping = "ENABLE_MIPMAPPING";
+	const std::string kCompression = "COMPRESSION";
 
 	m_metadata->Add(kMinFilter, static_cast<int>(ETextureFilteringMode::LINEAR_MIPMAP_LINEAR));
 	m_metadata->Add(kMagFilter, static_cast<int>(ETextureFilteringMode::LINEAR));
 	m_metadata->Add(kHorizontalWrap, static_cast<int>(ETextureWrapMode::REPEAT));
 	m_metadata->Add(kVerticalWrap, static_cast<int>(ETextureWrapMode::REPEAT));
 	m_metadata->Add(kEnableMipmapping, true);
+	m_metadata->Add(kCompression, static_cast<int>(ETextureCompression::NONE));
 
 	const auto filteringModes = std::map<int, std::string>{
 		{static_cast<int>(ETextureFilteringMode::NEAREST), "NEAREST"},
@@ -379,6 +450,41 @@ void OvEditor::Panels::AssetProperties::CreateTextureSettings()
 			m_metadata->Set<bool>(kEnableMipmapping, value);
 		}
 	);
+
+	OvCore::Helpers::GUIDrawer::CreateTitle(*m_settingsColumns, kCompression);
+	auto& compression = m_settingsColumns->CreateWidget<OvUI::Widgets::Selection::ComboBox>(m_metadata->Get<int>(kCompression));
+	compression.choices = std::map<int, std::string>{
+		{static_cast<int>(ETextureCompression::NONE), "NONE"},
+		{static_cast<int>(ETextureCompression::BC1), "BC1 (COLOR)"},
+		{static_cast<int>(ETextureCompression::BC3), "BC3 (COLOR + ALPHA)"},
+		{static_cast<int>(ETextureCompression::BC4), "BC4 (MASK)"},
+		{static_cast<int>(ETextureCompression::BC5), "BC5 (NORMAL)"},
+		{static_cast<int>(ETextureCompression::BC7), "BC7 (HIGH QUALITY COLOR)"},
+		{static_cast<int>(ETextureCompression::RGBA16F), "RGBA16F (HDR)"}
+	};
+	compression.ValueChangedEvent += [this, kCompression](int p_choice) {
+		m_metadata->Set(kCompression, p_choice);
+	};
+}
+
+void OvEditor::Panels::AssetProperties::CreateSoundSettings()
+{
+	using namespace OvAudio::Settings;
+
+	const std::string kLoadMode = "LOAD_MODE";
+
+	m_metadata->Add(kLoadMode, static_cast<int>(ESoundLoadMode::AUTO));
+
+	OvCore::Helpers::GUIDrawer::CreateTitle(*m_settingsColumns, kLoadMode);
+	auto& loadMode = m_settingsColumns->CreateWidget<OvUI::Widgets::Selection::ComboBox>(m_metadata->Get<int>(kLoadMode));
+	loadMode.choices = std::map<int, std::string>{
+		{static_cast<int>(ESoundLoadMode::AUTO), "AUTO"},
+		{static_cast<int>(ESoundLoadMode::DECOMPRESS), "DECOMPRESS"},
+		{static_cast<int>(ESoundLoadMode::STREAM), "STREAM"}
+	};
+	loadMode.ValueChangedEvent += [this, kLoadMode](int p_choice) {
+		m_metadata->Set(kLoadMode, p_choice);
+	};
 }
 
 void OvEditor::Panels::AssetProperties::Apply()
@@ -406,6 +512,14 @@ void OvEditor::Panels::AssetProperties::Apply()
 			textureManager.AResourceManager::ReloadResource(resourcePath);
 		}
 	}
+	else if (fileType == OvTools::Utils::PathParser::EFileType::SOUND)
+	{
+		auto& soundManager = OVSERVICE(OvCore::ResourceManagement::SoundManager);
+		if (soundManager.IsResourceRegistered(resourcePath))
+		{
+			soundManager.AResourceManager::ReloadResource(resourcePath);
+		}
+	}
 
 	Refresh();
 }
@@ -6,6 +6,7 @@
 
 #include <cmath>
 
+#include <OvAudio/Core/AudioEngine.h>
 #include <OvDebug/Logger.h>
 
 #include <OvRendering/Features/FrameInfoRenderFeature.h>
@@ -38,7 +39,12 @@ OvEditor::Panels::FrameInfo::FrameInfo
 	m_batchCountText(CreateWidget<Texts::Text>("")),
 	m_instanceCountText(CreateWidget<Texts::Text>("")),
 	m_polyCountText(CreateWidget<Texts::Text>("")),
-	m_vertexCountText(CreateWidget<Texts::Text>(""))
+	m_vertexCountText(CreateWidget<Texts::Text>("")),
+
+	m_audioSeparator(CreateWidget<Visual::Separator>()),
+
+	m_voiceCountText(CreateWidget<Texts::Text>("")),
+	m_mixTimeText(CreateWidget<Texts::Text>(""))
 {
 	m_polyCountText.lineBreak = false;
 }
@@ -84,4 +90,8 @@ void OvEditor::Panels::FrameInfo::Update(OvTools::Utils::OptRef<AView> p_targetV
 	m_instanceCountText.content = std::format(loc, "Instances: {:L}", frameInfo.instanceCount);
 	m_polyCountText.content = std::format(loc, "Polygons: {:L}", frameInfo.polyCount);
 	m_vertexCountText.content = std::format(loc, "Vertices: {:L}", frameInfo.vertexCount);
+
+	const auto& audioStats = EDITOR_CONTEXT(audioEngine)->GetStats();
+	m_voiceCountText.content = std::format(loc, "Voices: {:L} active, {:L} virtual", audioStats.activeVoices, audioStats.virtualVoices);
+	m_mixTimeText.content = std::format("Audio Mix: {:.2f} ms", audioStats.mixTime);
 }
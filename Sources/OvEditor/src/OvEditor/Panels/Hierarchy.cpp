@@ -403,6 +403,7 @@ OvEditor::Panels::Hierarchy::Hierarchy
 	// TODO: This code is unsafe, if the hierarchy gets deleted before the last actor gets deleted, this might crash
 	EDITOR_EVENT(ActorUnselectedEvent) += std::bind(&Hierarchy::UnselectActorsWidgets, this);
 	EDITOR_CONTEXT(sceneManager).SceneUnloadEvent += std::bind(&Hierarchy::Clear, this);
+	EDITOR_CONTEXT(sceneManager).SceneLoadEvent += std::bind(&Hierarchy::AddMissingActors, this);
 	OvCore::ECS::Actor::CreatedEvent += std::bind(&Hierarchy::AddActorByInstance, this, std::placeholders::_1);
 	OvCore::ECS::Actor::DestroyedEvent += std::bind(&Hierarchy::DeleteActorByInstance, this, std::placeholders::_1);
 	EDITOR_EVENT(ActorSelectedEvent) += std::bind(&Hierarchy::SelectActorByInstance, this, std::placeholders::_1);
@@ -514,6 +515,31 @@ void OvEditor::Panels::Hierarchy::DeleteActorByInstance(OvCore::ECS::Actor& p_ac
 	}
 }
 
+void OvEditor::Panels::Hierarchy::AddMissingActors()
+{
+	auto& actors = EDITOR_CONTEXT(sceneManager).GetCurrentScene()->GetActors();
+
+	std::vector<OvCore::ECS::Actor*> addedActors;
+
+	for (auto actor : actors)
+	{
+		if (!m_widgetActorLink.contains(actor))
+		{
+			AddActorByInstance(*actor);
+			addedActors.push_back(actor);
+		}
+	}
+
+	// Parents are attached once every widget exists, as a parent can come after its children
+	for (auto actor : addedActors)
+	{
+		if (actor->HasParent())
+		{
+			AttachActorToParent(*actor);
+		}
+	}
+}
+
 void OvEditor::Panels::Hierarchy::AddActorByInstance(OvCore::ECS::Actor & p_actor)
 {
 	auto& textSelectable = m_actors.CreateWidget<OvUI::Widgets::Layout::TreeNode>(p_actor.GetName(), true);
@@ -19,6 +19,8 @@
 #include <OvCore/ECS/Components/CModelRenderer.h>
 #include <OvCore/ECS/Components/CPhysicalBox.h>
 #include <OvCore/ECS/Components/CPhysicalCapsule.h>
+#include <OvCore/ECS/Components/CPhysicalConvex.h>
+#include <OvCore/ECS/Components/CPhysicalMesh.h>
 #include <OvCore/ECS/Components/CPhysicalSphere.h>
 #include <OvCore/ECS/Components/CPointLight.h>
 #include <OvCore/ECS/Components/CPostProcessStack.h>
@@ -94,6 +96,8 @@ namespace
 		CreateComponentInfo<CPhysicalBox>("Physical Box"),
 		CreateComponentInfo<CPhysicalSphere>("Physical Sphere"),
 		CreateComponentInfo<CPhysicalCapsule>("Physical Capsule"),
+		CreateComponentInfo<CPhysicalMesh>("Physical Mesh"),
+		CreateComponentInfo<CPhysicalConvex>("Physical Convex"),
 		CreateComponentInfo<CPointLight>("Point Light"),
 		CreateComponentInfo<CDirectionalLight>("Directional Light"),
 		CreateComponentInfo<CSpotLight>("Spot Light"),
@@ -56,6 +56,38 @@ OvEditor::Panels::ProjectSettings::ProjectSettings(const std::string & p_title,
 		columns.widths[0] = 125 * OVUI_SCALE;
 
 		GUIDrawer::DrawScalar<float>(columns, "Gravity", GenerateGatherer<float>("gravity"), GenerateProvider<float>("gravity"), 0.1f, GUIDrawer::_MIN_FLOAT, GUIDrawer::_MAX_FLOAT);
+		GUIDrawer::DrawScalar<float>(columns, "Fixed Timestep", GenerateGatherer<float>("physics_fixed_timestep"), GenerateProvider<float>("physics_fixed_timestep"), 0.001f, 0.001f, 1.0f);
+		GUIDrawer::DrawBoolean(columns, "Multithreaded", GenerateGatherer<bool>("physics_multithreaded"), GenerateProvider<bool>("physics_multithreaded"));
+		GUIDrawer::DrawScalar<int>(columns, "Worker Count", GenerateGatherer<int>("physics_worker_count"), GenerateProvider<int>("physics_worker_count"), 1, 0, 64);
+	}
+
+	{
+		/* Audio settings */
+		auto& root = CreateWidget<Layout::GroupCollapsable>("Audio");
+		auto& columns = root.CreateWidget<Layout::Columns<2>>();
+		columns.widths[0] = 125 * OVUI_SCALE;
+
+		GUIDrawer::DrawScalar<int>(columns, "Max Voices", GenerateGatherer<int>("audio_max_voices"), GenerateProvider<int>("audio_max_voices"), 1, 1, 254);
+		GUIDrawer::DrawScalar<float>(columns, "Virtualization Volume", GenerateGatherer<float>("audio_virtualization_volume"), GenerateProvider<float>("audio_virtualization_volume"), 0.0001f, 0.0f, 1.0f);
+	}
+
+	{
+		/* Rendering settings */
+		auto& root = CreateWidget<Layout::GroupCollapsable>("Rendering");
+		auto& columns = root.CreateWidget<Layout::Columns<2>>();
+		columns.widths[0] = 125 * OVUI_SCALE;
+
+		GUIDrawer::DrawBoolean(columns, "Texture Streaming", GenerateGatherer<bool>("texture_streaming"), GenerateProvider<bool>("texture_streaming"));
+		GUIDrawer::DrawScalar<int>(columns, "Streaming Budget (MB)", GenerateGatherer<int>("texture_streaming_budget"), GenerateProvider<int>("texture_streaming_budget"), 16, 16, 65536);
+	}
+
+	{
+		/* Resources settings (Only applied to builds, as the editor keeps references to the project resources) */
+		auto& root = CreateWidget<Layout::GroupCollapsable>("Resources");
+		auto& columns = root.CreateWidget<Layout::Columns<2>>();
+		columns.widths[0] = 125 * OVUI_SCALE;
+
+		GUIDrawer::DrawScalar<float>(columns, "Release Delay (s)", GenerateGatherer<float>("resource_release_delay"), GenerateProvider<float>("resource_release_delay"), 0.5f, -1.0f, 3600.0f);
 	}
 
 	{
@@ -74,6 +106,9 @@ OvEditor::Panels::ProjectSettings::ProjectSettings(const std::string & p_title,
 		auto& dispatcher = comboBox.AddPlugin<OvUI::Plugins::DataDispatcher<int>>();
 		dispatcher.RegisterGatherer(GenerateGatherer<int>("build_type"));
 		dispatcher.RegisterProvider(GenerateProvider<int>("build_type"));
+
+		GUIDrawer::DrawBoolean(columns, "Binary Scenes", GenerateGatherer<bool>("binary_scenes"), GenerateProvider<bool>("binary_scenes"));
+		GUIDrawer::DrawBoolean(columns, "Precompiled Scripts", GenerateGatherer<bool>("precompiled_scripts"), GenerateProvider<bool>("precompiled_scripts"));
 	}
 
 	{
@@ -107,5 +142,6 @@ OvEditor::Panels::ProjectSettings::ProjectSettings(const std::string & p_title,
 		columns.widths[0] = 125 * OVUI_SCALE;
 
 		GUIDrawer::DrawScene(columns, "Start scene", GenerateGatherer<std::string>("start_scene"), GenerateProvider<std::string>("start_scene"));
+		GUIDrawer::DrawScalar<float>(columns, "Activation Budget (ms)", GenerateGatherer<float>("scene_activation_budget"), GenerateProvider<float>("scene_activation_budget"), 0.5f, 0.0f, 100.0f);
 	}
 }
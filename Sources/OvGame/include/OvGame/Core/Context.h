@@ -25,6 +25,7 @@
 #include <OvAudio/Core/AudioEngine.h>
 
 #include <OvTools/Filesystem/IniFile.h>
+#include <OvTools/Utils/ThreadPool.h>
 
 namespace OvGame::Core
 {
@@ -58,6 +59,8 @@ namespace OvGame::Core
 		std::unique_ptr<OvCore::Scripting::ScriptEngine> scriptEngine;
 		std::unique_ptr<baregl::Framebuffer> framebuffer;
 
+		std::unique_ptr<OvTools::Utils::ThreadPool> resourceLoadingPool;
+
 		OvCore::SceneSystem::SceneManager sceneManager;
 
 		OvCore::ResourceManagement::ModelManager modelManager;
@@ -4,6 +4,7 @@
 * @licence: MIT
 */
 
+#include <algorithm>
 #include <filesystem>
 
 #include <OvCore/Global/ServiceLocator.h>
@@ -59,6 +60,30 @@ OvGame::Core::Context::Context() :
 	MaterialManager::ProvideAssetPaths(projectAssetsPath, engineAssetsPath);
 	SoundManager::ProvideAssetPaths(projectAssetsPath, engineAssetsPath);
 
+	resourceLoadingPool = std::make_unique<OvTools::Utils::ThreadPool>();
+	ModelManager::ProvideThreadPool(resourceLoadingPool.get());
+	TextureManager::ProvideThreadPool(resourceLoadingPool.get());
+	textureManager.GetStreamer().ProvideThreadPool(resourceLoadingPool.get());
+	sceneManager.ProvideThreadPool(resourceLoadingPool.get());
+
+	/* Texture streaming */
+	bool textureStreaming = true;
+	int textureStreamingBudget = static_cast<int>(OvCore::ResourceManagement::TextureStreamer::kDefaultBudgetInMegabytes);
+	projectSettings.TryGet("texture_streaming", textureStreaming);
+	projectSettings.TryGet("texture_streaming_budget", textureStreamingBudget);
+	textureManager.GetStreamer().SetEnabled(textureStreaming);
+	textureManager.GetStreamer().SetBudget(static_cast<uint64_t>(std::max(textureStreamingBudget, 0)) * 1024 * 1024);
+
+	/* Resources unused after a scene change */
+	float resourceReleaseDelay = OvCore::SceneSystem::SceneManager::kDefaultResourceReleaseDelay;
+	projectSettings.TryGet("resource_release_delay", resourceReleaseDelay);
+	sceneManager.SetResourceReleaseDelay(resourceReleaseDelay);
+
+	/* Scenes loaded in the background */
+	float sceneActivationBudget = OvCore::SceneSystem::SceneManager::kDefaultSceneActivationBudget;
+	projectSettings.TryGet("scene_activation_budget", sceneActivationBudget);
+	sceneManager.SetSceneActivationBudget(sceneActivationBudget);
+
 	materialManager.ProvideStandardShaderDefinition({
 		.shaderPath = ":Shaders/Standard.ovfx"
 	});
@@ -144,10 +169,18 @@ OvGame::Core::Context::Context() :
 	uiManager->EnableDocking(false);
 
 	/* Audio */
-	audioEngine = std::make_unique<OvAudio::Core::AudioEngine>();
+	OvAudio::Settings::AudioSettings audioSettings;
+	projectSettings.TryGet("audio_max_voices", audioSettings.maxVoices);
+	projectSettings.TryGet("audio_virtualization_volume", audioSettings.virtualizationVolume);
+	audioEngine = std::make_unique<OvAudio::Core::AudioEngine>(audioSettings);
 
 	/* Physics engine */
-	physicsEngine = std::make_unique<OvPhysics::Core::PhysicsEngine>(OvPhysics::Settings::PhysicsSettings{ {0.0f, projectSettings.Get<float>("gravity"), 0.0f } });
+	OvPhysics::Settings::PhysicsSettings physicsSettings;
+	physicsSettings.gravity = { 0.0f, projectSettings.Get<float>("gravity"), 0.0f };
+	projectSettings.TryGet("physics_fixed_timestep", physicsSettings.fixedTimestep);
+	projectSettings.TryGet("physics_multithreaded", physicsSettings.multithreaded);
+	projectSettings.TryGet("physics_worker_count", physicsSettings.workerCount);
+	physicsEngine = std::make_unique<OvPhysics::Core::PhysicsEngine>(physicsSettings);
 
 	/* Scripting */
 	scriptEngine = std::make_unique<OvCore::Scripting::ScriptEngine>(
@@ -185,4 +218,9 @@ OvGame::Core::Context::~Context()
 	shaderManager.UnloadResources();
 	materialManager.UnloadResources();
 	soundManager.UnloadResources();
+
+	ModelManager::ProvideThreadPool(nullptr);
+	TextureManager::ProvideThreadPool(nullptr);
+	textureManager.GetStreamer().ProvideThreadPool(nullptr);
+	sceneManager.ProvideThreadPool(nullptr);
 }
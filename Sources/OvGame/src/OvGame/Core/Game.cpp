@@ -4,6 +4,8 @@
 * @licence: MIT
 */
 
+#include <chrono>
+
 #include <tracy/Tracy.hpp>
 
 #include <OvDebug/Logger.h>
@@ -52,6 +54,16 @@ void OvGame::Core::Game::PreUpdate()
 	ZoneScoped;
 
 	m_context.device->PollEvents();
+
+	{
+		ZoneScopedN("Async Resource Uploads");
+
+		// Finalize the resources loaded in background, within a small per-frame budget to avoid hitches
+		const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(2);
+		m_context.textureManager.ProcessAsyncLoads(deadline);
+		m_context.modelManager.ProcessAsyncLoads(deadline);
+		m_context.textureManager.GetStreamer().Update(deadline);
+	}
 }
 
 void RenderCurrentScene(
@@ -101,8 +113,10 @@ void OvGame::Core::Game::Update(float p_deltaTime)
 			ZoneScopedN("Physics Update");
 			#endif
 
-			if (m_context.physicsEngine->Update(p_deltaTime))
-				currentScene->FixedUpdate(p_deltaTime);
+			m_context.physicsEngine->Update(p_deltaTime, [currentScene](float p_fixedDeltaTime)
+			{
+				currentScene->FixedUpdate(p_fixedDeltaTime);
+			});
 		}
 
 		{
@@ -124,6 +138,13 @@ void OvGame::Core::Game::Update(float p_deltaTime)
 
 		auto [windowWidth, windowHeight] = m_context.window->GetSize();
 		m_context.framebuffer->BlitToBackBuffer(windowWidth, windowHeight);
+
+		{
+			#ifdef _DEBUG
+			ZoneScopedN("Scene garbage collection");
+			#endif
+			currentScene->CollectGarbages();
+		}
 	}
 
 	m_context.sceneManager.Update();
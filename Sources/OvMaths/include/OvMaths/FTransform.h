@@ -218,6 +218,12 @@ namespace OvMaths
 		* Return the transform local right
 		*/
 		FVector3 GetLocalRight() const;		
+
+		/**
+		* Return a counter that is incremented every time the transform matrices change (Including changes coming from a parent).
+		* Useful to detect changes without comparing matrices
+		*/
+		uint64_t GetVersion() const;
 	
 	private:
 		void PreDecomposeWorldMatrix();
@@ -235,6 +241,7 @@ namespace OvMaths
 		FMatrix4 m_worldMatrix;
 
 		FTransform*	m_parent;
+		uint64_t	m_version = 0;
 		
 		Internal::TransformNotifier m_notifier;
 		Internal::TransformNotifier::NotificationHandlerID m_notificationHandlerID;
@@ -106,6 +106,7 @@ void OvMaths::FTransform::UpdateWorldMatrix()
 {
 	m_worldMatrix = HasParent() ? m_parent->m_worldMatrix * m_localMatrix : m_localMatrix;
 	PreDecomposeWorldMatrix();
+	++m_version;
 
 	m_notifier.NotifyChildren(Internal::TransformNotifier::ENotification::TRANSFORM_CHANGED);
 }
@@ -114,6 +115,7 @@ void OvMaths::FTransform::UpdateLocalMatrix()
 {
 	m_localMatrix = HasParent() ? FMatrix4::Inverse(m_parent->m_worldMatrix) * m_worldMatrix : m_worldMatrix;
 	PreDecomposeLocalMatrix();
+	++m_version;
 
 	m_notifier.NotifyChildren(Internal::TransformNotifier::ENotification::TRANSFORM_CHANGED);
 }
@@ -238,6 +240,11 @@ OvMaths::FVector3 OvMaths::FTransform::GetLocalRight() const
 	return m_localRotation * FVector3::Right;
 }
 
+uint64_t OvMaths::FTransform::GetVersion() const
+{
+	return m_version;
+}
+
 void OvMaths::FTransform::PreDecomposeWorldMatrix()
 {
 	m_worldPosition.x = m_worldMatrix(0, 3);
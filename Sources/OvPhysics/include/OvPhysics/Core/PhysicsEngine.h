@@ -6,32 +6,39 @@
 
 #pragma once
 
-#include <map>
+#include <functional>
 #include <optional>
+#include <span>
+#include <unordered_set>
 #include <vector>
 
 #include <OvPhysics/Entities/PhysicalObject.h>
+#include <OvPhysics/Entities/PhysicsQuery.h>
 #include <OvPhysics/Entities/RaycastHit.h>
 #include <OvPhysics/Settings/PhysicsSettings.h>
 
 class btDynamicsWorld;
+class btDiscreteDynamicsWorld;
 class btDispatcher;
 class btCollisionConfiguration;
 class btBroadphaseInterface;
 class btConstraintSolver;
 class btRigidBody;
-class btManifoldPoint;
-struct btCollisionObjectWrapper;
+class btCollisionObject;
+class btITaskScheduler;
 
 namespace OvPhysics::Core
 {
 	/**
-	* Main class of OvPhysics, it handles the creation of the physical world. It must be created
-	* before any PhysicalObject to ensure PhysicalObject consideration
+	* Main class of OvPhysics, it handles the creation of the physical world.
+	* A PhysicalObject is only simulated once it has been added to an engine, and belongs to a single engine at a time,
+	* so several engines (Worlds) can coexist
 	*/
 	class PhysicsEngine
 	{
 	public:
+		friend class OvPhysics::Entities::PhysicalObject;
+
 		/**
 		* Creates the PhysicsEngine
 		* @param p_settings
@@ -44,13 +51,15 @@ namespace OvPhysics::Core
 		virtual ~PhysicsEngine();
 
 		/**
-		* Simulate the physics. This method call is decomposed in 3 things:
-		* - Pre-Update (Apply FTransforms to btTransforms, called every Update call)
-		* - Simulation (Simulate the physics, called 60 times per seconds)
-		* - Post-Update (Apply the simulation results, btTransforms, to FTransforms)
+		* Simulate the physics. Each internal substep (fixed timestep) is decomposed in 3 things:
+		* - Pre-Update (Apply modified FTransforms to btTransforms)
+		* - Simulation (Simulate the physics for one fixed timestep)
+		* - Post-Update (Apply the simulation results of awake bodies, btTransforms, to FTransforms, dispatch contact events, then call the fixed update callback)
 		* This methods returns true if the call invoked a physics simulation
+		* @param p_deltaTime
+		* @param p_fixedUpdateCallback (Called once per internal substep with the fixed timestep)
 		*/
-		bool Update(float p_deltaTime);
+		bool Update(float p_deltaTime, const std::function<void(float)>& p_fixedUpdateCallback = {});
 
 		/* Casts a ray against all Physical Object in the Scene and returns information on what was hit
 		 * @param p_origin
@@ -58,6 +67,51 @@ namespace OvPhysics::Core
 		 */
 		std::optional<Entities::RaycastHit> Raycast(OvMaths::FVector3 p_origin, OvMaths::FVector3 p_direction, float p_distance);
 
+		/**
+		* Casts every given ray against the physical world and writes the closest hit of each ray into the result buffer
+		* (p_results[i] is the result of p_queries[i], p_results must be at least as big as p_queries)
+		* @param p_queries
+		* @param p_results
+		* @param p_parallel (Distribute queries over the physics task scheduler, only effective if the engine is multithreaded)
+		*/
+		void RaycastBatch(std::span<const Entities::RayQuery> p_queries, std::span<Entities::QueryHit> p_results, bool p_parallel = false) const;
+
+		/**
+		* Sweeps every given sphere against the physical world and writes the closest hit of each sweep into the result buffer
+		* (p_results[i] is the result of p_queries[i], p_results must be at least as big as p_queries)
+		* @param p_queries
+		* @param p_results
+		* @param p_parallel (Distribute queries over the physics task scheduler, only effective if the engine is multithreaded)
+		*/
+		void SphereCastBatch(std::span<const Entities::SphereCastQuery> p_queries, std::span<Entities::QueryHit> p_results, bool p_parallel = false) const;
+
+		/**
+		* Sweeps every given box against the physical world and writes the closest hit of each sweep into the result buffer
+		* (p_results[i] is the result of p_queries[i], p_results must be at least as big as p_queries)
+		* @param p_queries
+		* @param p_results
+		* @param p_parallel (Distribute queries over the physics task scheduler, only effective if the engine is multithreaded)
+		*/
+		void BoxCastBatch(std::span<const Entities::BoxCastQuery> p_queries, std::span<Entities::QueryHit> p_results, bool p_parallel = false) const;
+
+		/**
+		* Finds the physical objects overlapping each given sphere. The result buffer is split in equal slices
+		* (One per query), p_counts[i] receives the number of objects written in the slice of p_queries[i]
+		* @param p_queries
+		* @param p_results
+		* @param p_counts
+		*/
+		void OverlapSphereBatch(std::span<const Entities::SphereOverlapQuery> p_queries, std::span<Entities::PhysicalObject*> p_results, std::span<uint32_t> p_counts);
+
+		/**
+		* Finds the physical objects overlapping each given box. The result buffer is split in equal slices
+		* (One per query), p_counts[i] receives the number of objects written in the slice of p_queries[i]
+		* @param p_queries
+		* @param p_results
+		* @param p_counts
+		*/
+		void OverlapBoxBatch(std::span<const Entities::BoxOverlapQuery> p_queries, std::span<Entities::PhysicalObject*> p_results, std::span<uint32_t> p_counts);
+
 		/**
 		* Defines the world gravity to apply
 		* @param p_gravity
@@ -69,33 +123,98 @@ namespace OvPhysics::Core
 		*/
 		OvMaths::FVector3 GetGravity() const;
 
+		/**
+		* Defines the duration (in seconds) of a single internal simulation step
+		* @param p_fixedTimestep
+		*/
+		void SetFixedTimestep(float p_fixedTimestep);
+
+		/**
+		* Returns the duration (in seconds) of a single internal simulation step
+		*/
+		float GetFixedTimestep() const;
+
+		/**
+		* Returns true if the physics world is simulated using multiple threads
+		*/
+		bool IsMultithreaded() const;
+
+		/**
+		* Add the given physical object to this engine world. If it belongs to another engine, it is removed from it first
+		* @param p_physicalObject
+		*/
+		void AddPhysicalObject(Entities::PhysicalObject& p_physicalObject);
+
+		/**
+		* Remove the given physical object from this engine world (Nothing happens if it doesn't belong to this engine)
+		* @param p_physicalObject
+		*/
+		void RemovePhysicalObject(Entities::PhysicalObject& p_physicalObject);
+
+		/**
+		* Returns true if the given physical object belongs to this engine
+		* @param p_physicalObject
+		*/
+		bool Owns(const Entities::PhysicalObject& p_physicalObject) const;
+
 	private:
+		void CreateSingleThreadedWorld();
+		void CreateMultithreadedWorld(uint32_t p_workerCount);
+
 		void PreUpdate();
-		void PostUpdate();
+		void PostUpdate(float p_timeStep);
 
-		void ListenToPhysicalObjects();
+		static void PreTickCallback(btDynamicsWorld* p_world, float p_timeStep);
+		static void PostTickCallback(btDynamicsWorld* p_world, float p_timeStep);
+		void SetTickCallbacks();
 
-		void Consider(OvPhysics::Entities::PhysicalObject& p_toConsider);
-		void Unconsider(OvPhysics::Entities::PhysicalObject& p_toUnconsider);
+		template<typename TQuery, typename TFunctor>
+		void ExecuteQueries(std::span<const TQuery> p_queries, bool p_parallel, TFunctor p_functor) const;
+
+		uint32_t Overlap(btCollisionObject& p_queryObject, uint32_t p_layerMask, std::span<Entities::PhysicalObject*> p_results);
 
 		void Consider(btRigidBody& p_toConsider);
 		void Unconsider(btRigidBody& p_toUnconsider);
 
-		void ResetCollisionEvents();
-		void CheckCollisionStopEvents();
-
-		static bool CollisionCallback(btManifoldPoint& cp, const btCollisionObjectWrapper* obj1, int id1, int index1, const btCollisionObjectWrapper* obj2, int id2, int index2);
-		void SetCollisionCallback();
+		void GatherContacts();
+		void DispatchContactEvents();
 
 	private:
 		/* Bullet world */
-		std::unique_ptr<btDynamicsWorld> m_world;
+		std::unique_ptr<btDiscreteDynamicsWorld> m_world;
 		std::unique_ptr<btDispatcher> m_dispatcher;
 		std::unique_ptr<btCollisionConfiguration> m_collisionConfig;
 		std::unique_ptr<btBroadphaseInterface> m_broadphase;
 		std::unique_ptr<btConstraintSolver> m_solver;
+		std::unique_ptr<btConstraintSolver> m_solverMt;
+		btITaskScheduler* m_taskScheduler = nullptr; // Shared by every multithreaded engine of the process
+
+		/* Simulation */
+		float m_fixedTimestep;
+		int m_maxSubSteps;
+		const std::function<void(float)>* m_fixedUpdateCallback = nullptr;
+
+		/* Pair of touching physical objects, stored with the lowest address first */
+		struct ContactPair
+		{
+			Entities::PhysicalObject* first;
+			Entities::PhysicalObject* second;
+
+			bool operator==(const ContactPair&) const = default;
+		};
+
+		struct ContactPairHash
+		{
+			size_t operator()(const ContactPair& p_pair) const;
+		};
+
+		/* Contacts are read from Bullet's persistent manifolds after each substep, and compared with the previous substep ones */
+		std::unordered_set<ContactPair, ContactPairHash> m_contacts;
+		std::unordered_set<ContactPair, ContactPairHash> m_previousContacts;
+		std::vector<ContactPair> m_startedContacts;
+		std::vector<ContactPair> m_stayingContacts;
+		std::vector<ContactPair> m_stoppedContacts;
 
-		static std::map<std::pair<Entities::PhysicalObject*, Entities::PhysicalObject*>, bool> m_collisionEvents;
 		std::vector<std::reference_wrapper<Entities::PhysicalObject>> m_physicalObjects;
 	};
 }
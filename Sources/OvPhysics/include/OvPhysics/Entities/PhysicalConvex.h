@@ -0,0 +1,56 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "OvPhysics/Entities/PhysicalObject.h"
+
+namespace OvPhysics::Entities
+{
+	/**
+	* PhysicalObject with a convex hull shape
+	*/
+	class PhysicalConvex : public PhysicalObject
+	{
+	public:
+		/**
+		* PhysicalConvex constructor (Internal transform management)
+		* @param p_points
+		*/
+		PhysicalConvex(std::span<const OvMaths::FVector3> p_points = {});
+
+		/**
+		* PhysicalConvex constructor (External transform management)
+		* @param p_transform
+		* @param p_points
+		*/
+		PhysicalConvex(OvMaths::FTransform& p_transform, std::span<const OvMaths::FVector3> p_points = {});
+
+		/**
+		* Defines the points of the convex hull (Should already be reduced, see CollisionCache::CookConvexHull).
+		* An empty hull collides with nothing
+		* @param p_points
+		*/
+		void SetPoints(std::span<const OvMaths::FVector3> p_points);
+
+		/**
+		* Returns the points of the convex hull
+		*/
+		const std::vector<OvMaths::FVector3>& GetPoints() const;
+
+	private:
+		void CreateCollisionShape(std::span<const OvMaths::FVector3> p_points);
+		void RecreateCollisionShape(std::span<const OvMaths::FVector3> p_points);
+		virtual void SetLocalScaling(const OvMaths::FVector3& p_scaling) override;
+
+	private:
+		std::vector<OvMaths::FVector3> m_points;
+		OvMaths::FVector3 m_scaling = OvMaths::FVector3::One;
+	};
+}
@@ -0,0 +1,55 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <memory>
+
+#include "OvPhysics/Entities/PhysicalObject.h"
+#include "OvPhysics/Entities/TriangleMesh.h"
+
+namespace OvPhysics::Entities
+{
+	/**
+	* PhysicalObject with a triangle mesh shape. Triangle meshes are concave, so the object is always static
+	*/
+	class PhysicalMesh : public PhysicalObject
+	{
+	public:
+		/**
+		* PhysicalMesh constructor (Internal transform management)
+		* @param p_mesh
+		*/
+		PhysicalMesh(std::shared_ptr<const TriangleMesh> p_mesh = nullptr);
+
+		/**
+		* PhysicalMesh constructor (External transform management)
+		* @param p_transform
+		* @param p_mesh
+		*/
+		PhysicalMesh(OvMaths::FTransform& p_transform, std::shared_ptr<const TriangleMesh> p_mesh = nullptr);
+
+		/**
+		* Defines the triangle mesh to use (nullptr to collide with nothing)
+		* @param p_mesh
+		*/
+		void SetMesh(std::shared_ptr<const TriangleMesh> p_mesh);
+
+		/**
+		* Returns the triangle mesh in use
+		*/
+		const std::shared_ptr<const TriangleMesh>& GetMesh() const;
+
+	private:
+		void CreateCollisionShape(std::shared_ptr<const TriangleMesh> p_mesh);
+		void RecreateCollisionShape(std::shared_ptr<const TriangleMesh> p_mesh);
+		virtual void SetLocalScaling(const OvMaths::FVector3& p_scaling) override;
+
+	private:
+		std::shared_ptr<const TriangleMesh> m_mesh;
+		OvMaths::FVector3 m_scaling = OvMaths::FVector3::One;
+	};
+}
@@ -8,6 +8,7 @@
 
 #include <any>
 #include <memory>
+#include <optional>
 
 #include <OvMaths/FTransform.h>
 #include <OvTools/Eventing/Event.h>
@@ -221,6 +222,17 @@ namespace OvPhysics::Entities
 		*/
 		bool IsEnabled() const;
 
+		/**
+		* Defines the layer (From 0 to 31) of the physical object. Queries only consider objects whose layer is in their layer mask
+		* @param p_layer
+		*/
+		void SetLayer(uint8_t p_layer);
+
+		/**
+		* Returns the layer of the physical object
+		*/
+		uint8_t GetLayer() const;
+
 		/**
 		* Returns the user data associated to this physical object instance
 		*/
@@ -271,15 +283,14 @@ namespace OvPhysics::Entities
 		bool					m_trigger = false;
 		bool					m_enabled = true;
 		bool					m_considered = false;
+		uint8_t					m_layer = 0;
 		ECollisionDetectionMode m_collisionMode = ECollisionDetectionMode::DISCRETE;
 
 		/* Other */
 		std::any m_userData;
 		OvMaths::FVector3 m_previousScale = { 0.0f, 0.0f, 0.0f };
-		static OvTools::Eventing::Event<PhysicalObject&>	CreatedEvent;
-		static OvTools::Eventing::Event<PhysicalObject&>	DestroyedEvent;
-		static OvTools::Eventing::Event<btRigidBody&>		ConsiderEvent;
-		static OvTools::Eventing::Event<btRigidBody&>		UnconsiderEvent;
+		std::optional<uint64_t> m_syncedTransformVersion;
+		OvPhysics::Core::PhysicsEngine* m_engine = nullptr;
 
 		/* Bullet relatives */
 		std::unique_ptr<btMotionState>		m_motion;
@@ -0,0 +1,91 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+#include <OvMaths/FQuaternion.h>
+#include <OvMaths/FVector3.h>
+
+namespace OvPhysics::Entities
+{
+	class PhysicalObject;
+
+	/**
+	* Layer mask that accepts every physical object
+	*/
+	constexpr uint32_t kAllLayers = std::numeric_limits<uint32_t>::max();
+
+	/**
+	* Ray to cast against the physical world
+	*/
+	struct RayQuery
+	{
+		OvMaths::FVector3 origin = OvMaths::FVector3::Zero;
+		OvMaths::FVector3 direction = OvMaths::FVector3::Forward;
+		float distance = 0.0f;
+		uint32_t layerMask = kAllLayers;
+	};
+
+	/**
+	* Sphere to sweep against the physical world
+	*/
+	struct SphereCastQuery
+	{
+		OvMaths::FVector3 origin = OvMaths::FVector3::Zero;
+		OvMaths::FVector3 direction = OvMaths::FVector3::Forward;
+		float distance = 0.0f;
+		float radius = 0.5f;
+		uint32_t layerMask = kAllLayers;
+	};
+
+	/**
+	* Oriented box to sweep against the physical world
+	*/
+	struct BoxCastQuery
+	{
+		OvMaths::FVector3 origin = OvMaths::FVector3::Zero;
+		OvMaths::FQuaternion rotation = OvMaths::FQuaternion::Identity;
+		OvMaths::FVector3 halfExtents = { 0.5f, 0.5f, 0.5f };
+		OvMaths::FVector3 direction = OvMaths::FVector3::Forward;
+		float distance = 0.0f;
+		uint32_t layerMask = kAllLayers;
+	};
+
+	/**
+	* Sphere to test for overlaps against the physical world
+	*/
+	struct SphereOverlapQuery
+	{
+		OvMaths::FVector3 center = OvMaths::FVector3::Zero;
+		float radius = 0.5f;
+		uint32_t layerMask = kAllLayers;
+	};
+
+	/**
+	* Oriented box to test for overlaps against the physical world
+	*/
+	struct BoxOverlapQuery
+	{
+		OvMaths::FVector3 center = OvMaths::FVector3::Zero;
+		OvMaths::FQuaternion rotation = OvMaths::FQuaternion::Identity;
+		OvMaths::FVector3 halfExtents = { 0.5f, 0.5f, 0.5f };
+		uint32_t layerMask = kAllLayers;
+	};
+
+	/**
+	* Closest hit of a ray or shape cast. "object" is nullptr if nothing has been hit
+	*/
+	struct QueryHit
+	{
+		PhysicalObject* object = nullptr;
+		OvMaths::FVector3 point = OvMaths::FVector3::Zero;
+		OvMaths::FVector3 normal = OvMaths::FVector3::Zero;
+		float distance = 0.0f;
+	};
+}
@@ -0,0 +1,85 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include <OvMaths/FVector3.h>
+
+class btTriangleIndexVertexArray;
+class btBvhTriangleMeshShape;
+
+namespace OvPhysics::Entities
+{
+	/**
+	* Triangle soup and its bounding volume hierarchy, used as a static collision shape.
+	* A single instance can be shared by any number of PhysicalMesh (The BVH is built once, in unscaled space)
+	*/
+	class TriangleMesh
+	{
+	public:
+		/**
+		* Creates a triangle mesh and builds its BVH
+		* @param p_vertices
+		* @param p_indices
+		*/
+		TriangleMesh(std::vector<OvMaths::FVector3> p_vertices, std::vector<uint32_t> p_indices);
+
+		/**
+		* Creates a triangle mesh from a BVH previously returned by SerializeBvh.
+		* The BVH is rebuilt if the given data is invalid
+		* @param p_vertices
+		* @param p_indices
+		* @param p_serializedBvh
+		*/
+		TriangleMesh(std::vector<OvMaths::FVector3> p_vertices, std::vector<uint32_t> p_indices, std::span<const uint8_t> p_serializedBvh);
+
+		/**
+		* Destructor
+		*/
+		~TriangleMesh();
+
+		TriangleMesh(const TriangleMesh&) = delete;
+		TriangleMesh& operator=(const TriangleMesh&) = delete;
+
+		/**
+		* Returns the vertices of the triangle mesh
+		*/
+		const std::vector<OvMaths::FVector3>& GetVertices() const;
+
+		/**
+		* Returns the indices of the triangle mesh (3 per triangle)
+		*/
+		const std::vector<uint32_t>& GetIndices() const;
+
+		/**
+		* Returns the BVH of the triangle mesh in a form that can be given back to the constructor
+		*/
+		std::vector<uint8_t> SerializeBvh() const;
+
+		/**
+		* Returns the unscaled bullet shape of the triangle mesh
+		*/
+		btBvhTriangleMeshShape& GetShape() const;
+
+	private:
+		void CreateShape(std::span<const uint8_t> p_serializedBvh);
+
+	private:
+		/* Bullet requires the serialized BVH to be 16 bytes aligned */
+		struct alignas(16) BvhBlock { uint8_t bytes[16]; };
+
+		std::vector<OvMaths::FVector3> m_vertices;
+		std::vector<uint32_t> m_indices;
+		std::vector<BvhBlock> m_bvhData;
+		std::unique_ptr<btTriangleIndexVertexArray> m_meshInterface;
+		std::unique_ptr<btBvhTriangleMeshShape> m_shape;
+	};
+}
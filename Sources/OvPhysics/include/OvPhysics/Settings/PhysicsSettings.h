@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include <OvMaths/FVector3.h>
 
 namespace OvPhysics::Settings
@@ -16,5 +18,27 @@ namespace OvPhysics::Settings
 	struct PhysicsSettings
 	{
 		OvMaths::FVector3 gravity = { 0.0f, -9.81f, 0.f };
+
+		/**
+		* Duration (in seconds) of a single internal simulation step
+		*/
+		float fixedTimestep = 1.0f / 60.0f;
+
+		/**
+		* Maximum number of internal simulation steps that a single Update call can perform
+		*/
+		int maxSubSteps = 10;
+
+		/**
+		* If true, the physics world will dispatch collisions, solve islands and integrate bodies
+		* using Bullet's task scheduler (btDiscreteDynamicsWorldMt)
+		*/
+		bool multithreaded = false;
+
+		/**
+		* Number of threads used by the task scheduler when multithreaded (0 means one per hardware thread).
+		* The task scheduler is shared by the multithreaded engines of the process, only the first one sets it
+		*/
+		uint32_t workerCount = 0;
 	};
-}
\ No newline at end of file
+}
@@ -0,0 +1,70 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include <OvMaths/FVector3.h>
+#include <OvTools/Filesystem/CookedAssetStamp.h>
+
+#include "OvPhysics/Entities/TriangleMesh.h"
+
+namespace OvPhysics::Tools
+{
+	/**
+	* Cooks collision data and reads/writes it from/to cache files, so that BVHs and hulls aren't rebuilt on every load.
+	* Each cache file is stamped with the source file and settings it has been cooked from, an outdated cache is ignored
+	*/
+	class CollisionCache
+	{
+	public:
+		CollisionCache() = delete;
+
+		/**
+		* Reduce a point cloud to a simplified convex hull, suitable for a PhysicalConvex
+		* @param p_points
+		*/
+		static std::vector<OvMaths::FVector3> CookConvexHull(std::span<const OvMaths::FVector3> p_points);
+
+		/**
+		* Write a triangle mesh and its BVH to a cache file. Return true on success
+		* @param p_path
+		* @param p_stamp
+		* @param p_mesh
+		*/
+		static bool SaveTriangleMesh(const std::filesystem::path& p_path, const OvTools::Filesystem::CookedAssetStamp& p_stamp, const Entities::TriangleMesh& p_mesh);
+
+		/**
+		* Read a triangle mesh from a cache file. Return nullptr if the file is missing, invalid or outdated
+		* @param p_path
+		* @param p_sourcePath
+		* @param p_settingsHash
+		*/
+		static std::unique_ptr<Entities::TriangleMesh> LoadTriangleMesh(const std::filesystem::path& p_path, const std::filesystem::path& p_sourcePath, uint64_t p_settingsHash);
+
+		/**
+		* Write convex hull points to a cache file. Return true on success
+		* @param p_path
+		* @param p_stamp
+		* @param p_points
+		*/
+		static bool SaveConvexHull(const std::filesystem::path& p_path, const OvTools::Filesystem::CookedAssetStamp& p_stamp, std::span<const OvMaths::FVector3> p_points);
+
+		/**
+		* Read convex hull points from a cache file. Return std::nullopt if the file is missing, invalid or outdated
+		* @param p_path
+		* @param p_sourcePath
+		* @param p_settingsHash
+		*/
+		static std::optional<std::vector<OvMaths::FVector3>> LoadConvexHull(const std::filesystem::path& p_path, const std::filesystem::path& p_sourcePath, uint64_t p_settingsHash);
+	};
+}
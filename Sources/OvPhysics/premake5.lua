@@ -14,6 +14,10 @@ project "OvPhysics"
 		"**.ini"
 	}
 
+	defines {
+		"BT_THREADSAFE=1"
+	}
+
 	includedirs { 
 		-- Dependencies
 		dependdir .. "bullet3/",
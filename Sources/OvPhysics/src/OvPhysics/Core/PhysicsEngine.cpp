@@ -6,10 +6,17 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <mutex>
+#include <thread>
 
 #include <bullet/btBulletCollisionCommon.h>
 #include <bullet/btBulletDynamicsCommon.h>
+#include <bullet/BulletCollision/CollisionDispatch/btCollisionDispatcherMt.h>
+#include <bullet/BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolverMt.h>
+#include <bullet/BulletDynamics/Dynamics/btDiscreteDynamicsWorldMt.h>
+#include <bullet/LinearMath/btThreads.h>
 
+#include <OvDebug/Assertion.h>
 #include <OvDebug/Logger.h>
 
 #include <OvPhysics/Core/PhysicsEngine.h>
@@ -19,52 +26,218 @@
 using namespace OvPhysics::Tools;
 using namespace OvPhysics::Entities;
 
-std::map<std::pair<PhysicalObject*, PhysicalObject*>, bool> OvPhysics::Core::PhysicsEngine::m_collisionEvents;
+namespace
+{
+	/**
+	* Wraps a Bullet query callback to only accept physical objects whose layer is part of the given layer mask
+	*/
+	template<typename TCallback>
+	struct LayerFilteredCallback : public TCallback
+	{
+		uint32_t layerMask;
+
+		template<typename... Args>
+		LayerFilteredCallback(uint32_t p_layerMask, Args&&... p_args) : TCallback(std::forward<Args>(p_args)...), layerMask(p_layerMask) {}
+
+		bool needsCollision(btBroadphaseProxy* p_proxy) const override
+		{
+			if (!TCallback::needsCollision(p_proxy))
+				return false;
+
+			auto object = static_cast<const PhysicalObject*>(static_cast<btCollisionObject*>(p_proxy->m_clientObject)->getUserPointer());
+			return object && (layerMask & (1u << object->GetLayer()));
+		}
+	};
+
+	/**
+	* Bullet's task scheduler is global to the process, so it is shared by every multithreaded engine.
+	* It is created and installed by the first one, and uninstalled once the last one is destroyed
+	*/
+	struct SharedTaskScheduler
+	{
+		std::mutex mutex;
+		std::unique_ptr<btITaskScheduler> scheduler;
+		uint32_t userCount = 0;
+	};
+
+	SharedTaskScheduler& GetSharedTaskScheduler()
+	{
+		static SharedTaskScheduler sharedTaskScheduler;
+		return sharedTaskScheduler;
+	}
+
+	/**
+	* Returns the shared task scheduler, creating it with the given number of threads if no engine uses it yet
+	* (nullptr if Bullet has been built without BT_THREADSAFE)
+	*/
+	btITaskScheduler* AcquireTaskScheduler(uint32_t p_workerCount)
+	{
+		auto& shared = GetSharedTaskScheduler();
+		std::scoped_lock lock(shared.mutex);
+
+		if (!shared.scheduler)
+		{
+			shared.scheduler.reset(btCreateDefaultTaskScheduler());
+
+			if (!shared.scheduler)
+				return nullptr;
+
+			const int maxThreads = shared.scheduler->getMaxNumThreads();
+			const int workerCount = p_workerCount == 0 ? static_cast<int>(std::thread::hardware_concurrency()) : static_cast<int>(p_workerCount);
+			shared.scheduler->setNumThreads(std::clamp(workerCount, 1, maxThreads));
+			btSetTaskScheduler(shared.scheduler.get());
+		}
+
+		++shared.userCount;
+		return shared.scheduler.get();
+	}
+
+	void ReleaseTaskScheduler()
+	{
+		auto& shared = GetSharedTaskScheduler();
+		std::scoped_lock lock(shared.mutex);
+
+		if (shared.userCount > 0 && --shared.userCount == 0)
+		{
+			btSetTaskScheduler(btGetSequentialTaskScheduler());
+			shared.scheduler.reset();
+		}
+	}
+
+	QueryHit ConvexSweep(const btDiscreteDynamicsWorld& p_world, const btConvexShape& p_shape, const btQuaternion& p_rotation, const OvMaths::FVector3& p_origin, const OvMaths::FVector3& p_direction, float p_distance, uint32_t p_layerMask)
+	{
+		const btTransform from(p_rotation, Conversion::ToBtVector3(p_origin));
+		const btTransform to(p_rotation, Conversion::ToBtVector3(p_origin + p_direction * p_distance));
+
+		LayerFilteredCallback<btCollisionWorld::ClosestConvexResultCallback> callback(p_layerMask, from.getOrigin(), to.getOrigin());
+		p_world.convexSweepTest(&p_shape, from, to, callback);
+
+		if (!callback.hasHit())
+			return {};
+
+		return {
+			static_cast<PhysicalObject*>(const_cast<void*>(callback.m_hitCollisionObject->getUserPointer())),
+			Conversion::ToOvVector3(callback.m_hitPointWorld),
+			Conversion::ToOvVector3(callback.m_hitNormalWorld),
+			callback.m_closestHitFraction * p_distance
+		};
+	}
+}
+
+OvPhysics::Core::PhysicsEngine::PhysicsEngine(const Settings::PhysicsSettings & p_settings) :
+	m_fixedTimestep(p_settings.fixedTimestep),
+	m_maxSubSteps(p_settings.maxSubSteps)
+{
+	if (p_settings.multithreaded)
+		CreateMultithreadedWorld(p_settings.workerCount);
+
+	if (!m_world)
+		CreateSingleThreadedWorld();
+
+	m_world->setGravity(Conversion::ToBtVector3(p_settings.gravity));
+
+	SetTickCallbacks();
+}
+
+OvPhysics::Core::PhysicsEngine::~PhysicsEngine()
+{
+	// Objects that outlive the engine must not reference it anymore
+	for (auto& physicalObject : m_physicalObjects)
+		physicalObject.get().m_engine = nullptr;
+
+	// The world must be destroyed before the solvers, dispatcher and task scheduler it relies on
+	m_world.reset();
 
-OvPhysics::Core::PhysicsEngine::PhysicsEngine(const Settings::PhysicsSettings & p_settings)
+	if (m_taskScheduler)
+		ReleaseTaskScheduler();
+}
+
+void OvPhysics::Core::PhysicsEngine::CreateSingleThreadedWorld()
 {
 	m_collisionConfig = std::make_unique<btDefaultCollisionConfiguration>();
 	m_dispatcher = std::make_unique<btCollisionDispatcher>(m_collisionConfig.get());
 	m_broadphase = std::make_unique<btDbvtBroadphase>();
 	m_solver = std::make_unique<btSequentialImpulseConstraintSolver>();
 	m_world = std::make_unique<btDiscreteDynamicsWorld>(m_dispatcher.get(), m_broadphase.get(), m_solver.get(), m_collisionConfig.get());
-
-	m_world->setGravity(Conversion::ToBtVector3(p_settings.gravity));
-
-	ListenToPhysicalObjects();
-	SetCollisionCallback();
 }
 
-OvPhysics::Core::PhysicsEngine::~PhysicsEngine()
+void OvPhysics::Core::PhysicsEngine::CreateMultithreadedWorld(uint32_t p_workerCount)
 {
+	m_taskScheduler = AcquireTaskScheduler(p_workerCount);
 
+	if (!m_taskScheduler)
+	{
+		OVLOG_WARNING("Bullet has been built without BT_THREADSAFE, falling back to a single-threaded physics world");
+		return;
+	}
+
+	btDefaultCollisionConstructionInfo constructionInfo;
+	constructionInfo.m_defaultMaxPersistentManifoldPoolSize = 80000;
+	constructionInfo.m_defaultMaxCollisionAlgorithmPoolSize = 80000;
+
+	m_collisionConfig = std::make_unique<btDefaultCollisionConfiguration>(constructionInfo);
+	m_dispatcher = std::make_unique<btCollisionDispatcherMt>(m_collisionConfig.get());
+	m_broadphase = std::make_unique<btDbvtBroadphase>();
+	m_solver = std::make_unique<btConstraintSolverPoolMt>(m_taskScheduler->getNumThreads());
+	m_solverMt = std::make_unique<btSequentialImpulseConstraintSolverMt>();
+	m_world = std::make_unique<btDiscreteDynamicsWorldMt>(
+		m_dispatcher.get(),
+		m_broadphase.get(),
+		static_cast<btConstraintSolverPoolMt*>(m_solver.get()),
+		m_solverMt.get(),
+		m_collisionConfig.get()
+	);
 }
 
 void OvPhysics::Core::PhysicsEngine::PreUpdate()
 {
 	std::for_each(m_physicalObjects.begin(), m_physicalObjects.end(), std::mem_fn(&PhysicalObject::UpdateBtTransform));
+}
+
+void OvPhysics::Core::PhysicsEngine::PostUpdate(float p_timeStep)
+{
+	// Only awake dynamic bodies can have been moved by the simulation, sleeping and static ones are skipped
+	const auto& nonStaticBodies = m_world->getNonStaticRigidBodies();
+
+	for (int i = 0; i < nonStaticBodies.size(); ++i)
+	{
+		if (nonStaticBodies[i]->isActive())
+		{
+			if (auto physicalObject = static_cast<PhysicalObject*>(nonStaticBodies[i]->getUserPointer()))
+				physicalObject->UpdateFTransform();
+		}
+	}
+
+	GatherContacts();
+	DispatchContactEvents();
 
-	ResetCollisionEvents();
+	if (m_fixedUpdateCallback && *m_fixedUpdateCallback)
+		(*m_fixedUpdateCallback)(p_timeStep);
 }
 
-void OvPhysics::Core::PhysicsEngine::PostUpdate()
+bool OvPhysics::Core::PhysicsEngine::Update(float p_deltaTime, const std::function<void(float)>& p_fixedUpdateCallback)
 {
-	std::for_each(m_physicalObjects.begin(), m_physicalObjects.end(), std::mem_fn(&PhysicalObject::UpdateFTransform));
+	m_fixedUpdateCallback = &p_fixedUpdateCallback;
+	const int simulatedSteps = m_world->stepSimulation(p_deltaTime, m_maxSubSteps, m_fixedTimestep);
+	m_fixedUpdateCallback = nullptr;
 
-	CheckCollisionStopEvents();
+	return simulatedSteps > 0;
 }
 
-bool OvPhysics::Core::PhysicsEngine::Update(float p_deltaTime)
+void OvPhysics::Core::PhysicsEngine::PreTickCallback(btDynamicsWorld* p_world, float p_timeStep)
 {
-	PreUpdate();
+	static_cast<PhysicsEngine*>(p_world->getWorldUserInfo())->PreUpdate();
+}
 
-	if (m_world->stepSimulation(p_deltaTime, 10))
-	{
-		PostUpdate();
-		return true;
-	}
+void OvPhysics::Core::PhysicsEngine::PostTickCallback(btDynamicsWorld* p_world, float p_timeStep)
+{
+	static_cast<PhysicsEngine*>(p_world->getWorldUserInfo())->PostUpdate(p_timeStep);
+}
 
-	return false;
+void OvPhysics::Core::PhysicsEngine::SetTickCallbacks()
+{
+	m_world->setInternalTickCallback(&PhysicsEngine::PreTickCallback, this, true);
+	m_world->setInternalTickCallback(&PhysicsEngine::PostTickCallback, this, false);
 }
 
 std::optional<RaycastHit> OvPhysics::Core::PhysicsEngine::Raycast(OvMaths::FVector3 p_origin, OvMaths::FVector3 p_direction, float p_distance)
@@ -75,29 +248,167 @@ std::optional<RaycastHit> OvPhysics::Core::PhysicsEngine::Raycast(OvMaths::FVect
 	btVector3 origin = Tools::Conversion::ToBtVector3(p_origin);
 	btVector3 target = Tools::Conversion::ToBtVector3(p_origin + p_direction * p_distance);
 
+	// A single "all hits" pass gives both the hit list and the closest hit
+	btCollisionWorld::AllHitsRayResultCallback rayCallback(origin, target);
+	m_world->rayTest(origin, target, rayCallback);
+
+	if (!rayCallback.hasHit())
+		return {};
+
 	RaycastHit resultHit;
+	resultHit.ResultObjects.reserve(rayCallback.m_collisionObjects.size());
 
-	// Try to get First Hit
-	btCollisionWorld::ClosestRayResultCallback ClosestRayCallback(origin, target);
-	m_world->rayTest(origin, target, ClosestRayCallback);
+	int closestIndex = 0;
 
-	if (ClosestRayCallback.hasHit())
+	for (int i = 0; i < rayCallback.m_collisionObjects.size(); i++)
 	{
-		// Get First Hit
-		resultHit.FirstResultObject = reinterpret_cast<OvPhysics::Entities::PhysicalObject*>(ClosestRayCallback.m_collisionObject->getUserPointer());
+		resultHit.ResultObjects.push_back(reinterpret_cast<OvPhysics::Entities::PhysicalObject*>(rayCallback.m_collisionObjects[i]->getUserPointer()));
 
-		// Try to get all Hit
-		btCollisionWorld::AllHitsRayResultCallback rayCallback(origin, target);
-		m_world->rayTest(origin, target, rayCallback);
+		if (rayCallback.m_hitFractions[i] < rayCallback.m_hitFractions[closestIndex])
+			closestIndex = i;
+	}
 
-		// Get all Hit
-		for (int i = 0; i < rayCallback.m_collisionObjects.size(); i++)
-			resultHit.ResultObjects.push_back(reinterpret_cast<OvPhysics::Entities::PhysicalObject*>(rayCallback.m_collisionObjects[i]->getUserPointer()));
+	resultHit.FirstResultObject = resultHit.ResultObjects[closestIndex];
 
-		return resultHit;
-	}
+	return resultHit;
+}
+
+template<typename TQuery, typename TFunctor>
+void OvPhysics::Core::PhysicsEngine::ExecuteQueries(std::span<const TQuery> p_queries, bool p_parallel, TFunctor p_functor) const
+{
+	struct QueryLoop : public btIParallelForBody
+	{
+		std::span<const TQuery> queries;
+		TFunctor& functor;
+
+		QueryLoop(std::span<const TQuery> p_queries, TFunctor& p_functor) : queries(p_queries), functor(p_functor) {}
+
+		void forLoop(int p_begin, int p_end) const override
+		{
+			for (int i = p_begin; i < p_end; ++i)
+				functor(queries[i], static_cast<size_t>(i));
+		}
+	};
+
+	QueryLoop loop(p_queries, p_functor);
+
+	if (p_parallel && IsMultithreaded())
+		btParallelFor(0, static_cast<int>(p_queries.size()), 64, loop);
 	else
-		return {};
+		loop.forLoop(0, static_cast<int>(p_queries.size()));
+}
+
+void OvPhysics::Core::PhysicsEngine::RaycastBatch(std::span<const RayQuery> p_queries, std::span<QueryHit> p_results, bool p_parallel) const
+{
+	OVASSERT(p_results.size() >= p_queries.size(), "The result buffer is smaller than the query buffer");
+
+	ExecuteQueries(p_queries, p_parallel, [this, p_results](const RayQuery& p_query, size_t p_index)
+	{
+		const btVector3 from = Conversion::ToBtVector3(p_query.origin);
+		const btVector3 to = Conversion::ToBtVector3(p_query.origin + p_query.direction * p_query.distance);
+
+		LayerFilteredCallback<btCollisionWorld::ClosestRayResultCallback> callback(p_query.layerMask, from, to);
+		m_world->rayTest(from, to, callback);
+
+		p_results[p_index] = callback.hasHit() ? QueryHit{
+			static_cast<PhysicalObject*>(callback.m_collisionObject->getUserPointer()),
+			Conversion::ToOvVector3(callback.m_hitPointWorld),
+			Conversion::ToOvVector3(callback.m_hitNormalWorld),
+			callback.m_closestHitFraction * p_query.distance
+		} : QueryHit{};
+	});
+}
+
+void OvPhysics::Core::PhysicsEngine::SphereCastBatch(std::span<const SphereCastQuery> p_queries, std::span<QueryHit> p_results, bool p_parallel) const
+{
+	OVASSERT(p_results.size() >= p_queries.size(), "The result buffer is smaller than the query buffer");
+
+	ExecuteQueries(p_queries, p_parallel, [this, p_results](const SphereCastQuery& p_query, size_t p_index)
+	{
+		btSphereShape shape(p_query.radius);
+		p_results[p_index] = ConvexSweep(*m_world, shape, btQuaternion::getIdentity(), p_query.origin, p_query.direction, p_query.distance, p_query.layerMask);
+	});
+}
+
+void OvPhysics::Core::PhysicsEngine::BoxCastBatch(std::span<const BoxCastQuery> p_queries, std::span<QueryHit> p_results, bool p_parallel) const
+{
+	OVASSERT(p_results.size() >= p_queries.size(), "The result buffer is smaller than the query buffer");
+
+	ExecuteQueries(p_queries, p_parallel, [this, p_results](const BoxCastQuery& p_query, size_t p_index)
+	{
+		btBoxShape shape(Conversion::ToBtVector3(p_query.halfExtents));
+		p_results[p_index] = ConvexSweep(*m_world, shape, Conversion::ToBtQuaternion(p_query.rotation), p_query.origin, p_query.direction, p_query.distance, p_query.layerMask);
+	});
+}
+
+void OvPhysics::Core::PhysicsEngine::OverlapSphereBatch(std::span<const SphereOverlapQuery> p_queries, std::span<PhysicalObject*> p_results, std::span<uint32_t> p_counts)
+{
+	OVASSERT(p_counts.size() >= p_queries.size(), "The count buffer is smaller than the query buffer");
+
+	if (p_queries.empty())
+		return;
+
+	const size_t sliceSize = p_results.size() / p_queries.size();
+
+	for (size_t i = 0; i < p_queries.size(); ++i)
+	{
+		btSphereShape shape(p_queries[i].radius);
+		btCollisionObject queryObject;
+		queryObject.setCollisionShape(&shape);
+		queryObject.setWorldTransform(btTransform(btQuaternion::getIdentity(), Conversion::ToBtVector3(p_queries[i].center)));
+
+		p_counts[i] = Overlap(queryObject, p_queries[i].layerMask, p_results.subspan(i * sliceSize, sliceSize));
+	}
+}
+
+void OvPhysics::Core::PhysicsEngine::OverlapBoxBatch(std::span<const BoxOverlapQuery> p_queries, std::span<PhysicalObject*> p_results, std::span<uint32_t> p_counts)
+{
+	OVASSERT(p_counts.size() >= p_queries.size(), "The count buffer is smaller than the query buffer");
+
+	if (p_queries.empty())
+		return;
+
+	const size_t sliceSize = p_results.size() / p_queries.size();
+
+	for (size_t i = 0; i < p_queries.size(); ++i)
+	{
+		btBoxShape shape(Conversion::ToBtVector3(p_queries[i].halfExtents));
+		btCollisionObject queryObject;
+		queryObject.setCollisionShape(&shape);
+		queryObject.setWorldTransform(btTransform(Conversion::ToBtQuaternion(p_queries[i].rotation), Conversion::ToBtVector3(p_queries[i].center)));
+
+		p_counts[i] = Overlap(queryObject, p_queries[i].layerMask, p_results.subspan(i * sliceSize, sliceSize));
+	}
+}
+
+uint32_t OvPhysics::Core::PhysicsEngine::Overlap(btCollisionObject& p_queryObject, uint32_t p_layerMask, std::span<PhysicalObject*> p_results)
+{
+	struct OverlapCallback : public LayerFilteredCallback<btCollisionWorld::ContactResultCallback>
+	{
+		std::span<PhysicalObject*> results;
+		uint32_t count = 0;
+
+		OverlapCallback(uint32_t p_layerMask, std::span<PhysicalObject*> p_results) :
+			LayerFilteredCallback(p_layerMask), results(p_results) {}
+
+		btScalar addSingleResult(btManifoldPoint& p_point, const btCollisionObjectWrapper* p_object0, int, int, const btCollisionObjectWrapper* p_object1, int, int) override
+		{
+			// The query object has no user pointer, the other one is the overlapped physical object
+			void* userPointer0 = p_object0->getCollisionObject()->getUserPointer();
+			void* userPointer1 = p_object1->getCollisionObject()->getUserPointer();
+			auto object = static_cast<PhysicalObject*>(userPointer0 ? userPointer0 : userPointer1);
+
+			// The same object can report multiple contact points
+			if (object && count < results.size() && std::find(results.begin(), results.begin() + count, object) == results.begin() + count)
+				results[count++] = object;
+
+			return 0.0f;
+		}
+	};
+
+	OverlapCallback callback(p_layerMask, p_results);
+	m_world->contactTest(&p_queryObject, callback);
+	return callback.count;
 }
 
 void OvPhysics::Core::PhysicsEngine::SetGravity(const OvMaths::FVector3 & p_gravity)
@@ -110,47 +421,68 @@ OvMaths::FVector3 OvPhysics::Core::PhysicsEngine::GetGravity() const
 	return Conversion::ToOvVector3(m_world->getGravity());
 }
 
-void OvPhysics::Core::PhysicsEngine::ListenToPhysicalObjects()
+void OvPhysics::Core::PhysicsEngine::SetFixedTimestep(float p_fixedTimestep)
 {
-	PhysicalObject::CreatedEvent += std::bind(static_cast<void(PhysicsEngine::*)(PhysicalObject&)>(&PhysicsEngine::Consider), this, std::placeholders::_1);
-	PhysicalObject::DestroyedEvent += std::bind(static_cast<void(PhysicsEngine::*)(PhysicalObject&)>(&PhysicsEngine::Unconsider), this, std::placeholders::_1);
+	m_fixedTimestep = std::max(p_fixedTimestep, 0.0001f);
+}
 
-	PhysicalObject::ConsiderEvent += std::bind(static_cast<void(PhysicsEngine::*)(btRigidBody&)>(&PhysicsEngine::Consider), this, std::placeholders::_1);
-	PhysicalObject::UnconsiderEvent += std::bind(static_cast<void(PhysicsEngine::*)(btRigidBody&)>(&PhysicsEngine::Unconsider), this, std::placeholders::_1);
+float OvPhysics::Core::PhysicsEngine::GetFixedTimestep() const
+{
+	return m_fixedTimestep;
 }
 
-void OvPhysics::Core::PhysicsEngine::Consider(PhysicalObject& p_toConsider)
+bool OvPhysics::Core::PhysicsEngine::IsMultithreaded() const
 {
-	m_physicalObjects.push_back(std::ref(p_toConsider));
+	return m_taskScheduler != nullptr;
 }
 
-void OvPhysics::Core::PhysicsEngine::Unconsider(PhysicalObject& p_toUnconsider)
+void OvPhysics::Core::PhysicsEngine::AddPhysicalObject(PhysicalObject& p_physicalObject)
 {
+	if (Owns(p_physicalObject))
+		return;
+
+	if (p_physicalObject.m_engine)
+		p_physicalObject.m_engine->RemovePhysicalObject(p_physicalObject);
+
+	p_physicalObject.m_engine = this;
+	m_physicalObjects.push_back(std::ref(p_physicalObject));
+
+	// The body may have been considered before the object had an engine
+	if (p_physicalObject.m_considered)
+		Consider(*p_physicalObject.m_body);
+}
+
+void OvPhysics::Core::PhysicsEngine::RemovePhysicalObject(PhysicalObject& p_physicalObject)
+{
+	if (!Owns(p_physicalObject))
+		return;
+
+	if (p_physicalObject.m_considered && p_physicalObject.m_body)
+		Unconsider(*p_physicalObject.m_body);
+
+	auto found = std::find_if(m_physicalObjects.begin(), m_physicalObjects.end(), [&p_physicalObject](std::reference_wrapper<PhysicalObject> element)
 	{
-		auto found = std::find_if(m_physicalObjects.begin(), m_physicalObjects.end(), [&p_toUnconsider](std::reference_wrapper<PhysicalObject> element)
-		{
-			return std::addressof(p_toUnconsider) == std::addressof(element.get());
-		});
+		return std::addressof(p_physicalObject) == std::addressof(element.get());
+	});
 
-		if (found != m_physicalObjects.end())
-			m_physicalObjects.erase(found);
-	}
+	if (found != m_physicalObjects.end())
+		m_physicalObjects.erase(found);
 
+	// Forget the contacts of the removed object, so that no event is dispatched to or about it
+	auto involvesObject = [&p_physicalObject](const ContactPair& p_pair)
 	{
-		decltype(m_collisionEvents)::iterator iter = m_collisionEvents.begin();
-		decltype(m_collisionEvents)::iterator endIter = m_collisionEvents.end();
+		return p_pair.first == std::addressof(p_physicalObject) || p_pair.second == std::addressof(p_physicalObject);
+	};
 
-		for (; iter != endIter; )
-		{
-			if (iter->first.first == std::addressof(p_toUnconsider) || iter->first.second == std::addressof(p_toUnconsider))
-			{
-				m_collisionEvents.erase(iter++);
-			}
-			else {
-				++iter;
-			}
-		}
-	}
+	std::erase_if(m_contacts, involvesObject);
+	std::erase_if(m_previousContacts, involvesObject);
+
+	p_physicalObject.m_engine = nullptr;
+}
+
+bool OvPhysics::Core::PhysicsEngine::Owns(const PhysicalObject& p_physicalObject) const
+{
+	return p_physicalObject.m_engine == this;
 }
 
 void OvPhysics::Core::PhysicsEngine::Consider(btRigidBody& p_toConsider)
@@ -163,122 +495,86 @@ void OvPhysics::Core::PhysicsEngine::Unconsider(btRigidBody& p_toUnconsider)
 	m_world->removeRigidBody(&p_toUnconsider);
 }
 
-void OvPhysics::Core::PhysicsEngine::ResetCollisionEvents()
+size_t OvPhysics::Core::PhysicsEngine::ContactPairHash::operator()(const ContactPair& p_pair) const
 {
-	for (auto& element : m_collisionEvents)
-		element.second = false;
+	const size_t first = std::hash<PhysicalObject*>{}(p_pair.first);
+	const size_t second = std::hash<PhysicalObject*>{}(p_pair.second);
+	return first ^ (second + 0x9e3779b97f4a7c15ull + (first << 6) + (first >> 2));
 }
 
-void OvPhysics::Core::PhysicsEngine::CheckCollisionStopEvents()
+void OvPhysics::Core::PhysicsEngine::GatherContacts()
 {
-	for (auto it = m_collisionEvents.begin(); it != m_collisionEvents.end();)
+	std::swap(m_contacts, m_previousContacts);
+	m_contacts.clear();
+
+	// Bullet keeps one persistent manifold per overlapping pair, a pair touches if its manifold holds at least one point
+	btDispatcher& dispatcher = *m_world->getDispatcher();
+
+	for (int i = 0; i < dispatcher.getNumManifolds(); ++i)
 	{
-		auto objects = it->first;
-		if (!it->second)
-		{
-			if (!objects.first->IsTrigger() && !objects.second->IsTrigger())
-			{
-				objects.first->CollisionStopEvent.Invoke(*objects.second);
-				objects.second->CollisionStopEvent.Invoke(*objects.first);
-			}
-			else
-			{
-				if (objects.first->IsTrigger())
-					objects.first->TriggerStopEvent.Invoke(*objects.second);
-				else
-					objects.second->TriggerStopEvent.Invoke(*objects.first);
-			}
-
-			it = m_collisionEvents.erase(it);
-		}
-		else
-			++it;
+		const btPersistentManifold* manifold = dispatcher.getManifoldByIndexInternal(i);
+
+		if (manifold->getNumContacts() == 0)
+			continue;
+
+		auto object1 = static_cast<PhysicalObject*>(manifold->getBody0()->getUserPointer());
+		auto object2 = static_cast<PhysicalObject*>(manifold->getBody1()->getUserPointer());
+
+		if (!object1 || !object2 || (object1->IsTrigger() && object2->IsTrigger()))
+			continue;
+
+		if (object2 < object1)
+			std::swap(object1, object2);
+
+		m_contacts.insert({ object1, object2 });
 	}
 }
 
-bool OvPhysics::Core::PhysicsEngine::CollisionCallback(btManifoldPoint& cp, const btCollisionObjectWrapper* obj1, int id1, int index1, const btCollisionObjectWrapper* obj2, int id2, int index2)
+void OvPhysics::Core::PhysicsEngine::DispatchContactEvents()
 {
-	auto object1 = reinterpret_cast<PhysicalObject*>(obj1->getCollisionObject()->getUserPointer());
-	auto object2 = reinterpret_cast<PhysicalObject*>(obj2->getCollisionObject()->getUserPointer());
+	using Event = OvTools::Eventing::Event<PhysicalObject&> PhysicalObject::*;
+
+	// A trigger is notified with its trigger events, a solid object is only notified when touching another solid object
+	auto notify = [](PhysicalObject& p_object, PhysicalObject& p_other, Event p_collisionEvent, Event p_triggerEvent)
+	{
+		if (p_object.IsTrigger())
+			(p_object.*p_triggerEvent).Invoke(p_other);
+		else if (!p_other.IsTrigger())
+			(p_object.*p_collisionEvent).Invoke(p_other);
+	};
+
+	auto notifyPair = [&notify](const ContactPair& p_pair, Event p_collisionEvent, Event p_triggerEvent)
+	{
+		notify(*p_pair.first, *p_pair.second, p_collisionEvent, p_triggerEvent);
+		notify(*p_pair.second, *p_pair.first, p_collisionEvent, p_triggerEvent);
+	};
 
-	if (object1 && object2)
+	m_startedContacts.clear();
+	m_stayingContacts.clear();
+	m_stoppedContacts.clear();
+
+	for (const auto& pair : m_contacts)
+		(m_previousContacts.contains(pair) ? m_stayingContacts : m_startedContacts).push_back(pair);
+
+	for (const auto& pair : m_previousContacts)
+		if (!m_contacts.contains(pair))
+			m_stoppedContacts.push_back(pair);
+
+	// Listeners can destroy physical objects, which removes their pairs from the sets: a pair is only notified if it is still there
+	for (const auto& pair : m_startedContacts)
 	{
-		/* If the objects are not all trigger, enter */
-		if (!object1->IsTrigger() || !object2->IsTrigger())
+		if (m_contacts.contains(pair))
 		{
-			if (m_collisionEvents.find({ object1 , object2 }) == m_collisionEvents.end())
-			{
-				/* If object is trigger, invoke Trigger event,
-				 * else : is the other object trigger ? yes -> do nothing, no -> invoke Collision event
-				 */
-
-				 // Object 1 (Start event)
-				if (object1->IsTrigger())
-					object1->TriggerStartEvent.Invoke(*object2);
-				else
-				{
-					if (!object2->IsTrigger())
-						object1->CollisionStartEvent.Invoke(*object2);
-				}
-				// Object 2 (Start event)
-				if (object2->IsTrigger())
-					object2->TriggerStartEvent.Invoke(*object1);
-				else
-				{
-					if (!object1->IsTrigger())
-						object2->CollisionStartEvent.Invoke(*object1);
-				}
-
-				// Object 1 (Stay event)
-				if (object1->IsTrigger())
-					object1->TriggerStayEvent.Invoke(*object2);
-				else
-				{
-					if (!object2->IsTrigger())
-						object1->CollisionStayEvent.Invoke(*object2);
-				}
-				// Object 2 (Stay event)
-				if (object2->IsTrigger())
-					object2->TriggerStayEvent.Invoke(*object1);
-				else
-				{
-					if (!object1->IsTrigger())
-						object2->CollisionStayEvent.Invoke(*object1);
-				}
-
-				m_collisionEvents[{ object1, object2 }] = true;
-			}
-			else
-			{
-				if (!m_collisionEvents[{ object1, object2 }])
-				{
-					// Object 1 (Stay event)
-					if (object1->IsTrigger())
-						object1->TriggerStayEvent.Invoke(*object2);
-					else
-					{
-						if (!object2->IsTrigger())
-							object1->CollisionStayEvent.Invoke(*object2);
-					}
-					// Object 2 (Stay event)
-					if (object2->IsTrigger())
-						object2->TriggerStayEvent.Invoke(*object1);
-					else
-					{
-						if (!object1->IsTrigger())
-							object2->CollisionStayEvent.Invoke(*object1);
-					}
-
-					m_collisionEvents[{ object1, object2 }] = true;
-				}
-			}
+			notifyPair(pair, &PhysicalObject::CollisionStartEvent, &PhysicalObject::TriggerStartEvent);
+			notifyPair(pair, &PhysicalObject::CollisionStayEvent, &PhysicalObject::TriggerStayEvent);
 		}
 	}
 
-	return false;
-}
+	for (const auto& pair : m_stayingContacts)
+		if (m_contacts.contains(pair))
+			notifyPair(pair, &PhysicalObject::CollisionStayEvent, &PhysicalObject::TriggerStayEvent);
 
-void OvPhysics::Core::PhysicsEngine::SetCollisionCallback()
-{
-	gContactAddedCallback = &PhysicsEngine::CollisionCallback;
+	for (const auto& pair : m_stoppedContacts)
+		if (m_previousContacts.contains(pair))
+			notifyPair(pair, &PhysicalObject::CollisionStopEvent, &PhysicalObject::TriggerStopEvent);
 }
@@ -0,0 +1,66 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <bullet/btBulletCollisionCommon.h>
+
+#include <OvPhysics/Entities/PhysicalConvex.h>
+#include <OvPhysics/Tools/Conversion.h>
+
+OvPhysics::Entities::PhysicalConvex::PhysicalConvex(std::span<const OvMaths::FVector3> p_points) : PhysicalObject()
+{
+	CreateCollisionShape(p_points);
+	Init();
+}
+
+OvPhysics::Entities::PhysicalConvex::PhysicalConvex(OvMaths::FTransform& p_transform, std::span<const OvMaths::FVector3> p_points) : PhysicalObject(p_transform)
+{
+	CreateCollisionShape(p_points);
+	Init();
+}
+
+void OvPhysics::Entities::PhysicalConvex::SetPoints(std::span<const OvMaths::FVector3> p_points)
+{
+	RecreateCollisionShape(p_points);
+}
+
+const std::vector<OvMaths::FVector3>& OvPhysics::Entities::PhysicalConvex::GetPoints() const
+{
+	return m_points;
+}
+
+void OvPhysics::Entities::PhysicalConvex::CreateCollisionShape(std::span<const OvMaths::FVector3> p_points)
+{
+	m_points = std::vector<OvMaths::FVector3>(p_points.begin(), p_points.end());
+
+	if (!m_points.empty())
+	{
+		m_shape = std::make_unique<btConvexHullShape>(
+			reinterpret_cast<const btScalar*>(m_points.data()),
+			static_cast<int>(m_points.size()),
+			static_cast<int>(sizeof(OvMaths::FVector3))
+		);
+	}
+	else
+	{
+		m_shape = std::make_unique<btEmptyShape>();
+	}
+
+	m_shape->setLocalScaling(OvPhysics::Tools::Conversion::ToBtVector3(m_scaling));
+}
+
+void OvPhysics::Entities::PhysicalConvex::RecreateCollisionShape(std::span<const OvMaths::FVector3> p_points)
+{
+	// The body references the current shape, it has to be destroyed before the shape
+	auto previousShape = std::move(m_shape);
+	CreateCollisionShape(p_points);
+	RecreateBody();
+}
+
+void OvPhysics::Entities::PhysicalConvex::SetLocalScaling(const OvMaths::FVector3& p_scaling)
+{
+	m_scaling = p_scaling;
+	m_shape->setLocalScaling(OvPhysics::Tools::Conversion::ToBtVector3(p_scaling));
+}
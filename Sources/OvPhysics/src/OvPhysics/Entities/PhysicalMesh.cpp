@@ -0,0 +1,60 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <bullet/btBulletCollisionCommon.h>
+#include <bullet/BulletCollision/CollisionShapes/btScaledBvhTriangleMeshShape.h>
+
+#include <OvPhysics/Entities/PhysicalMesh.h>
+#include <OvPhysics/Tools/Conversion.h>
+
+OvPhysics::Entities::PhysicalMesh::PhysicalMesh(std::shared_ptr<const TriangleMesh> p_mesh) : PhysicalObject()
+{
+	CreateCollisionShape(std::move(p_mesh));
+	Init();
+}
+
+OvPhysics::Entities::PhysicalMesh::PhysicalMesh(OvMaths::FTransform& p_transform, std::shared_ptr<const TriangleMesh> p_mesh) : PhysicalObject(p_transform)
+{
+	CreateCollisionShape(std::move(p_mesh));
+	Init();
+}
+
+void OvPhysics::Entities::PhysicalMesh::SetMesh(std::shared_ptr<const TriangleMesh> p_mesh)
+{
+	if (m_mesh != p_mesh)
+		RecreateCollisionShape(std::move(p_mesh));
+}
+
+const std::shared_ptr<const OvPhysics::Entities::TriangleMesh>& OvPhysics::Entities::PhysicalMesh::GetMesh() const
+{
+	return m_mesh;
+}
+
+void OvPhysics::Entities::PhysicalMesh::CreateCollisionShape(std::shared_ptr<const TriangleMesh> p_mesh)
+{
+	// The shared BVH stays unscaled, the scaling is applied by a per-object wrapper
+	if (p_mesh)
+		m_shape = std::make_unique<btScaledBvhTriangleMeshShape>(&p_mesh->GetShape(), OvPhysics::Tools::Conversion::ToBtVector3(m_scaling));
+	else
+		m_shape = std::make_unique<btEmptyShape>();
+
+	m_mesh = std::move(p_mesh);
+}
+
+void OvPhysics::Entities::PhysicalMesh::RecreateCollisionShape(std::shared_ptr<const TriangleMesh> p_mesh)
+{
+	// The body references the current shape, it has to be destroyed before the shape
+	auto previousShape = std::move(m_shape);
+	auto previousMesh = m_mesh;
+	CreateCollisionShape(std::move(p_mesh));
+	RecreateBody();
+}
+
+void OvPhysics::Entities::PhysicalMesh::SetLocalScaling(const OvMaths::FVector3& p_scaling)
+{
+	m_scaling = p_scaling;
+	m_shape->setLocalScaling(OvPhysics::Tools::Conversion::ToBtVector3(p_scaling));
+}
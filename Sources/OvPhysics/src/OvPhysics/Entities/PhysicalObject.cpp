@@ -4,23 +4,20 @@
 * @licence: MIT
 */
 
+#include <algorithm>
 #include <cstdint>
 
 #include <bullet/btBulletCollisionCommon.h>
 #include <bullet/btBulletDynamicsCommon.h>
 
 #include <OvDebug/Logger.h>
+#include <OvPhysics/Core/PhysicsEngine.h>
 #include <OvPhysics/Entities/PhysicalObject.h>
 #include <OvPhysics/Tools/Conversion.h>
 
 using namespace OvPhysics::Tools;
 using namespace OvPhysics::Settings;
 
-OvTools::Eventing::Event<OvPhysics::Entities::PhysicalObject&>	OvPhysics::Entities::PhysicalObject::CreatedEvent;
-OvTools::Eventing::Event<OvPhysics::Entities::PhysicalObject&>	OvPhysics::Entities::PhysicalObject::DestroyedEvent;
-OvTools::Eventing::Event<btRigidBody&>							OvPhysics::Entities::PhysicalObject::ConsiderEvent;
-OvTools::Eventing::Event<btRigidBody&>							OvPhysics::Entities::PhysicalObject::UnconsiderEvent;
-
 namespace
 {
 	void AddFlag(btCollisionObject& p_object, btCollisionObject::CollisionFlags p_flag)
@@ -54,7 +51,9 @@ OvPhysics::Entities::PhysicalObject::PhysicalObject(OvMaths::FTransform& p_trans
 OvPhysics::Entities::PhysicalObject::~PhysicalObject()
 {
 	DestroyBody();
-	PhysicalObject::DestroyedEvent.Invoke(*this);
+
+	if (m_engine)
+		m_engine->RemovePhysicalObject(*this);
 
 	if (m_internalTransform)
 		delete m_transform;
@@ -62,17 +61,18 @@ OvPhysics::Entities::PhysicalObject::~PhysicalObject()
 
 void OvPhysics::Entities::PhysicalObject::Init()
 {
-	PhysicalObject::CreatedEvent.Invoke(*this);
 	CreateBody({});
 }
 
 void OvPhysics::Entities::PhysicalObject::AddForce(const OvMaths::FVector3& p_force)
 {
+	m_body->activate();
 	m_body->applyCentralForce(Conversion::ToBtVector3(p_force));
 }
 
 void OvPhysics::Entities::PhysicalObject::AddImpulse(const OvMaths::FVector3& p_impulse)
 {
+	m_body->activate();
 	m_body->applyCentralImpulse(Conversion::ToBtVector3(p_impulse));
 }
 
@@ -176,11 +176,13 @@ void OvPhysics::Entities::PhysicalObject::SetFriction(float p_friction)
 
 void OvPhysics::Entities::PhysicalObject::SetLinearVelocity(const OvMaths::FVector3 & p_linearVelocity)
 {
+	m_body->activate();
 	m_body->setLinearVelocity(Conversion::ToBtVector3(p_linearVelocity));
 }
 
 void OvPhysics::Entities::PhysicalObject::SetAngularVelocity(const OvMaths::FVector3 & p_angularVelocity)
 {
+	m_body->activate();
 	m_body->setAngularVelocity(Conversion::ToBtVector3(p_angularVelocity));
 }
 
@@ -238,9 +240,26 @@ bool OvPhysics::Entities::PhysicalObject::IsEnabled() const
 	return m_enabled;
 }
 
+void OvPhysics::Entities::PhysicalObject::SetLayer(uint8_t p_layer)
+{
+	m_layer = std::min<uint8_t>(p_layer, 31);
+}
+
+uint8_t OvPhysics::Entities::PhysicalObject::GetLayer() const
+{
+	return m_layer;
+}
+
 void OvPhysics::Entities::PhysicalObject::UpdateBtTransform()
 {
+	// Nothing to push to Bullet if the transform didn't change since the last synchronization
+	if (m_syncedTransformVersion == m_transform->GetVersion())
+		return;
+
+	m_syncedTransformVersion = m_transform->GetVersion();
+
 	m_body->setWorldTransform(Conversion::ToBtTransform(*m_transform));
+	m_body->activate();
 
 	if (OvMaths::FVector3::Distance(m_transform->GetWorldScale(), m_previousScale) >= 0.01f)
 	{
@@ -255,8 +274,14 @@ void OvPhysics::Entities::PhysicalObject::UpdateFTransform()
 	if (!m_kinematic)
 	{
 		const btTransform& result = m_body->getWorldTransform();
-		m_transform->SetLocalPosition(Conversion::ToOvVector3(result.getOrigin()));
-		m_transform->SetLocalRotation(Conversion::ToOvQuaternion(result.getRotation()));
+		m_transform->GenerateMatricesLocal(
+			Conversion::ToOvVector3(result.getOrigin()),
+			Conversion::ToOvQuaternion(result.getRotation()),
+			m_transform->GetLocalScale()
+		);
+
+		// The transform now reflects the body, it doesn't need to be pushed back to Bullet
+		m_syncedTransformVersion = m_transform->GetVersion();
 	}
 }
 
@@ -267,9 +292,12 @@ void OvPhysics::Entities::PhysicalObject::RecreateBody()
 
 void OvPhysics::Entities::PhysicalObject::ApplyInertia()
 {
+	// Bullet can't simulate concave shapes (Triangle meshes), they are treated as static whatever their settings are
+	const bool isStatic = m_kinematic || m_shape->isConcave();
+
 	m_body->setMassProps(
-		m_kinematic ? 0.0f : std::max(0.0000001f, m_mass),
-		m_kinematic ? btVector3(0.0f, 0.0f, 0.0f) : Tools::Conversion::ToBtVector3(CalculateInertia()));
+		isStatic ? 0.0f : std::max(0.0000001f, m_mass),
+		isStatic ? btVector3(0.0f, 0.0f, 0.0f) : Tools::Conversion::ToBtVector3(CalculateInertia()));
 }
 
 void OvPhysics::Entities::PhysicalObject::Consider()
@@ -277,7 +305,9 @@ void OvPhysics::Entities::PhysicalObject::Consider()
 	if (!m_considered)
 	{
 		m_considered = true;
-		ConsiderEvent.Invoke(*m_body);
+
+		if (m_engine)
+			m_engine->Consider(*m_body);
 	}
 }
 
@@ -286,7 +316,9 @@ void OvPhysics::Entities::PhysicalObject::Unconsider()
 	if (m_considered)
 	{
 		m_considered = false;
-		UnconsiderEvent.Invoke(*m_body);
+
+		if (m_engine)
+			m_engine->Unconsider(*m_body);
 	}
 }
 
@@ -306,12 +338,10 @@ void OvPhysics::Entities::PhysicalObject::CreateBody(const Settings::BodySetting
 	m_body->setAngularFactor(Conversion::ToBtVector3(p_bodySettings.angularFactor));
 	m_body->setUserPointer(this);
 
-	AddFlag(*m_body, btCollisionObject::CF_CUSTOM_MATERIAL_CALLBACK);
-
 	if (p_bodySettings.isTrigger)
 		AddFlag(*m_body, btCollisionObject::CF_NO_CONTACT_RESPONSE);
 
-	SetActivationState(EActivationState::ALWAYS_ACTIVE); // TODO: Avoid using always active
+	SetActivationState(EActivationState::ACTIVE);
 
 	if (m_enabled)
 		Consider();
@@ -0,0 +1,92 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <cstring>
+
+#include <bullet/btBulletCollisionCommon.h>
+
+#include <OvDebug/Logger.h>
+#include <OvPhysics/Entities/TriangleMesh.h>
+
+OvPhysics::Entities::TriangleMesh::TriangleMesh(std::vector<OvMaths::FVector3> p_vertices, std::vector<uint32_t> p_indices) :
+	m_vertices(std::move(p_vertices)),
+	m_indices(std::move(p_indices))
+{
+	CreateShape({});
+}
+
+OvPhysics::Entities::TriangleMesh::TriangleMesh(std::vector<OvMaths::FVector3> p_vertices, std::vector<uint32_t> p_indices, std::span<const uint8_t> p_serializedBvh) :
+	m_vertices(std::move(p_vertices)),
+	m_indices(std::move(p_indices))
+{
+	CreateShape(p_serializedBvh);
+}
+
+OvPhysics::Entities::TriangleMesh::~TriangleMesh()
+{
+	// The shape references the mesh interface, which references the geometry
+	m_shape.reset();
+	m_meshInterface.reset();
+}
+
+const std::vector<OvMaths::FVector3>& OvPhysics::Entities::TriangleMesh::GetVertices() const
+{
+	return m_vertices;
+}
+
+const std::vector<uint32_t>& OvPhysics::Entities::TriangleMesh::GetIndices() const
+{
+	return m_indices;
+}
+
+std::vector<uint8_t> OvPhysics::Entities::TriangleMesh::SerializeBvh() const
+{
+	const btOptimizedBvh* bvh = m_shape->getOptimizedBvh();
+	const unsigned size = bvh->calculateSerializeBufferSize();
+
+	std::vector<BvhBlock> buffer((size + sizeof(BvhBlock) - 1) / sizeof(BvhBlock));
+	if (!bvh->serializeInPlace(buffer.data(), size, false))
+		return {};
+
+	const auto* bytes = reinterpret_cast<const uint8_t*>(buffer.data());
+	return { bytes, bytes + size };
+}
+
+btBvhTriangleMeshShape& OvPhysics::Entities::TriangleMesh::GetShape() const
+{
+	return *m_shape;
+}
+
+void OvPhysics::Entities::TriangleMesh::CreateShape(std::span<const uint8_t> p_serializedBvh)
+{
+	m_meshInterface = std::make_unique<btTriangleIndexVertexArray>(
+		static_cast<int>(m_indices.size() / 3),
+		reinterpret_cast<int*>(m_indices.data()),
+		static_cast<int>(3 * sizeof(uint32_t)),
+		static_cast<int>(m_vertices.size()),
+		reinterpret_cast<btScalar*>(m_vertices.data()),
+		static_cast<int>(sizeof(OvMaths::FVector3))
+	);
+
+	if (!p_serializedBvh.empty())
+	{
+		// The BVH is deserialized in place, so the buffer has to live as long as the shape
+		m_bvhData.resize((p_serializedBvh.size() + sizeof(BvhBlock) - 1) / sizeof(BvhBlock));
+		std::memcpy(m_bvhData.data(), p_serializedBvh.data(), p_serializedBvh.size());
+
+		if (btOptimizedBvh* bvh = btOptimizedBvh::deSerializeInPlace(m_bvhData.data(), static_cast<unsigned>(p_serializedBvh.size()), false))
+		{
+			m_shape = std::make_unique<btBvhTriangleMeshShape>(m_meshInterface.get(), true, false);
+			m_shape->setOptimizedBvh(bvh);
+			return;
+		}
+
+		OVLOG_WARNING("TriangleMesh: Invalid serialized BVH, rebuilding it");
+		m_bvhData.clear();
+	}
+
+	m_shape = std::make_unique<btBvhTriangleMeshShape>(m_meshInterface.get(), true, true);
+}
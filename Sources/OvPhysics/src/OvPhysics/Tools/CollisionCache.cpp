@@ -0,0 +1,231 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <fstream>
+
+#include <bullet/btBulletCollisionCommon.h>
+#include <bullet/BulletCollision/CollisionShapes/btShapeHull.h>
+
+#include <OvDebug/Logger.h>
+#include <OvPhysics/Tools/CollisionCache.h>
+
+namespace
+{
+	constexpr std::array<char, 4> kMagic = { 'O', 'V', 'C', 'L' };
+
+	// Bump whenever the layout of the cache changes
+	constexpr uint32_t kFormatVersion = 2;
+
+	enum class ECacheType : uint32_t
+	{
+		TRIANGLE_MESH,
+		CONVEX_HULL
+	};
+
+	/**
+	* Serialized BVHs depend on the Bullet version, the scalar precision and the endianness,
+	* so all of them are part of the header
+	*/
+	struct CacheHeader
+	{
+		std::array<char, 4> magic = kMagic;
+		uint32_t formatVersion = kFormatVersion;
+		uint32_t bulletVersion = static_cast<uint32_t>(btGetVersion());
+		uint32_t scalarSize = sizeof(btScalar);
+		uint32_t isBigEndian = std::endian::native == std::endian::big ? 1 : 0;
+		ECacheType type = ECacheType::TRIANGLE_MESH;
+		OvTools::Filesystem::CookedAssetStamp stamp;
+	};
+
+	template<typename T>
+	void Write(std::ofstream& p_stream, const T& p_value)
+	{
+		p_stream.write(reinterpret_cast<const char*>(&p_value), sizeof(T));
+	}
+
+	template<typename T>
+	void WriteArray(std::ofstream& p_stream, std::span<const T> p_values)
+	{
+		Write(p_stream, static_cast<uint64_t>(p_values.size()));
+		p_stream.write(reinterpret_cast<const char*>(p_values.data()), p_values.size_bytes());
+	}
+
+	template<typename T>
+	bool Read(std::ifstream& p_stream, T& p_value)
+	{
+		return static_cast<bool>(p_stream.read(reinterpret_cast<char*>(&p_value), sizeof(T)));
+	}
+
+	template<typename T>
+	bool ReadArray(std::ifstream& p_stream, std::vector<T>& p_values, uint64_t p_remainingBytes)
+	{
+		uint64_t count = 0;
+		if (!Read(p_stream, count) || count > p_remainingBytes / sizeof(T))
+			return false;
+
+		p_values.resize(count);
+		return static_cast<bool>(p_stream.read(reinterpret_cast<char*>(p_values.data()), count * sizeof(T)));
+	}
+
+	std::optional<std::ifstream> OpenCache(
+		const std::filesystem::path& p_path,
+		ECacheType p_type,
+		const std::filesystem::path& p_sourcePath,
+		uint64_t p_settingsHash,
+		uint64_t& p_fileSize
+	)
+	{
+		std::error_code error;
+		p_fileSize = std::filesystem::file_size(p_path, error);
+
+		if (error)
+			return std::nullopt;
+
+		std::ifstream stream(p_path, std::ios::binary);
+		CacheHeader expected;
+		expected.type = p_type;
+		CacheHeader header;
+
+		if (!stream ||
+			!Read(stream, header) ||
+			header.magic != expected.magic ||
+			header.formatVersion != expected.formatVersion ||
+			header.bulletVersion != expected.bulletVersion ||
+			header.scalarSize != expected.scalarSize ||
+			header.isBigEndian != expected.isBigEndian ||
+			header.type != expected.type ||
+			!OvTools::Filesystem::IsCookedAssetUpToDate(header.stamp, p_sourcePath, p_settingsHash))
+		{
+			return std::nullopt;
+		}
+
+		return stream;
+	}
+
+	std::optional<std::ofstream> CreateCache(const std::filesystem::path& p_path, ECacheType p_type, const OvTools::Filesystem::CookedAssetStamp& p_stamp)
+	{
+		std::ofstream stream(p_path, std::ios::binary | std::ios::trunc);
+
+		if (!stream)
+		{
+			OVLOG_WARNING("CollisionCache: Unable to write \"" + p_path.string() + "\"");
+			return std::nullopt;
+		}
+
+		CacheHeader header;
+		header.type = p_type;
+		header.stamp = p_stamp;
+		Write(stream, header);
+
+		return stream;
+	}
+}
+
+std::vector<OvMaths::FVector3> OvPhysics::Tools::CollisionCache::CookConvexHull(std::span<const OvMaths::FVector3> p_points)
+{
+	if (p_points.empty())
+		return {};
+
+	const btConvexHullShape fullHull(
+		reinterpret_cast<const btScalar*>(p_points.data()),
+		static_cast<int>(p_points.size()),
+		static_cast<int>(sizeof(OvMaths::FVector3))
+	);
+
+	// btShapeHull samples the support function of the hull, which gives a bounded vertex count whatever the input size
+	btShapeHull simplifiedHull(&fullHull);
+	if (!simplifiedHull.buildHull(fullHull.getMargin()))
+		return { p_points.begin(), p_points.end() };
+
+	std::vector<OvMaths::FVector3> result;
+	result.reserve(simplifiedHull.numVertices());
+
+	for (int i = 0; i < simplifiedHull.numVertices(); ++i)
+	{
+		const btVector3& vertex = simplifiedHull.getVertexPointer()[i];
+		result.emplace_back(vertex.x(), vertex.y(), vertex.z());
+	}
+
+	return result;
+}
+
+bool OvPhysics::Tools::CollisionCache::SaveTriangleMesh(const std::filesystem::path& p_path, const OvTools::Filesystem::CookedAssetStamp& p_stamp, const Entities::TriangleMesh& p_mesh)
+{
+	auto stream = CreateCache(p_path, ECacheType::TRIANGLE_MESH, p_stamp);
+
+	if (!stream)
+		return false;
+
+	const std::vector<uint8_t> bvh = p_mesh.SerializeBvh();
+	WriteArray(*stream, std::span(p_mesh.GetVertices()));
+	WriteArray(*stream, std::span(p_mesh.GetIndices()));
+	WriteArray(*stream, std::span(bvh));
+
+	return static_cast<bool>(*stream);
+}
+
+std::unique_ptr<OvPhysics::Entities::TriangleMesh> OvPhysics::Tools::CollisionCache::LoadTriangleMesh(const std::filesystem::path& p_path, const std::filesystem::path& p_sourcePath, uint64_t p_settingsHash)
+{
+	uint64_t fileSize = 0;
+	auto stream = OpenCache(p_path, ECacheType::TRIANGLE_MESH, p_sourcePath, p_settingsHash, fileSize);
+
+	if (!stream)
+		return nullptr;
+
+	std::vector<OvMaths::FVector3> vertices;
+	std::vector<uint32_t> indices;
+	std::vector<uint8_t> bvh;
+
+	if (!ReadArray(*stream, vertices, fileSize) ||
+		!ReadArray(*stream, indices, fileSize) ||
+		!ReadArray(*stream, bvh, fileSize) ||
+		indices.empty() ||
+		indices.size() % 3 != 0)
+	{
+		return nullptr;
+	}
+
+	// A corrupted index would make Bullet read out of the vertices, the mesh is cooked again instead
+	const size_t vertexCount = vertices.size();
+	if (std::any_of(indices.begin(), indices.end(), [vertexCount](uint32_t p_index) { return p_index >= vertexCount; }))
+	{
+		OVLOG_WARNING("CollisionCache: Invalid index in \"" + p_path.string() + "\"");
+		return nullptr;
+	}
+
+	return std::make_unique<Entities::TriangleMesh>(std::move(vertices), std::move(indices), bvh);
+}
+
+bool OvPhysics::Tools::CollisionCache::SaveConvexHull(const std::filesystem::path& p_path, const OvTools::Filesystem::CookedAssetStamp& p_stamp, std::span<const OvMaths::FVector3> p_points)
+{
+	auto stream = CreateCache(p_path, ECacheType::CONVEX_HULL, p_stamp);
+
+	if (!stream)
+		return false;
+
+	WriteArray(*stream, p_points);
+
+	return static_cast<bool>(*stream);
+}
+
+std::optional<std::vector<OvMaths::FVector3>> OvPhysics::Tools::CollisionCache::LoadConvexHull(const std::filesystem::path& p_path, const std::filesystem::path& p_sourcePath, uint64_t p_settingsHash)
+{
+	uint64_t fileSize = 0;
+	auto stream = OpenCache(p_path, ECacheType::CONVEX_HULL, p_sourcePath, p_settingsHash, fileSize);
+
+	if (!stream)
+		return std::nullopt;
+
+	std::vector<OvMaths::FVector3> points;
+
+	if (!ReadArray(*stream, points, fileSize))
+		return std::nullopt;
+
+	return points;
+}
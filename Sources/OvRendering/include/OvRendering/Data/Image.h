@@ -4,6 +4,9 @@
 * @licence: MIT
 */
 
+#pragma once
+
+#include <cstdint>
 #include <filesystem>
 
 namespace OvRendering::Data
@@ -21,6 +21,8 @@ namespace OvRendering::Resources
 		virtual void Unbind() const = 0;
 		virtual uint32_t GetVertexCount() const = 0;
 		virtual uint32_t GetIndexCount() const = 0;
+		virtual baregl::types::EDataType GetIndexType() const = 0;
 		virtual const OvRendering::Geometry::BoundingSphere& GetBoundingSphere() const = 0;
+		virtual float GetUVDensity() const = 0;
 	};
 }
@@ -6,10 +6,13 @@
 
 #pragma once
 
+#include <filesystem>
 #include <string>
+#include <vector>
 
 #include "OvRendering/Resources/Model.h"
 #include "OvRendering/Resources/Parsers/AssimpParser.h"
+#include "OvRendering/Settings/LODSettings.h"
 
 namespace OvRendering::Resources::Loaders
 {
@@ -25,29 +28,97 @@ namespace OvRendering::Resources::Loaders
 		ModelLoader() = delete;
 
 		/**
-		* Create a model
+		* Create a model.
+		* If a cooked path is given, the model is loaded from this cooked file when it is up-to-date,
+		* otherwise the model file is parsed and the cooked file is (re)generated
 		* @param p_filepath
 		* @param p_parserFlags
 		* @param p_generateEmbeddedAssets
+		* @param p_cookedPath
+		* @param p_vertexFormat
+		* @param p_lodSettings
 		*/
 		static Model* Create(
 			const std::string& p_filepath,
 			Parsers::EModelParserFlags p_parserFlags = Parsers::EModelParserFlags::NONE,
-			bool p_generateEmbeddedAssets = true
+			bool p_generateEmbeddedAssets = true,
+			const std::filesystem::path& p_cookedPath = {},
+			Settings::EVertexFormat p_vertexFormat = Settings::EVertexFormat::STANDARD,
+			const Settings::LODSettings& p_lodSettings = {}
 		);
 
+		/**
+		* Create a model without meshes, meant to be filled later with Upload
+		* @param p_filepath
+		*/
+		static Model* CreateEmpty(const std::string& p_filepath);
+
+		/**
+		* Read a model file (or its up-to-date cooked file) without uploading anything to the GPU, so it can be used from any thread.
+		* If a cooked path is given and the cooked file is outdated, it is regenerated.
+		* The levels of detail of the meshes are generated when the model file is parsed, and stored in the cooked file.
+		* Return true on success
+		* @param p_filepath
+		* @param p_data
+		* @param p_parserFlags
+		* @param p_generateEmbeddedAssets
+		* @param p_cookedPath
+		* @param p_lodSettings
+		* @param p_messages (Optional, receives the informative messages instead of logging them, as the logger must only be used from the main thread)
+		*/
+		static bool LoadData(
+			const std::string& p_filepath,
+			Parsers::ModelData& p_data,
+			Parsers::EModelParserFlags p_parserFlags = Parsers::EModelParserFlags::NONE,
+			bool p_generateEmbeddedAssets = true,
+			const std::filesystem::path& p_cookedPath = {},
+			const Settings::LODSettings& p_lodSettings = {},
+			std::vector<std::string>* p_messages = nullptr
+		);
+
+		/**
+		* Replace the content of a model with the given data, uploading its meshes to the GPU (Main thread only)
+		* @param p_model
+		* @param p_data
+		* @param p_vertexFormat
+		*/
+		static void Upload(Model& p_model, Parsers::ModelData&& p_data, Settings::EVertexFormat p_vertexFormat = Settings::EVertexFormat::STANDARD);
+
 		/**
 		* Reload a model from file
 		* @param p_model
 		* @param p_filePath
 		* @param p_parserFlags
 		* @param p_generateEmbeddedAssets
+		* @param p_cookedPath
+		* @param p_vertexFormat
+		* @param p_lodSettings
 		*/
 		static void Reload(
 			Model& p_model,
 			const std::string& p_filePath,
 			Parsers::EModelParserFlags p_parserFlags = Parsers::EModelParserFlags::NONE,
-			bool p_generateEmbeddedAssets = true
+			bool p_generateEmbeddedAssets = true,
+			const std::filesystem::path& p_cookedPath = {},
+			Settings::EVertexFormat p_vertexFormat = Settings::EVertexFormat::STANDARD,
+			const Settings::LODSettings& p_lodSettings = {}
+		);
+
+		/**
+		* Generate the cooked file of a model if it is missing or outdated, without creating the model.
+		* Return true if the cooked file is up-to-date
+		* @param p_filepath
+		* @param p_cookedPath
+		* @param p_parserFlags
+		* @param p_generateEmbeddedAssets
+		* @param p_lodSettings
+		*/
+		static bool Cook(
+			const std::string& p_filepath,
+			const std::filesystem::path& p_cookedPath,
+			Parsers::EModelParserFlags p_parserFlags = Parsers::EModelParserFlags::NONE,
+			bool p_generateEmbeddedAssets = true,
+			const Settings::LODSettings& p_lodSettings = {}
 		);
 
 		/**
@@ -56,6 +127,21 @@ namespace OvRendering::Resources::Loaders
 		*/
 		static bool Destroy(Model*& p_modelInstance);
 
+		/**
+		* Load the triangles of a model file as CPU-side positions and indices (Used to build collision shapes)
+		* Return true on success
+		* @param p_filepath
+		* @param p_positions
+		* @param p_indices
+		* @param p_parserFlags
+		*/
+		static bool LoadCollisionGeometry(
+			const std::string& p_filepath,
+			std::vector<OvMaths::FVector3>& p_positions,
+			std::vector<uint32_t>& p_indices,
+			Parsers::EModelParserFlags p_parserFlags = Parsers::EModelParserFlags::NONE
+		);
+
 	private:
 		static Parsers::AssimpParser __ASSIMP;
 	};
@@ -7,13 +7,33 @@
 #pragma once
 
 #include <cstddef>
+#include <filesystem>
+#include <optional>
 #include <string>
 #include <vector>
 
+#include <OvRendering/Data/Image.h>
+#include <OvRendering/Resources/Parsers/TextureData.h>
 #include <OvRendering/Resources/Texture.h>
+#include <OvRendering/Settings/ETextureCompression.h>
+#include <OvRendering/Utils/TextureCompression.h>
 
 namespace OvRendering::Resources::Loaders
 {
+	/**
+	* Result of a texture encoding done by TextureLoader::LoadData
+	*/
+	struct TextureEncodeReport
+	{
+		Settings::ETextureCompression compression = Settings::ETextureCompression::NONE;
+		uint32_t width = 0;
+		uint32_t height = 0;
+		size_t levelCount = 0;
+		uint64_t size = 0; // In bytes, every level included
+		uint64_t uncompressedSize = 0; // Size of the same levels in RGBA8
+		Utils::TextureCompressionStats stats;
+	};
+
 	/**
 	* Handle the Texture creation and destruction
 	*/
@@ -26,13 +46,16 @@ namespace OvRendering::Resources::Loaders
 		TextureLoader() = delete;
 
 		/**
-		* Create a texture from file
+		* Create a texture from file.
+		* Compressed textures are read from the given cooked file when it is up-to-date, and encoded (then cooked) otherwise
 		* @param p_filePath
 		* @param p_minFilter
 		* @param p_magFilter
 		* @param p_horizontalWrapMode
 		* @param p_verticalWrapMode
 		* @param p_generateMipmap
+		* @param p_compression
+		* @param p_cookedPath (Optional)
 		*/
 		static Texture* Create(
 			const std::string& p_filepath,
@@ -40,7 +63,9 @@ namespace OvRendering::Resources::Loaders
 			baregl::types::ETextureFilteringMode p_magFilter,
 			baregl::types::ETextureWrapMode p_horizontalWrapMode,
 			baregl::types::ETextureWrapMode p_verticalWrapMode,
-			bool p_generateMipmap
+			bool p_generateMipmap,
+			Settings::ETextureCompression p_compression = Settings::ETextureCompression::NONE,
+			const std::filesystem::path& p_cookedPath = {}
 		);
 
 		/**
@@ -94,6 +119,106 @@ namespace OvRendering::Resources::Loaders
 			bool p_generateMipmap
 		);
 
+		/**
+		* Reload a texture from an already decoded image (The image can be decoded on any thread, the upload must happen on the main thread)
+		* @param p_texture
+		* @param p_image
+		* @param p_minFilter
+		* @param p_magFilter
+		* @param p_horizontalWrapMode
+		* @param p_verticalWrapMode
+		* @param p_generateMipmap
+		*/
+		static void ReloadFromImage(
+			Texture& p_texture,
+			const Data::Image& p_image,
+			baregl::types::ETextureFilteringMode p_minFilter,
+			baregl::types::ETextureFilteringMode p_magFilter,
+			baregl::types::ETextureWrapMode p_horizontalWrapMode,
+			baregl::types::ETextureWrapMode p_verticalWrapMode,
+			bool p_generateMipmap
+		);
+
+		/**
+		* Read the GPU-ready data of a compressed texture, without uploading anything (Can be used from any thread).
+		* The data is read from the given cooked file when it is up-to-date, and encoded (then cooked) otherwise
+		* @param p_filepath
+		* @param p_compression (Anything but NONE)
+		* @param p_generateMipmap
+		* @param p_data
+		* @param p_cookedPath (Optional)
+		* @param p_maxLevelSize (Levels larger than this are left out, the smallest level is always kept. 0 keeps every level)
+		* @param p_encodeReport (Optional, receives the encoding result instead of logging it, as the logger must only be used from the main thread. Left empty if the cooked file was up-to-date)
+		*/
+		static bool LoadData(
+			const std::string& p_filepath,
+			Settings::ETextureCompression p_compression,
+			bool p_generateMipmap,
+			Parsers::TextureData& p_data,
+			const std::filesystem::path& p_cookedPath = {},
+			uint32_t p_maxLevelSize = 0,
+			std::optional<TextureEncodeReport>* p_encodeReport = nullptr
+		);
+
+		/**
+		* Log the result of a texture encoding (Main thread only)
+		* @param p_filepath
+		* @param p_report
+		*/
+		static void LogEncodeReport(const std::string& p_filepath, const TextureEncodeReport& p_report);
+
+		/**
+		* Create a texture from GPU-ready data (Previously returned by LoadData)
+		* @param p_filepath
+		* @param p_data
+		* @param p_minFilter
+		* @param p_magFilter
+		* @param p_horizontalWrapMode
+		* @param p_verticalWrapMode
+		*/
+		static Texture* CreateFromData(
+			const std::string& p_filepath,
+			const Parsers::TextureData& p_data,
+			baregl::types::ETextureFilteringMode p_minFilter,
+			baregl::types::ETextureFilteringMode p_magFilter,
+			baregl::types::ETextureWrapMode p_horizontalWrapMode,
+			baregl::types::ETextureWrapMode p_verticalWrapMode
+		);
+
+		/**
+		* Reload a texture from GPU-ready data (Previously returned by LoadData).
+		* Only the given levels end up allocated, so a partial mipmap chain only costs the memory of its levels
+		* @param p_texture
+		* @param p_data
+		* @param p_minFilter
+		* @param p_magFilter
+		* @param p_horizontalWrapMode
+		* @param p_verticalWrapMode
+		*/
+		static void ReloadFromData(
+			Texture& p_texture,
+			const Parsers::TextureData& p_data,
+			baregl::types::ETextureFilteringMode p_minFilter,
+			baregl::types::ETextureFilteringMode p_magFilter,
+			baregl::types::ETextureWrapMode p_horizontalWrapMode,
+			baregl::types::ETextureWrapMode p_verticalWrapMode
+		);
+
+		/**
+		* Generate the cooked file of a compressed texture if it is missing or outdated.
+		* Return false if the texture can't be cooked (Uncompressed textures have nothing to cook)
+		* @param p_filepath
+		* @param p_cookedPath
+		* @param p_compression
+		* @param p_generateMipmap
+		*/
+		static bool Cook(
+			const std::string& p_filepath,
+			const std::filesystem::path& p_cookedPath,
+			Settings::ETextureCompression p_compression,
+			bool p_generateMipmap
+		);
+
 		/**
 		* Reload a texture from file
 		* @param p_texture
@@ -103,6 +228,8 @@ namespace OvRendering::Resources::Loaders
 		* @param p_horizontalWrapMode
 		* @param p_verticalWrapMode
 		* @param p_generateMipmap
+		* @param p_compression
+		* @param p_cookedPath (Optional)
 		*/
 		static void Reload(
 			Texture& p_texture,
@@ -111,7 +238,9 @@ namespace OvRendering::Resources::Loaders
 			baregl::types::ETextureFilteringMode p_magFilter,
 			baregl::types::ETextureWrapMode p_horizontalWrapMode,
 			baregl::types::ETextureWrapMode p_verticalWrapMode,
-			bool p_generateMipmap
+			bool p_generateMipmap,
+			Settings::ETextureCompression p_compression = Settings::ETextureCompression::NONE,
+			const std::filesystem::path& p_cookedPath = {}
 		);
 
 		/**
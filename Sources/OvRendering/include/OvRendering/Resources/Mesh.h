@@ -7,13 +7,16 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <span>
+#include <vector>
 
 #include <baregl/Buffer.h>
 #include <baregl/VertexArray.h>
 #include <OvRendering/Geometry/Vertex.h>
 #include <OvRendering/Geometry/BoundingSphere.h>
 #include <OvRendering/Resources/IMesh.h>
+#include <OvRendering/Settings/EVertexFormat.h>
 
 namespace OvRendering::Resources
 {
@@ -23,16 +26,36 @@ namespace OvRendering::Resources
 	class Mesh : public IMesh
 	{
 	public:
+		/**
+		* Simplified indices of a mesh (Referencing its vertices), drawn instead of the mesh when it is small on screen
+		*/
+		struct LODDescriptor
+		{
+			std::span<const uint32_t> indices;
+			float screenSize = 0.0f; // Largest screen coverage (Bounding sphere diameter over the screen height) the level is used at
+		};
+
+		/**
+		* Relative margin around the LOD screen sizes, so that an object around a threshold doesn't switch every frame
+		*/
+		static constexpr float kLODHysteresis = 0.1f;
+
 		/**
 		* Create a non-skinned mesh with the given vertices, indices and material index
 		* @param p_vertices
 		* @param p_indices
 		* @param p_materialIndex
+		* @param p_boundingSphere (Computed from the vertices if not provided)
+		* @param p_vertexFormat (Layout of the vertices on the GPU)
+		* @param p_lods (From the most to the least detailed)
 		*/
 		Mesh(
 			std::span<const Geometry::Vertex> p_vertices,
 			std::span<const uint32_t> p_indices,
-			uint32_t p_materialIndex = 0
+			uint32_t p_materialIndex = 0,
+			std::optional<Geometry::BoundingSphere> p_boundingSphere = std::nullopt,
+			Settings::EVertexFormat p_vertexFormat = Settings::EVertexFormat::STANDARD,
+			std::span<const LODDescriptor> p_lods = {}
 		);
 
 		/**
@@ -40,11 +63,17 @@ namespace OvRendering::Resources
 		* @param p_vertices
 		* @param p_indices
 		* @param p_materialIndex
+		* @param p_boundingSphere (Computed from the vertices if not provided)
+		* @param p_vertexFormat (Layout of the vertices on the GPU)
+		* @param p_lods (From the most to the least detailed)
 		*/
 		Mesh(
 			std::span<const Geometry::SkinnedVertex> p_vertices,
 			std::span<const uint32_t> p_indices,
-			uint32_t p_materialIndex = 0
+			uint32_t p_materialIndex = 0,
+			std::optional<Geometry::BoundingSphere> p_boundingSphere = std::nullopt,
+			Settings::EVertexFormat p_vertexFormat = Settings::EVertexFormat::STANDARD,
+			std::span<const LODDescriptor> p_lods = {}
 		);
 
 		/**
@@ -67,11 +96,22 @@ namespace OvRendering::Resources
 		*/
 		virtual uint32_t GetIndexCount() const override;
 
+		/**
+		* Returns the type of the indices on the GPU (16-bit when every vertex can be addressed with them)
+		*/
+		virtual baregl::types::EDataType GetIndexType() const override;
+
 		/**
 		* Returns the bounding sphere of the mesh
 		*/
 		virtual const OvRendering::Geometry::BoundingSphere& GetBoundingSphere() const override;
 
+		/**
+		* Returns the average texture coordinates density of the mesh, in UV units per mesh space unit
+		* (Used to estimate the texture resolution needed on screen, 0 if the mesh has no texture coordinates)
+		*/
+		virtual float GetUVDensity() const override;
+
 		/**
 		* Returns the material index of the mesh
 		*/
@@ -82,20 +122,88 @@ namespace OvRendering::Resources
 		*/
 		bool HasSkinningData() const;
 
+		/**
+		* Returns the layout of the vertices of this mesh on the GPU
+		*/
+		Settings::EVertexFormat GetVertexFormat() const;
+
+		/**
+		* Returns the size (In bytes) of the GPU buffers of this mesh, levels of detail included
+		*/
+		uint64_t GetMemoryUsage() const;
+
+		/**
+		* Returns the number of levels of detail of this mesh, the full detail one included
+		*/
+		uint32_t GetLODCount() const;
+
+		/**
+		* Returns the mesh to draw for the given level of detail (0 being this mesh)
+		* @param p_level
+		*/
+		Mesh& GetLOD(uint32_t p_level);
+
+		/**
+		* Returns the largest screen coverage (Bounding sphere diameter over the screen height) the given level is used at
+		* @param p_level
+		*/
+		float GetLODScreenSize(uint32_t p_level) const;
+
+		/**
+		* Returns the level of detail to use for the given screen coverage (Bounding sphere diameter over the screen height).
+		* The current level is only left once the coverage crosses a threshold by more than kLODHysteresis
+		* @param p_screenSize
+		* @param p_currentLevel
+		*/
+		uint32_t SelectLOD(float p_screenSize, uint32_t p_currentLevel) const;
+
+		/**
+		* Returns the level of detail to use for the given screen coverage, given the largest screen coverage of each
+		* level of detail after the full detail one (Decreasing). Used by the SelectLOD method
+		* @param p_lodScreenSizes
+		* @param p_screenSize
+		* @param p_currentLevel
+		*/
+		static uint32_t SelectLOD(std::span<const float> p_lodScreenSizes, float p_screenSize, uint32_t p_currentLevel);
+
+		/**
+		* Compute the bounding sphere of the given vertices
+		* @param p_vertices
+		*/
+		static Geometry::BoundingSphere ComputeBoundingSphere(std::span<const Geometry::Vertex> p_vertices);
+
+		/**
+		* Compute the bounding sphere of the given skinned vertices (In bind pose)
+		* @param p_vertices
+		*/
+		static Geometry::BoundingSphere ComputeBoundingSphere(std::span<const Geometry::SkinnedVertex> p_vertices);
+
 	private:
 		void Upload(std::span<const Geometry::Vertex> p_vertices, std::span<const uint32_t> p_indices);
 		void Upload(std::span<const Geometry::SkinnedVertex> p_vertices, std::span<const uint32_t> p_indices);
+		void UploadPacked(std::span<const Geometry::Vertex> p_vertices, std::span<const uint32_t> p_indices);
+		void UploadPacked(std::span<const Geometry::SkinnedVertex> p_vertices, std::span<const uint32_t> p_indices);
+		void UploadBuffers(std::span<const std::byte> p_vertexData, std::span<const uint32_t> p_indices, baregl::data::VertexAttributeLayout p_layout);
+
+		template<typename TVertex>
+		void CreateLODs(std::span<const TVertex> p_vertices, std::span<const LODDescriptor> p_lods);
 
 	private:
 		const uint32_t m_vertexCount;
 		const uint32_t m_indicesCount;
 		const uint32_t m_materialIndex;
 		const bool m_hasSkinningData;
+		const Settings::EVertexFormat m_vertexFormat;
 
 		baregl::VertexArray m_vertexArray;
 		baregl::Buffer m_vertexBuffer;
 		baregl::Buffer m_indexBuffer;
+		baregl::types::EDataType m_indexType = baregl::types::EDataType::UNSIGNED_INT;
 
 		Geometry::BoundingSphere m_boundingSphere;
+		float m_uvDensity = 0.0f;
+
+		std::vector<std::unique_ptr<Mesh>> m_lods;
+		std::vector<float> m_lodScreenSizes;
 	};
 }
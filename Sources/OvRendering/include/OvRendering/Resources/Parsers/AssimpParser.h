@@ -8,8 +8,10 @@
 
 #include <vector>
 
+#include <OvMaths/FVector3.h>
 #include <OvRendering/Resources/Mesh.h>
 #include <OvRendering/Resources/Parsers/IModelParser.h>
+#include <OvRendering/Resources/Parsers/ModelData.h>
 
 namespace OvRendering::Resources::Parsers
 {
@@ -38,5 +40,38 @@ namespace OvRendering::Resources::Parsers
 			EModelParserFlags p_parserFlags,
 			bool p_generateEmbeddedAssets
 		) override;
+
+		/**
+		* Load the content of a file using assimp without uploading anything to the GPU.
+		* Return true on success
+		* @param p_fileName
+		* @param p_data
+		* @param p_parserFlags
+		* @param p_generateEmbeddedAssets
+		*/
+		bool LoadModelData
+		(
+			const std::string& p_fileName,
+			ModelData& p_data,
+			EModelParserFlags p_parserFlags,
+			bool p_generateEmbeddedAssets
+		);
+
+		/**
+		* Load the triangles of every mesh of a file into a single CPU-side vertex/index soup (Node transforms applied).
+		* Nothing is uploaded to the GPU, the result is meant to build collision shapes
+		* Return true on success
+		* @param p_fileName
+		* @param p_positions
+		* @param p_indices
+		* @param p_parserFlags
+		*/
+		bool LoadCollisionGeometry
+		(
+			const std::string& p_fileName,
+			std::vector<OvMaths::FVector3>& p_positions,
+			std::vector<uint32_t>& p_indices,
+			EModelParserFlags p_parserFlags
+		);
 	};
 }
@@ -0,0 +1,102 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <OvRendering/Resources/Mesh.h>
+#include <OvRendering/Resources/Parsers/ModelData.h>
+#include <OvTools/Filesystem/CookedAssetStamp.h>
+
+namespace OvRendering::Resources::Parsers
+{
+	/**
+	* Identifies the source a cooked model has been generated from
+	*/
+	using CookedModelStamp = OvTools::Filesystem::CookedAssetStamp;
+
+	/**
+	* Reads and writes cooked models (.ovmesh): a versioned binary blob holding the GPU-ready vertex/index buffers,
+	* the mesh bounds and levels of detail, the skeleton, the animations and the embedded assets descriptors of a model.
+	* Cooked models are memory-mapped and uploaded as-is, without going through assimp
+	*/
+	class CookedModelParser
+	{
+	public:
+		CookedModelParser() = delete;
+
+		/**
+		* Returns the stamp of the given source file (Its content is hashed, which reads the whole file)
+		* @param p_sourcePath
+		* @param p_settingsHash
+		*/
+		static CookedModelStamp ComputeStamp(const std::filesystem::path& p_sourcePath, uint64_t p_settingsHash);
+
+		/**
+		* Returns true if the cooked file exists and has been generated from the current source file and settings.
+		* A cooked file without source (Shipped build without raw assets) is considered up-to-date
+		* @param p_cookedPath
+		* @param p_sourcePath
+		* @param p_settingsHash
+		*/
+		static bool IsUpToDate(const std::filesystem::path& p_cookedPath, const std::filesystem::path& p_sourcePath, uint64_t p_settingsHash);
+
+		/**
+		* Write the given model data to a cooked file. Return true on success
+		* @param p_cookedPath
+		* @param p_stamp
+		* @param p_data
+		*/
+		static bool Save(const std::filesystem::path& p_cookedPath, const CookedModelStamp& p_stamp, const ModelData& p_data);
+
+		/**
+		* Read the content of a cooked file without uploading anything to the GPU (Can be used from any thread).
+		* Return false if the file is missing, invalid or outdated (See IsUpToDate)
+		* @param p_cookedPath
+		* @param p_sourcePath
+		* @param p_settingsHash
+		* @param p_data
+		*/
+		static bool LoadModelData(
+			const std::filesystem::path& p_cookedPath,
+			const std::filesystem::path& p_sourcePath,
+			uint64_t p_settingsHash,
+			ModelData& p_data
+		);
+
+		/**
+		* Load a model from a cooked file, uploading its meshes directly from the mapped file.
+		* Return false if the file is missing, invalid or outdated (See IsUpToDate)
+		* @param p_cookedPath
+		* @param p_sourcePath
+		* @param p_settingsHash
+		* @param p_meshes
+		* @param p_materials
+		* @param p_skeleton
+		* @param p_animations
+		* @param p_embeddedMaterials
+		* @param p_embeddedTextures
+		* @param p_vertexFormat
+		*/
+		static bool LoadModel(
+			const std::filesystem::path& p_cookedPath,
+			const std::filesystem::path& p_sourcePath,
+			uint64_t p_settingsHash,
+			std::vector<Mesh*>& p_meshes,
+			std::vector<std::string>& p_materials,
+			std::optional<Animation::Skeleton>& p_skeleton,
+			std::vector<Animation::SkeletalAnimation>& p_animations,
+			std::vector<EmbeddedMaterialData>& p_embeddedMaterials,
+			std::vector<EmbeddedTextureData>& p_embeddedTextures,
+			Settings::EVertexFormat p_vertexFormat = Settings::EVertexFormat::STANDARD
+		);
+	};
+}
@@ -0,0 +1,73 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+
+#include <OvRendering/Resources/Parsers/TextureData.h>
+#include <OvTools/Filesystem/CookedAssetStamp.h>
+
+namespace OvRendering::Resources::Parsers
+{
+	/**
+	* Reads and writes cooked textures (.ovtex). Follows the layout of a KTX2 file: a header identifying the GPU format,
+	* a level index, then every mipmap level already encoded, uploaded as-is without decoding the source image
+	*/
+	class CookedTextureParser
+	{
+	public:
+		CookedTextureParser() = delete;
+
+		/**
+		* Returns true if the cooked file exists and has been generated from the current source file and settings.
+		* A cooked file without source (Shipped build without raw assets) is considered up-to-date
+		* @param p_cookedPath
+		* @param p_sourcePath
+		* @param p_settingsHash
+		*/
+		static bool IsUpToDate(const std::filesystem::path& p_cookedPath, const std::filesystem::path& p_sourcePath, uint64_t p_settingsHash);
+
+		/**
+		* Write the given texture data to a cooked file (Its complete mipmap chain is expected). Return true on success
+		* @param p_cookedPath
+		* @param p_stamp
+		* @param p_data
+		*/
+		static bool Save(const std::filesystem::path& p_cookedPath, const OvTools::Filesystem::CookedAssetStamp& p_stamp, const TextureData& p_data);
+
+		/**
+		* Read the content of a cooked file (Can be used from any thread).
+		* Return false if the file is missing, invalid or outdated (See IsUpToDate)
+		* @param p_cookedPath
+		* @param p_sourcePath
+		* @param p_settingsHash
+		* @param p_data
+		* @param p_maxLevelSize (Levels larger than this are left out, the smallest level is always read. 0 reads every level)
+		*/
+		static bool LoadTextureData(
+			const std::filesystem::path& p_cookedPath,
+			const std::filesystem::path& p_sourcePath,
+			uint64_t p_settingsHash,
+			TextureData& p_data,
+			uint32_t p_maxLevelSize = 0
+		);
+
+		/**
+		* Read the levels of a cooked file from the given one down to the smallest one (Can be used from any thread).
+		* The source isn't checked, this is meant to stream the levels of a texture already loaded with LoadTextureData
+		* @param p_cookedPath
+		* @param p_firstLevel (Clamped to the smallest level)
+		* @param p_data
+		*/
+		static bool LoadTextureLevels(
+			const std::filesystem::path& p_cookedPath,
+			uint32_t p_firstLevel,
+			TextureData& p_data
+		);
+	};
+}
@@ -0,0 +1,60 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <OvRendering/Animation/SkeletalData.h>
+#include <OvRendering/Geometry/BoundingSphere.h>
+#include <OvRendering/Geometry/Vertex.h>
+#include <OvRendering/Resources/EmbeddedAssets.h>
+
+namespace OvRendering::Resources::Parsers
+{
+	/**
+	* Simplified version of a mesh, drawn instead of the mesh when it is small on screen
+	*/
+	struct MeshLODData
+	{
+		std::vector<uint32_t> indices; // Reference the vertices of the full detail mesh
+		float screenSize = 0.0f; // Largest screen coverage (Bounding sphere diameter over the screen height) the level is used at
+	};
+
+	/**
+	* CPU-side geometry of a mesh, before its upload to the GPU
+	*/
+	struct MeshData
+	{
+		std::vector<Geometry::Vertex> vertices;
+		std::vector<Geometry::SkinnedVertex> skinnedVertices; // Used instead of "vertices" by skinned meshes
+		std::vector<uint32_t> indices;
+		uint32_t materialIndex = 0;
+		std::optional<Geometry::BoundingSphere> boundingSphere; // Computed from the vertices if not provided
+		std::vector<MeshLODData> lods; // From the most to the least detailed, the full detail mesh excluded
+
+		bool IsSkinned() const
+		{
+			return !skinnedVertices.empty();
+		}
+	};
+
+	/**
+	* CPU-side content of a model, as extracted by a model parser
+	*/
+	struct ModelData
+	{
+		std::vector<MeshData> meshes;
+		std::vector<std::string> materialNames;
+		std::optional<Animation::Skeleton> skeleton;
+		std::vector<Animation::SkeletalAnimation> animations;
+		std::vector<EmbeddedMaterialData> embeddedMaterials;
+		std::vector<EmbeddedTextureData> embeddedTextures;
+	};
+}
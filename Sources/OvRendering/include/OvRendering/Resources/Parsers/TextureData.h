@@ -0,0 +1,40 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <OvRendering/Settings/ETextureCompression.h>
+
+namespace OvRendering::Resources::Parsers
+{
+	/**
+	* Location of a mipmap level in TextureData::data
+	*/
+	struct TextureLevel
+	{
+		uint32_t width = 0;
+		uint32_t height = 0;
+		uint64_t offset = 0;
+		uint64_t size = 0;
+	};
+
+	/**
+	* CPU-side, GPU-ready texture: every mipmap level, already in its final format.
+	* Can be produced on any thread, only the upload has to happen on the main thread
+	*/
+	struct TextureData
+	{
+		Settings::ETextureCompression compression = Settings::ETextureCompression::NONE;
+		uint32_t width = 0; // Of the complete mipmap chain first level
+		uint32_t height = 0;
+		uint32_t firstLevel = 0; // Index of levels[0] in the complete mipmap chain (Non-zero when the largest levels are left out)
+		std::vector<TextureLevel> levels; // Largest first
+		std::vector<uint8_t> data;
+	};
+}
@@ -30,6 +30,11 @@ namespace OvRendering::Resources
 		*/
 		baregl::Texture& GetTexture();
 
+		/**
+		* Returns the associated texture instance
+		*/
+		const baregl::Texture& GetTexture() const;
+
 	private:
 		Texture(const std::string p_path, std::unique_ptr<baregl::Texture>&& p_texture);
 		~Texture() = default;
@@ -0,0 +1,26 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+
+namespace OvRendering::Settings
+{
+	/**
+	* GPU format a texture is cooked to. Anything but NONE is encoded offline, with its mipmaps, into a cooked texture (.ovtex)
+	*/
+	enum class ETextureCompression : uint8_t
+	{
+		NONE,		// Uploaded as decoded (RGBA8 or RGBA32F), mipmaps generated on the GPU
+		BC1,		// Opaque color, 4 bits per pixel
+		BC3,		// Color with alpha, 8 bits per pixel
+		BC4,		// Single channel mask (red), 4 bits per pixel
+		BC5,		// Normal map (red and green, blue is reconstructed in the shader), 8 bits per pixel
+		BC7,		// High quality color with alpha, 8 bits per pixel
+		RGBA16F		// HDR, 64 bits per pixel
+	};
+}
@@ -0,0 +1,23 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+
+namespace OvRendering::Settings
+{
+	/**
+	* Layout of the vertices of a mesh once uploaded to the GPU. Packed formats trade precision for bandwidth and memory,
+	* they are decoded by the vertex fetch, except the bitangent that is rebuilt in the shader from the normal and the tangent
+	*/
+	enum class EVertexFormat : uint8_t
+	{
+		STANDARD,		// 32-bit floats everywhere, 56 bytes per vertex (88 when skinned)
+		PACKED,			// Half-float UVs, 10:10:10:2 normals and tangents, 8-bit bone indices, UNORM16 bone weights, 24 bytes per vertex (36 when skinned)
+		PACKED_COMPACT	// Same as PACKED, with UNORM8 bone weights, 24 bytes per vertex (32 when skinned)
+	};
+}
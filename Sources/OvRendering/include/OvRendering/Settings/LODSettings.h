@@ -0,0 +1,23 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+
+namespace OvRendering::Settings
+{
+	/**
+	* Describes the level of detail chain generated for the meshes of a model when it is imported
+	*/
+	struct LODSettings
+	{
+		static constexpr uint32_t kMaxLevelCount = 4;
+
+		uint32_t levelCount = 0; // Levels generated in addition to the full detail one (0 disables the generation)
+		float reduction = 0.5f; // Ratio of triangles each level keeps from the previous one
+	};
+}
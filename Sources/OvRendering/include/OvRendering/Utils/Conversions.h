@@ -24,4 +24,20 @@ namespace OvRendering::Utils::Conversions
     {
         return static_cast<uint8_t>(_log2(p_value) - 1);
     }
+
+    /**
+    * Convert a float to a half-float (IEEE 754 binary16), clamped to the largest finite half. NaN is converted to 0
+    * @param p_value
+    */
+    uint16_t FloatToHalf(float p_value);
+
+    /**
+    * Pack 4 floats in [-1, 1] into a signed normalized 10:10:10:2 integer (x in the lowest bits), as read by the
+    * GL_INT_2_10_10_10_REV vertex attribute type
+    * @param p_x
+    * @param p_y
+    * @param p_z
+    * @param p_w (Only -1, 0 and 1 are representable)
+    */
+    uint32_t PackSnorm1010102(float p_x, float p_y, float p_z, float p_w);
 }
@@ -0,0 +1,87 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <OvMaths/FVector3.h>
+
+namespace OvRendering::Utils
+{
+	/**
+	* Number of entries of the post-transform vertex cache the optimizations and statistics assume
+	*/
+	constexpr uint32_t kVertexCacheSize = 16;
+
+	/**
+	* Post-transform vertex cache efficiency of an index buffer
+	*/
+	struct VertexCacheStats
+	{
+		float acmr = 0.0f; // Average cache miss ratio: transformed vertices per triangle (0.5 at best, 3 at worst)
+		float atvr = 0.0f; // Average transformed vertex ratio: transformed vertices per referenced vertex (1 at best)
+	};
+
+	/**
+	* Simulate a FIFO post-transform vertex cache over the given triangle list
+	* @param p_indices
+	* @param p_vertexCount
+	* @param p_cacheSize
+	*/
+	VertexCacheStats AnalyzeVertexCache(std::span<const uint32_t> p_indices, size_t p_vertexCount, uint32_t p_cacheSize = kVertexCacheSize);
+
+	/**
+	* Reorder the given triangle list for the post-transform vertex cache (Tipsify), then reorder its triangle clusters
+	* so that the ones facing outward, which are likely to occlude the others, are drawn first. Can be called from any thread
+	* @param p_indices
+	* @param p_positions
+	*/
+	void OptimizeTriangleOrder(std::span<uint32_t> p_indices, std::span<const OvMaths::FVector3> p_positions);
+
+	/**
+	* Rewrite the given triangle list so that its vertices are numbered in the order they are first referenced,
+	* which makes the vertex fetches sequential. Unreferenced vertices are dropped.
+	* Returns the new index of each vertex (UINT32_MAX if dropped), to be applied to the vertex buffer with RemapVertices
+	* @param p_indices
+	* @param p_vertexCount
+	*/
+	std::vector<uint32_t> OptimizeVertexFetch(std::span<uint32_t> p_indices, size_t p_vertexCount);
+
+	/**
+	* Reorder the given vertices following a remap table returned by OptimizeVertexFetch
+	* @param p_vertices
+	* @param p_remap
+	*/
+	template<typename TVertex>
+	void RemapVertices(std::vector<TVertex>& p_vertices, std::span<const uint32_t> p_remap)
+	{
+		size_t vertexCount = 0;
+
+		for (const uint32_t index : p_remap)
+		{
+			if (index != UINT32_MAX)
+			{
+				++vertexCount;
+			}
+		}
+
+		std::vector<TVertex> remapped(vertexCount);
+
+		for (size_t i = 0; i < p_vertices.size() && i < p_remap.size(); ++i)
+		{
+			if (p_remap[i] != UINT32_MAX)
+			{
+				remapped[p_remap[i]] = p_vertices[i];
+			}
+		}
+
+		p_vertices = std::move(remapped);
+	}
+}
@@ -0,0 +1,43 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include <OvMaths/FVector3.h>
+
+namespace OvRendering::Utils
+{
+	/**
+	* Result of a mesh simplification
+	*/
+	struct MeshSimplificationResult
+	{
+		std::vector<uint32_t> indices; // Triangles of the simplified mesh, referencing the source vertices
+		float error = 0.0f; // Largest geometric error introduced, relative to the mesh extent
+	};
+
+	/**
+	* Simplify a triangle list by collapsing its edges in the order of their quadric error, until the given index count
+	* or the given error is reached. Vertices are never moved nor created, so the result can reuse the source vertex
+	* buffer. Vertices sharing a position but not their other attributes (UV seams, hard edges) and mesh borders are
+	* kept, collapses flipping triangles are rejected. Can be called from any thread
+	* @param p_positions
+	* @param p_indices
+	* @param p_targetIndexCount
+	* @param p_maxError (Relative to the mesh extent)
+	*/
+	MeshSimplificationResult SimplifyMesh(
+		std::span<const OvMaths::FVector3> p_positions,
+		std::span<const uint32_t> p_indices,
+		size_t p_targetIndexCount,
+		float p_maxError = std::numeric_limits<float>::max()
+	);
+}
@@ -23,6 +23,19 @@ namespace OvRendering::Utils::ResourceTracking
 		const baregl::Texture* texture;
 	};
 
+	/**
+	* Memory usage of the streamed textures (Compressed textures whose larger mipmap levels are loaded on demand)
+	*/
+	struct TextureStreamingStats
+	{
+		uint64_t budget = 0; // In bytes
+		uint64_t residentSize = 0; // In bytes, mipmap levels currently allocated
+		uint64_t requestedSize = 0; // In bytes, mipmap levels needed by what has been rendered
+		uint32_t streamedTextureCount = 0;
+		uint32_t pendingLoadCount = 0;
+		uint64_t evictionCount = 0; // Textures brought back to their smallest levels to fit the budget, since startup
+	};
+
 	extern OvTools::Eventing::Event<const TextureRegistryEntryDesc&> TextureAddedEvent;
 	extern OvTools::Eventing::Event<const TextureRegistryEntryDesc&> TextureRemovedEvent;
 
@@ -41,5 +54,15 @@ namespace OvRendering::Utils::ResourceTracking
 	* Returns all the texture ids
 	*/
 	std::span<const uint32_t> GetTextureIDs();
-}
 
+	/**
+	* Update the texture streaming stats (Reported by the texture streamer)
+	* @param p_stats
+	*/
+	void SetTextureStreamingStats(const TextureStreamingStats& p_stats);
+
+	/**
+	* Returns the latest texture streaming stats
+	*/
+	const TextureStreamingStats& GetTextureStreamingStats();
+}
\ No newline at end of file
@@ -0,0 +1,52 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+
+#include <OvRendering/Data/Image.h>
+#include <OvRendering/Resources/Parsers/TextureData.h>
+#include <OvRendering/Settings/ETextureCompression.h>
+
+namespace OvRendering::Utils
+{
+	/**
+	* Cost and quality of a texture encoding
+	*/
+	struct TextureCompressionStats
+	{
+		double encodingTime = 0.0; // In seconds, mipmaps generation included
+		double megapixelsPerSecond = 0.0;
+		std::optional<double> psnr; // First level against the source, in dB (Not measured for RGBA16F)
+	};
+
+	/**
+	* Returns the size in bytes of a mipmap level of the given format
+	* @param p_compression
+	* @param p_width
+	* @param p_height
+	*/
+	uint64_t GetTextureLevelSize(Settings::ETextureCompression p_compression, uint32_t p_width, uint32_t p_height);
+
+	/**
+	* Encode the given image to the given format on the CPU, generating its mipmap chain down to 1x1 if requested.
+	* HDR images are always encoded to RGBA16F. Can be called from any thread
+	* @param p_image
+	* @param p_compression (Anything but NONE)
+	* @param p_generateMipmaps
+	* @param p_data
+	* @param p_stats
+	*/
+	bool CompressTexture(
+		const Data::Image& p_image,
+		Settings::ETextureCompression p_compression,
+		bool p_generateMipmaps,
+		Resources::Parsers::TextureData& p_data,
+		TextureCompressionStats* p_stats = nullptr
+	);
+}
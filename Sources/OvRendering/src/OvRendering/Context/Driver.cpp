@@ -191,11 +191,11 @@ void OvRendering::Context::Driver::Draw(
 		{
 			if (p_instances == 1)
 			{
-				m_gfxContext->DrawElements(p_primitiveMode, p_mesh.GetIndexCount());
+				m_gfxContext->DrawElements(p_primitiveMode, p_mesh.GetIndexCount(), p_mesh.GetIndexType());
 			}
 			else
 			{
-				m_gfxContext->DrawElementsInstanced(p_primitiveMode, p_mesh.GetIndexCount(), p_instances);
+				m_gfxContext->DrawElementsInstanced(p_primitiveMode, p_mesh.GetIndexCount(), p_instances, p_mesh.GetIndexType());
 			}
 		}
 		else
@@ -12,7 +12,8 @@
 
 OvRendering::Data::Image::Image(const std::filesystem::path& p_filepath, const bool p_flipVertically)
 {
-	stbi_set_flip_vertically_on_load(p_flipVertically ? 1 : 0);
+	// Per-thread setting, images can be decoded from worker threads
+	stbi_set_flip_vertically_on_load_thread(p_flipVertically ? 1 : 0);
 
 	isHDR = stbi_is_hdr(p_filepath.string().c_str());
 
@@ -29,7 +30,8 @@ OvRendering::Data::Image::Image(const uint8_t* p_data, const size_t p_size, cons
 	}
 
 	const int encodedSize = static_cast<int>(p_size);
-	stbi_set_flip_vertically_on_load(p_flipVertically ? 1 : 0);
+	// Per-thread setting, images can be decoded from worker threads
+	stbi_set_flip_vertically_on_load_thread(p_flipVertically ? 1 : 0);
 	isHDR = stbi_is_hdr_from_memory(p_data, encodedSize) != 0;
 
 	data = isHDR ?
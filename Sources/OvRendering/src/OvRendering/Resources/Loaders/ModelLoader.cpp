@@ -4,62 +4,351 @@
 * @licence: MIT
 */
 
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <format>
 #include <utility>
 
+#include <OvDebug/Logger.h>
+
 #include "OvRendering/Resources/Loaders/ModelLoader.h"
+#include "OvRendering/Resources/Parsers/CookedModelParser.h"
+#include "OvRendering/Utils/MeshOptimization.h"
+#include "OvRendering/Utils/MeshSimplification.h"
+
+#include <OvTools/Utils/ParallelFor.h>
+
+namespace
+{
+	// Screen coverage under which the full detail mesh isn't needed anymore, the levels below follow their triangle count
+	constexpr float kFullDetailScreenSize = 0.5f;
+
+	// A level removing less triangles than this from the previous one isn't worth its memory
+	constexpr float kMinLODReduction = 0.9f;
+
+	// Bumped whenever the mesh optimizations change, so that the cooked models are regenerated
+	constexpr uint64_t kMeshOptimizerVersion = 1;
+
+	uint64_t GetSettingsHash(
+		OvRendering::Resources::Parsers::EModelParserFlags p_parserFlags,
+		bool p_generateEmbeddedAssets,
+		const OvRendering::Settings::LODSettings& p_lodSettings
+	)
+	{
+		uint64_t hash = 14695981039346656037ull;
+		hash = (hash ^ static_cast<uint64_t>(p_parserFlags)) * 1099511628211ull;
+		hash = (hash ^ static_cast<uint64_t>(p_generateEmbeddedAssets)) * 1099511628211ull;
+		hash = (hash ^ static_cast<uint64_t>(p_lodSettings.levelCount)) * 1099511628211ull;
+		hash = (hash ^ static_cast<uint64_t>(std::bit_cast<uint32_t>(p_lodSettings.reduction))) * 1099511628211ull;
+		hash = (hash ^ kMeshOptimizerVersion) * 1099511628211ull;
+		return hash;
+	}
+
+	template<typename TVertex>
+	std::vector<OvMaths::FVector3> GetPositions(const std::vector<TVertex>& p_vertices)
+	{
+		std::vector<OvMaths::FVector3> positions;
+		positions.reserve(p_vertices.size());
+
+		for (const auto& vertex : p_vertices)
+		{
+			positions.emplace_back(vertex.position[0], vertex.position[1], vertex.position[2]);
+		}
+
+		return positions;
+	}
+
+	/**
+	* Vertex cache efficiency of a mesh before and after its optimization
+	*/
+	struct MeshOptimizationReport
+	{
+		OvRendering::Utils::VertexCacheStats before;
+		OvRendering::Utils::VertexCacheStats after;
+	};
+
+	/**
+	* Reorder the triangles and vertices of the given mesh for the post-transform vertex cache, overdraw and vertex fetch
+	*/
+	template<typename TVertex>
+	MeshOptimizationReport OptimizeMesh(std::vector<TVertex>& p_vertices, std::vector<uint32_t>& p_indices)
+	{
+		MeshOptimizationReport report;
+		report.before = OvRendering::Utils::AnalyzeVertexCache(p_indices, p_vertices.size());
+
+		OvRendering::Utils::OptimizeTriangleOrder(p_indices, GetPositions(p_vertices));
+		OvRendering::Utils::RemapVertices(p_vertices, OvRendering::Utils::OptimizeVertexFetch(p_indices, p_vertices.size()));
+
+		report.after = OvRendering::Utils::AnalyzeVertexCache(p_indices, p_vertices.size());
+		return report;
+	}
+
+	void GenerateLODs(OvRendering::Resources::Parsers::MeshData& p_mesh, const OvRendering::Settings::LODSettings& p_settings, bool p_optimize)
+	{
+		p_mesh.lods.clear();
+
+		const uint32_t levelCount = std::min(p_settings.levelCount, OvRendering::Settings::LODSettings::kMaxLevelCount);
+		const float reduction = std::clamp(p_settings.reduction, 0.01f, 0.99f);
+		const auto positions = p_mesh.IsSkinned() ? GetPositions(p_mesh.skinnedVertices) : GetPositions(p_mesh.vertices);
+
+		size_t previousIndexCount = p_mesh.indices.size();
+		float ratio = 1.0f;
+
+		for (uint32_t level = 0; level < levelCount; ++level)
+		{
+			ratio *= reduction;
+
+			// Every level is simplified from the full detail mesh, so the errors don't accumulate along the chain
+			const size_t targetIndexCount = static_cast<size_t>(static_cast<float>(p_mesh.indices.size()) * ratio) / 3 * 3;
+			auto result = OvRendering::Utils::SimplifyMesh(positions, p_mesh.indices, targetIndexCount);
+
+			if (result.indices.empty() || static_cast<float>(result.indices.size()) > static_cast<float>(previousIndexCount) * kMinLODReduction)
+			{
+				break;
+			}
+
+			previousIndexCount = result.indices.size();
+
+			// The triangle density on screen stays the same from a level to the next
+			const float achievedRatio = static_cast<float>(result.indices.size()) / static_cast<float>(p_mesh.indices.size());
+
+			// The vertex fetch order is decided when the level vertices are compacted at upload time
+			if (p_optimize)
+			{
+				OvRendering::Utils::OptimizeTriangleOrder(result.indices, positions);
+			}
+
+			p_mesh.lods.push_back({
+				.indices = std::move(result.indices),
+				.screenSize = kFullDetailScreenSize * std::sqrt(achievedRatio)
+			});
+		}
+	}
+}
 
 OvRendering::Resources::Parsers::AssimpParser OvRendering::Resources::Loaders::ModelLoader::__ASSIMP;
 
 OvRendering::Resources::Model* OvRendering::Resources::Loaders::ModelLoader::Create(
 	const std::string& p_filepath,
 	Parsers::EModelParserFlags p_parserFlags,
-	bool p_generateEmbeddedAssets
+	bool p_generateEmbeddedAssets,
+	const std::filesystem::path& p_cookedPath,
+	Settings::EVertexFormat p_vertexFormat,
+	const Settings::LODSettings& p_lodSettings
 )
 {
 	Model* result = new Model(p_filepath);
 
-	if (__ASSIMP.LoadModel(
+	// The parser uploads the standard vertex format without LODs nor mesh optimizations only, other setups go through Upload
+	if (
+		p_cookedPath.empty() &&
+		p_vertexFormat == Settings::EVertexFormat::STANDARD &&
+		p_lodSettings.levelCount == 0 &&
+		!static_cast<bool>(p_parserFlags & Parsers::EModelParserFlags::IMPROVE_CACHE_LOCALITY)
+	)
+	{
+		if (__ASSIMP.LoadModel(
+			p_filepath,
+			result->m_meshes,
+			result->m_materialNames,
+			result->m_skeleton,
+			result->m_animations,
+			result->m_embeddedMaterials,
+			result->m_embeddedTextures,
+			p_parserFlags,
+			p_generateEmbeddedAssets
+		))
+		{
+			result->ComputeBoundingSphere();
+			return result;
+		}
+	}
+	else if (Parsers::CookedModelParser::LoadModel(
+		p_cookedPath,
 		p_filepath,
+		GetSettingsHash(p_parserFlags, p_generateEmbeddedAssets, p_lodSettings),
 		result->m_meshes,
 		result->m_materialNames,
 		result->m_skeleton,
 		result->m_animations,
 		result->m_embeddedMaterials,
 		result->m_embeddedTextures,
-		p_parserFlags,
-		p_generateEmbeddedAssets
+		p_vertexFormat
 	))
 	{
 		result->ComputeBoundingSphere();
 		return result;
 	}
+	else if (Parsers::ModelData data; LoadData(p_filepath, data, p_parserFlags, p_generateEmbeddedAssets, p_cookedPath, p_lodSettings))
+	{
+		Upload(*result, std::move(data), p_vertexFormat);
+		return result;
+	}
 
 	delete result;
 
 	return nullptr;
 }
 
+OvRendering::Resources::Model* OvRendering::Resources::Loaders::ModelLoader::CreateEmpty(const std::string& p_filepath)
+{
+	Model* result = new Model(p_filepath);
+	result->ComputeBoundingSphere();
+	return result;
+}
+
+bool OvRendering::Resources::Loaders::ModelLoader::LoadData(
+	const std::string& p_filepath,
+	Parsers::ModelData& p_data,
+	Parsers::EModelParserFlags p_parserFlags,
+	bool p_generateEmbeddedAssets,
+	const std::filesystem::path& p_cookedPath,
+	const Settings::LODSettings& p_lodSettings,
+	std::vector<std::string>* p_messages
+)
+{
+	const uint64_t settingsHash = GetSettingsHash(p_parserFlags, p_generateEmbeddedAssets, p_lodSettings);
+
+	if (!p_cookedPath.empty() && Parsers::CookedModelParser::LoadModelData(p_cookedPath, p_filepath, settingsHash, p_data))
+	{
+		return true;
+	}
+
+	// The mesh optimizations supersede the cache locality improvement of Assimp, which would be wasted work
+	const bool optimizeMeshes = static_cast<bool>(p_parserFlags & Parsers::EModelParserFlags::IMPROVE_CACHE_LOCALITY);
+
+	if (!__ASSIMP.LoadModelData(p_filepath, p_data, p_parserFlags & ~Parsers::EModelParserFlags::IMPROVE_CACHE_LOCALITY, p_generateEmbeddedAssets))
+	{
+		return false;
+	}
+
+	std::vector<MeshOptimizationReport> optimizationReports(p_data.meshes.size());
+
+	// Meshes are independent from each other, and their processing (mostly the LOD generation) dominates the import time
+	OvTools::Utils::ParallelFor(p_data.meshes.size(), [&](size_t p_meshIndex)
+	{
+		auto& mesh = p_data.meshes[p_meshIndex];
+
+		if (optimizeMeshes)
+		{
+			optimizationReports[p_meshIndex] = mesh.IsSkinned() ?
+				OptimizeMesh(mesh.skinnedVertices, mesh.indices) :
+				OptimizeMesh(mesh.vertices, mesh.indices);
+		}
+
+		mesh.boundingSphere = mesh.IsSkinned() ?
+			Mesh::ComputeBoundingSphere(mesh.skinnedVertices) :
+			Mesh::ComputeBoundingSphere(mesh.vertices);
+
+		if (p_lodSettings.levelCount > 0)
+		{
+			GenerateLODs(mesh, p_lodSettings, optimizeMeshes);
+		}
+	});
+
+	// Reported afterward, as the logger isn't thread-safe (And only the caller knows if it runs on the main thread)
+	for (size_t meshIndex = 0; optimizeMeshes && meshIndex < optimizationReports.size(); ++meshIndex)
+	{
+		const auto& [before, after] = optimizationReports[meshIndex];
+
+		auto message = std::format(
+			"ModelLoader: \"{}\" mesh {} optimized (ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f})",
+			p_filepath, meshIndex, before.acmr, after.acmr, before.atvr, after.atvr
+		);
+
+		if (p_messages)
+		{
+			p_messages->push_back(std::move(message));
+		}
+		else
+		{
+			OVLOG_INFO(message);
+		}
+	}
+
+	if (!p_cookedPath.empty())
+	{
+		Parsers::CookedModelParser::Save(p_cookedPath, Parsers::CookedModelParser::ComputeStamp(p_filepath, settingsHash), p_data);
+	}
+
+	return true;
+}
+
+void OvRendering::Resources::Loaders::ModelLoader::Upload(Model& p_model, Parsers::ModelData&& p_data, Settings::EVertexFormat p_vertexFormat)
+{
+	for (auto mesh : p_model.m_meshes)
+		delete mesh;
+
+	p_model.m_meshes.clear();
+	p_model.m_meshes.reserve(p_data.meshes.size());
+
+	std::vector<Mesh::LODDescriptor> lods;
+
+	for (const auto& mesh : p_data.meshes)
+	{
+		lods.clear();
+
+		for (const auto& lod : mesh.lods)
+		{
+			lods.push_back({ lod.indices, lod.screenSize });
+		}
+
+		// The model will handle mesh destruction
+		p_model.m_meshes.push_back(mesh.IsSkinned() ?
+			new Mesh(std::span(mesh.skinnedVertices), std::span(mesh.indices), mesh.materialIndex, mesh.boundingSphere, p_vertexFormat, lods) :
+			new Mesh(std::span(mesh.vertices), std::span(mesh.indices), mesh.materialIndex, mesh.boundingSphere, p_vertexFormat, lods)
+		);
+	}
+
+	p_model.m_materialNames = std::move(p_data.materialNames);
+	p_model.m_skeleton = std::move(p_data.skeleton);
+	p_model.m_animations = std::move(p_data.animations);
+	p_model.m_embeddedMaterials = std::move(p_data.embeddedMaterials);
+	p_model.m_embeddedTextures = std::move(p_data.embeddedTextures);
+	p_model.ComputeBoundingSphere();
+}
+
 void OvRendering::Resources::Loaders::ModelLoader::Reload(
 	Model& p_model,
 	const std::string& p_filePath,
 	Parsers::EModelParserFlags p_parserFlags,
-	bool p_generateEmbeddedAssets
+	bool p_generateEmbeddedAssets,
+	const std::filesystem::path& p_cookedPath,
+	Settings::EVertexFormat p_vertexFormat,
+	const Settings::LODSettings& p_lodSettings
 )
 {
-	Model* newModel = Create(p_filePath, p_parserFlags, p_generateEmbeddedAssets);
+	if (Parsers::ModelData data; LoadData(p_filePath, data, p_parserFlags, p_generateEmbeddedAssets, p_cookedPath, p_lodSettings))
+	{
+		Upload(p_model, std::move(data), p_vertexFormat);
+	}
+}
 
-	if (newModel)
+bool OvRendering::Resources::Loaders::ModelLoader::Cook(
+	const std::string& p_filepath,
+	const std::filesystem::path& p_cookedPath,
+	Parsers::EModelParserFlags p_parserFlags,
+	bool p_generateEmbeddedAssets,
+	const Settings::LODSettings& p_lodSettings
+)
+{
+	const uint64_t settingsHash = GetSettingsHash(p_parserFlags, p_generateEmbeddedAssets, p_lodSettings);
+
+	if (Parsers::CookedModelParser::IsUpToDate(p_cookedPath, p_filepath, settingsHash))
+	{
+		return true;
+	}
+
+	Parsers::ModelData data;
+
+	if (!LoadData(p_filepath, data, p_parserFlags, p_generateEmbeddedAssets, p_cookedPath, p_lodSettings))
 	{
-		p_model.m_meshes = newModel->m_meshes;
-		p_model.m_materialNames = newModel->m_materialNames;
-		p_model.m_embeddedMaterials = std::move(newModel->m_embeddedMaterials);
-		p_model.m_embeddedTextures = std::move(newModel->m_embeddedTextures);
-		p_model.m_skeleton = std::move(newModel->m_skeleton);
-		p_model.m_animations = std::move(newModel->m_animations);
-		p_model.m_boundingSphere = newModel->m_boundingSphere;
-		newModel->m_meshes.clear();
-		delete newModel;
+		OVLOG_WARNING("ModelLoader: Unable to cook \"" + p_filepath + "\"");
+		return false;
 	}
+
+	return Parsers::CookedModelParser::IsUpToDate(p_cookedPath, p_filepath, settingsHash);
 }
 
 bool OvRendering::Resources::Loaders::ModelLoader::Destroy(Model*& p_modelInstance)
@@ -74,3 +363,13 @@ bool OvRendering::Resources::Loaders::ModelLoader::Destroy(Model*& p_modelInstan
 
 	return false;
 }
+
+bool OvRendering::Resources::Loaders::ModelLoader::LoadCollisionGeometry(
+	const std::string& p_filepath,
+	std::vector<OvMaths::FVector3>& p_positions,
+	std::vector<uint32_t>& p_indices,
+	Parsers::EModelParserFlags p_parserFlags
+)
+{
+	return __ASSIMP.LoadCollisionGeometry(p_filepath, p_positions, p_indices, p_parserFlags);
+}
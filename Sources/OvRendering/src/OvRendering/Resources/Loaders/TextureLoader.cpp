@@ -4,12 +4,16 @@
 * @licence: MIT
 */
 
+#include <algorithm>
 #include <array>
+#include <format>
 #include <memory>
 
 #include <OvDebug/Logger.h>
 #include <OvRendering/Data/Image.h>
 #include <OvRendering/Resources/Loaders/TextureLoader.h>
+#include <OvRendering/Resources/Parsers/CookedTextureParser.h>
+#include <OvRendering/Utils/TextureCompression.h>
 #include <OvTools/Utils/PathParser.h>
 
 namespace
@@ -47,6 +51,117 @@ namespace
 			p_texture.GenerateMipmaps();
 		}
 	}
+
+	baregl::types::EInternalFormat GetInternalFormat(OvRendering::Settings::ETextureCompression p_compression)
+	{
+		using namespace OvRendering::Settings;
+		using namespace baregl::types;
+
+		switch (p_compression)
+		{
+		case ETextureCompression::BC1: return EInternalFormat::COMPRESSED_RGB_S3TC_DXT1;
+		case ETextureCompression::BC3: return EInternalFormat::COMPRESSED_RGBA_S3TC_DXT5;
+		case ETextureCompression::BC4: return EInternalFormat::COMPRESSED_RED_RGTC1;
+		case ETextureCompression::BC5: return EInternalFormat::COMPRESSED_RG_RGTC2;
+		case ETextureCompression::BC7: return EInternalFormat::COMPRESSED_RGBA_BPTC_UNORM;
+		case ETextureCompression::RGBA16F: return EInternalFormat::RGBA16F;
+		default: return EInternalFormat::RGBA8;
+		}
+	}
+
+	std::string_view GetCompressionName(OvRendering::Settings::ETextureCompression p_compression)
+	{
+		using namespace OvRendering::Settings;
+
+		switch (p_compression)
+		{
+		case ETextureCompression::BC1: return "BC1";
+		case ETextureCompression::BC3: return "BC3";
+		case ETextureCompression::BC4: return "BC4";
+		case ETextureCompression::BC5: return "BC5";
+		case ETextureCompression::BC7: return "BC7";
+		case ETextureCompression::RGBA16F: return "RGBA16F";
+		default: return "NONE";
+		}
+	}
+
+	uint64_t GetSettingsHash(OvRendering::Settings::ETextureCompression p_compression, bool p_generateMipmap)
+	{
+		uint64_t hash = 14695981039346656037ull;
+		hash = (hash ^ static_cast<uint64_t>(p_compression)) * 1099511628211ull;
+		hash = (hash ^ static_cast<uint64_t>(p_generateMipmap)) * 1099511628211ull;
+		return hash;
+	}
+
+	/**
+	* Leave out the levels larger than the given size, always keeping the smallest one
+	*/
+	void DropLargestLevels(OvRendering::Resources::Parsers::TextureData& p_data, uint32_t p_maxLevelSize)
+	{
+		uint32_t dropped = 0;
+
+		while (dropped + 1 < p_data.levels.size() && std::max(p_data.levels[dropped].width, p_data.levels[dropped].height) > p_maxLevelSize)
+		{
+			++dropped;
+		}
+
+		if (dropped == 0)
+		{
+			return;
+		}
+
+		const uint64_t droppedSize = p_data.levels[dropped].offset;
+
+		p_data.data.erase(p_data.data.begin(), p_data.data.begin() + droppedSize);
+		p_data.levels.erase(p_data.levels.begin(), p_data.levels.begin() + dropped);
+		p_data.firstLevel += dropped;
+
+		for (auto& level : p_data.levels)
+		{
+			level.offset -= droppedSize;
+		}
+	}
+
+	/**
+	* Upload every level as-is, the mipmaps are never generated on the GPU
+	*/
+	void PrepareTexture(
+		baregl::Texture& p_texture,
+		const OvRendering::Resources::Parsers::TextureData& p_data,
+		baregl::types::ETextureFilteringMode p_minFilter,
+		baregl::types::ETextureFilteringMode p_magFilter,
+		baregl::types::ETextureWrapMode p_horizontalWrapMode,
+		baregl::types::ETextureWrapMode p_verticalWrapMode
+	)
+	{
+		using namespace baregl::types;
+
+		p_texture.Allocate({
+			.width = p_data.levels.front().width,
+			.height = p_data.levels.front().height,
+			.minFilter = p_minFilter,
+			.magFilter = p_magFilter,
+			.horizontalWrap = p_horizontalWrapMode,
+			.verticalWrap = p_verticalWrapMode,
+			.internalFormat = GetInternalFormat(p_data.compression),
+			.useMipMaps = p_data.levels.size() > 1
+		});
+
+		for (uint32_t i = 0; i < p_data.levels.size(); ++i)
+		{
+			const auto& level = p_data.levels[i];
+			const uint8_t* levelData = p_data.data.data() + level.offset;
+
+			if (p_data.compression == OvRendering::Settings::ETextureCompression::RGBA16F)
+			{
+				p_texture.Upload(levelData, EFormat::RGBA, EPixelDataType::HALF_FLOAT, i);
+			}
+			else
+			{
+				p_texture.UploadCompressed(levelData, static_cast<uint32_t>(level.size), i);
+			}
+		}
+	}
 }
 
 OvRendering::Resources::Texture* OvRendering::Resources::Loaders::TextureLoader::Create(
@@ -55,9 +170,21 @@ OvRendering::Resources::Texture* OvRendering::Resources::Loaders::TextureLoader:
 	baregl::types::ETextureFilteringMode p_magFilter,
 	baregl::types::ETextureWrapMode p_horizontalWrapMode,
 	baregl::types::ETextureWrapMode p_verticalWrapMode,
-	bool p_generateMipmap
+	bool p_generateMipmap,
+	Settings::ETextureCompression p_compression,
+	const std::filesystem::path& p_cookedPath
 )
 {
+	if (p_compression != Settings::ETextureCompression::NONE)
+	{
+		if (Parsers::TextureData data; LoadData(p_filepath, p_compression, p_generateMipmap, data, p_cookedPath))
+		{
+			return CreateFromData(p_filepath, data, p_minFilter, p_magFilter, p_horizontalWrapMode, p_verticalWrapMode);
+		}
+
+		return nullptr;
+	}
+
 	if (Data::Image image{ p_filepath })
 	{
 		auto texture = std::make_unique<baregl::Texture>(
@@ -172,9 +299,21 @@ void OvRendering::Resources::Loaders::TextureLoader::Reload(
 	baregl::types::ETextureFilteringMode p_magFilter,
 	baregl::types::ETextureWrapMode p_horizontalWrapMode,
 	baregl::types::ETextureWrapMode p_verticalWrapMode,
-	bool p_generateMipmap
+	bool p_generateMipmap,
+	Settings::ETextureCompression p_compression,
+	const std::filesystem::path& p_cookedPath
 )
 {
+	if (p_compression != Settings::ETextureCompression::NONE)
+	{
+		if (Parsers::TextureData data; LoadData(p_filePath, p_compression, p_generateMipmap, data, p_cookedPath))
+		{
+			ReloadFromData(p_texture, data, p_minFilter, p_magFilter, p_horizontalWrapMode, p_verticalWrapMode);
+		}
+
+		return;
+	}
+
 	if (Data::Image image{ p_filePath })
 	{
 		auto texture = std::make_unique<baregl::Texture>(
@@ -199,6 +338,194 @@ void OvRendering::Resources::Loaders::TextureLoader::Reload(
 	}
 }
 
+bool OvRendering::Resources::Loaders::TextureLoader::LoadData(
+	const std::string& p_filepath,
+	Settings::ETextureCompression p_compression,
+	bool p_generateMipmap,
+	Parsers::TextureData& p_data,
+	const std::filesystem::path& p_cookedPath,
+	uint32_t p_maxLevelSize,
+	std::optional<TextureEncodeReport>* p_encodeReport
+)
+{
+	const uint64_t settingsHash = GetSettingsHash(p_compression, p_generateMipmap);
+
+	if (!p_cookedPath.empty() && Parsers::CookedTextureParser::LoadTextureData(p_cookedPath, p_filepath, settingsHash, p_data, p_maxLevelSize))
+	{
+		return true;
+	}
+
+	const Data::Image image{ p_filepath };
+	Utils::TextureCompressionStats stats;
+
+	if (!Utils::CompressTexture(image, p_compression, p_generateMipmap, p_data, &stats))
+	{
+		return false;
+	}
+
+	TextureEncodeReport report{
+		.compression = p_data.compression,
+		.width = p_data.width,
+		.height = p_data.height,
+		.levelCount = p_data.levels.size(),
+		.size = p_data.data.size(),
+		.stats = stats
+	};
+
+	for (const auto& level : p_data.levels)
+	{
+		report.uncompressedSize += Utils::GetTextureLevelSize(Settings::ETextureCompression::NONE, level.width, level.height);
+	}
+
+	if (p_encodeReport)
+	{
+		*p_encodeReport = report;
+	}
+	else
+	{
+		LogEncodeReport(p_filepath, report);
+	}
+
+	if (!p_cookedPath.empty())
+	{
+		Parsers::CookedTextureParser::Save(p_cookedPath, OvTools::Filesystem::ComputeCookedAssetStamp(p_filepath, settingsHash), p_data);
+	}
+
+	if (p_maxLevelSize > 0)
+	{
+		DropLargestLevels(p_data, p_maxLevelSize);
+	}
+
+	return true;
+}
+
+void OvRendering::Resources::Loaders::TextureLoader::LogEncodeReport(const std::string& p_filepath, const TextureEncodeReport& p_report)
+{
+	OVLOG_INFO(std::format(
+		"TextureLoader: Encoded \"{}\" to {} ({}x{}, {} levels, {} KiB, {:.0f}% of RGBA8) in {:.1f} ms ({:.2f} MPix/s), PSNR: {}",
+		p_filepath,
+		GetCompressionName(p_report.compression),
+		p_report.width,
+		p_report.height,
+		p_report.levelCount,
+		p_report.size / 1024,
+		100.0 * static_cast<double>(p_report.size) / static_cast<double>(p_report.uncompressedSize),
+		p_report.stats.encodingTime * 1000.0,
+		p_report.stats.megapixelsPerSecond,
+		p_report.stats.psnr ? std::format("{:.2f} dB", p_report.stats.psnr.value()) : "n/a"
+	));
+}
+
+OvRendering::Resources::Texture* OvRendering::Resources::Loaders::TextureLoader::CreateFromData(
+	const std::string& p_filepath,
+	const Parsers::TextureData& p_data,
+	baregl::types::ETextureFilteringMode p_minFilter,
+	baregl::types::ETextureFilteringMode p_magFilter,
+	baregl::types::ETextureWrapMode p_horizontalWrapMode,
+	baregl::types::ETextureWrapMode p_verticalWrapMode
+)
+{
+	if (p_data.levels.empty())
+	{
+		return nullptr;
+	}
+
+	auto texture = std::make_unique<baregl::Texture>(
+		baregl::types::ETextureType::TEXTURE_2D,
+		OvTools::Utils::PathParser::GetElementName(p_filepath)
+	);
+
+	PrepareTexture(*texture, p_data, p_minFilter, p_magFilter, p_horizontalWrapMode, p_verticalWrapMode);
+
+	return new Texture{ p_filepath, std::move(texture) };
+}
+
+void OvRendering::Resources::Loaders::TextureLoader::ReloadFromData(
+	Texture& p_texture,
+	const Parsers::TextureData& p_data,
+	baregl::types::ETextureFilteringMode p_minFilter,
+	baregl::types::ETextureFilteringMode p_magFilter,
+	baregl::types::ETextureWrapMode p_horizontalWrapMode,
+	baregl::types::ETextureWrapMode p_verticalWrapMode
+)
+{
+	if (p_data.levels.empty())
+	{
+		return;
+	}
+
+	auto texture = std::make_unique<baregl::Texture>(
+		baregl::types::ETextureType::TEXTURE_2D,
+		OvTools::Utils::PathParser::GetElementName(p_texture.path)
+	);
+
+	PrepareTexture(*texture, p_data, p_minFilter, p_magFilter, p_horizontalWrapMode, p_verticalWrapMode);
+
+	p_texture.SetTexture(std::move(texture));
+}
+
+bool OvRendering::Resources::Loaders::TextureLoader::Cook(
+	const std::string& p_filepath,
+	const std::filesystem::path& p_cookedPath,
+	Settings::ETextureCompression p_compression,
+	bool p_generateMipmap
+)
+{
+	if (p_compression == Settings::ETextureCompression::NONE)
+	{
+		return true;
+	}
+
+	const uint64_t settingsHash = GetSettingsHash(p_compression, p_generateMipmap);
+
+	if (Parsers::CookedTextureParser::IsUpToDate(p_cookedPath, p_filepath, settingsHash))
+	{
+		return true;
+	}
+
+	if (Parsers::TextureData data; !LoadData(p_filepath, p_compression, p_generateMipmap, data, p_cookedPath))
+	{
+		OVLOG_WARNING("TextureLoader: Unable to cook \"" + p_filepath + "\"");
+		return false;
+	}
+
+	return Parsers::CookedTextureParser::IsUpToDate(p_cookedPath, p_filepath, settingsHash);
+}
+
+void OvRendering::Resources::Loaders::TextureLoader::ReloadFromImage(
+	Texture& p_texture,
+	const Data::Image& p_image,
+	baregl::types::ETextureFilteringMode p_minFilter,
+	baregl::types::ETextureFilteringMode p_magFilter,
+	baregl::types::ETextureWrapMode p_horizontalWrapMode,
+	baregl::types::ETextureWrapMode p_verticalWrapMode,
+	bool p_generateMipmap
+)
+{
+	if (p_image)
+	{
+		auto texture = std::make_unique<baregl::Texture>(
+			baregl::types::ETextureType::TEXTURE_2D,
+			OvTools::Utils::PathParser::GetElementName(p_texture.path)
+		);
+
+		PrepareTexture(
+			*texture,
+			p_image.data,
+			p_minFilter,
+			p_magFilter,
+			p_horizontalWrapMode,
+			p_verticalWrapMode,
+			p_image.width,
+			p_image.height,
+			p_generateMipmap,
+			p_image.isHDR
+		);
+
+		p_texture.SetTexture(std::move(texture));
+	}
+}
+
 void OvRendering::Resources::Loaders::TextureLoader::ReloadFromMemory(
 	Texture& p_texture,
 	const uint8_t* p_data,
@@ -4,19 +4,22 @@
 * @licence: MIT
 */
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <vector>
 
 #include <OvDebug/Logger.h>
 #include <OvRendering/Resources/Mesh.h>
+#include <OvRendering/Utils/Conversions.h>
 
 namespace
 {
 	template<typename TVertex>
-	OvRendering::Geometry::BoundingSphere ComputeBoundingSphere(std::span<const TVertex> p_vertices)
+	OvRendering::Geometry::BoundingSphere ComputeVerticesBoundingSphere(std::span<const TVertex> p_vertices)
 	{
 		OvRendering::Geometry::BoundingSphere sphere{};
 		sphere.position = OvMaths::FVector3::Zero;
@@ -54,34 +57,152 @@ namespace
 
 		return sphere;
 	}
+
+	template<typename TVertex>
+	float ComputeVerticesUVDensity(std::span<const TVertex> p_vertices, std::span<const uint32_t> p_indices)
+	{
+		double worldArea = 0.0;
+		double uvArea = 0.0;
+
+		for (size_t i = 0; i + 2 < p_indices.size(); i += 3)
+		{
+			if (p_indices[i] >= p_vertices.size() || p_indices[i + 1] >= p_vertices.size() || p_indices[i + 2] >= p_vertices.size())
+				continue;
+
+			const auto& a = p_vertices[p_indices[i]];
+			const auto& b = p_vertices[p_indices[i + 1]];
+			const auto& c = p_vertices[p_indices[i + 2]];
+
+			const OvMaths::FVector3 ab{ b.position[0] - a.position[0], b.position[1] - a.position[1], b.position[2] - a.position[2] };
+			const OvMaths::FVector3 ac{ c.position[0] - a.position[0], c.position[1] - a.position[1], c.position[2] - a.position[2] };
+			worldArea += OvMaths::FVector3::Length(OvMaths::FVector3::Cross(ab, ac)) * 0.5;
+
+			const float abU = b.texCoords[0] - a.texCoords[0];
+			const float abV = b.texCoords[1] - a.texCoords[1];
+			const float acU = c.texCoords[0] - a.texCoords[0];
+			const float acV = c.texCoords[1] - a.texCoords[1];
+			uvArea += std::abs(abU * acV - abV * acU) * 0.5;
+		}
+
+		return worldArea > 0.0 ? static_cast<float>(std::sqrt(uvArea / worldArea)) : 0.0f;
+	}
+
+	/**
+	* Attributes shared by the packed vertices, skinning data is appended right after them
+	*/
+	struct PackedVertex
+	{
+		float position[3];
+		uint16_t texCoords[2];	// Half-floats
+		uint32_t normal;		// SNORM 10:10:10:2
+		uint32_t tangent;		// SNORM 10:10:10:2, the sign of the bitangent in w
+	};
+
+	static_assert(sizeof(PackedVertex) == 24);
+
+	PackedVertex PackVertex(const OvRendering::Geometry::Vertex& p_vertex)
+	{
+		using namespace OvRendering::Utils::Conversions;
+
+		const auto& normal = reinterpret_cast<const OvMaths::FVector3&>(p_vertex.normals);
+		const auto& tangent = reinterpret_cast<const OvMaths::FVector3&>(p_vertex.tangent);
+		const auto& bitangent = reinterpret_cast<const OvMaths::FVector3&>(p_vertex.bitangent);
+
+		// Mirrored UVs give a left-handed tangent space, the bitangent is rebuilt as cross(normal, tangent) * sign
+		const float bitangentSign = OvMaths::FVector3::Dot(OvMaths::FVector3::Cross(normal, tangent), bitangent) < 0.0f ? -1.0f : 1.0f;
+
+		PackedVertex result;
+		std::memcpy(result.position, p_vertex.position, sizeof(result.position));
+		result.texCoords[0] = FloatToHalf(p_vertex.texCoords[0]);
+		result.texCoords[1] = FloatToHalf(p_vertex.texCoords[1]);
+		result.normal = PackSnorm1010102(normal.x, normal.y, normal.z, 0.0f);
+		result.tangent = PackSnorm1010102(tangent.x, tangent.y, tangent.z, bitangentSign);
+		return result;
+	}
+
+	template<typename T>
+	void AppendBytes(std::vector<std::byte>& p_output, const T& p_value)
+	{
+		const auto bytes = std::as_bytes(std::span(&p_value, 1));
+		p_output.insert(p_output.end(), bytes.begin(), bytes.end());
+	}
+
+	/**
+	* Quantize the bone weights of a vertex to the given unsigned normalized type, keeping their sum exact
+	*/
+	template<typename T>
+	std::array<T, OvRendering::Animation::kMaxBonesPerVertex> QuantizeBoneWeights(const OvRendering::Geometry::SkinnedVertex& p_vertex)
+	{
+		constexpr float kMaxValue = static_cast<float>(std::numeric_limits<T>::max());
+
+		std::array<T, OvRendering::Animation::kMaxBonesPerVertex> result{};
+		int32_t total = 0;
+		size_t heaviest = 0;
+
+		for (size_t i = 0; i < result.size(); ++i)
+		{
+			result[i] = static_cast<T>(std::round(std::clamp(p_vertex.boneWeights[i], 0.0f, 1.0f) * kMaxValue));
+			total += result[i];
+			heaviest = result[i] > result[heaviest] ? i : heaviest;
+		}
+
+		// Rounding errors go to the heaviest influence, so that a vertex doesn't shrink toward the origin
+		if (total > 0)
+		{
+			const int32_t corrected = static_cast<int32_t>(result[heaviest]) + static_cast<int32_t>(kMaxValue) - total;
+			result[heaviest] = static_cast<T>(std::clamp(corrected, 0, static_cast<int32_t>(kMaxValue)));
+		}
+
+		return result;
+	}
 }
 
 OvRendering::Resources::Mesh::Mesh(
 	std::span<const Geometry::Vertex> p_vertices,
 	std::span<const uint32_t> p_indices,
-	uint32_t p_materialIndex
+	uint32_t p_materialIndex,
+	std::optional<Geometry::BoundingSphere> p_boundingSphere,
+	Settings::EVertexFormat p_vertexFormat,
+	std::span<const LODDescriptor> p_lods
 ) :
 	m_vertexCount(static_cast<uint32_t>(p_vertices.size())),
 	m_indicesCount(static_cast<uint32_t>(p_indices.size())),
 	m_materialIndex(p_materialIndex),
-	m_hasSkinningData(false)
+	m_hasSkinningData(false),
+	m_vertexFormat(p_vertexFormat)
 {
-	Upload(p_vertices, p_indices);
-	m_boundingSphere = ComputeBoundingSphere(p_vertices);
+	if (m_vertexFormat == Settings::EVertexFormat::STANDARD)
+		Upload(p_vertices, p_indices);
+	else
+		UploadPacked(p_vertices, p_indices);
+
+	m_boundingSphere = p_boundingSphere ? p_boundingSphere.value() : ComputeVerticesBoundingSphere(p_vertices);
+	m_uvDensity = ComputeVerticesUVDensity(p_vertices, p_indices);
+	CreateLODs(p_vertices, p_lods);
 }
 
 OvRendering::Resources::Mesh::Mesh(
 	std::span<const Geometry::SkinnedVertex> p_vertices,
 	std::span<const uint32_t> p_indices,
-	uint32_t p_materialIndex
+	uint32_t p_materialIndex,
+	std::optional<Geometry::BoundingSphere> p_boundingSphere,
+	Settings::EVertexFormat p_vertexFormat,
+	std::span<const LODDescriptor> p_lods
 ) :
 	m_vertexCount(static_cast<uint32_t>(p_vertices.size())),
 	m_indicesCount(static_cast<uint32_t>(p_indices.size())),
 	m_materialIndex(p_materialIndex),
-	m_hasSkinningData(true)
+	m_hasSkinningData(true),
+	m_vertexFormat(p_vertexFormat)
 {
-	Upload(p_vertices, p_indices);
-	m_boundingSphere = ComputeBoundingSphere(p_vertices);
+	if (m_vertexFormat == Settings::EVertexFormat::STANDARD)
+		Upload(p_vertices, p_indices);
+	else
+		UploadPacked(p_vertices, p_indices);
+
+	m_boundingSphere = p_boundingSphere ? p_boundingSphere.value() : ComputeVerticesBoundingSphere(p_vertices);
+	m_uvDensity = ComputeVerticesUVDensity(p_vertices, p_indices);
+	CreateLODs(p_vertices, p_lods);
 }
 
 void OvRendering::Resources::Mesh::Bind() const
@@ -104,11 +225,21 @@ uint32_t OvRendering::Resources::Mesh::GetIndexCount() const
 	return m_indicesCount;
 }
 
+baregl::types::EDataType OvRendering::Resources::Mesh::GetIndexType() const
+{
+	return m_indexType;
+}
+
 const OvRendering::Geometry::BoundingSphere& OvRendering::Resources::Mesh::GetBoundingSphere() const
 {
 	return m_boundingSphere;
 }
 
+float OvRendering::Resources::Mesh::GetUVDensity() const
+{
+	return m_uvDensity;
+}
+
 uint32_t OvRendering::Resources::Mesh::GetMaterialIndex() const
 {
 	return m_materialIndex;
@@ -119,52 +250,188 @@ bool OvRendering::Resources::Mesh::HasSkinningData() const
 	return m_hasSkinningData;
 }
 
+OvRendering::Settings::EVertexFormat OvRendering::Resources::Mesh::GetVertexFormat() const
+{
+	return m_vertexFormat;
+}
+
+uint64_t OvRendering::Resources::Mesh::GetMemoryUsage() const
+{
+	uint64_t memoryUsage = m_vertexBuffer.GetSize() + m_indexBuffer.GetSize();
+
+	for (const auto& lod : m_lods)
+	{
+		memoryUsage += lod->GetMemoryUsage();
+	}
+
+	return memoryUsage;
+}
+
+uint32_t OvRendering::Resources::Mesh::GetLODCount() const
+{
+	return static_cast<uint32_t>(m_lods.size()) + 1;
+}
+
+OvRendering::Resources::Mesh& OvRendering::Resources::Mesh::GetLOD(uint32_t p_level)
+{
+	return p_level == 0 || m_lods.empty() ? *this : *m_lods[std::min<size_t>(p_level, m_lods.size()) - 1];
+}
+
+float OvRendering::Resources::Mesh::GetLODScreenSize(uint32_t p_level) const
+{
+	return p_level == 0 || m_lodScreenSizes.empty() ?
+		std::numeric_limits<float>::max() :
+		m_lodScreenSizes[std::min<size_t>(p_level, m_lodScreenSizes.size()) - 1];
+}
+
+uint32_t OvRendering::Resources::Mesh::SelectLOD(float p_screenSize, uint32_t p_currentLevel) const
+{
+	return SelectLOD(m_lodScreenSizes, p_screenSize, p_currentLevel);
+}
+
+uint32_t OvRendering::Resources::Mesh::SelectLOD(std::span<const float> p_lodScreenSizes, float p_screenSize, uint32_t p_currentLevel)
+{
+	const uint32_t levelCount = static_cast<uint32_t>(p_lodScreenSizes.size()) + 1;
+	uint32_t level = std::min(p_currentLevel, levelCount - 1);
+
+	// The screen size of level N is stored at index N - 1, the full detail level having no upper bound
+	while (level + 1 < levelCount && p_screenSize < p_lodScreenSizes[level] * (1.0f - kLODHysteresis))
+	{
+		++level;
+	}
+
+	while (level > 0 && p_screenSize > p_lodScreenSizes[level - 1] * (1.0f + kLODHysteresis))
+	{
+		--level;
+	}
+
+	return level;
+}
+
+OvRendering::Geometry::BoundingSphere OvRendering::Resources::Mesh::ComputeBoundingSphere(std::span<const Geometry::Vertex> p_vertices)
+{
+	return ComputeVerticesBoundingSphere(p_vertices);
+}
+
+OvRendering::Geometry::BoundingSphere OvRendering::Resources::Mesh::ComputeBoundingSphere(std::span<const Geometry::SkinnedVertex> p_vertices)
+{
+	return ComputeVerticesBoundingSphere(p_vertices);
+}
+
 void OvRendering::Resources::Mesh::Upload(std::span<const Geometry::Vertex> p_vertices, std::span<const uint32_t> p_indices)
 {
-	if (m_vertexBuffer.Allocate(p_vertices.size_bytes()))
+	UploadBuffers(std::as_bytes(p_vertices), p_indices, {
+		baregl::data::FloatVertexAttribute{ baregl::types::EDataType::FLOAT, 3 }, // position
+		baregl::data::FloatVertexAttribute{ baregl::types::EDataType::FLOAT, 2 }, // texCoords
+		baregl::data::FloatVertexAttribute{ baregl::types::EDataType::FLOAT, 3 }, // normal
+		baregl::data::FloatVertexAttribute{ baregl::types::EDataType::FLOAT, 3 }, // tangent
+		baregl::data::FloatVertexAttribute{ baregl::types::EDataType::FLOAT, 3 }, // bitangent
+	});
+}
+
+void OvRendering::Resources::Mesh::Upload(std::span<const Geometry::SkinnedVertex> p_vertices, std::span<const uint32_t> p_indices)
+{
+	UploadBuffers(std::as_bytes(p_vertices), p_indices, {
+		baregl::data::FloatVertexAttribute{ baregl::types::EDataType::FLOAT, 3 }, // position
+		baregl::data::FloatVertexAttribute{ baregl::types::EDataType::FLOAT, 2 }, // texCoords
+		baregl::data::FloatVertexAttribute{ baregl::types::EDataType::FLOAT, 3 }, // normal
+		baregl::data::FloatVertexAttribute{ baregl::types::EDataType::FLOAT, 3 }, // tangent
+		baregl::data::FloatVertexAttribute{ baregl::types::EDataType::FLOAT, 3 }, // bitangent
+		baregl::data::IntegerVertexAttribute{ baregl::types::EDataType::UNSIGNED_INT, 4 }, // boneIDs
+		baregl::data::FloatVertexAttribute{ baregl::types::EDataType::FLOAT, 4 }  // boneWeights
+	});
+}
+
+void OvRendering::Resources::Mesh::UploadPacked(std::span<const Geometry::Vertex> p_vertices, std::span<const uint32_t> p_indices)
+{
+	std::vector<PackedVertex> packedVertices;
+	packedVertices.reserve(p_vertices.size());
+
+	for (const auto& vertex : p_vertices)
 	{
-		m_vertexBuffer.Upload(p_vertices.data());
+		packedVertices.push_back(PackVertex(vertex));
+	}
+
+	UploadBuffers(std::as_bytes(std::span(packedVertices)), p_indices, {
+		baregl::data::FloatVertexAttribute{ baregl::types::EDataType::FLOAT, 3 }, // position
+		baregl::data::FloatVertexAttribute{ baregl::types::EDataType::HALF_FLOAT, 2 }, // texCoords
+		baregl::data::FloatVertexAttribute{ baregl::types::EDataType::INT_2_10_10_10_REV, 4, true }, // normal
+		baregl::data::FloatVertexAttribute{ baregl::types::EDataType::INT_2_10_10_10_REV, 4, true }, // tangent (bitangent sign in w)
+		baregl::data::UnusedVertexAttribute{}, // bitangent (Rebuilt in the shader)
+	});
+}
 
-		if (m_indexBuffer.Allocate(p_indices.size_bytes()))
+void OvRendering::Resources::Mesh::UploadPacked(std::span<const Geometry::SkinnedVertex> p_vertices, std::span<const uint32_t> p_indices)
+{
+	const bool compactWeights = m_vertexFormat == Settings::EVertexFormat::PACKED_COMPACT;
+
+	// 8-bit bone indices address 256 bones, larger skeletons fallback to 16-bit indices
+	const bool compactBoneIDs = std::ranges::all_of(p_vertices, [](const Geometry::SkinnedVertex& p_vertex) {
+		return std::ranges::all_of(p_vertex.boneIDs, [](uint32_t p_boneID) { return p_boneID <= std::numeric_limits<uint8_t>::max(); });
+	});
+
+	const size_t vertexSize =
+		sizeof(PackedVertex) +
+		Animation::kMaxBonesPerVertex * (compactBoneIDs ? sizeof(uint8_t) : sizeof(uint16_t)) +
+		Animation::kMaxBonesPerVertex * (compactWeights ? sizeof(uint8_t) : sizeof(uint16_t));
+
+	std::vector<std::byte> packedVertices;
+	packedVertices.reserve(p_vertices.size() * vertexSize);
+
+	for (const auto& vertex : p_vertices)
+	{
+		AppendBytes(packedVertices, PackVertex(vertex));
+
+		for (const uint32_t boneID : vertex.boneIDs)
 		{
-			m_indexBuffer.Upload(p_indices.data());
-			m_vertexArray.SetLayout({
-				baregl::data::FloatVertexAttribute{ baregl::types::EDataType::FLOAT, 3 }, // position
-				baregl::data::FloatVertexAttribute{ baregl::types::EDataType::FLOAT, 2 }, // texCoords
-				baregl::data::FloatVertexAttribute{ baregl::types::EDataType::FLOAT, 3 }, // normal
-				baregl::data::FloatVertexAttribute{ baregl::types::EDataType::FLOAT, 3 }, // tangent
-				baregl::data::FloatVertexAttribute{ baregl::types::EDataType::FLOAT, 3 }, // bitangent
-			}, m_vertexBuffer, m_indexBuffer);
+			if (compactBoneIDs)
+				AppendBytes(packedVertices, static_cast<uint8_t>(boneID));
+			else
+				AppendBytes(packedVertices, static_cast<uint16_t>(std::min<uint32_t>(boneID, std::numeric_limits<uint16_t>::max())));
 		}
+
+		if (compactWeights)
+			AppendBytes(packedVertices, QuantizeBoneWeights<uint8_t>(vertex));
 		else
-		{
-			OVLOG_WARNING("Empty index buffer!");
-		}
-	}
-	else
-	{
-		OVLOG_WARNING("Empty vertex buffer!");
+			AppendBytes(packedVertices, QuantizeBoneWeights<uint16_t>(vertex));
 	}
+
+	const auto boneIDsType = compactBoneIDs ? baregl::types::EDataType::UNSIGNED_BYTE : baregl::types::EDataType::UNSIGNED_SHORT;
+	const auto boneWeightsType = compactWeights ? baregl::types::EDataType::UNSIGNED_BYTE : baregl::types::EDataType::UNSIGNED_SHORT;
+
+	UploadBuffers(packedVertices, p_indices, {
+		baregl::data::FloatVertexAttribute{ baregl::types::EDataType::FLOAT, 3 }, // position
+		baregl::data::FloatVertexAttribute{ baregl::types::EDataType::HALF_FLOAT, 2 }, // texCoords
+		baregl::data::FloatVertexAttribute{ baregl::types::EDataType::INT_2_10_10_10_REV, 4, true }, // normal
+		baregl::data::FloatVertexAttribute{ baregl::types::EDataType::INT_2_10_10_10_REV, 4, true }, // tangent (bitangent sign in w)
+		baregl::data::UnusedVertexAttribute{}, // bitangent (Rebuilt in the shader)
+		baregl::data::IntegerVertexAttribute{ boneIDsType, 4 }, // boneIDs
+		baregl::data::FloatVertexAttribute{ boneWeightsType, 4, true }  // boneWeights
+	});
 }
 
-void OvRendering::Resources::Mesh::Upload(std::span<const Geometry::SkinnedVertex> p_vertices, std::span<const uint32_t> p_indices)
+void OvRendering::Resources::Mesh::UploadBuffers(std::span<const std::byte> p_vertexData, std::span<const uint32_t> p_indices, baregl::data::VertexAttributeLayout p_layout)
 {
-	if (m_vertexBuffer.Allocate(p_vertices.size_bytes()))
+	if (m_vertexBuffer.Allocate(p_vertexData.size_bytes()))
 	{
-		m_vertexBuffer.Upload(p_vertices.data());
+		m_vertexBuffer.Upload(p_vertexData.data());
 
-		if (m_indexBuffer.Allocate(p_indices.size_bytes()))
+		auto indexData = std::as_bytes(p_indices);
+
+		// Halves the index buffer memory and bandwidth when every vertex can be addressed with 16 bits
+		std::vector<uint16_t> narrowIndices;
+
+		if (m_vertexCount <= std::numeric_limits<uint16_t>::max() + 1u)
+		{
+			narrowIndices.assign(p_indices.begin(), p_indices.end());
+			indexData = std::as_bytes(std::span<const uint16_t>(narrowIndices));
+			m_indexType = baregl::types::EDataType::UNSIGNED_SHORT;
+		}
+
+		if (m_indexBuffer.Allocate(indexData.size_bytes()))
 		{
-			m_indexBuffer.Upload(p_indices.data());
-			m_vertexArray.SetLayout({
-				baregl::data::FloatVertexAttribute{ baregl::types::EDataType::FLOAT, 3 }, // position
-				baregl::data::FloatVertexAttribute{ baregl::types::EDataType::FLOAT, 2 }, // texCoords
-				baregl::data::FloatVertexAttribute{ baregl::types::EDataType::FLOAT, 3 }, // normal
-				baregl::data::FloatVertexAttribute{ baregl::types::EDataType::FLOAT, 3 }, // tangent
-				baregl::data::FloatVertexAttribute{ baregl::types::EDataType::FLOAT, 3 }, // bitangent
-				baregl::data::IntegerVertexAttribute{ baregl::types::EDataType::UNSIGNED_INT, 4 }, // boneIDs
-				baregl::data::FloatVertexAttribute{ baregl::types::EDataType::FLOAT, 4 }  // boneWeights
-			}, m_vertexBuffer, m_indexBuffer);
+			m_indexBuffer.Upload(indexData.data());
+			m_vertexArray.SetLayout(p_layout, m_vertexBuffer, m_indexBuffer);
 		}
 		else
 		{
@@ -177,4 +444,55 @@ void OvRendering::Resources::Mesh::Upload(std::span<const Geometry::SkinnedVerte
 	}
 }
 
+template<typename TVertex>
+void OvRendering::Resources::Mesh::CreateLODs(std::span<const TVertex> p_vertices, std::span<const LODDescriptor> p_lods)
+{
+	m_lods.reserve(p_lods.size());
+	m_lodScreenSizes.reserve(p_lods.size());
+
+	std::vector<uint32_t> remap;
+	std::vector<TVertex> vertices;
+	std::vector<uint32_t> indices;
 
+	for (const auto& lod : p_lods)
+	{
+		// Each level only keeps the vertices it references, so the vertex shader work shrinks along with the triangles
+		remap.assign(p_vertices.size(), std::numeric_limits<uint32_t>::max());
+		vertices.clear();
+		indices.clear();
+		indices.reserve(lod.indices.size());
+
+		for (const uint32_t index : lod.indices)
+		{
+			if (index >= p_vertices.size())
+			{
+				continue;
+			}
+
+			if (remap[index] == std::numeric_limits<uint32_t>::max())
+			{
+				remap[index] = static_cast<uint32_t>(vertices.size());
+				vertices.push_back(p_vertices[index]);
+			}
+
+			indices.push_back(remap[index]);
+		}
+
+		if (indices.empty() || indices.size() % 3 != 0)
+		{
+			OVLOG_WARNING("Invalid mesh level of detail, the following levels are ignored");
+			break;
+		}
+
+		// Levels share the bounding sphere of the full detail mesh, so that they are culled and selected the same way
+		m_lods.push_back(std::make_unique<Mesh>(
+			std::span<const TVertex>(vertices),
+			std::span<const uint32_t>(indices),
+			m_materialIndex,
+			m_boundingSphere,
+			m_vertexFormat
+		));
+
+		m_lodScreenSizes.push_back(lod.screenSize);
+	}
+}
@@ -27,6 +27,7 @@
 
 #include <OvDebug/Logger.h>
 #include <OvRendering/Resources/Parsers/AssimpParser.h>
+#include <OvTools/Utils/ParallelFor.h>
 #include <OvTools/Utils/PathParser.h>
 
 namespace
@@ -741,11 +742,20 @@ namespace
 		}
 	}
 
-	OvRendering::Resources::Mesh* ProcessMesh(
+	/**
+	* Mesh referenced by a node of the scene, with the transform of that node
+	*/
+	struct MeshInstance
+	{
+		aiMatrix4x4 transform;
+		const aiMesh* mesh;
+	};
+
+	// Only reads the given mesh, so meshes can be processed concurrently
+	std::optional<OvRendering::Resources::Parsers::MeshData> ProcessMesh(
 		const aiMatrix4x4& p_transform,
-		aiMesh* p_mesh,
-		OvRendering::Animation::Skeleton* p_skeleton,
-		const std::unordered_map<const aiNode*, uint32_t>* p_nodeIndexByPointer
+		const aiMesh* p_mesh,
+		bool p_skinned
 	)
 	{
 		std::vector<uint32_t> indices;
@@ -775,9 +785,12 @@ namespace
 
 		if (p_mesh->mNumVertices == 0 || indices.empty())
 		{
-			return nullptr;
+			return std::nullopt;
 		}
 
+		OvRendering::Resources::Parsers::MeshData result;
+		result.materialIndex = p_mesh->mMaterialIndex;
+
 		auto fillGeometry = [&](OvRendering::Geometry::Vertex& v, uint32_t i)
 		{
 			const aiVector3D position = p_transform * p_mesh->mVertices[i];
@@ -806,142 +819,184 @@ namespace
 			v.bitangent[2] = -bitangent.z;
 		};
 
-		if (p_skeleton && p_mesh->HasBones())
+		if (p_skinned)
 		{
-			const OvMaths::FMatrix4 meshGlobalBindTransform = ToMatrix4(p_transform);
-			std::optional<OvMaths::FMatrix4> meshGlobalBindTransformInverse;
-
-			try
-			{
-				meshGlobalBindTransformInverse = OvMaths::FMatrix4::Inverse(meshGlobalBindTransform);
-			}
-			catch (...)
+			result.skinnedVertices.resize(p_mesh->mNumVertices);
+			for (uint32_t i = 0; i < p_mesh->mNumVertices; ++i)
 			{
-				meshGlobalBindTransformInverse = std::nullopt;
+				fillGeometry(result.skinnedVertices[i], i);
 			}
-
-			std::vector<OvRendering::Geometry::SkinnedVertex> vertices(p_mesh->mNumVertices);
+		}
+		else
+		{
+			result.vertices.resize(p_mesh->mNumVertices);
 			for (uint32_t i = 0; i < p_mesh->mNumVertices; ++i)
 			{
-				fillGeometry(vertices[i], i);
+				fillGeometry(result.vertices[i], i);
 			}
+		}
 
-			for (uint32_t boneID = 0; boneID < p_mesh->mNumBones; ++boneID)
-			{
-				const aiBone* bone = p_mesh->mBones[boneID];
-				const std::string boneName = bone->mName.C_Str();
-				const OvMaths::FMatrix4 rawOffsetMatrix = ToMatrix4(bone->mOffsetMatrix);
+		result.indices = std::move(indices);
+		return result;
+	}
 
-				std::optional<uint32_t> nodeIndex;
+	// Register the bones of the given mesh in the skeleton, and bind them to the vertices of its processed data
+	void ProcessBones(
+		const aiMatrix4x4& p_transform,
+		const aiMesh* p_mesh,
+		OvRendering::Resources::Parsers::MeshData& p_meshData,
+		OvRendering::Animation::Skeleton& p_skeleton,
+		const std::unordered_map<const aiNode*, uint32_t>* p_nodeIndexByPointer
+	)
+	{
+		const OvMaths::FMatrix4 meshGlobalBindTransform = ToMatrix4(p_transform);
+		std::optional<OvMaths::FMatrix4> meshGlobalBindTransformInverse;
+
+		try
+		{
+			meshGlobalBindTransformInverse = OvMaths::FMatrix4::Inverse(meshGlobalBindTransform);
+		}
+		catch (...)
+		{
+			meshGlobalBindTransformInverse = std::nullopt;
+		}
+
+		auto& vertices = p_meshData.skinnedVertices;
+
+		for (uint32_t boneID = 0; boneID < p_mesh->mNumBones; ++boneID)
+		{
+			const aiBone* bone = p_mesh->mBones[boneID];
+			const std::string boneName = bone->mName.C_Str();
+			const OvMaths::FMatrix4 rawOffsetMatrix = ToMatrix4(bone->mOffsetMatrix);
+
+			std::optional<uint32_t> nodeIndex;
 #ifndef ASSIMP_BUILD_NO_ARMATUREPOPULATE_PROCESS
-				if (p_nodeIndexByPointer && bone->mNode)
+			if (p_nodeIndexByPointer && bone->mNode)
+			{
+				if (const auto foundNode = p_nodeIndexByPointer->find(bone->mNode); foundNode != p_nodeIndexByPointer->end())
 				{
-					if (const auto foundNode = p_nodeIndexByPointer->find(bone->mNode); foundNode != p_nodeIndexByPointer->end())
-					{
-						nodeIndex = foundNode->second;
-					}
+					nodeIndex = foundNode->second;
 				}
+			}
 #endif
 
-				if (!nodeIndex)
-				{
-					nodeIndex = p_skeleton->FindNodeIndex(boneName);
-				}
+			if (!nodeIndex)
+			{
+				nodeIndex = p_skeleton.FindNodeIndex(boneName);
+			}
 
-				if (!nodeIndex.has_value())
-				{
-					OVLOG_WARNING("AssimpParser: Bone '" + boneName + "' has no matching node in hierarchy and will be ignored.");
-					continue;
-				}
+			if (!nodeIndex.has_value())
+			{
+				OVLOG_WARNING("AssimpParser: Bone '" + boneName + "' has no matching node in hierarchy and will be ignored.");
+				continue;
+			}
 
-				OvMaths::FMatrix4 normalizedOffsetMatrix = rawOffsetMatrix;
-				if (meshGlobalBindTransformInverse)
-				{
-					// Assimp FBX stores aiBone::mOffsetMatrix relative to the source mesh bind space.
-					// Our importer bakes mesh vertices to scene/root space via p_transform, so we must
-					// remap the offset to the same space for consistent skinning across sub-meshes.
-					normalizedOffsetMatrix = rawOffsetMatrix * meshGlobalBindTransformInverse.value();
-				}
+			OvMaths::FMatrix4 normalizedOffsetMatrix = rawOffsetMatrix;
+			if (meshGlobalBindTransformInverse)
+			{
+				// Assimp FBX stores aiBone::mOffsetMatrix relative to the source mesh bind space.
+				// Our importer bakes mesh vertices to scene/root space via p_transform, so we must
+				// remap the offset to the same space for consistent skinning across sub-meshes.
+				normalizedOffsetMatrix = rawOffsetMatrix * meshGlobalBindTransformInverse.value();
+			}
 
-				uint32_t boneIndex = 0;
-				const int32_t existingNodeBoneIndex = p_skeleton->nodes[nodeIndex.value()].boneIndex;
-				if (existingNodeBoneIndex >= 0)
+			uint32_t boneIndex = 0;
+			const int32_t existingNodeBoneIndex = p_skeleton.nodes[nodeIndex.value()].boneIndex;
+			if (existingNodeBoneIndex >= 0)
+			{
+				boneIndex = static_cast<uint32_t>(existingNodeBoneIndex);
+			}
+			else
+			{
+				boneIndex = static_cast<uint32_t>(p_skeleton.bones.size());
+				if (!p_skeleton.boneByName.contains(boneName))
 				{
-					boneIndex = static_cast<uint32_t>(existingNodeBoneIndex);
+					p_skeleton.boneByName.emplace(boneName, boneIndex);
 				}
-				else
-				{
-					boneIndex = static_cast<uint32_t>(p_skeleton->bones.size());
-					if (!p_skeleton->boneByName.contains(boneName))
-					{
-						p_skeleton->boneByName.emplace(boneName, boneIndex);
-					}
 
-					p_skeleton->bones.push_back({
-						.name = boneName,
-						.nodeIndex = nodeIndex.value(),
-						.offsetMatrix = normalizedOffsetMatrix
-					});
+				p_skeleton.bones.push_back({
+					.name = boneName,
+					.nodeIndex = nodeIndex.value(),
+					.offsetMatrix = normalizedOffsetMatrix
+				});
 
-					p_skeleton->nodes[nodeIndex.value()].boneIndex = static_cast<int32_t>(boneIndex);
-				}
+				p_skeleton.nodes[nodeIndex.value()].boneIndex = static_cast<int32_t>(boneIndex);
+			}
 
-				for (uint32_t weightID = 0; weightID < bone->mNumWeights; ++weightID)
+			for (uint32_t weightID = 0; weightID < bone->mNumWeights; ++weightID)
+			{
+				const auto& weight = bone->mWeights[weightID];
+				if (weight.mVertexId < vertices.size())
 				{
-					const auto& weight = bone->mWeights[weightID];
-					if (weight.mVertexId < vertices.size())
-					{
-						AddBoneData(vertices[weight.mVertexId], boneIndex, weight.mWeight);
-					}
+					AddBoneData(vertices[weight.mVertexId], boneIndex, weight.mWeight);
 				}
 			}
-
-			return new OvRendering::Resources::Mesh(std::span(vertices), std::span(indices), p_mesh->mMaterialIndex);
 		}
+	}
+
+	void CollectMeshInstances(
+		const aiMatrix4x4& p_transform,
+		const aiNode* p_node,
+		const aiScene* p_scene,
+		std::vector<MeshInstance>& p_meshInstances
+	)
+	{
+		const aiMatrix4x4 nodeTransform = p_transform * p_node->mTransformation;
 
-		std::vector<OvRendering::Geometry::Vertex> vertices(p_mesh->mNumVertices);
-		for (uint32_t i = 0; i < p_mesh->mNumVertices; ++i)
+		for (uint32_t i = 0; i < p_node->mNumMeshes; ++i)
 		{
-			fillGeometry(vertices[i], i);
+			p_meshInstances.push_back({ nodeTransform, p_scene->mMeshes[p_node->mMeshes[i]] });
 		}
 
-		return new OvRendering::Resources::Mesh(std::span(vertices), std::span(indices), p_mesh->mMaterialIndex);
+		for (uint32_t i = 0; i < p_node->mNumChildren; ++i)
+		{
+			CollectMeshInstances(nodeTransform, p_node->mChildren[i], p_scene, p_meshInstances);
+		}
 	}
 
-	void ProcessNode(
+	void ProcessCollisionNode(
 		const aiMatrix4x4& p_transform,
-		aiNode* p_node,
+		const aiNode* p_node,
 		const aiScene* p_scene,
-		std::vector<OvRendering::Resources::Mesh*>& p_meshes,
-		OvRendering::Animation::Skeleton* p_skeleton,
-		const std::unordered_map<const aiNode*, uint32_t>* p_nodeIndexByPointer
+		std::vector<OvMaths::FVector3>& p_positions,
+		std::vector<uint32_t>& p_indices
 	)
 	{
 		const aiMatrix4x4 nodeTransform = p_transform * p_node->mTransformation;
 
 		for (uint32_t i = 0; i < p_node->mNumMeshes; ++i)
 		{
-			if (OvRendering::Resources::Mesh* result = ProcessMesh(
-				nodeTransform,
-				p_scene->mMeshes[p_node->mMeshes[i]],
-				p_skeleton,
-				p_nodeIndexByPointer
-			))
+			const aiMesh* mesh = p_scene->mMeshes[p_node->mMeshes[i]];
+			const auto baseVertex = static_cast<uint32_t>(p_positions.size());
+
+			for (uint32_t vertexID = 0; vertexID < mesh->mNumVertices; ++vertexID)
+			{
+				const aiVector3D position = nodeTransform * mesh->mVertices[vertexID];
+				p_positions.emplace_back(position.x, position.y, position.z);
+			}
+
+			for (uint32_t faceID = 0; faceID < mesh->mNumFaces; ++faceID)
 			{
-				p_meshes.push_back(result); // The model will handle mesh destruction
+				const auto& face = mesh->mFaces[faceID];
+
+				// Collision shapes are built from triangles only, points and lines are ignored
+				if (face.mNumIndices != 3 ||
+					face.mIndices[0] >= mesh->mNumVertices ||
+					face.mIndices[1] >= mesh->mNumVertices ||
+					face.mIndices[2] >= mesh->mNumVertices)
+				{
+					continue;
+				}
+
+				p_indices.push_back(baseVertex + face.mIndices[0]);
+				p_indices.push_back(baseVertex + face.mIndices[1]);
+				p_indices.push_back(baseVertex + face.mIndices[2]);
 			}
 		}
 
 		for (uint32_t i = 0; i < p_node->mNumChildren; ++i)
 		{
-			ProcessNode(
-				nodeTransform,
-				p_node->mChildren[i],
-				p_scene,
-				p_meshes,
-				p_skeleton,
-				p_nodeIndexByPointer
-			);
+			ProcessCollisionNode(nodeTransform, p_node->mChildren[i], p_scene, p_positions, p_indices);
 		}
 	}
 }
@@ -957,6 +1012,38 @@ bool OvRendering::Resources::Parsers::AssimpParser::LoadModel(
 	EModelParserFlags p_parserFlags,
 	bool p_generateEmbeddedAssets
 )
+{
+	ModelData data;
+
+	if (!LoadModelData(p_fileName, data, p_parserFlags, p_generateEmbeddedAssets))
+	{
+		return false;
+	}
+
+	for (const auto& mesh : data.meshes)
+	{
+		// The model will handle mesh destruction
+		p_meshes.push_back(mesh.IsSkinned() ?
+			new Mesh(std::span(mesh.skinnedVertices), std::span(mesh.indices), mesh.materialIndex) :
+			new Mesh(std::span(mesh.vertices), std::span(mesh.indices), mesh.materialIndex)
+		);
+	}
+
+	p_materials = std::move(data.materialNames);
+	p_skeleton = std::move(data.skeleton);
+	p_animations = std::move(data.animations);
+	p_embeddedMaterials = std::move(data.embeddedMaterials);
+	p_embeddedTextures = std::move(data.embeddedTextures);
+
+	return true;
+}
+
+bool OvRendering::Resources::Parsers::AssimpParser::LoadModelData(
+	const std::string& p_fileName,
+	ModelData& p_data,
+	EModelParserFlags p_parserFlags,
+	bool p_generateEmbeddedAssets
+)
 {
 	Assimp::Importer import;
 
@@ -976,17 +1063,17 @@ bool OvRendering::Resources::Parsers::AssimpParser::LoadModel(
 		return false;
 	}
 
-	p_materials.clear();
-	p_embeddedMaterials.clear();
-	p_embeddedTextures.clear();
+	p_data = {};
+	auto& p_skeleton = p_data.skeleton;
+	auto& p_animations = p_data.animations;
 
 	const auto modelDirectory = std::filesystem::path{ p_fileName }.parent_path();
 	ProcessMaterials(
 		scene,
 		modelDirectory,
-		p_materials,
-		p_embeddedMaterials,
-		p_embeddedTextures,
+		p_data.materialNames,
+		p_data.embeddedMaterials,
+		p_data.embeddedTextures,
 		p_generateEmbeddedAssets
 	);
 
@@ -997,8 +1084,6 @@ bool OvRendering::Resources::Parsers::AssimpParser::LoadModel(
 	}
 	const bool hasAnimations = scene->mNumAnimations > 0;
 
-	p_skeleton.reset();
-	p_animations.clear();
 	std::unordered_map<const aiNode*, uint32_t> nodeIndexByPointer;
 
 	if (hasBones || hasAnimations)
@@ -1008,14 +1093,33 @@ bool OvRendering::Resources::Parsers::AssimpParser::LoadModel(
 		AddSkeletonNodeRecursive(p_skeleton.value(), scene->mRootNode, -1, &nodeIndexByPointer);
 	}
 
-	ProcessNode(
-		aiMatrix4x4{},
-		scene->mRootNode,
-		scene,
-		p_meshes,
-		p_skeleton ? &p_skeleton.value() : nullptr,
-		p_skeleton ? &nodeIndexByPointer : nullptr
-	);
+	std::vector<MeshInstance> meshInstances;
+	CollectMeshInstances(aiMatrix4x4{}, scene->mRootNode, scene, meshInstances);
+
+	// The geometry of the meshes is processed in parallel, then their bones are registered in the scene order,
+	// so that the skeleton and the mesh order are the same as with a serial import
+	std::vector<std::optional<MeshData>> meshes(meshInstances.size());
+
+	OvTools::Utils::ParallelFor(meshInstances.size(), [&](size_t p_index)
+	{
+		const auto& instance = meshInstances[p_index];
+		meshes[p_index] = ProcessMesh(instance.transform, instance.mesh, p_skeleton && instance.mesh->HasBones());
+	});
+
+	for (size_t i = 0; i < meshes.size(); ++i)
+	{
+		if (!meshes[i])
+		{
+			continue;
+		}
+
+		if (meshes[i]->IsSkinned())
+		{
+			ProcessBones(meshInstances[i].transform, meshInstances[i].mesh, meshes[i].value(), p_skeleton.value(), &nodeIndexByPointer);
+		}
+
+		p_data.meshes.push_back(std::move(meshes[i].value()));
+	}
 
 	if (hasAnimations && p_skeleton.has_value())
 	{
@@ -1030,3 +1134,40 @@ bool OvRendering::Resources::Parsers::AssimpParser::LoadModel(
 
 	return true;
 }
+
+bool OvRendering::Resources::Parsers::AssimpParser::LoadCollisionGeometry(
+	const std::string& p_fileName,
+	std::vector<OvMaths::FVector3>& p_positions,
+	std::vector<uint32_t>& p_indices,
+	EModelParserFlags p_parserFlags
+)
+{
+	Assimp::Importer import;
+
+	// Only positions matter for collisions, skip the expensive attribute generation steps
+	p_parserFlags = FixFlags(p_parserFlags);
+	p_parserFlags &= ~(
+		EModelParserFlags::CALC_TANGENT_SPACE |
+		EModelParserFlags::GEN_NORMALS |
+		EModelParserFlags::GEN_SMOOTH_NORMALS |
+		EModelParserFlags::GEN_UV_COORDS |
+		EModelParserFlags::TRANSFORM_UV_COORDS |
+		EModelParserFlags::LIMIT_BONE_WEIGHTS |
+		EModelParserFlags::EMBED_TEXTURES
+	);
+	p_parserFlags |= EModelParserFlags::TRIANGULATE;
+
+	const aiScene* scene = import.ReadFile(p_fileName, static_cast<uint32_t>(p_parserFlags));
+
+	if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode)
+	{
+		return false;
+	}
+
+	p_positions.clear();
+	p_indices.clear();
+
+	ProcessCollisionNode(aiMatrix4x4{}, scene->mRootNode, scene, p_positions, p_indices);
+
+	return !p_indices.empty();
+}
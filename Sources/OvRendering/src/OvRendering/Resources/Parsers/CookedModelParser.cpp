@@ -0,0 +1,872 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+#include <OvDebug/Logger.h>
+#include <OvRendering/Resources/Parsers/CookedModelParser.h>
+#include <OvRendering/Settings/LODSettings.h>
+#include <OvTools/Filesystem/MappedFile.h>
+
+namespace
+{
+	constexpr std::array<char, 4> kMagic = { 'O', 'V', 'M', 'S' };
+
+	// Bump whenever the layout of the cooked file changes
+	constexpr uint32_t kFormatVersion = 2;
+
+	// Vertex and index buffers are aligned so they can be uploaded straight from the mapped file
+	constexpr uint64_t kDataAlignment = 16;
+
+	/**
+	* Vertex layouts are stored as-is, so their sizes and the endianness are part of the header
+	*/
+	struct FileHeader
+	{
+		std::array<char, 4> magic = kMagic;
+		uint32_t formatVersion = kFormatVersion;
+		uint32_t vertexSize = sizeof(OvRendering::Geometry::Vertex);
+		uint32_t skinnedVertexSize = sizeof(OvRendering::Geometry::SkinnedVertex);
+		uint32_t isBigEndian = std::endian::native == std::endian::big ? 1 : 0;
+		uint32_t meshCount = 0;
+		OvRendering::Resources::Parsers::CookedModelStamp stamp;
+		uint64_t metadataOffset = 0;
+		uint64_t metadataSize = 0;
+	};
+
+	struct LODEntry
+	{
+		uint32_t indexCount = 0;
+		float screenSize = 0.0f;
+		uint64_t indexOffset = 0;
+	};
+
+	struct MeshEntry
+	{
+		uint32_t materialIndex = 0;
+		uint32_t isSkinned = 0;
+		uint32_t vertexCount = 0;
+		uint32_t indexCount = 0;
+		float boundingSphere[4] = {}; // Position + radius
+		uint64_t vertexOffset = 0;
+		uint64_t indexOffset = 0;
+		uint32_t lodCount = 0;
+		uint32_t padding = 0;
+		LODEntry lods[OvRendering::Settings::LODSettings::kMaxLevelCount] = {}; // Their indices reference the mesh vertices
+	};
+
+	class BlobWriter
+	{
+	public:
+		template<typename T>
+		void Write(const T& p_value)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			WriteBytes(&p_value, sizeof(T));
+		}
+
+		void WriteBytes(const void* p_data, size_t p_size)
+		{
+			const auto* bytes = static_cast<const uint8_t*>(p_data);
+			m_bytes.insert(m_bytes.end(), bytes, bytes + p_size);
+		}
+
+		void WriteString(const std::string& p_value)
+		{
+			Write(static_cast<uint32_t>(p_value.size()));
+			WriteBytes(p_value.data(), p_value.size());
+		}
+
+		void WriteByteArray(const std::vector<uint8_t>& p_value)
+		{
+			Write(static_cast<uint64_t>(p_value.size()));
+			WriteBytes(p_value.data(), p_value.size());
+		}
+
+		void WriteVector3(const OvMaths::FVector3& p_value)
+		{
+			Write(p_value.x); Write(p_value.y); Write(p_value.z);
+		}
+
+		void WriteVector4(const OvMaths::FVector4& p_value)
+		{
+			Write(p_value.x); Write(p_value.y); Write(p_value.z); Write(p_value.w);
+		}
+
+		void WriteQuaternion(const OvMaths::FQuaternion& p_value)
+		{
+			Write(p_value.x); Write(p_value.y); Write(p_value.z); Write(p_value.w);
+		}
+
+		void WriteMatrix4(const OvMaths::FMatrix4& p_value)
+		{
+			WriteBytes(p_value.data, sizeof(p_value.data));
+		}
+
+		void WriteOptionalIndex(const std::optional<uint32_t>& p_value)
+		{
+			Write(static_cast<uint8_t>(p_value.has_value()));
+			Write(p_value.value_or(0));
+		}
+
+		void Align(uint64_t p_alignment)
+		{
+			m_bytes.resize((m_bytes.size() + p_alignment - 1) / p_alignment * p_alignment, 0);
+		}
+
+		template<typename T>
+		void Patch(size_t p_offset, const T& p_value)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			std::memcpy(m_bytes.data() + p_offset, &p_value, sizeof(T));
+		}
+
+		size_t GetSize() const
+		{
+			return m_bytes.size();
+		}
+
+		const std::vector<uint8_t>& GetBytes() const
+		{
+			return m_bytes;
+		}
+
+	private:
+		std::vector<uint8_t> m_bytes;
+	};
+
+	/**
+	* Bounds-checked reader, any out of range read invalidates the reader and returns zeroed values
+	*/
+	class BlobReader
+	{
+	public:
+		BlobReader(std::span<const uint8_t> p_data) : m_data(p_data) {}
+
+		template<typename T>
+		T Read()
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			T result{};
+			ReadBytes(&result, sizeof(T));
+			return result;
+		}
+
+		void ReadBytes(void* p_destination, size_t p_size)
+		{
+			if (!m_valid || p_size > m_data.size() - m_cursor)
+			{
+				m_valid = false;
+				return;
+			}
+
+			std::memcpy(p_destination, m_data.data() + m_cursor, p_size);
+			m_cursor += p_size;
+		}
+
+		/**
+		* Read an element count, rejecting counts that can't fit in the remaining bytes
+		* @param p_minElementSize
+		*/
+		uint64_t ReadCount(size_t p_minElementSize)
+		{
+			const uint64_t count = Read<uint64_t>();
+
+			if (p_minElementSize > 0 && count > (m_data.size() - m_cursor) / p_minElementSize)
+			{
+				m_valid = false;
+				return 0;
+			}
+
+			return count;
+		}
+
+		std::string ReadString()
+		{
+			const uint32_t size = Read<uint32_t>();
+			std::string result;
+
+			if (m_valid && size <= m_data.size() - m_cursor)
+			{
+				result.resize(size);
+				ReadBytes(result.data(), size);
+			}
+			else
+			{
+				m_valid = false;
+			}
+
+			return result;
+		}
+
+		std::vector<uint8_t> ReadByteArray()
+		{
+			std::vector<uint8_t> result(ReadCount(1));
+			ReadBytes(result.data(), result.size());
+			return result;
+		}
+
+		OvMaths::FVector3 ReadVector3()
+		{
+			const float x = Read<float>(), y = Read<float>(), z = Read<float>();
+			return { x, y, z };
+		}
+
+		OvMaths::FVector4 ReadVector4()
+		{
+			const float x = Read<float>(), y = Read<float>(), z = Read<float>(), w = Read<float>();
+			return { x, y, z, w };
+		}
+
+		OvMaths::FQuaternion ReadQuaternion()
+		{
+			const float x = Read<float>(), y = Read<float>(), z = Read<float>(), w = Read<float>();
+			return { x, y, z, w };
+		}
+
+		OvMaths::FMatrix4 ReadMatrix4()
+		{
+			OvMaths::FMatrix4 result;
+			ReadBytes(result.data, sizeof(result.data));
+			return result;
+		}
+
+		std::optional<uint32_t> ReadOptionalIndex()
+		{
+			const bool hasValue = Read<uint8_t>() != 0;
+			const uint32_t value = Read<uint32_t>();
+			return hasValue ? std::optional<uint32_t>{ value } : std::nullopt;
+		}
+
+		bool IsValid() const
+		{
+			return m_valid;
+		}
+
+	private:
+		std::span<const uint8_t> m_data;
+		size_t m_cursor = 0;
+		bool m_valid = true;
+	};
+
+	template<typename T>
+	void WriteKeys(BlobWriter& p_writer, const std::vector<OvRendering::Animation::Keyframe<T>>& p_keys)
+	{
+		p_writer.Write(static_cast<uint64_t>(p_keys.size()));
+
+		for (const auto& key : p_keys)
+		{
+			p_writer.Write(key.time);
+
+			if constexpr (std::is_same_v<T, OvMaths::FQuaternion>)
+				p_writer.WriteQuaternion(key.value);
+			else
+				p_writer.WriteVector3(key.value);
+		}
+	}
+
+	template<typename T>
+	void ReadKeys(BlobReader& p_reader, std::vector<OvRendering::Animation::Keyframe<T>>& p_keys)
+	{
+		p_keys.resize(p_reader.ReadCount(sizeof(float) * 4));
+
+		for (auto& key : p_keys)
+		{
+			key.time = p_reader.Read<float>();
+
+			if constexpr (std::is_same_v<T, OvMaths::FQuaternion>)
+				key.value = p_reader.ReadQuaternion();
+			else
+				key.value = p_reader.ReadVector3();
+		}
+	}
+
+	void WriteMetadata(BlobWriter& p_writer, const OvRendering::Resources::Parsers::ModelData& p_data)
+	{
+		p_writer.Write(static_cast<uint64_t>(p_data.materialNames.size()));
+		for (const auto& name : p_data.materialNames)
+		{
+			p_writer.WriteString(name);
+		}
+
+		p_writer.Write(static_cast<uint8_t>(p_data.skeleton.has_value()));
+		if (const auto& skeleton = p_data.skeleton)
+		{
+			p_writer.Write(static_cast<uint64_t>(skeleton->nodes.size()));
+			for (const auto& node : skeleton->nodes)
+			{
+				p_writer.WriteString(node.name);
+				p_writer.Write(node.parentIndex);
+				p_writer.Write(node.boneIndex);
+				p_writer.WriteMatrix4(node.localBindTransform);
+				p_writer.WriteVector3(node.bindPosition);
+				p_writer.WriteQuaternion(node.bindRotation);
+				p_writer.WriteVector3(node.bindScale);
+			}
+
+			p_writer.Write(static_cast<uint64_t>(skeleton->bones.size()));
+			for (const auto& bone : skeleton->bones)
+			{
+				p_writer.WriteString(bone.name);
+				p_writer.Write(bone.nodeIndex);
+				p_writer.WriteMatrix4(bone.offsetMatrix);
+			}
+
+			for (const auto* map : { &skeleton->nodeByName, &skeleton->boneByName })
+			{
+				p_writer.Write(static_cast<uint64_t>(map->size()));
+				for (const auto& [name, index] : *map)
+				{
+					p_writer.WriteString(name);
+					p_writer.Write(index);
+				}
+			}
+		}
+
+		p_writer.Write(static_cast<uint64_t>(p_data.animations.size()));
+		for (const auto& animation : p_data.animations)
+		{
+			p_writer.WriteString(animation.name);
+			p_writer.Write(animation.duration);
+			p_writer.Write(animation.ticksPerSecond);
+
+			p_writer.Write(static_cast<uint64_t>(animation.tracks.size()));
+			for (const auto& track : animation.tracks)
+			{
+				p_writer.Write(track.nodeIndex);
+				WriteKeys(p_writer, track.positionKeys);
+				WriteKeys(p_writer, track.rotationKeys);
+				WriteKeys(p_writer, track.scaleKeys);
+			}
+
+			p_writer.Write(static_cast<uint64_t>(animation.trackByNodeIndex.size()));
+			for (const auto& [nodeIndex, trackIndex] : animation.trackByNodeIndex)
+			{
+				p_writer.Write(nodeIndex);
+				p_writer.Write(trackIndex);
+			}
+		}
+
+		p_writer.Write(static_cast<uint64_t>(p_data.embeddedMaterials.size()));
+		for (const auto& material : p_data.embeddedMaterials)
+		{
+			p_writer.WriteString(material.name);
+			p_writer.WriteVector4(material.albedo);
+			p_writer.Write(material.metallic);
+			p_writer.Write(material.roughness);
+			p_writer.WriteVector3(material.emissiveColor);
+			p_writer.Write(material.emissiveIntensity);
+			p_writer.WriteOptionalIndex(material.albedoTexture);
+			p_writer.WriteOptionalIndex(material.metallicTexture);
+			p_writer.WriteOptionalIndex(material.roughnessTexture);
+			p_writer.WriteOptionalIndex(material.ambientOcclusionTexture);
+			p_writer.WriteOptionalIndex(material.normalTexture);
+			p_writer.WriteOptionalIndex(material.heightTexture);
+			p_writer.WriteOptionalIndex(material.emissiveTexture);
+			p_writer.WriteOptionalIndex(material.opacityTexture);
+		}
+
+		p_writer.Write(static_cast<uint64_t>(p_data.embeddedTextures.size()));
+		for (const auto& texture : p_data.embeddedTextures)
+		{
+			p_writer.Write(static_cast<uint32_t>(texture.sourceType));
+			p_writer.WriteString(texture.sourcePath);
+			p_writer.WriteString(texture.extension);
+			p_writer.WriteByteArray(texture.compressedData);
+			p_writer.WriteByteArray(texture.rawRGBAData);
+			p_writer.Write(texture.width);
+			p_writer.Write(texture.height);
+		}
+	}
+
+	bool ReadMetadata(BlobReader& p_reader, OvRendering::Resources::Parsers::ModelData& p_data)
+	{
+		p_data.materialNames.resize(p_reader.ReadCount(sizeof(uint32_t)));
+		for (auto& name : p_data.materialNames)
+		{
+			name = p_reader.ReadString();
+		}
+
+		if (p_reader.Read<uint8_t>() != 0)
+		{
+			auto& skeleton = p_data.skeleton.emplace();
+
+			skeleton.nodes.resize(p_reader.ReadCount(sizeof(uint32_t)));
+			for (auto& node : skeleton.nodes)
+			{
+				node.name = p_reader.ReadString();
+				node.parentIndex = p_reader.Read<int32_t>();
+				node.boneIndex = p_reader.Read<int32_t>();
+				node.localBindTransform = p_reader.ReadMatrix4();
+				node.bindPosition = p_reader.ReadVector3();
+				node.bindRotation = p_reader.ReadQuaternion();
+				node.bindScale = p_reader.ReadVector3();
+			}
+
+			skeleton.bones.resize(p_reader.ReadCount(sizeof(uint32_t)));
+			for (auto& bone : skeleton.bones)
+			{
+				bone.name = p_reader.ReadString();
+				bone.nodeIndex = p_reader.Read<uint32_t>();
+				bone.offsetMatrix = p_reader.ReadMatrix4();
+			}
+
+			for (auto* map : { &skeleton.nodeByName, &skeleton.boneByName })
+			{
+				const uint64_t count = p_reader.ReadCount(sizeof(uint32_t) * 2);
+				map->reserve(count);
+
+				for (uint64_t i = 0; i < count && p_reader.IsValid(); ++i)
+				{
+					std::string name = p_reader.ReadString();
+					(*map)[std::move(name)] = p_reader.Read<uint32_t>();
+				}
+			}
+
+			// Nodes are stored parents first, the pose is computed in that order and hierarchies are walked up to the root
+			for (size_t i = 0; i < skeleton.nodes.size(); ++i)
+			{
+				const auto& node = skeleton.nodes[i];
+
+				if (node.parentIndex < -1 || node.parentIndex >= static_cast<int64_t>(i) ||
+					node.boneIndex < -1 || node.boneIndex >= static_cast<int64_t>(skeleton.bones.size()))
+					return false;
+			}
+
+			const auto isNodeIndexValid = [&skeleton](uint32_t p_index) { return p_index < skeleton.nodes.size(); };
+			const auto isBoneIndexValid = [&skeleton](uint32_t p_index) { return p_index < skeleton.bones.size(); };
+
+			if (!std::ranges::all_of(skeleton.bones, isNodeIndexValid, &OvRendering::Animation::Bone::nodeIndex) ||
+				!std::ranges::all_of(skeleton.nodeByName | std::views::values, isNodeIndexValid) ||
+				!std::ranges::all_of(skeleton.boneByName | std::views::values, isBoneIndexValid))
+				return false;
+		}
+
+		p_data.animations.resize(p_reader.ReadCount(sizeof(uint32_t)));
+		for (auto& animation : p_data.animations)
+		{
+			animation.name = p_reader.ReadString();
+			animation.duration = p_reader.Read<float>();
+			animation.ticksPerSecond = p_reader.Read<float>();
+
+			animation.tracks.resize(p_reader.ReadCount(sizeof(uint32_t)));
+			for (auto& track : animation.tracks)
+			{
+				track.nodeIndex = p_reader.Read<uint32_t>();
+				ReadKeys(p_reader, track.positionKeys);
+				ReadKeys(p_reader, track.rotationKeys);
+				ReadKeys(p_reader, track.scaleKeys);
+			}
+
+			const uint64_t trackCount = p_reader.ReadCount(sizeof(uint32_t) * 2);
+			animation.trackByNodeIndex.reserve(trackCount);
+			for (uint64_t i = 0; i < trackCount && p_reader.IsValid(); ++i)
+			{
+				const uint32_t nodeIndex = p_reader.Read<uint32_t>();
+				const uint32_t trackIndex = p_reader.Read<uint32_t>();
+
+				if (trackIndex >= animation.tracks.size())
+					return false;
+
+				animation.trackByNodeIndex[nodeIndex] = trackIndex;
+			}
+		}
+
+		p_data.embeddedMaterials.resize(p_reader.ReadCount(sizeof(uint32_t)));
+		for (auto& material : p_data.embeddedMaterials)
+		{
+			material.name = p_reader.ReadString();
+			material.albedo = p_reader.ReadVector4();
+			material.metallic = p_reader.Read<float>();
+			material.roughness = p_reader.Read<float>();
+			material.emissiveColor = p_reader.ReadVector3();
+			material.emissiveIntensity = p_reader.Read<float>();
+			material.albedoTexture = p_reader.ReadOptionalIndex();
+			material.metallicTexture = p_reader.ReadOptionalIndex();
+			material.roughnessTexture = p_reader.ReadOptionalIndex();
+			material.ambientOcclusionTexture = p_reader.ReadOptionalIndex();
+			material.normalTexture = p_reader.ReadOptionalIndex();
+			material.heightTexture = p_reader.ReadOptionalIndex();
+			material.emissiveTexture = p_reader.ReadOptionalIndex();
+			material.opacityTexture = p_reader.ReadOptionalIndex();
+		}
+
+		p_data.embeddedTextures.resize(p_reader.ReadCount(sizeof(uint32_t)));
+		for (auto& texture : p_data.embeddedTextures)
+		{
+			const uint32_t sourceType = p_reader.Read<uint32_t>();
+
+			if (sourceType > static_cast<uint32_t>(OvRendering::Resources::EmbeddedTextureData::ESourceType::EMBEDDED_RAW_RGBA8))
+				return false;
+
+			texture.sourceType = static_cast<OvRendering::Resources::EmbeddedTextureData::ESourceType>(sourceType);
+			texture.sourcePath = p_reader.ReadString();
+			texture.extension = p_reader.ReadString();
+			texture.compressedData = p_reader.ReadByteArray();
+			texture.rawRGBAData = p_reader.ReadByteArray();
+			texture.width = p_reader.Read<uint32_t>();
+			texture.height = p_reader.Read<uint32_t>();
+		}
+
+		return p_reader.IsValid();
+	}
+
+	bool IsHeaderCompatible(const FileHeader& p_header)
+	{
+		const FileHeader expected;
+
+		return
+			p_header.magic == expected.magic &&
+			p_header.formatVersion == expected.formatVersion &&
+			p_header.vertexSize == expected.vertexSize &&
+			p_header.skinnedVertexSize == expected.skinnedVertexSize &&
+			p_header.isBigEndian == expected.isBigEndian;
+	}
+
+	template<typename TVertex>
+	std::span<const TVertex> GetVertices(std::span<const uint8_t> p_file, const MeshEntry& p_entry)
+	{
+		if (p_entry.vertexOffset % alignof(TVertex) != 0 ||
+			p_entry.vertexOffset > p_file.size() ||
+			p_entry.vertexCount > (p_file.size() - p_entry.vertexOffset) / sizeof(TVertex))
+		{
+			return {};
+		}
+
+		return { reinterpret_cast<const TVertex*>(p_file.data() + p_entry.vertexOffset), p_entry.vertexCount };
+	}
+
+	template<typename TEntry>
+	std::span<const uint32_t> GetIndices(std::span<const uint8_t> p_file, const TEntry& p_entry)
+	{
+		if (p_entry.indexOffset % alignof(uint32_t) != 0 ||
+			p_entry.indexOffset > p_file.size() ||
+			p_entry.indexCount > (p_file.size() - p_entry.indexOffset) / sizeof(uint32_t))
+		{
+			return {};
+		}
+
+		return { reinterpret_cast<const uint32_t*>(p_file.data() + p_entry.indexOffset), p_entry.indexCount };
+	}
+
+	std::span<const LODEntry> GetLODs(const MeshEntry& p_entry)
+	{
+		return std::span(p_entry.lods).first(std::min<size_t>(p_entry.lodCount, std::size(p_entry.lods)));
+	}
+
+	OvRendering::Geometry::BoundingSphere GetBoundingSphere(const MeshEntry& p_entry)
+	{
+		return {
+			{ p_entry.boundingSphere[0], p_entry.boundingSphere[1], p_entry.boundingSphere[2] },
+			p_entry.boundingSphere[3]
+		};
+	}
+
+	/**
+	* Read and validate everything but the vertex/index buffers, which stay in the mapped file
+	*/
+	bool ReadCookedModel(
+		const OvTools::Filesystem::MappedFile& p_file,
+		const std::filesystem::path& p_cookedPath,
+		const std::filesystem::path& p_sourcePath,
+		uint64_t p_settingsHash,
+		std::vector<MeshEntry>& p_entries,
+		OvRendering::Resources::Parsers::ModelData& p_data
+	)
+	{
+		if (!p_file.IsValid())
+			return false;
+
+		const auto bytes = p_file.GetData();
+		BlobReader reader(bytes);
+		const auto header = reader.Read<FileHeader>();
+
+		if (!reader.IsValid() || !IsHeaderCompatible(header) || !OvTools::Filesystem::IsCookedAssetUpToDate(header.stamp, p_sourcePath, p_settingsHash))
+			return false;
+
+		p_entries.resize(header.meshCount <= bytes.size() / sizeof(MeshEntry) ? header.meshCount : 0);
+		for (auto& entry : p_entries)
+		{
+			entry = reader.Read<MeshEntry>();
+		}
+
+		const bool validMetadataRange =
+			header.metadataOffset <= bytes.size() &&
+			header.metadataSize <= bytes.size() - header.metadataOffset;
+
+		BlobReader metadataReader(validMetadataRange ? bytes.subspan(header.metadataOffset, header.metadataSize) : std::span<const uint8_t>{});
+
+		if (!validMetadataRange || !reader.IsValid() || p_entries.size() != header.meshCount || !ReadMetadata(metadataReader, p_data))
+		{
+			OVLOG_WARNING("CookedModelParser: \"" + p_cookedPath.string() + "\" is corrupted");
+			return false;
+		}
+
+		// Every range is validated before using anything, so a corrupted file never creates partial models
+		for (const auto& entry : p_entries)
+		{
+			const size_t vertexCount = entry.isSkinned ?
+				GetVertices<OvRendering::Geometry::SkinnedVertex>(bytes, entry).size() :
+				GetVertices<OvRendering::Geometry::Vertex>(bytes, entry).size();
+
+			// An index outside of the vertices would make the GPU read out of the vertex buffer
+			const auto areIndicesValid = [vertexCount](std::span<const uint32_t> p_indices, uint32_t p_expectedCount)
+			{
+				return
+					p_indices.size() == p_expectedCount &&
+					std::ranges::all_of(p_indices, [vertexCount](uint32_t p_index) { return p_index < vertexCount; });
+			};
+
+			const bool validLODs =
+				entry.lodCount <= std::size(entry.lods) &&
+				std::ranges::all_of(GetLODs(entry), [&bytes, &areIndicesValid](const LODEntry& p_lod) { return areIndicesValid(GetIndices(bytes, p_lod), p_lod.indexCount); });
+
+			// A bone ID outside of the skeleton would make skinning read and write out of the bone matrices
+			const size_t boneCount = p_data.skeleton ? p_data.skeleton->bones.size() : 0;
+			const bool validBoneIDs = !entry.isSkinned || std::ranges::all_of(GetVertices<OvRendering::Geometry::SkinnedVertex>(bytes, entry), [boneCount](const OvRendering::Geometry::SkinnedVertex& p_vertex)
+			{
+				for (uint8_t i = 0; i < OvRendering::Animation::kMaxBonesPerVertex; ++i)
+				{
+					// Unused influences keep their default ID
+					if (p_vertex.boneIDs[i] >= boneCount && (p_vertex.boneWeights[i] != 0.0f || p_vertex.boneIDs[i] != 0))
+						return false;
+				}
+
+				return true;
+			});
+
+			if (entry.vertexCount == 0 || vertexCount != entry.vertexCount || !areIndicesValid(GetIndices(bytes, entry), entry.indexCount) || !validLODs || !validBoneIDs)
+			{
+				OVLOG_WARNING("CookedModelParser: \"" + p_cookedPath.string() + "\" is corrupted");
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
+
+OvRendering::Resources::Parsers::CookedModelStamp OvRendering::Resources::Parsers::CookedModelParser::ComputeStamp(const std::filesystem::path& p_sourcePath, uint64_t p_settingsHash)
+{
+	return OvTools::Filesystem::ComputeCookedAssetStamp(p_sourcePath, p_settingsHash);
+}
+
+bool OvRendering::Resources::Parsers::CookedModelParser::IsUpToDate(const std::filesystem::path& p_cookedPath, const std::filesystem::path& p_sourcePath, uint64_t p_settingsHash)
+{
+	std::ifstream stream(p_cookedPath, std::ios::binary);
+	FileHeader header;
+
+	return
+		stream &&
+		stream.read(reinterpret_cast<char*>(&header), sizeof(FileHeader)) &&
+		IsHeaderCompatible(header) &&
+		OvTools::Filesystem::IsCookedAssetUpToDate(header.stamp, p_sourcePath, p_settingsHash);
+}
+
+bool OvRendering::Resources::Parsers::CookedModelParser::Save(const std::filesystem::path& p_cookedPath, const CookedModelStamp& p_stamp, const ModelData& p_data)
+{
+	BlobWriter writer;
+
+	FileHeader header;
+	header.meshCount = static_cast<uint32_t>(p_data.meshes.size());
+	header.stamp = p_stamp;
+	writer.Write(header);
+
+	const size_t entriesOffset = writer.GetSize();
+	std::vector<MeshEntry> entries(p_data.meshes.size());
+	for (const auto& entry : entries)
+	{
+		writer.Write(entry);
+	}
+
+	for (size_t i = 0; i < p_data.meshes.size(); ++i)
+	{
+		const auto& mesh = p_data.meshes[i];
+		auto& entry = entries[i];
+
+		const auto sphere = mesh.boundingSphere ? mesh.boundingSphere.value() : mesh.IsSkinned() ?
+			Mesh::ComputeBoundingSphere(mesh.skinnedVertices) :
+			Mesh::ComputeBoundingSphere(mesh.vertices);
+
+		entry.materialIndex = mesh.materialIndex;
+		entry.isSkinned = mesh.IsSkinned() ? 1 : 0;
+		entry.vertexCount = static_cast<uint32_t>(mesh.IsSkinned() ? mesh.skinnedVertices.size() : mesh.vertices.size());
+		entry.indexCount = static_cast<uint32_t>(mesh.indices.size());
+		entry.boundingSphere[0] = sphere.position.x;
+		entry.boundingSphere[1] = sphere.position.y;
+		entry.boundingSphere[2] = sphere.position.z;
+		entry.boundingSphere[3] = sphere.radius;
+
+		writer.Align(kDataAlignment);
+		entry.vertexOffset = writer.GetSize();
+		if (mesh.IsSkinned())
+			writer.WriteBytes(mesh.skinnedVertices.data(), mesh.skinnedVertices.size() * sizeof(Geometry::SkinnedVertex));
+		else
+			writer.WriteBytes(mesh.vertices.data(), mesh.vertices.size() * sizeof(Geometry::Vertex));
+
+		writer.Align(kDataAlignment);
+		entry.indexOffset = writer.GetSize();
+		writer.WriteBytes(mesh.indices.data(), mesh.indices.size() * sizeof(uint32_t));
+
+		entry.lodCount = static_cast<uint32_t>(std::min(mesh.lods.size(), std::size(entry.lods)));
+
+		for (uint32_t level = 0; level < entry.lodCount; ++level)
+		{
+			const auto& lod = mesh.lods[level];
+			auto& lodEntry = entry.lods[level];
+
+			lodEntry.indexCount = static_cast<uint32_t>(lod.indices.size());
+			lodEntry.screenSize = lod.screenSize;
+
+			writer.Align(kDataAlignment);
+			lodEntry.indexOffset = writer.GetSize();
+			writer.WriteBytes(lod.indices.data(), lod.indices.size() * sizeof(uint32_t));
+		}
+	}
+
+	for (size_t i = 0; i < entries.size(); ++i)
+	{
+		writer.Patch(entriesOffset + i * sizeof(MeshEntry), entries[i]);
+	}
+
+	header.metadataOffset = writer.GetSize();
+	WriteMetadata(writer, p_data);
+	header.metadataSize = writer.GetSize() - header.metadataOffset;
+	writer.Patch(0, header);
+
+	// Written next to the destination then renamed, so that a failed write never leaves a truncated cooked file
+	auto temporaryPath = p_cookedPath;
+	temporaryPath += ".tmp";
+
+	{
+		std::ofstream stream(temporaryPath, std::ios::binary | std::ios::trunc);
+		const auto& bytes = writer.GetBytes();
+
+		if (!stream || !stream.write(reinterpret_cast<const char*>(bytes.data()), bytes.size()))
+		{
+			OVLOG_WARNING("CookedModelParser: Unable to write \"" + temporaryPath.string() + "\"");
+			return false;
+		}
+	}
+
+	std::error_code error;
+	std::filesystem::rename(temporaryPath, p_cookedPath, error);
+
+	if (error)
+	{
+		OVLOG_WARNING("CookedModelParser: Unable to write \"" + p_cookedPath.string() + "\": " + error.message());
+		std::filesystem::remove(temporaryPath, error);
+		return false;
+	}
+
+	return true;
+}
+
+bool OvRendering::Resources::Parsers::CookedModelParser::LoadModel(
+	const std::filesystem::path& p_cookedPath,
+	const std::filesystem::path& p_sourcePath,
+	uint64_t p_settingsHash,
+	std::vector<Mesh*>& p_meshes,
+	std::vector<std::string>& p_materials,
+	std::optional<Animation::Skeleton>& p_skeleton,
+	std::vector<Animation::SkeletalAnimation>& p_animations,
+	std::vector<EmbeddedMaterialData>& p_embeddedMaterials,
+	std::vector<EmbeddedTextureData>& p_embeddedTextures,
+	Settings::EVertexFormat p_vertexFormat
+)
+{
+	const OvTools::Filesystem::MappedFile file(p_cookedPath);
+	std::vector<MeshEntry> entries;
+	ModelData data;
+
+	if (!ReadCookedModel(file, p_cookedPath, p_sourcePath, p_settingsHash, entries, data))
+		return false;
+
+	const auto bytes = file.GetData();
+	p_meshes.reserve(entries.size());
+
+	std::vector<Mesh::LODDescriptor> lods;
+
+	for (const auto& entry : entries)
+	{
+		lods.clear();
+
+		for (const auto& lod : GetLODs(entry))
+		{
+			lods.push_back({ GetIndices(bytes, lod), lod.screenSize });
+		}
+
+		// The model will handle mesh destruction
+		p_meshes.push_back(entry.isSkinned ?
+			new Mesh(GetVertices<Geometry::SkinnedVertex>(bytes, entry), GetIndices(bytes, entry), entry.materialIndex, GetBoundingSphere(entry), p_vertexFormat, lods) :
+			new Mesh(GetVertices<Geometry::Vertex>(bytes, entry), GetIndices(bytes, entry), entry.materialIndex, GetBoundingSphere(entry), p_vertexFormat, lods)
+		);
+	}
+
+	p_materials = std::move(data.materialNames);
+	p_skeleton = std::move(data.skeleton);
+	p_animations = std::move(data.animations);
+	p_embeddedMaterials = std::move(data.embeddedMaterials);
+	p_embeddedTextures = std::move(data.embeddedTextures);
+
+	return true;
+}
+
+bool OvRendering::Resources::Parsers::CookedModelParser::LoadModelData(
+	const std::filesystem::path& p_cookedPath,
+	const std::filesystem::path& p_sourcePath,
+	uint64_t p_settingsHash,
+	ModelData& p_data
+)
+{
+	const OvTools::Filesystem::MappedFile file(p_cookedPath);
+	std::vector<MeshEntry> entries;
+	ModelData data;
+
+	if (!ReadCookedModel(file, p_cookedPath, p_sourcePath, p_settingsHash, entries, data))
+		return false;
+
+	const auto bytes = file.GetData();
+	data.meshes.resize(entries.size());
+
+	for (size_t i = 0; i < entries.size(); ++i)
+	{
+		const auto& entry = entries[i];
+		auto& mesh = data.meshes[i];
+
+		if (entry.isSkinned)
+		{
+			const auto vertices = GetVertices<Geometry::SkinnedVertex>(bytes, entry);
+			mesh.skinnedVertices.assign(vertices.begin(), vertices.end());
+		}
+		else
+		{
+			const auto vertices = GetVertices<Geometry::Vertex>(bytes, entry);
+			mesh.vertices.assign(vertices.begin(), vertices.end());
+		}
+
+		const auto indices = GetIndices(bytes, entry);
+		mesh.indices.assign(indices.begin(), indices.end());
+		mesh.materialIndex = entry.materialIndex;
+		mesh.boundingSphere = GetBoundingSphere(entry);
+
+		for (const auto& lod : GetLODs(entry))
+		{
+			const auto lodIndices = GetIndices(bytes, lod);
+			mesh.lods.push_back({ .indices = { lodIndices.begin(), lodIndices.end() }, .screenSize = lod.screenSize });
+		}
+	}
+
+	p_data = std::move(data);
+	return true;
+}
@@ -0,0 +1,260 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <fstream>
+
+#include <OvDebug/Logger.h>
+#include <OvRendering/Resources/Parsers/CookedTextureParser.h>
+#include <OvRendering/Utils/TextureCompression.h>
+#include <OvTools/Filesystem/MappedFile.h>
+
+namespace
+{
+	constexpr std::array<char, 4> kMagic = { 'O', 'V', 'T', 'X' };
+
+	// Bump whenever the layout of the cooked file or the encoders output changes
+	constexpr uint32_t kFormatVersion = 1;
+
+	// Levels are aligned so they can be copied with wide loads
+	constexpr uint64_t kDataAlignment = 16;
+
+	constexpr uint32_t kMaxLevelCount = 32;
+
+	struct FileHeader
+	{
+		std::array<char, 4> magic = kMagic;
+		uint32_t formatVersion = kFormatVersion;
+		uint32_t isBigEndian = std::endian::native == std::endian::big ? 1 : 0;
+		uint32_t compression = 0;
+		uint32_t width = 0;
+		uint32_t height = 0;
+		uint32_t levelCount = 0;
+		uint32_t reserved = 0;
+		OvTools::Filesystem::CookedAssetStamp stamp;
+	};
+
+	struct LevelEntry
+	{
+		uint32_t width = 0;
+		uint32_t height = 0;
+		uint64_t offset = 0;
+		uint64_t size = 0;
+	};
+
+	bool IsHeaderCompatible(const FileHeader& p_header)
+	{
+		const FileHeader expected;
+
+		return
+			p_header.magic == expected.magic &&
+			p_header.formatVersion == expected.formatVersion &&
+			p_header.isBigEndian == expected.isBigEndian;
+	}
+
+	bool IsHeaderValid(const FileHeader& p_header)
+	{
+		using namespace OvRendering::Settings;
+
+		return
+			p_header.compression > static_cast<uint32_t>(ETextureCompression::NONE) &&
+			p_header.compression <= static_cast<uint32_t>(ETextureCompression::RGBA16F) &&
+			p_header.width > 0 && p_header.height > 0 &&
+			p_header.levelCount > 0 && p_header.levelCount <= kMaxLevelCount;
+	}
+
+	bool IsLevelValid(const LevelEntry& p_entry, const FileHeader& p_header, size_t p_fileSize)
+	{
+		const auto compression = static_cast<OvRendering::Settings::ETextureCompression>(p_header.compression);
+
+		return
+			p_entry.width > 0 && p_entry.width <= p_header.width &&
+			p_entry.height > 0 && p_entry.height <= p_header.height &&
+			p_entry.size == OvRendering::Utils::GetTextureLevelSize(compression, p_entry.width, p_entry.height) &&
+			p_entry.offset <= p_fileSize &&
+			p_entry.size <= p_fileSize - p_entry.offset;
+	}
+
+	bool ReadHeader(const OvTools::Filesystem::MappedFile& p_file, FileHeader& p_header)
+	{
+		if (!p_file.IsValid() || p_file.GetData().size() < sizeof(FileHeader))
+			return false;
+
+		std::memcpy(&p_header, p_file.GetData().data(), sizeof(FileHeader));
+		return IsHeaderCompatible(p_header);
+	}
+
+	bool ReadLevelEntries(const OvTools::Filesystem::MappedFile& p_file, const FileHeader& p_header, std::vector<LevelEntry>& p_entries)
+	{
+		const auto bytes = p_file.GetData();
+
+		p_entries.resize(IsHeaderValid(p_header) ? p_header.levelCount : 0);
+
+		if (p_entries.empty() || bytes.size() - sizeof(FileHeader) < p_entries.size() * sizeof(LevelEntry))
+			return false;
+
+		std::memcpy(p_entries.data(), bytes.data() + sizeof(FileHeader), p_entries.size() * sizeof(LevelEntry));
+
+		return std::ranges::all_of(p_entries, [&](const LevelEntry& p_entry) {
+			return IsLevelValid(p_entry, p_header, bytes.size());
+		});
+	}
+
+	OvRendering::Resources::Parsers::TextureData CopyLevels(
+		const OvTools::Filesystem::MappedFile& p_file,
+		const FileHeader& p_header,
+		const std::vector<LevelEntry>& p_entries,
+		uint32_t p_firstLevel
+	)
+	{
+		const auto bytes = p_file.GetData();
+
+		OvRendering::Resources::Parsers::TextureData data;
+		data.compression = static_cast<OvRendering::Settings::ETextureCompression>(p_header.compression);
+		data.width = p_header.width;
+		data.height = p_header.height;
+		data.firstLevel = p_firstLevel;
+
+		for (uint32_t i = p_firstLevel; i < p_entries.size(); ++i)
+		{
+			const auto& entry = p_entries[i];
+			data.levels.push_back({ entry.width, entry.height, data.data.size(), entry.size });
+			data.data.insert(data.data.end(), bytes.begin() + entry.offset, bytes.begin() + entry.offset + entry.size);
+		}
+
+		return data;
+	}
+}
+
+bool OvRendering::Resources::Parsers::CookedTextureParser::IsUpToDate(const std::filesystem::path& p_cookedPath, const std::filesystem::path& p_sourcePath, uint64_t p_settingsHash)
+{
+	std::ifstream stream(p_cookedPath, std::ios::binary);
+	FileHeader header;
+
+	return
+		stream &&
+		stream.read(reinterpret_cast<char*>(&header), sizeof(FileHeader)) &&
+		IsHeaderCompatible(header) &&
+		OvTools::Filesystem::IsCookedAssetUpToDate(header.stamp, p_sourcePath, p_settingsHash);
+}
+
+bool OvRendering::Resources::Parsers::CookedTextureParser::Save(const std::filesystem::path& p_cookedPath, const OvTools::Filesystem::CookedAssetStamp& p_stamp, const TextureData& p_data)
+{
+	FileHeader header;
+	header.compression = static_cast<uint32_t>(p_data.compression);
+	header.width = p_data.width;
+	header.height = p_data.height;
+	header.levelCount = static_cast<uint32_t>(p_data.levels.size());
+	header.stamp = p_stamp;
+
+	if (!IsHeaderValid(header) || p_data.firstLevel != 0)
+	{
+		return false;
+	}
+
+	std::vector<LevelEntry> entries;
+	uint64_t cursor = sizeof(FileHeader) + p_data.levels.size() * sizeof(LevelEntry);
+
+	for (const auto& level : p_data.levels)
+	{
+		cursor = (cursor + kDataAlignment - 1) / kDataAlignment * kDataAlignment;
+		entries.push_back({ level.width, level.height, cursor, level.size });
+		cursor += level.size;
+	}
+
+	std::vector<uint8_t> bytes(cursor, 0);
+	std::memcpy(bytes.data(), &header, sizeof(FileHeader));
+	std::memcpy(bytes.data() + sizeof(FileHeader), entries.data(), entries.size() * sizeof(LevelEntry));
+
+	for (size_t i = 0; i < entries.size(); ++i)
+	{
+		std::memcpy(bytes.data() + entries[i].offset, p_data.data.data() + p_data.levels[i].offset, entries[i].size);
+	}
+
+	// Written next to the destination then renamed, so that a failed write never leaves a truncated cooked file
+	auto temporaryPath = p_cookedPath;
+	temporaryPath += ".tmp";
+
+	{
+		std::ofstream stream(temporaryPath, std::ios::binary | std::ios::trunc);
+
+		if (!stream || !stream.write(reinterpret_cast<const char*>(bytes.data()), bytes.size()))
+		{
+			OVLOG_WARNING("CookedTextureParser: Unable to write \"" + temporaryPath.string() + "\"");
+			return false;
+		}
+	}
+
+	std::error_code error;
+	std::filesystem::rename(temporaryPath, p_cookedPath, error);
+
+	if (error)
+	{
+		OVLOG_WARNING("CookedTextureParser: Unable to write \"" + p_cookedPath.string() + "\": " + error.message());
+		std::filesystem::remove(temporaryPath, error);
+		return false;
+	}
+
+	return true;
+}
+
+bool OvRendering::Resources::Parsers::CookedTextureParser::LoadTextureData(
+	const std::filesystem::path& p_cookedPath,
+	const std::filesystem::path& p_sourcePath,
+	uint64_t p_settingsHash,
+	TextureData& p_data,
+	uint32_t p_maxLevelSize
+)
+{
+	const OvTools::Filesystem::MappedFile file(p_cookedPath);
+	FileHeader header;
+	std::vector<LevelEntry> entries;
+
+	if (!ReadHeader(file, header) || !OvTools::Filesystem::IsCookedAssetUpToDate(header.stamp, p_sourcePath, p_settingsHash))
+		return false;
+
+	if (!ReadLevelEntries(file, header, entries))
+	{
+		OVLOG_WARNING("CookedTextureParser: \"" + p_cookedPath.string() + "\" is corrupted");
+		return false;
+	}
+
+	uint32_t firstLevel = 0;
+
+	while (p_maxLevelSize > 0 && firstLevel + 1 < entries.size() && std::max(entries[firstLevel].width, entries[firstLevel].height) > p_maxLevelSize)
+	{
+		++firstLevel;
+	}
+
+	p_data = CopyLevels(file, header, entries, firstLevel);
+	return true;
+}
+
+bool OvRendering::Resources::Parsers::CookedTextureParser::LoadTextureLevels(
+	const std::filesystem::path& p_cookedPath,
+	uint32_t p_firstLevel,
+	TextureData& p_data
+)
+{
+	const OvTools::Filesystem::MappedFile file(p_cookedPath);
+	FileHeader header;
+	std::vector<LevelEntry> entries;
+
+	if (!ReadHeader(file, header))
+		return false;
+
+	if (!ReadLevelEntries(file, header, entries))
+	{
+		OVLOG_WARNING("CookedTextureParser: \"" + p_cookedPath.string() + "\" is corrupted");
+		return false;
+	}
+
+	p_data = CopyLevels(file, header, entries, std::min(p_firstLevel, static_cast<uint32_t>(entries.size() - 1)));
+	return true;
+}
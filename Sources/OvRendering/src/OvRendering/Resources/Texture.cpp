@@ -13,6 +13,12 @@ baregl::Texture& OvRendering::Resources::Texture::GetTexture()
 	return *m_texture;
 }
 
+const baregl::Texture& OvRendering::Resources::Texture::GetTexture() const
+{
+	OVASSERT(m_texture != nullptr, "Trying to access a null Texture");
+	return *m_texture;
+}
+
 OvRendering::Resources::Texture::Texture(const std::string p_path, std::unique_ptr<baregl::Texture>&& p_texture) : path(p_path)
 {
 	SetTexture(std::move(p_texture));
@@ -4,6 +4,55 @@
 * @licence: MIT
 */
 
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
 #include "OvRendering/Utils/Conversions.h"
 
+namespace
+{
+	uint32_t PackSnorm(float p_value, uint32_t p_bits)
+	{
+		const float maxValue = static_cast<float>((1 << (p_bits - 1)) - 1);
+		const int32_t quantized = static_cast<int32_t>(std::round(std::clamp(std::isnan(p_value) ? 0.0f : p_value, -1.0f, 1.0f) * maxValue));
+		return static_cast<uint32_t>(quantized) & ((1u << p_bits) - 1);
+	}
+}
+
+uint16_t OvRendering::Utils::Conversions::FloatToHalf(float p_value)
+{
+	if (std::isnan(p_value))
+		return 0;
+
+	// Clamped to the largest half, HDR sources can exceed its range
+	const uint32_t bits = std::bit_cast<uint32_t>(std::clamp(p_value, -65504.0f, 65504.0f));
+	const uint32_t sign = (bits >> 16) & 0x8000;
+	const int32_t exponent = static_cast<int32_t>((bits >> 23) & 0xFF) - 127 + 15;
+	uint32_t mantissa = bits & 0x7FFFFF;
+
+	if (exponent <= 0)
+	{
+		if (exponent < -10)
+			return static_cast<uint16_t>(sign);
+
+		mantissa |= 0x800000;
+		return static_cast<uint16_t>(sign | (mantissa >> (14 - exponent)));
+	}
+
+	uint32_t half = sign | (static_cast<uint32_t>(exponent) << 10) | (mantissa >> 13);
+
+	if (mantissa & 0x1000)
+		++half;
+
+	return static_cast<uint16_t>(half);
+}
 
+uint32_t OvRendering::Utils::Conversions::PackSnorm1010102(float p_x, float p_y, float p_z, float p_w)
+{
+	return
+		PackSnorm(p_x, 10) |
+		(PackSnorm(p_y, 10) << 10) |
+		(PackSnorm(p_z, 10) << 20) |
+		(PackSnorm(p_w, 2) << 30);
+}
@@ -0,0 +1,431 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+#include <numeric>
+
+#include <OvRendering/Utils/MeshOptimization.h>
+
+namespace
+{
+	// Clusters are split as long as the cache miss ratio doesn't get worse than this, relative to the unsplit cluster
+	constexpr float kClusterSplitThreshold = 1.05f;
+
+	/**
+	* FIFO post-transform vertex cache, a vertex being cached if it has been transformed less than "size" misses ago
+	*/
+	class VertexCache
+	{
+	public:
+		VertexCache(size_t p_vertexCount, uint32_t p_size) :
+			m_timestamps(p_vertexCount, 0),
+			m_size(p_size),
+			m_time(p_size + 1)
+		{
+		}
+
+		/**
+		* Returns true if the given vertex had to be transformed
+		*/
+		bool Access(uint32_t p_vertex)
+		{
+			if (m_time - m_timestamps[p_vertex] > m_size)
+			{
+				m_timestamps[p_vertex] = m_time++;
+				return true;
+			}
+
+			return false;
+		}
+
+		void Flush()
+		{
+			m_time += m_size + 1;
+		}
+
+	private:
+		std::vector<uint32_t> m_timestamps;
+		uint32_t m_size;
+		uint32_t m_time;
+	};
+
+	/**
+	* Triangles using each vertex, stored contiguously
+	*/
+	struct TriangleAdjacency
+	{
+		std::vector<uint32_t> offsets; // Per vertex, plus one
+		std::vector<uint32_t> triangles;
+
+		TriangleAdjacency(std::span<const uint32_t> p_indices, size_t p_vertexCount) :
+			offsets(p_vertexCount + 1, 0),
+			triangles(p_indices.size())
+		{
+			for (const uint32_t index : p_indices)
+			{
+				++offsets[index + 1];
+			}
+
+			std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+			std::vector<uint32_t> cursors(offsets.begin(), offsets.end() - 1);
+
+			for (size_t i = 0; i < p_indices.size(); ++i)
+			{
+				triangles[cursors[p_indices[i]]++] = static_cast<uint32_t>(i / 3);
+			}
+		}
+
+		std::span<const uint32_t> Get(uint32_t p_vertex) const
+		{
+			return std::span(triangles).subspan(offsets[p_vertex], offsets[p_vertex + 1] - offsets[p_vertex]);
+		}
+	};
+
+	/**
+	* Tipsify (Sander et al. 2007): fan around the vertex which stays the longest in the cache while it has triangles left.
+	* Returns the triangle order, and fills the starts of the clusters separated by a cache flush (Dead ends)
+	*/
+	std::vector<uint32_t> Tipsify(
+		std::span<const uint32_t> p_indices,
+		size_t p_vertexCount,
+		uint32_t p_cacheSize,
+		std::vector<uint32_t>& p_clusters
+	)
+	{
+		const size_t triangleCount = p_indices.size() / 3;
+		const TriangleAdjacency adjacency(p_indices, p_vertexCount);
+
+		std::vector<uint32_t> liveTriangles(p_vertexCount);
+		for (uint32_t vertex = 0; vertex < p_vertexCount; ++vertex)
+		{
+			liveTriangles[vertex] = adjacency.offsets[vertex + 1] - adjacency.offsets[vertex];
+		}
+
+		std::vector<uint32_t> cacheTimestamps(p_vertexCount, 0);
+		std::vector<bool> emitted(triangleCount, false);
+		std::vector<uint32_t> deadEnds;
+		std::vector<uint32_t> candidates;
+		std::vector<uint32_t> order;
+		order.reserve(triangleCount);
+
+		uint32_t time = p_cacheSize + 1;
+		uint32_t cursor = 0;
+		int64_t fanningVertex = p_vertexCount > 0 ? 0 : -1;
+
+		p_clusters.assign(1, 0);
+
+		while (fanningVertex >= 0)
+		{
+			candidates.clear();
+
+			for (const uint32_t triangle : adjacency.Get(static_cast<uint32_t>(fanningVertex)))
+			{
+				if (emitted[triangle])
+				{
+					continue;
+				}
+
+				for (uint32_t corner = 0; corner < 3; ++corner)
+				{
+					const uint32_t vertex = p_indices[triangle * 3 + corner];
+
+					candidates.push_back(vertex);
+					deadEnds.push_back(vertex);
+					--liveTriangles[vertex];
+
+					if (time - cacheTimestamps[vertex] > p_cacheSize)
+					{
+						cacheTimestamps[vertex] = time++;
+					}
+				}
+
+				emitted[triangle] = true;
+				order.push_back(triangle);
+			}
+
+			// Prefer the candidate cached the longest ago, as long as its remaining triangles still fit in the cache
+			fanningVertex = -1;
+			uint32_t bestPriority = 0;
+
+			for (const uint32_t vertex : candidates)
+			{
+				if (liveTriangles[vertex] > 0)
+				{
+					const uint32_t age = time - cacheTimestamps[vertex];
+					const uint32_t priority = age + 2 * liveTriangles[vertex] <= p_cacheSize ? age : 0;
+
+					if (priority > bestPriority)
+					{
+						bestPriority = priority;
+						fanningVertex = vertex;
+					}
+				}
+			}
+
+			if (fanningVertex >= 0)
+			{
+				continue;
+			}
+
+			// Dead end: resume from the most recently referenced vertex with triangles left, or the next one in input order
+			while (!deadEnds.empty() && fanningVertex < 0)
+			{
+				const uint32_t vertex = deadEnds.back();
+				deadEnds.pop_back();
+
+				if (liveTriangles[vertex] > 0)
+				{
+					fanningVertex = vertex;
+				}
+			}
+
+			for (; fanningVertex < 0 && cursor < p_vertexCount; ++cursor)
+			{
+				if (liveTriangles[cursor] > 0)
+				{
+					fanningVertex = cursor;
+				}
+			}
+
+			if (fanningVertex >= 0 && order.size() != p_clusters.back())
+			{
+				p_clusters.push_back(static_cast<uint32_t>(order.size()));
+			}
+		}
+
+		return order;
+	}
+
+	/**
+	* Split the given clusters wherever the cache miss ratio since the cluster start is already as good as the one of the
+	* whole cluster, so that the overdraw sort has finer clusters to work with without hurting the vertex cache much
+	*/
+	std::vector<uint32_t> SplitClusters(
+		std::span<const uint32_t> p_indices,
+		std::span<const uint32_t> p_order,
+		std::span<const uint32_t> p_clusters,
+		size_t p_vertexCount,
+		uint32_t p_cacheSize
+	)
+	{
+		std::vector<uint32_t> result;
+		VertexCache cache(p_vertexCount, p_cacheSize);
+
+		for (size_t cluster = 0; cluster < p_clusters.size(); ++cluster)
+		{
+			const uint32_t start = p_clusters[cluster];
+			const uint32_t end = cluster + 1 < p_clusters.size() ? p_clusters[cluster + 1] : static_cast<uint32_t>(p_order.size());
+
+			cache.Flush();
+			uint32_t clusterMisses = 0;
+
+			for (uint32_t i = start; i < end; ++i)
+			{
+				for (uint32_t corner = 0; corner < 3; ++corner)
+				{
+					clusterMisses += cache.Access(p_indices[p_order[i] * 3 + corner]);
+				}
+			}
+
+			const float clusterACMR = static_cast<float>(clusterMisses) / static_cast<float>(end - start);
+
+			cache.Flush();
+			result.push_back(start);
+
+			uint32_t misses = 0;
+			uint32_t triangles = 0;
+
+			for (uint32_t i = start; i < end; ++i)
+			{
+				for (uint32_t corner = 0; corner < 3; ++corner)
+				{
+					misses += cache.Access(p_indices[p_order[i] * 3 + corner]);
+				}
+
+				++triangles;
+
+				if (i + 1 < end && static_cast<float>(misses) <= kClusterSplitThreshold * clusterACMR * static_cast<float>(triangles))
+				{
+					cache.Flush();
+					result.push_back(i + 1);
+					misses = 0;
+					triangles = 0;
+				}
+			}
+		}
+
+		return result;
+	}
+
+	/**
+	* Sort the given clusters by occlusion potential (Sander et al. 2007): clusters far from the mesh center and facing
+	* away from it are likely to be in front of the others when visible
+	*/
+	std::vector<uint32_t> SortClusters(
+		std::span<const uint32_t> p_indices,
+		std::span<const uint32_t> p_order,
+		std::span<const uint32_t> p_clusters,
+		std::span<const OvMaths::FVector3> p_positions
+	)
+	{
+		struct ClusterInfo
+		{
+			OvMaths::FVector3 centroid;
+			OvMaths::FVector3 normal;
+			float area = 0.0f;
+			float occlusionPotential = 0.0f;
+		};
+
+		std::vector<ClusterInfo> infos(p_clusters.size());
+		OvMaths::FVector3 meshCentroid;
+		float meshArea = 0.0f;
+
+		for (size_t cluster = 0; cluster < p_clusters.size(); ++cluster)
+		{
+			const uint32_t end = cluster + 1 < p_clusters.size() ? p_clusters[cluster + 1] : static_cast<uint32_t>(p_order.size());
+			auto& info = infos[cluster];
+
+			for (uint32_t i = p_clusters[cluster]; i < end; ++i)
+			{
+				const auto& a = p_positions[p_indices[p_order[i] * 3]];
+				const auto& b = p_positions[p_indices[p_order[i] * 3 + 1]];
+				const auto& c = p_positions[p_indices[p_order[i] * 3 + 2]];
+
+				// Area weighted, so that the large triangles of a cluster decide its position and orientation
+				const auto cross = OvMaths::FVector3::Cross(b - a, c - a);
+				const float area = OvMaths::FVector3::Length(cross) * 0.5f;
+
+				info.centroid += (a + b + c) * (area / 3.0f);
+				info.normal += cross;
+				info.area += area;
+			}
+
+			meshCentroid += info.centroid;
+			meshArea += info.area;
+
+			if (info.area > 0.0f)
+			{
+				info.centroid /= info.area;
+			}
+		}
+
+		if (meshArea > 0.0f)
+		{
+			meshCentroid /= meshArea;
+		}
+
+		for (auto& info : infos)
+		{
+			const float normalLength = OvMaths::FVector3::Length(info.normal);
+
+			info.occlusionPotential = normalLength > 0.0f ?
+				OvMaths::FVector3::Dot(info.centroid - meshCentroid, info.normal) / normalLength :
+				0.0f;
+		}
+
+		std::vector<uint32_t> clusterOrder(p_clusters.size());
+		std::iota(clusterOrder.begin(), clusterOrder.end(), 0);
+
+		std::ranges::stable_sort(clusterOrder, [&infos](uint32_t p_left, uint32_t p_right) {
+			return infos[p_left].occlusionPotential > infos[p_right].occlusionPotential;
+		});
+
+		std::vector<uint32_t> order;
+		order.reserve(p_order.size());
+
+		for (const uint32_t cluster : clusterOrder)
+		{
+			const uint32_t end = cluster + 1 < p_clusters.size() ? p_clusters[cluster + 1] : static_cast<uint32_t>(p_order.size());
+			order.insert(order.end(), p_order.begin() + p_clusters[cluster], p_order.begin() + end);
+		}
+
+		return order;
+	}
+}
+
+OvRendering::Utils::VertexCacheStats OvRendering::Utils::AnalyzeVertexCache(std::span<const uint32_t> p_indices, size_t p_vertexCount, uint32_t p_cacheSize)
+{
+	VertexCache cache(p_vertexCount, p_cacheSize);
+	std::vector<bool> referenced(p_vertexCount, false);
+
+	uint32_t misses = 0;
+	uint32_t referencedCount = 0;
+
+	for (const uint32_t index : p_indices)
+	{
+		if (index >= p_vertexCount)
+		{
+			continue;
+		}
+
+		misses += cache.Access(index);
+
+		if (!referenced[index])
+		{
+			referenced[index] = true;
+			++referencedCount;
+		}
+	}
+
+	const size_t triangleCount = p_indices.size() / 3;
+
+	return VertexCacheStats{
+		.acmr = triangleCount > 0 ? static_cast<float>(misses) / static_cast<float>(triangleCount) : 0.0f,
+		.atvr = referencedCount > 0 ? static_cast<float>(misses) / static_cast<float>(referencedCount) : 0.0f
+	};
+}
+
+void OvRendering::Utils::OptimizeTriangleOrder(std::span<uint32_t> p_indices, std::span<const OvMaths::FVector3> p_positions)
+{
+	const size_t vertexCount = p_positions.size();
+
+	if (p_indices.size() < 3 || p_indices.size() % 3 != 0 ||
+		std::ranges::any_of(p_indices, [vertexCount](uint32_t p_index) { return p_index >= vertexCount; }))
+	{
+		return;
+	}
+
+	std::vector<uint32_t> clusters;
+	const auto cacheOrder = Tipsify(p_indices, vertexCount, kVertexCacheSize, clusters);
+	clusters = SplitClusters(p_indices, cacheOrder, clusters, vertexCount, kVertexCacheSize);
+	const auto order = SortClusters(p_indices, cacheOrder, clusters, p_positions);
+
+	std::vector<uint32_t> indices(p_indices.size());
+
+	for (size_t i = 0; i < order.size(); ++i)
+	{
+		std::copy_n(p_indices.begin() + order[i] * 3, 3, indices.begin() + i * 3);
+	}
+
+	std::ranges::copy(indices, p_indices.begin());
+}
+
+std::vector<uint32_t> OvRendering::Utils::OptimizeVertexFetch(std::span<uint32_t> p_indices, size_t p_vertexCount)
+{
+	std::vector<uint32_t> remap(p_vertexCount, UINT32_MAX);
+
+	// Out of range indices would end up referencing valid vertices once remapped, the vertex order is kept
+	if (std::ranges::any_of(p_indices, [p_vertexCount](uint32_t p_index) { return p_index >= p_vertexCount; }))
+	{
+		std::iota(remap.begin(), remap.end(), 0);
+		return remap;
+	}
+
+	uint32_t nextVertex = 0;
+
+	for (auto& index : p_indices)
+	{
+		if (remap[index] == UINT32_MAX)
+		{
+			remap[index] = nextVertex++;
+		}
+
+		index = remap[index];
+	}
+
+	return remap;
+}
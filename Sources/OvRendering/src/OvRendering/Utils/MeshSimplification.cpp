@@ -0,0 +1,521 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <iterator>
+#include <optional>
+#include <queue>
+#include <unordered_map>
+
+#include <tracy/Tracy.hpp>
+
+#include <OvRendering/Utils/MeshSimplification.h>
+
+namespace
+{
+	using Triangle = std::array<uint32_t, 3>;
+
+	/**
+	* Sum of squared distances to a set of planes (Garland & Heckbert), stored as a symmetric 4x4 matrix
+	*/
+	struct Quadric
+	{
+		double a2 = 0.0, ab = 0.0, ac = 0.0, ad = 0.0;
+		double b2 = 0.0, bc = 0.0, bd = 0.0;
+		double c2 = 0.0, cd = 0.0;
+		double d2 = 0.0;
+
+		static Quadric FromPlane(double p_a, double p_b, double p_c, double p_d)
+		{
+			return {
+				p_a * p_a, p_a * p_b, p_a * p_c, p_a * p_d,
+				p_b * p_b, p_b * p_c, p_b * p_d,
+				p_c * p_c, p_c * p_d,
+				p_d * p_d
+			};
+		}
+
+		Quadric& operator+=(const Quadric& p_other)
+		{
+			a2 += p_other.a2; ab += p_other.ab; ac += p_other.ac; ad += p_other.ad;
+			b2 += p_other.b2; bc += p_other.bc; bd += p_other.bd;
+			c2 += p_other.c2; cd += p_other.cd;
+			d2 += p_other.d2;
+			return *this;
+		}
+
+		double Evaluate(const OvMaths::FVector3& p_position) const
+		{
+			const double x = p_position.x, y = p_position.y, z = p_position.z;
+
+			const double result =
+				a2 * x * x + 2.0 * ab * x * y + 2.0 * ac * x * z + 2.0 * ad * x +
+				b2 * y * y + 2.0 * bc * y * z + 2.0 * bd * y +
+				c2 * z * z + 2.0 * cd * z +
+				d2;
+
+			return std::max(result, 0.0);
+		}
+	};
+
+	struct Collapse
+	{
+		double cost;
+		uint32_t from;
+		uint32_t to;
+		uint32_t fromStamp;
+		uint32_t toStamp;
+
+		bool operator>(const Collapse& p_other) const
+		{
+			return cost > p_other.cost;
+		}
+	};
+
+	struct PositionKey
+	{
+		uint32_t x, y, z;
+
+		bool operator==(const PositionKey&) const = default;
+	};
+
+	struct PositionKeyHash
+	{
+		size_t operator()(const PositionKey& p_key) const
+		{
+			return (static_cast<size_t>(p_key.x) * 73856093u) ^ (static_cast<size_t>(p_key.y) * 19349663u) ^ (static_cast<size_t>(p_key.z) * 83492791u);
+		}
+	};
+
+	uint64_t MakeEdgeKey(uint32_t p_a, uint32_t p_b)
+	{
+		return p_a < p_b ?
+			(static_cast<uint64_t>(p_a) << 32) | p_b :
+			(static_cast<uint64_t>(p_b) << 32) | p_a;
+	}
+
+	OvMaths::FVector3 ComputeTriangleNormal(const OvMaths::FVector3& p_a, const OvMaths::FVector3& p_b, const OvMaths::FVector3& p_c)
+	{
+		return OvMaths::FVector3::Cross(p_b - p_a, p_c - p_a);
+	}
+
+	class Simplifier
+	{
+	public:
+		Simplifier(std::span<const OvMaths::FVector3> p_positions, std::span<const uint32_t> p_indices) :
+			m_positions(p_positions)
+		{
+			WeldPositions();
+			BuildTriangles(p_indices);
+			LockSeamsAndBorders();
+			ComputeQuadrics();
+		}
+
+		float Run(size_t p_targetIndexCount, float p_maxError)
+		{
+			const double extent = ComputeExtent();
+			const double maxCost = static_cast<double>(p_maxError) * extent * static_cast<double>(p_maxError) * extent;
+
+			for (const auto& triangle : m_triangles)
+			{
+				for (uint32_t i = 0; i < 3; ++i)
+				{
+					const uint32_t a = m_canonical[triangle[i]];
+					const uint32_t b = m_canonical[triangle[(i + 1) % 3]];
+					PushCollapse(a, b);
+					PushCollapse(b, a);
+				}
+			}
+
+			double largestCost = 0.0;
+
+			while (m_aliveTriangleCount * 3 > p_targetIndexCount && !m_collapses.empty())
+			{
+				const Collapse collapse = m_collapses.top();
+				m_collapses.pop();
+
+				if (
+					!m_aliveVertices[collapse.from] || !m_aliveVertices[collapse.to] ||
+					m_stamps[collapse.from] != collapse.fromStamp || m_stamps[collapse.to] != collapse.toStamp
+				)
+				{
+					continue;
+				}
+
+				// The queue is sorted by cost, every remaining collapse would exceed the error as well
+				if (collapse.cost > maxCost)
+				{
+					break;
+				}
+
+				if (ApplyCollapse(collapse.from, collapse.to))
+				{
+					largestCost = std::max(largestCost, collapse.cost);
+				}
+			}
+
+			return extent > 0.0 ? static_cast<float>(std::sqrt(largestCost) / extent) : 0.0f;
+		}
+
+		std::vector<uint32_t> GetIndices() const
+		{
+			std::vector<uint32_t> result;
+			result.reserve(m_aliveTriangleCount * 3);
+
+			for (size_t i = 0; i < m_triangles.size(); ++i)
+			{
+				if (m_aliveTriangles[i])
+				{
+					result.insert(result.end(), m_triangles[i].begin(), m_triangles[i].end());
+				}
+			}
+
+			return result;
+		}
+
+	private:
+		/**
+		* Vertices sharing a position are simplified as a single one, their first occurrence is their canonical vertex
+		*/
+		void WeldPositions()
+		{
+			std::unordered_map<PositionKey, uint32_t, PositionKeyHash> firstOccurrences;
+			firstOccurrences.reserve(m_positions.size());
+
+			m_canonical.resize(m_positions.size());
+			m_wedgeCounts.assign(m_positions.size(), 0);
+
+			for (uint32_t i = 0; i < m_positions.size(); ++i)
+			{
+				const auto& position = m_positions[i];
+
+				// +0.0 and -0.0 are the same position
+				const PositionKey key{
+					std::bit_cast<uint32_t>(position.x + 0.0f),
+					std::bit_cast<uint32_t>(position.y + 0.0f),
+					std::bit_cast<uint32_t>(position.z + 0.0f)
+				};
+
+				m_canonical[i] = firstOccurrences.try_emplace(key, i).first->second;
+				++m_wedgeCounts[m_canonical[i]];
+			}
+		}
+
+		void BuildTriangles(std::span<const uint32_t> p_indices)
+		{
+			m_vertexTriangles.resize(m_positions.size());
+			m_triangles.reserve(p_indices.size() / 3);
+
+			for (size_t i = 0; i + 2 < p_indices.size(); i += 3)
+			{
+				const Triangle triangle{ p_indices[i], p_indices[i + 1], p_indices[i + 2] };
+
+				if (triangle[0] >= m_positions.size() || triangle[1] >= m_positions.size() || triangle[2] >= m_positions.size())
+				{
+					continue;
+				}
+
+				const uint32_t a = m_canonical[triangle[0]];
+				const uint32_t b = m_canonical[triangle[1]];
+				const uint32_t c = m_canonical[triangle[2]];
+
+				// Degenerated triangles are dropped right away
+				if (a == b || b == c || a == c)
+				{
+					continue;
+				}
+
+				const auto index = static_cast<uint32_t>(m_triangles.size());
+				m_triangles.push_back(triangle);
+				m_vertexTriangles[a].push_back(index);
+				m_vertexTriangles[b].push_back(index);
+				m_vertexTriangles[c].push_back(index);
+			}
+
+			m_aliveTriangles.assign(m_triangles.size(), true);
+			m_aliveTriangleCount = m_triangles.size();
+			m_aliveVertices.assign(m_positions.size(), true);
+			m_stamps.assign(m_positions.size(), 0);
+		}
+
+		/**
+		* Collapsing a vertex with several attribute sets or on a border (or non-manifold) edge would tear the mesh
+		*/
+		void LockSeamsAndBorders()
+		{
+			std::unordered_map<uint64_t, uint32_t> edgeUses;
+			edgeUses.reserve(m_triangles.size() * 3);
+
+			for (const auto& triangle : m_triangles)
+			{
+				for (uint32_t i = 0; i < 3; ++i)
+				{
+					++edgeUses[MakeEdgeKey(m_canonical[triangle[i]], m_canonical[triangle[(i + 1) % 3]])];
+				}
+			}
+
+			m_lockedVertices.assign(m_positions.size(), false);
+
+			for (uint32_t i = 0; i < m_positions.size(); ++i)
+			{
+				m_lockedVertices[i] = m_wedgeCounts[i] > 1;
+			}
+
+			for (const auto& [edge, uses] : edgeUses)
+			{
+				if (uses != 2)
+				{
+					m_lockedVertices[static_cast<uint32_t>(edge >> 32)] = true;
+					m_lockedVertices[static_cast<uint32_t>(edge & 0xFFFFFFFF)] = true;
+				}
+			}
+		}
+
+		void ComputeQuadrics()
+		{
+			m_quadrics.resize(m_positions.size());
+
+			for (const auto& triangle : m_triangles)
+			{
+				const auto& a = m_positions[triangle[0]];
+				auto normal = ComputeTriangleNormal(a, m_positions[triangle[1]], m_positions[triangle[2]]);
+				const float length = OvMaths::FVector3::Length(normal);
+
+				if (length <= 0.0f)
+				{
+					continue;
+				}
+
+				normal = normal / length;
+
+				const auto quadric = Quadric::FromPlane(normal.x, normal.y, normal.z, -OvMaths::FVector3::Dot(normal, a));
+
+				for (const uint32_t vertex : triangle)
+				{
+					m_quadrics[m_canonical[vertex]] += quadric;
+				}
+			}
+		}
+
+		double ComputeExtent() const
+		{
+			if (m_positions.empty())
+			{
+				return 0.0;
+			}
+
+			auto min = m_positions.front();
+			auto max = m_positions.front();
+
+			for (const auto& position : m_positions)
+			{
+				min = { std::min(min.x, position.x), std::min(min.y, position.y), std::min(min.z, position.z) };
+				max = { std::max(max.x, position.x), std::max(max.y, position.y), std::max(max.z, position.z) };
+			}
+
+			return OvMaths::FVector3::Distance(min, max);
+		}
+
+		void PushCollapse(uint32_t p_from, uint32_t p_to)
+		{
+			if (m_lockedVertices[p_from])
+			{
+				return;
+			}
+
+			Quadric quadric = m_quadrics[p_from];
+			quadric += m_quadrics[p_to];
+
+			m_collapses.push({
+				.cost = quadric.Evaluate(m_positions[p_to]),
+				.from = p_from,
+				.to = p_to,
+				.fromStamp = m_stamps[p_from],
+				.toStamp = m_stamps[p_to]
+			});
+		}
+
+		void GatherNeighbors(uint32_t p_vertex, std::vector<uint32_t>& p_neighbors) const
+		{
+			p_neighbors.clear();
+
+			for (const uint32_t triangle : m_vertexTriangles[p_vertex])
+			{
+				if (m_aliveTriangles[triangle])
+				{
+					for (const uint32_t vertex : m_triangles[triangle])
+					{
+						if (m_canonical[vertex] != p_vertex)
+						{
+							p_neighbors.push_back(m_canonical[vertex]);
+						}
+					}
+				}
+			}
+
+			std::ranges::sort(p_neighbors);
+			p_neighbors.erase(std::unique(p_neighbors.begin(), p_neighbors.end()), p_neighbors.end());
+		}
+
+		bool ContainsVertex(const Triangle& p_triangle, uint32_t p_canonical) const
+		{
+			return
+				m_canonical[p_triangle[0]] == p_canonical ||
+				m_canonical[p_triangle[1]] == p_canonical ||
+				m_canonical[p_triangle[2]] == p_canonical;
+		}
+
+		/**
+		* Move the given vertex onto the other one, removing the triangles of their shared edge
+		*/
+		bool ApplyCollapse(uint32_t p_from, uint32_t p_to)
+		{
+			// Both vertices must only share the two vertices opposed to their edge, otherwise the mesh would become non-manifold
+			GatherNeighbors(p_from, m_fromNeighbors);
+			GatherNeighbors(p_to, m_toNeighbors);
+
+			m_sharedNeighbors.clear();
+			std::ranges::set_intersection(m_fromNeighbors, m_toNeighbors, std::back_inserter(m_sharedNeighbors));
+
+			if (!std::ranges::binary_search(m_fromNeighbors, p_to) || m_sharedNeighbors.size() > 2)
+			{
+				return false;
+			}
+
+			// "from" isn't a seam, so its triangles all use the same attributes of "to": the ones of their shared edge
+			std::optional<uint32_t> toWedge;
+			const auto& target = m_positions[p_to];
+
+			for (const uint32_t triangle : m_vertexTriangles[p_from])
+			{
+				if (!m_aliveTriangles[triangle])
+				{
+					continue;
+				}
+
+				const auto& vertices = m_triangles[triangle];
+
+				if (ContainsVertex(vertices, p_to))
+				{
+					for (const uint32_t vertex : vertices)
+					{
+						if (m_canonical[vertex] == p_to)
+						{
+							toWedge = vertex;
+						}
+					}
+
+					continue;
+				}
+
+				// Reject collapses flipping or degenerating the remaining triangles
+				std::array<OvMaths::FVector3, 3> moved;
+
+				for (uint32_t i = 0; i < 3; ++i)
+				{
+					moved[i] = m_canonical[vertices[i]] == p_from ? target : m_positions[vertices[i]];
+				}
+
+				const auto before = ComputeTriangleNormal(m_positions[vertices[0]], m_positions[vertices[1]], m_positions[vertices[2]]);
+				const auto after = ComputeTriangleNormal(moved[0], moved[1], moved[2]);
+
+				if (OvMaths::FVector3::Dot(before, after) <= 0.25f * OvMaths::FVector3::Length(before) * OvMaths::FVector3::Length(after))
+				{
+					return false;
+				}
+			}
+
+			if (!toWedge)
+			{
+				return false;
+			}
+
+			for (const uint32_t triangle : m_vertexTriangles[p_from])
+			{
+				if (!m_aliveTriangles[triangle])
+				{
+					continue;
+				}
+
+				auto& vertices = m_triangles[triangle];
+
+				if (ContainsVertex(vertices, p_to))
+				{
+					m_aliveTriangles[triangle] = false;
+					--m_aliveTriangleCount;
+					continue;
+				}
+
+				for (auto& vertex : vertices)
+				{
+					if (m_canonical[vertex] == p_from)
+					{
+						vertex = toWedge.value();
+					}
+				}
+
+				m_vertexTriangles[p_to].push_back(triangle);
+			}
+
+			m_vertexTriangles[p_from].clear();
+			m_aliveVertices[p_from] = false;
+			m_quadrics[p_to] += m_quadrics[p_from];
+			++m_stamps[p_to];
+
+			std::erase_if(m_vertexTriangles[p_to], [this](uint32_t p_triangle) { return !m_aliveTriangles[p_triangle]; });
+
+			// The cost of every collapse involving "to" changed
+			GatherNeighbors(p_to, m_toNeighbors);
+
+			for (const uint32_t neighbor : m_toNeighbors)
+			{
+				PushCollapse(neighbor, p_to);
+				PushCollapse(p_to, neighbor);
+			}
+
+			return true;
+		}
+
+	private:
+		std::span<const OvMaths::FVector3> m_positions;
+		std::vector<uint32_t> m_canonical;
+		std::vector<uint32_t> m_wedgeCounts;
+		std::vector<bool> m_lockedVertices;
+		std::vector<bool> m_aliveVertices;
+		std::vector<uint32_t> m_stamps;
+		std::vector<Quadric> m_quadrics;
+		std::vector<Triangle> m_triangles;
+		std::vector<bool> m_aliveTriangles;
+		size_t m_aliveTriangleCount = 0;
+		std::vector<std::vector<uint32_t>> m_vertexTriangles; // Indexed by canonical vertex
+		std::priority_queue<Collapse, std::vector<Collapse>, std::greater<Collapse>> m_collapses;
+
+		// Scratch buffers, kept to avoid allocating on every collapse
+		std::vector<uint32_t> m_fromNeighbors;
+		std::vector<uint32_t> m_toNeighbors;
+		std::vector<uint32_t> m_sharedNeighbors;
+	};
+}
+
+OvRendering::Utils::MeshSimplificationResult OvRendering::Utils::SimplifyMesh(
+	std::span<const OvMaths::FVector3> p_positions,
+	std::span<const uint32_t> p_indices,
+	size_t p_targetIndexCount,
+	float p_maxError
+)
+{
+	ZoneScoped;
+
+	Simplifier simplifier(p_positions, p_indices);
+
+	MeshSimplificationResult result;
+	result.error = simplifier.Run(p_targetIndexCount, p_maxError);
+	result.indices = simplifier.GetIndices();
+	return result;
+}
@@ -6,6 +6,7 @@
 
 #include <OvRendering/Utils/ResourceTracking.h>
 
+#include <algorithm>
 #include <unordered_map>
 
 #include <baregl/debug/Debug.h>
@@ -22,6 +23,7 @@ namespace
 {
 	std::unordered_map<uint32_t, const baregl::Texture*> m_textures;
 	std::vector<uint32_t> m_quickAccessTextureIDs;
+	OvRendering::Utils::ResourceTracking::TextureStreamingStats m_textureStreamingStats;
 
 	class EventHandler : public baregl::debug::IEventHandler
 	{
@@ -84,4 +86,14 @@ namespace OvRendering::Utils::ResourceTracking
 	{
 		return m_quickAccessTextureIDs;
 	}
+
+	void SetTextureStreamingStats(const TextureStreamingStats& p_stats)
+	{
+		m_textureStreamingStats = p_stats;
+	}
+
+	const TextureStreamingStats& GetTextureStreamingStats()
+	{
+		return m_textureStreamingStats;
+	}
 }
@@ -0,0 +1,643 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+#include <OvRendering/Utils/Conversions.h>
+#include <OvRendering/Utils/TextureCompression.h>
+
+namespace
+{
+	using ETextureCompression = OvRendering::Settings::ETextureCompression;
+
+	using Pixel = std::array<uint8_t, 4>;
+	using Block = std::array<Pixel, 16>;
+
+	// BC7 interpolation weights for 4 bits indices
+	constexpr std::array<uint32_t, 16> kBC7Weights = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+	/**
+	* RGBA float image, the mipmap chain is built in this space for both SDR and HDR sources
+	*/
+	struct FloatImage
+	{
+		uint32_t width = 0;
+		uint32_t height = 0;
+		std::vector<float> pixels; // 4 channels per pixel
+	};
+
+	FloatImage ToFloatImage(const OvRendering::Data::Image& p_image)
+	{
+		FloatImage result;
+		result.width = static_cast<uint32_t>(p_image.width);
+		result.height = static_cast<uint32_t>(p_image.height);
+
+		const size_t count = static_cast<size_t>(result.width) * result.height * 4;
+		result.pixels.resize(count);
+
+		if (p_image.isHDR)
+		{
+			const auto* source = static_cast<const float*>(p_image.data);
+			std::copy(source, source + count, result.pixels.begin());
+		}
+		else
+		{
+			const auto* source = static_cast<const uint8_t*>(p_image.data);
+			std::transform(source, source + count, result.pixels.begin(), [](uint8_t p_value) { return p_value / 255.0f; });
+		}
+
+		return result;
+	}
+
+	/**
+	* 2x2 box filter (The last row/column of odd sizes is dropped).
+	* Normal maps are renormalized, averaging unit vectors shortens them
+	*/
+	FloatImage Downsample(const FloatImage& p_source, bool p_renormalize)
+	{
+		FloatImage result;
+		result.width = std::max(1u, p_source.width / 2);
+		result.height = std::max(1u, p_source.height / 2);
+		result.pixels.resize(static_cast<size_t>(result.width) * result.height * 4);
+
+		const auto texel = [&p_source](uint32_t p_x, uint32_t p_y)
+		{
+			return &p_source.pixels[(static_cast<size_t>(std::min(p_y, p_source.height - 1)) * p_source.width + std::min(p_x, p_source.width - 1)) * 4];
+		};
+
+		for (uint32_t y = 0; y < result.height; ++y)
+		{
+			for (uint32_t x = 0; x < result.width; ++x)
+			{
+				const float* samples[4] = {
+					texel(x * 2, y * 2), texel(x * 2 + 1, y * 2),
+					texel(x * 2, y * 2 + 1), texel(x * 2 + 1, y * 2 + 1)
+				};
+
+				float* destination = &result.pixels[(static_cast<size_t>(y) * result.width + x) * 4];
+
+				for (size_t c = 0; c < 4; ++c)
+				{
+					destination[c] = (samples[0][c] + samples[1][c] + samples[2][c] + samples[3][c]) * 0.25f;
+				}
+
+				if (p_renormalize)
+				{
+					const float nx = destination[0] * 2.0f - 1.0f;
+					const float ny = destination[1] * 2.0f - 1.0f;
+					const float nz = destination[2] * 2.0f - 1.0f;
+
+					if (const float length = std::sqrt(nx * nx + ny * ny + nz * nz); length > 0.0f)
+					{
+						destination[0] = nx / length * 0.5f + 0.5f;
+						destination[1] = ny / length * 0.5f + 0.5f;
+						destination[2] = nz / length * 0.5f + 0.5f;
+					}
+				}
+			}
+		}
+
+		return result;
+	}
+
+	std::vector<uint8_t> ToRGBA8(const FloatImage& p_image)
+	{
+		std::vector<uint8_t> result(p_image.pixels.size());
+
+		std::transform(p_image.pixels.begin(), p_image.pixels.end(), result.begin(), [](float p_value)
+		{
+			return static_cast<uint8_t>(std::clamp(p_value, 0.0f, 1.0f) * 255.0f + 0.5f);
+		});
+
+		return result;
+	}
+
+	/**
+	* Returns the 4x4 block at the given block coordinates, pixels outside of the image repeat the edges
+	*/
+	Block FetchBlock(const std::vector<uint8_t>& p_rgba, uint32_t p_width, uint32_t p_height, uint32_t p_blockX, uint32_t p_blockY)
+	{
+		Block block;
+
+		for (uint32_t y = 0; y < 4; ++y)
+		{
+			for (uint32_t x = 0; x < 4; ++x)
+			{
+				const size_t sourceX = std::min(p_blockX * 4 + x, p_width - 1);
+				const size_t sourceY = std::min(p_blockY * 4 + y, p_height - 1);
+				std::memcpy(block[y * 4 + x].data(), &p_rgba[(sourceY * p_width + sourceX) * 4], 4);
+			}
+		}
+
+		return block;
+	}
+
+	template<size_t N>
+	uint32_t Distance(const Pixel& p_a, const Pixel& p_b)
+	{
+		uint32_t result = 0;
+
+		for (size_t c = 0; c < N; ++c)
+		{
+			const int32_t difference = static_cast<int32_t>(p_a[c]) - static_cast<int32_t>(p_b[c]);
+			result += difference * difference;
+		}
+
+		return result;
+	}
+
+	/**
+	* Fit the segment the block colors are interpolated on: the extent of the colors along their principal axis,
+	* slightly inset to reduce the error of the interpolated colors
+	*/
+	template<size_t N>
+	void FitEndpoints(const Block& p_block, float p_inset, std::array<float, N>& p_start, std::array<float, N>& p_end)
+	{
+		std::array<float, N> mean{};
+
+		for (const auto& pixel : p_block)
+			for (size_t c = 0; c < N; ++c)
+				mean[c] += pixel[c] / 16.0f;
+
+		std::array<float, N * N> covariance{};
+
+		for (const auto& pixel : p_block)
+			for (size_t i = 0; i < N; ++i)
+				for (size_t j = 0; j < N; ++j)
+					covariance[i * N + j] += (pixel[i] - mean[i]) * (pixel[j] - mean[j]);
+
+		// Power iteration, converges quickly towards the dominant eigenvector
+		std::array<float, N> axis;
+		axis.fill(1.0f / std::sqrt(static_cast<float>(N)));
+
+		for (uint32_t iteration = 0; iteration < 8; ++iteration)
+		{
+			std::array<float, N> next{};
+			float length = 0.0f;
+
+			for (size_t i = 0; i < N; ++i)
+			{
+				for (size_t j = 0; j < N; ++j)
+					next[i] += covariance[i * N + j] * axis[j];
+
+				length += next[i] * next[i];
+			}
+
+			if (length < 1e-12f)
+				break; // Uniform block, any axis works
+
+			length = std::sqrt(length);
+
+			for (size_t i = 0; i < N; ++i)
+				axis[i] = next[i] / length;
+		}
+
+		float minimum = std::numeric_limits<float>::max();
+		float maximum = std::numeric_limits<float>::lowest();
+
+		for (const auto& pixel : p_block)
+		{
+			float projection = 0.0f;
+
+			for (size_t c = 0; c < N; ++c)
+				projection += (pixel[c] - mean[c]) * axis[c];
+
+			minimum = std::min(minimum, projection);
+			maximum = std::max(maximum, projection);
+		}
+
+		const float inset = (maximum - minimum) * p_inset;
+		minimum += inset;
+		maximum -= inset;
+
+		for (size_t c = 0; c < N; ++c)
+		{
+			p_start[c] = std::clamp(mean[c] + axis[c] * minimum, 0.0f, 255.0f);
+			p_end[c] = std::clamp(mean[c] + axis[c] * maximum, 0.0f, 255.0f);
+		}
+	}
+
+	uint16_t To565(const std::array<float, 3>& p_color)
+	{
+		const auto r = static_cast<uint16_t>(p_color[0] * 31.0f / 255.0f + 0.5f);
+		const auto g = static_cast<uint16_t>(p_color[1] * 63.0f / 255.0f + 0.5f);
+		const auto b = static_cast<uint16_t>(p_color[2] * 31.0f / 255.0f + 0.5f);
+		return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+	}
+
+	Pixel From565(uint16_t p_color)
+	{
+		const uint32_t r = (p_color >> 11) & 31;
+		const uint32_t g = (p_color >> 5) & 63;
+		const uint32_t b = p_color & 31;
+
+		return {
+			static_cast<uint8_t>((r << 3) | (r >> 2)),
+			static_cast<uint8_t>((g << 2) | (g >> 4)),
+			static_cast<uint8_t>((b << 3) | (b >> 2)),
+			255
+		};
+	}
+
+	/**
+	* BC1 block (Also the color part of BC3), always in 4 colors mode
+	*/
+	void EncodeColorBlock(const Block& p_block, uint8_t* p_output, Block& p_decoded)
+	{
+		std::array<float, 3> start;
+		std::array<float, 3> end;
+		FitEndpoints<3>(p_block, 1.0f / 16.0f, start, end);
+
+		uint16_t color0 = To565(end);
+		uint16_t color1 = To565(start);
+
+		// color0 > color1 selects the 4 colors mode, equal endpoints only use the first color
+		if (color0 < color1)
+			std::swap(color0, color1);
+
+		std::array<Pixel, 4> palette = { From565(color0), From565(color1) };
+
+		for (size_t c = 0; c < 3; ++c)
+		{
+			palette[2][c] = static_cast<uint8_t>((2 * palette[0][c] + palette[1][c] + 1) / 3);
+			palette[3][c] = static_cast<uint8_t>((palette[0][c] + 2 * palette[1][c] + 1) / 3);
+		}
+
+		uint32_t indices = 0;
+
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			uint32_t best = 0;
+
+			if (color0 != color1)
+			{
+				uint32_t bestDistance = Distance<3>(p_block[i], palette[0]);
+
+				for (uint32_t candidate = 1; candidate < 4; ++candidate)
+				{
+					if (const uint32_t distance = Distance<3>(p_block[i], palette[candidate]); distance < bestDistance)
+					{
+						best = candidate;
+						bestDistance = distance;
+					}
+				}
+			}
+
+			indices |= best << (2 * i);
+			std::copy_n(palette[best].begin(), 3, p_decoded[i].begin());
+		}
+
+		p_output[0] = static_cast<uint8_t>(color0 & 0xFF);
+		p_output[1] = static_cast<uint8_t>(color0 >> 8);
+		p_output[2] = static_cast<uint8_t>(color1 & 0xFF);
+		p_output[3] = static_cast<uint8_t>(color1 >> 8);
+
+		for (uint32_t byte = 0; byte < 4; ++byte)
+			p_output[4 + byte] = static_cast<uint8_t>(indices >> (8 * byte));
+	}
+
+	/**
+	* BC4 block (Also the alpha part of BC3 and each channel of BC5), always in 8 values mode
+	*/
+	void EncodeChannelBlock(const Block& p_block, size_t p_channel, uint8_t* p_output, Block& p_decoded)
+	{
+		uint8_t minimum = 255;
+		uint8_t maximum = 0;
+
+		for (const auto& pixel : p_block)
+		{
+			minimum = std::min(minimum, pixel[p_channel]);
+			maximum = std::max(maximum, pixel[p_channel]);
+		}
+
+		std::array<uint8_t, 8> palette = { maximum, minimum };
+
+		for (uint32_t i = 2; i < 8; ++i)
+			palette[i] = static_cast<uint8_t>(((8 - i) * maximum + (i - 1) * minimum + 3) / 7);
+
+		uint64_t indices = 0;
+
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			uint64_t best = 0;
+
+			if (maximum != minimum)
+			{
+				for (uint32_t candidate = 1; candidate < 8; ++candidate)
+				{
+					if (std::abs(p_block[i][p_channel] - palette[candidate]) < std::abs(p_block[i][p_channel] - palette[best]))
+						best = candidate;
+				}
+			}
+
+			indices |= best << (3 * i);
+			p_decoded[i][p_channel] = palette[best];
+		}
+
+		p_output[0] = maximum;
+		p_output[1] = minimum;
+
+		for (uint32_t byte = 0; byte < 6; ++byte)
+			p_output[2 + byte] = static_cast<uint8_t>(indices >> (8 * byte));
+	}
+
+	/**
+	* Mode 6 endpoints are stored on 7 bits per channel, plus a low bit shared by the channels of the endpoint
+	*/
+	void QuantizeBC7Endpoint(const std::array<float, 4>& p_color, std::array<uint8_t, 4>& p_quantized, uint8_t& p_pBit)
+	{
+		float bestError = std::numeric_limits<float>::max();
+
+		for (uint8_t pBit = 0; pBit < 2; ++pBit)
+		{
+			std::array<uint8_t, 4> candidate;
+			float error = 0.0f;
+
+			for (size_t c = 0; c < 4; ++c)
+			{
+				candidate[c] = static_cast<uint8_t>(std::clamp(std::round((p_color[c] - pBit) / 2.0f), 0.0f, 127.0f));
+				const float difference = static_cast<float>(candidate[c] * 2 + pBit) - p_color[c];
+				error += difference * difference;
+			}
+
+			if (error < bestError)
+			{
+				bestError = error;
+				p_quantized = candidate;
+				p_pBit = pBit;
+			}
+		}
+	}
+
+	/**
+	* BC7 block, always using mode 6 (Single subset, RGBA endpoints, 4 bits indices).
+	* Other modes (Partitions, separate alpha) would raise the quality, at a much higher encoding cost
+	*/
+	void EncodeBC7Block(const Block& p_block, uint8_t* p_output, Block& p_decoded)
+	{
+		std::array<float, 4> start;
+		std::array<float, 4> end;
+		FitEndpoints<4>(p_block, 1.0f / 32.0f, start, end);
+
+		std::array<std::array<uint8_t, 4>, 2> quantized;
+		std::array<uint8_t, 2> pBits;
+		QuantizeBC7Endpoint(start, quantized[0], pBits[0]);
+		QuantizeBC7Endpoint(end, quantized[1], pBits[1]);
+
+		std::array<Pixel, 16> palette;
+
+		for (size_t i = 0; i < 16; ++i)
+		{
+			for (size_t c = 0; c < 4; ++c)
+			{
+				const uint32_t endpoint0 = quantized[0][c] * 2 + pBits[0];
+				const uint32_t endpoint1 = quantized[1][c] * 2 + pBits[1];
+				palette[i][c] = static_cast<uint8_t>(((64 - kBC7Weights[i]) * endpoint0 + kBC7Weights[i] * endpoint1 + 32) >> 6);
+			}
+		}
+
+		std::array<uint8_t, 16> indices;
+
+		for (size_t i = 0; i < 16; ++i)
+		{
+			uint8_t best = 0;
+			uint32_t bestDistance = Distance<4>(p_block[i], palette[0]);
+
+			for (uint8_t candidate = 1; candidate < 16; ++candidate)
+			{
+				if (const uint32_t distance = Distance<4>(p_block[i], palette[candidate]); distance < bestDistance)
+				{
+					best = candidate;
+					bestDistance = distance;
+				}
+			}
+
+			indices[i] = best;
+			p_decoded[i] = palette[best];
+		}
+
+		// The first index is stored on 3 bits, its high bit is implicitly 0. Swapping the endpoints mirrors the (symmetric) weights
+		if (indices[0] >= 8)
+		{
+			std::swap(quantized[0], quantized[1]);
+			std::swap(pBits[0], pBits[1]);
+
+			for (auto& index : indices)
+				index = static_cast<uint8_t>(15 - index);
+		}
+
+		std::memset(p_output, 0, 16);
+		uint32_t position = 0;
+
+		const auto writeBits = [p_output, &position](uint32_t p_value, uint32_t p_count)
+		{
+			for (uint32_t bit = 0; bit < p_count; ++bit, ++position)
+			{
+				if ((p_value >> bit) & 1)
+					p_output[position >> 3] |= static_cast<uint8_t>(1 << (position & 7));
+			}
+		};
+
+		writeBits(1 << 6, 7); // Mode 6: six 0 bits, then a 1
+
+		for (size_t c = 0; c < 4; ++c)
+		{
+			writeBits(quantized[0][c], 7);
+			writeBits(quantized[1][c], 7);
+		}
+
+		writeBits(pBits[0], 1);
+		writeBits(pBits[1], 1);
+		writeBits(indices[0], 3);
+
+		for (size_t i = 1; i < 16; ++i)
+			writeBits(indices[i], 4);
+	}
+
+	/**
+	* Number of channels the format stores, the quality is only measured on these
+	*/
+	uint32_t GetEncodedChannelCount(ETextureCompression p_compression)
+	{
+		switch (p_compression)
+		{
+		case ETextureCompression::BC1: return 3;
+		case ETextureCompression::BC4: return 1;
+		case ETextureCompression::BC5: return 2;
+		default: return 4;
+		}
+	}
+
+	/**
+	* Encode a level, adding the squared error of its encoded channels to p_squaredError when given
+	*/
+	void EncodeLevel(const FloatImage& p_level, ETextureCompression p_compression, uint8_t* p_output, double* p_squaredError)
+	{
+		if (p_compression == ETextureCompression::RGBA16F)
+		{
+			for (const float value : p_level.pixels)
+			{
+				const uint16_t half = OvRendering::Utils::Conversions::FloatToHalf(value);
+				*p_output++ = static_cast<uint8_t>(half & 0xFF);
+				*p_output++ = static_cast<uint8_t>(half >> 8);
+			}
+
+			return;
+		}
+
+		const std::vector<uint8_t> rgba = ToRGBA8(p_level);
+		const uint32_t blocksX = (p_level.width + 3) / 4;
+		const uint32_t blocksY = (p_level.height + 3) / 4;
+		const uint64_t blockSize = OvRendering::Utils::GetTextureLevelSize(p_compression, 4, 4);
+		const uint32_t channelCount = GetEncodedChannelCount(p_compression);
+
+		for (uint32_t blockY = 0; blockY < blocksY; ++blockY)
+		{
+			for (uint32_t blockX = 0; blockX < blocksX; ++blockX)
+			{
+				const Block block = FetchBlock(rgba, p_level.width, p_level.height, blockX, blockY);
+				uint8_t* output = p_output + (static_cast<size_t>(blockY) * blocksX + blockX) * blockSize;
+				Block decoded = block;
+
+				switch (p_compression)
+				{
+				case ETextureCompression::BC1:
+					EncodeColorBlock(block, output, decoded);
+					break;
+
+				case ETextureCompression::BC3:
+					EncodeChannelBlock(block, 3, output, decoded);
+					EncodeColorBlock(block, output + 8, decoded);
+					break;
+
+				case ETextureCompression::BC4:
+					EncodeChannelBlock(block, 0, output, decoded);
+					break;
+
+				case ETextureCompression::BC5:
+					EncodeChannelBlock(block, 0, output, decoded);
+					EncodeChannelBlock(block, 1, output + 8, decoded);
+					break;
+
+				case ETextureCompression::BC7:
+					EncodeBC7Block(block, output, decoded);
+					break;
+
+				default:
+					break;
+				}
+
+				if (p_squaredError)
+				{
+					for (uint32_t i = 0; i < 16; ++i)
+					{
+						// Edge blocks repeat the last pixels, which must only be counted once
+						if (blockX * 4 + i % 4 >= p_level.width || blockY * 4 + i / 4 >= p_level.height)
+							continue;
+
+						for (uint32_t c = 0; c < channelCount; ++c)
+						{
+							const double difference = static_cast<double>(block[i][c]) - static_cast<double>(decoded[i][c]);
+							*p_squaredError += difference * difference;
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+uint64_t OvRendering::Utils::GetTextureLevelSize(Settings::ETextureCompression p_compression, uint32_t p_width, uint32_t p_height)
+{
+	const uint64_t blockCount = static_cast<uint64_t>((p_width + 3) / 4) * ((p_height + 3) / 4);
+
+	switch (p_compression)
+	{
+	case ETextureCompression::BC1:
+	case ETextureCompression::BC4:
+		return blockCount * 8;
+
+	case ETextureCompression::BC3:
+	case ETextureCompression::BC5:
+	case ETextureCompression::BC7:
+		return blockCount * 16;
+
+	case ETextureCompression::RGBA16F:
+		return static_cast<uint64_t>(p_width) * p_height * 8;
+
+	default:
+		return static_cast<uint64_t>(p_width) * p_height * 4;
+	}
+}
+
+bool OvRendering::Utils::CompressTexture(
+	const Data::Image& p_image,
+	Settings::ETextureCompression p_compression,
+	bool p_generateMipmaps,
+	Resources::Parsers::TextureData& p_data,
+	TextureCompressionStats* p_stats
+)
+{
+	if (!p_image || p_image.width <= 0 || p_image.height <= 0 || p_compression == ETextureCompression::NONE)
+	{
+		return false;
+	}
+
+	const auto startTime = std::chrono::steady_clock::now();
+	const auto compression = p_image.isHDR ? ETextureCompression::RGBA16F : p_compression;
+
+	p_data = {};
+	p_data.compression = compression;
+	p_data.width = static_cast<uint32_t>(p_image.width);
+	p_data.height = static_cast<uint32_t>(p_image.height);
+
+	FloatImage level = ToFloatImage(p_image);
+	double squaredError = 0.0;
+	uint64_t pixelCount = 0;
+
+	while (true)
+	{
+		const uint64_t offset = p_data.data.size();
+		const uint64_t size = GetTextureLevelSize(compression, level.width, level.height);
+
+		p_data.levels.push_back({ level.width, level.height, offset, size });
+		p_data.data.resize(offset + size);
+
+		const bool measureError = p_stats && p_data.levels.size() == 1 && compression != ETextureCompression::RGBA16F;
+		EncodeLevel(level, compression, p_data.data.data() + offset, measureError ? &squaredError : nullptr);
+		pixelCount += static_cast<uint64_t>(level.width) * level.height;
+
+		if (!p_generateMipmaps || (level.width == 1 && level.height == 1))
+			break;
+
+		level = Downsample(level, compression == ETextureCompression::BC5);
+	}
+
+	if (p_stats)
+	{
+		p_stats->encodingTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+		p_stats->megapixelsPerSecond = p_stats->encodingTime > 0.0 ? static_cast<double>(pixelCount) / 1e6 / p_stats->encodingTime : 0.0;
+		p_stats->psnr = std::nullopt;
+
+		if (compression != ETextureCompression::RGBA16F)
+		{
+			const double sampleCount = static_cast<double>(p_data.width) * p_data.height * GetEncodedChannelCount(compression);
+			const double meanSquaredError = squaredError / sampleCount;
+
+			p_stats->psnr = meanSquaredError > 0.0 ?
+				10.0 * std::log10(255.0 * 255.0 / meanSquaredError) :
+				std::numeric_limits<double>::infinity();
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,77 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace OvTests
+{
+	/**
+	* A registered test or benchmark. Benchmarks only run when requested, they print their measures and fail like tests
+	*/
+	struct TestCase
+	{
+		const char* name;
+		void(*function)();
+		bool benchmark;
+	};
+
+	/**
+	* Thrown by OVTEST_CHECK when a check fails
+	*/
+	class CheckFailure : public std::runtime_error
+	{
+	public:
+		CheckFailure(const std::string& p_message) : std::runtime_error(p_message) {}
+	};
+
+	/**
+	* Returns every registered test case, in registration order
+	*/
+	std::vector<TestCase>& GetTestCases();
+
+	/**
+	* Registers a test case when constructed (Used by the OVTEST and OVBENCHMARK macros)
+	*/
+	struct TestRegistrar
+	{
+		TestRegistrar(const char* p_name, void(*p_function)(), bool p_benchmark)
+		{
+			GetTestCases().push_back({ p_name, p_function, p_benchmark });
+		}
+	};
+
+	/**
+	* Returns the time taken by the given function, in milliseconds
+	* @param p_function
+	*/
+	template<typename Function>
+	double MeasureMilliseconds(Function&& p_function)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		p_function();
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+}
+
+#define OVTEST_CASE(name, benchmark) \
+	static void name(); \
+	static OvTests::TestRegistrar name##Registrar(#name, &name, benchmark); \
+	static void name()
+
+#define OVTEST(name) OVTEST_CASE(name, false)
+#define OVBENCHMARK(name) OVTEST_CASE(name, true)
+
+#define OVTEST_CHECK(condition) \
+	do \
+	{ \
+		if (!(condition)) \
+			throw OvTests::CheckFailure(std::string(__FILE__) + ":" + std::to_string(__LINE__) + ": " + #condition); \
+	} while (false)
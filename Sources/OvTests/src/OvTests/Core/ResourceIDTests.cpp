@@ -0,0 +1,128 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <iostream>
+#include <string>
+
+#include <OvCore/ResourceManagement/AResourceManager.h>
+
+#include <OvTests/Test.h>
+
+namespace
+{
+	/**
+	* Resource manager of integers, which only tracks the created and destroyed resources
+	*/
+	class IntegerManager : public OvCore::ResourceManagement::AResourceManager<int>
+	{
+	public:
+		int destroyedCount = 0;
+
+	protected:
+		int* CreateResource(const std::filesystem::path&) override { return new int(0); }
+		void DestroyResource(int* p_resource) override { ++destroyedCount; delete p_resource; }
+		void ReloadResource(int*, const std::filesystem::path&) override {}
+	};
+
+	std::vector<std::string> CreateResourcePaths(size_t p_count)
+	{
+		std::vector<std::string> paths;
+		paths.reserve(p_count);
+
+		for (size_t i = 0; i < p_count; ++i)
+		{
+			paths.push_back("Textures/Environment/Rocks/Rock_" + std::to_string(i) + "_Albedo.png");
+		}
+
+		return paths;
+	}
+}
+
+OVTEST(ResourceIDIgnoresPathSpelling)
+{
+	using namespace OvCore::ResourceManagement;
+
+	const auto id = GetResourceID("Textures/Rock.png");
+
+	OVTEST_CHECK(GetResourceID("Textures\\Rock.png") == id);
+	OVTEST_CHECK(GetResourceID("Textures/./Rock.png") == id);
+	OVTEST_CHECK(GetResourceID("Models/../Textures/Rock.png") == id);
+	OVTEST_CHECK(GetResourceID("Textures//Rock.png") == id);
+	OVTEST_CHECK(GetResourceID("Textures/Rock.jpg") != id);
+	OVTEST_CHECK(GetResourceID(":Textures/Rock.png") != id);
+}
+
+OVTEST(ResourceManagerLookupsByPathAndID)
+{
+	IntegerManager manager;
+	int* resource = manager.LoadResource("Textures\\Rock.png");
+
+	OVTEST_CHECK(resource != nullptr);
+	OVTEST_CHECK(manager.GetResource("Textures/Rock.png", false) == resource);
+	OVTEST_CHECK(manager.GetResource(OvCore::ResourceManagement::GetResourceID("Textures/./Rock.png")) == resource);
+	OVTEST_CHECK(manager.GetResources().contains("Textures/Rock.png"));
+
+	// Loading another spelling of the same path returns the registered resource
+	OVTEST_CHECK(manager.LoadResource("Models/../Textures/Rock.png") == resource);
+
+	OVTEST_CHECK(manager.MoveResource("Textures/Rock.png", "Textures/Stone.png"));
+	OVTEST_CHECK(!manager.IsResourceRegistered("Textures/Rock.png"));
+	OVTEST_CHECK(manager.GetResource("Textures\\Stone.png", false) == resource);
+
+	manager.UnloadResource("Textures/Stone.png");
+	OVTEST_CHECK(manager.destroyedCount == 1);
+	OVTEST_CHECK(manager.GetResource(OvCore::ResourceManagement::GetResourceID("Textures/Stone.png")) == nullptr);
+	OVTEST_CHECK(manager.GetResources().empty());
+}
+
+OVBENCHMARK(ResourceLookupBenchmark)
+{
+	using namespace OvCore::ResourceManagement;
+
+	constexpr size_t kLookupCount = 100000;
+
+	IntegerManager manager;
+	const auto paths = CreateResourcePaths(1000);
+	std::vector<ResourceID> ids;
+
+	for (const auto& path : paths)
+	{
+		manager.LoadResource(path);
+		ids.push_back(GetResourceID(path));
+	}
+
+	size_t found = 0;
+
+	// Normalizing the path before each lookup in the path map, as resource managers used to
+	const double normalizedPathDuration = OvTests::MeasureMilliseconds([&]
+	{
+		for (size_t i = 0; i < kLookupCount; ++i)
+		{
+			found += manager.GetResources().contains(NormalizeResourcePath(paths[i % paths.size()]));
+		}
+	});
+
+	const double pathDuration = OvTests::MeasureMilliseconds([&]
+	{
+		for (size_t i = 0; i < kLookupCount; ++i)
+		{
+			found += manager.GetResource(paths[i % paths.size()], false) != nullptr;
+		}
+	});
+
+	const double idDuration = OvTests::MeasureMilliseconds([&]
+	{
+		for (size_t i = 0; i < kLookupCount; ++i)
+		{
+			found += manager.GetResource(ids[i % ids.size()]) != nullptr;
+		}
+	});
+
+	std::cout << "\t" << kLookupCount << " lookups: " << normalizedPathDuration << " ms (Normalized path), " << pathDuration << " ms (Path), " << idDuration << " ms (ID)" << std::endl;
+
+	OVTEST_CHECK(found == kLookupCount * 3);
+	manager.UnloadResources();
+}
@@ -0,0 +1,65 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <string_view>
+
+#include <OvTests/Test.h>
+
+std::vector<OvTests::TestCase>& OvTests::GetTestCases()
+{
+	static std::vector<TestCase> testCases;
+	return testCases;
+}
+
+/**
+* Runs every test, and the benchmarks if "--benchmarks" is given.
+* Any other argument is a filter, only the cases whose name contains it are run.
+* Returns the number of failed cases
+*/
+int main(int p_argc, char** p_argv)
+{
+	bool runBenchmarks = false;
+	std::string_view filter;
+
+	for (int i = 1; i < p_argc; ++i)
+	{
+		if (std::strcmp(p_argv[i], "--benchmarks") == 0)
+			runBenchmarks = true;
+		else
+			filter = p_argv[i];
+	}
+
+	int run = 0;
+	int failed = 0;
+
+	for (const auto& testCase : OvTests::GetTestCases())
+	{
+		if (testCase.benchmark && !runBenchmarks)
+			continue;
+
+		if (!filter.empty() && std::string_view(testCase.name).find(filter) == std::string_view::npos)
+			continue;
+
+		++run;
+
+		try
+		{
+			testCase.function();
+			std::cout << "[PASSED] " << testCase.name << std::endl;
+		}
+		catch (const std::exception& e)
+		{
+			++failed;
+			std::cout << "[FAILED] " << testCase.name << ": " << e.what() << std::endl;
+		}
+	}
+
+	std::cout << run - failed << "/" << run << " passed" << std::endl;
+	return failed;
+}
@@ -0,0 +1,120 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <bullet/LinearMath/btThreads.h>
+
+#include <OvPhysics/Core/PhysicsEngine.h>
+#include <OvPhysics/Entities/PhysicalBox.h>
+
+#include <OvTests/Test.h>
+
+OVTEST(MultithreadedEnginesShareTaskScheduler)
+{
+	OvPhysics::Settings::PhysicsSettings settings;
+	settings.multithreaded = true;
+	settings.workerCount = 2;
+
+	auto first = std::make_unique<OvPhysics::Core::PhysicsEngine>(settings);
+
+	// Bullet built without BT_THREADSAFE: there is no scheduler to share
+	if (!first->IsMultithreaded())
+	{
+		return;
+	}
+
+	btITaskScheduler* const scheduler = btGetTaskScheduler();
+	OVTEST_CHECK(scheduler != btGetSequentialTaskScheduler());
+
+	auto second = std::make_unique<OvPhysics::Core::PhysicsEngine>(settings);
+	OVTEST_CHECK(second->IsMultithreaded());
+	OVTEST_CHECK(btGetTaskScheduler() == scheduler);
+
+	// Destroying an engine keeps the scheduler of the other one installed
+	first.reset();
+	OVTEST_CHECK(btGetTaskScheduler() == scheduler);
+	OVTEST_CHECK(second->Update(settings.fixedTimestep));
+
+	second.reset();
+	OVTEST_CHECK(btGetTaskScheduler() == btGetSequentialTaskScheduler());
+
+	// A new engine installs a scheduler again
+	OvPhysics::Core::PhysicsEngine third(settings);
+	OVTEST_CHECK(third.IsMultithreaded());
+	OVTEST_CHECK(btGetTaskScheduler() != btGetSequentialTaskScheduler());
+}
+
+OVBENCHMARK(RaycastBatchBenchmark)
+{
+	constexpr uint32_t kBoxesPerRow = 100;
+	constexpr uint32_t kBoxCount = 5000;
+	constexpr uint32_t kRayCount = 10000;
+
+	OvPhysics::Settings::PhysicsSettings settings;
+	settings.multithreaded = true;
+
+	OvPhysics::Core::PhysicsEngine engine(settings);
+
+	// Kinematic boxes on a grid, spaced so that some rays fall between them
+	std::vector<std::unique_ptr<OvPhysics::Entities::PhysicalBox>> boxes;
+	boxes.reserve(kBoxCount);
+
+	for (uint32_t i = 0; i < kBoxCount; ++i)
+	{
+		auto& box = boxes.emplace_back(std::make_unique<OvPhysics::Entities::PhysicalBox>());
+		box->SetKinematic(true);
+		box->GetTransform().SetLocalPosition({ static_cast<float>(i % kBoxesPerRow) * 1.5f, 0.0f, static_cast<float>(i / kBoxesPerRow) * 1.5f });
+		engine.AddPhysicalObject(*box);
+	}
+
+	// Transforms are sent to Bullet at the beginning of each simulation step
+	engine.Update(settings.fixedTimestep);
+
+	std::mt19937 generator(42);
+	std::uniform_real_distribution<float> xDistribution(-1.0f, kBoxesPerRow * 1.5f);
+	std::uniform_real_distribution<float> zDistribution(-1.0f, kBoxCount / kBoxesPerRow * 1.5f);
+
+	std::vector<OvPhysics::Entities::RayQuery> queries(kRayCount);
+	for (auto& query : queries)
+	{
+		query.origin = { xDistribution(generator), 10.0f, zDistribution(generator) };
+		query.direction = { 0.0f, -1.0f, 0.0f };
+		query.distance = 20.0f;
+	}
+
+	std::vector<OvPhysics::Entities::QueryHit> sequentialHits(kRayCount);
+	std::vector<OvPhysics::Entities::QueryHit> parallelHits(kRayCount);
+
+	const double sequentialDuration = OvTests::MeasureMilliseconds([&] { engine.RaycastBatch(queries, sequentialHits, false); });
+	const double parallelDuration = OvTests::MeasureMilliseconds([&] { engine.RaycastBatch(queries, parallelHits, true); });
+
+	uint32_t hitCount = 0;
+
+	for (uint32_t i = 0; i < kRayCount; ++i)
+	{
+		const auto& sequential = sequentialHits[i];
+		const auto& parallel = parallelHits[i];
+
+		OVTEST_CHECK(sequential.object == parallel.object);
+		OVTEST_CHECK(sequential.distance == parallel.distance);
+		OVTEST_CHECK(sequential.point.x == parallel.point.x && sequential.point.y == parallel.point.y && sequential.point.z == parallel.point.z);
+		OVTEST_CHECK(sequential.normal.x == parallel.normal.x && sequential.normal.y == parallel.normal.y && sequential.normal.z == parallel.normal.z);
+
+		hitCount += sequential.object != nullptr;
+	}
+
+	// Rays either hit the top face of a box or miss the whole grid
+	OVTEST_CHECK(hitCount > 0 && hitCount < kRayCount);
+
+	std::cout
+		<< "\t" << kRayCount << " rays against " << kBoxCount << " bodies (" << hitCount << " hits): "
+		<< "sequential " << sequentialDuration << " ms, "
+		<< "parallel " << parallelDuration << " ms" << (engine.IsMultithreaded() ? "" : " (not multithreaded)") << std::endl;
+}
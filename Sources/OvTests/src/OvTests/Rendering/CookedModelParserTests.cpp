@@ -0,0 +1,111 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <filesystem>
+#include <functional>
+
+#include <OvRendering/Resources/Parsers/CookedModelParser.h>
+
+#include <OvTests/Test.h>
+
+namespace
+{
+	/**
+	* Skinned triangle driven by a skeleton of two nodes, each having a bone
+	*/
+	OvRendering::Resources::Parsers::ModelData CreateSkinnedModel()
+	{
+		OvRendering::Resources::Parsers::ModelData data;
+		data.materialNames = { "Material" };
+
+		auto& mesh = data.meshes.emplace_back();
+		mesh.skinnedVertices.resize(3);
+		mesh.skinnedVertices[1].position[0] = 1.0f;
+		mesh.skinnedVertices[2].position[1] = 1.0f;
+		mesh.indices = { 0, 1, 2 };
+
+		for (auto& vertex : mesh.skinnedVertices)
+		{
+			vertex.boneIDs[0] = 0;
+			vertex.boneWeights[0] = 0.5f;
+			vertex.boneIDs[1] = 1;
+			vertex.boneWeights[1] = 0.5f;
+		}
+
+		auto& skeleton = data.skeleton.emplace();
+		skeleton.nodes = { { .name = "Root", .parentIndex = -1, .boneIndex = 0 }, { .name = "Arm", .parentIndex = 0, .boneIndex = 1 } };
+		skeleton.bones = { { .name = "Root", .nodeIndex = 0 }, { .name = "Arm", .nodeIndex = 1 } };
+		skeleton.nodeByName = { { "Root", 0 }, { "Arm", 1 } };
+		skeleton.boneByName = { { "Root", 0 }, { "Arm", 1 } };
+
+		return data;
+	}
+
+	/**
+	* Cook the given model and return true if it can be loaded back
+	*/
+	bool CookAndLoad(const OvRendering::Resources::Parsers::ModelData& p_data)
+	{
+		using OvRendering::Resources::Parsers::CookedModelParser;
+
+		// A missing source never makes the cooked file outdated
+		const auto sourcePath = std::filesystem::temp_directory_path() / "OvTestsMissingSource.fbx";
+		const auto cookedPath = std::filesystem::temp_directory_path() / "OvTestsModel.ovmesh";
+
+		OvRendering::Resources::Parsers::ModelData loaded;
+
+		const bool result =
+			CookedModelParser::Save(cookedPath, CookedModelParser::ComputeStamp(sourcePath, 0), p_data) &&
+			CookedModelParser::LoadModelData(cookedPath, sourcePath, 0, loaded);
+
+		std::filesystem::remove(cookedPath);
+		return result;
+	}
+
+	bool CookAndLoadModified(const std::function<void(OvRendering::Resources::Parsers::ModelData&)>& p_modification)
+	{
+		auto data = CreateSkinnedModel();
+		p_modification(data);
+		return CookAndLoad(data);
+	}
+}
+
+OVTEST(CookedModelLoadsValidSkeleton)
+{
+	OVTEST_CHECK(CookAndLoad(CreateSkinnedModel()));
+
+	// Unused influences can keep their default bone ID
+	OVTEST_CHECK(CookAndLoadModified([](auto& p_data) { p_data.meshes[0].skinnedVertices[0].boneIDs[2] = 0; }));
+}
+
+OVTEST(CookedModelRejectsInvalidIndices)
+{
+	OVTEST_CHECK(!CookAndLoadModified([](auto& p_data) { p_data.meshes[0].indices[1] = 3; }));
+}
+
+OVTEST(CookedModelRejectsInvalidSkeleton)
+{
+	// Parents must be stored before their children, which also rules out cycles
+	OVTEST_CHECK(!CookAndLoadModified([](auto& p_data) { p_data.skeleton->nodes[0].parentIndex = 1; }));
+	OVTEST_CHECK(!CookAndLoadModified([](auto& p_data) { p_data.skeleton->nodes[1].parentIndex = 1; }));
+	OVTEST_CHECK(!CookAndLoadModified([](auto& p_data) { p_data.skeleton->nodes[1].parentIndex = -2; }));
+
+	OVTEST_CHECK(!CookAndLoadModified([](auto& p_data) { p_data.skeleton->nodes[1].boneIndex = 2; }));
+	OVTEST_CHECK(!CookAndLoadModified([](auto& p_data) { p_data.skeleton->bones[1].nodeIndex = 2; }));
+	OVTEST_CHECK(!CookAndLoadModified([](auto& p_data) { p_data.skeleton->nodeByName["Arm"] = 2; }));
+	OVTEST_CHECK(!CookAndLoadModified([](auto& p_data) { p_data.skeleton->boneByName["Arm"] = 2; }));
+}
+
+OVTEST(CookedModelRejectsInvalidBoneIDs)
+{
+	OVTEST_CHECK(!CookAndLoadModified([](auto& p_data) { p_data.meshes[0].skinnedVertices[2].boneIDs[1] = 2; }));
+
+	// Even without weight, only the default ID is accepted outside of the skeleton
+	OVTEST_CHECK(!CookAndLoadModified([](auto& p_data) { p_data.meshes[0].skinnedVertices[2].boneIDs[3] = 1000; }));
+
+	// A skinned mesh needs bones
+	OVTEST_CHECK(!CookAndLoadModified([](auto& p_data) { p_data.skeleton.reset(); }));
+}
@@ -0,0 +1,235 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <iostream>
+#include <map>
+
+#include <OvRendering/Resources/Mesh.h>
+#include <OvRendering/Utils/MeshSimplification.h>
+
+#include <OvTests/Test.h>
+
+namespace
+{
+	struct TestMesh
+	{
+		std::vector<OvMaths::FVector3> positions;
+		std::vector<uint32_t> indices;
+	};
+
+	/**
+	* Unit sphere made by subdividing an octahedron, closed and without duplicated positions
+	*/
+	TestMesh CreateSphere(uint32_t p_subdivisions)
+	{
+		TestMesh mesh;
+		mesh.positions = { { 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 } };
+		mesh.indices = { 0, 2, 4, 2, 1, 4, 1, 3, 4, 3, 0, 4, 2, 0, 5, 1, 2, 5, 3, 1, 5, 0, 3, 5 };
+
+		for (uint32_t i = 0; i < p_subdivisions; ++i)
+		{
+			std::map<std::pair<uint32_t, uint32_t>, uint32_t> midpoints;
+			std::vector<uint32_t> indices;
+			indices.reserve(mesh.indices.size() * 4);
+
+			const auto getMidpoint = [&](uint32_t p_a, uint32_t p_b)
+			{
+				const auto key = std::minmax(p_a, p_b);
+
+				if (auto found = midpoints.find(key); found != midpoints.end())
+				{
+					return found->second;
+				}
+
+				const auto midpoint = mesh.positions[p_a] + mesh.positions[p_b];
+				mesh.positions.push_back(midpoint / OvMaths::FVector3::Length(midpoint));
+				return midpoints[key] = static_cast<uint32_t>(mesh.positions.size() - 1);
+			};
+
+			for (size_t j = 0; j < mesh.indices.size(); j += 3)
+			{
+				const uint32_t a = mesh.indices[j], b = mesh.indices[j + 1], c = mesh.indices[j + 2];
+				const uint32_t ab = getMidpoint(a, b), bc = getMidpoint(b, c), ca = getMidpoint(c, a);
+				indices.insert(indices.end(), { a, ab, ca, ab, b, bc, ca, bc, c, ab, bc, ca });
+			}
+
+			mesh.indices = std::move(indices);
+		}
+
+		return mesh;
+	}
+
+	/**
+	* Flat square grid of the given number of cells per side
+	*/
+	TestMesh CreateGrid(uint32_t p_cells)
+	{
+		TestMesh mesh;
+
+		for (uint32_t y = 0; y <= p_cells; ++y)
+		{
+			for (uint32_t x = 0; x <= p_cells; ++x)
+			{
+				mesh.positions.push_back({ static_cast<float>(x), 0.0f, static_cast<float>(y) });
+			}
+		}
+
+		for (uint32_t y = 0; y < p_cells; ++y)
+		{
+			for (uint32_t x = 0; x < p_cells; ++x)
+			{
+				const uint32_t corner = y * (p_cells + 1) + x;
+				mesh.indices.insert(mesh.indices.end(), { corner, corner + p_cells + 1, corner + 1, corner + 1, corner + p_cells + 1, corner + p_cells + 2 });
+			}
+		}
+
+		return mesh;
+	}
+
+	bool AreTrianglesValid(const std::vector<uint32_t>& p_indices, size_t p_vertexCount)
+	{
+		if (p_indices.size() % 3 != 0)
+		{
+			return false;
+		}
+
+		for (size_t i = 0; i < p_indices.size(); i += 3)
+		{
+			const uint32_t a = p_indices[i], b = p_indices[i + 1], c = p_indices[i + 2];
+
+			if (a >= p_vertexCount || b >= p_vertexCount || c >= p_vertexCount || a == b || b == c || a == c)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
+
+OVTEST(SimplifyMeshReachesTargetWithValidIndices)
+{
+	const auto sphere = CreateSphere(4);
+	const auto result = OvRendering::Utils::SimplifyMesh(sphere.positions, sphere.indices, sphere.indices.size() / 4);
+
+	OVTEST_CHECK(result.indices.size() <= sphere.indices.size() / 4);
+	OVTEST_CHECK(!result.indices.empty());
+	OVTEST_CHECK(AreTrianglesValid(result.indices, sphere.positions.size()));
+}
+
+OVTEST(SimplifyMeshErrorGrowsWithReduction)
+{
+	const auto sphere = CreateSphere(4);
+	const auto half = OvRendering::Utils::SimplifyMesh(sphere.positions, sphere.indices, sphere.indices.size() / 2);
+	const auto quarter = OvRendering::Utils::SimplifyMesh(sphere.positions, sphere.indices, sphere.indices.size() / 4);
+
+	OVTEST_CHECK(half.error > 0.0f);
+	OVTEST_CHECK(quarter.error >= half.error);
+
+	// A sphere keeps its shape: the error stays small relative to its extent
+	OVTEST_CHECK(quarter.error < 0.05f);
+}
+
+OVTEST(SimplifyMeshRespectsMaxError)
+{
+	const auto sphere = CreateSphere(4);
+	const float maxError = OvRendering::Utils::SimplifyMesh(sphere.positions, sphere.indices, sphere.indices.size() / 2).error;
+	const auto result = OvRendering::Utils::SimplifyMesh(sphere.positions, sphere.indices, 0, maxError);
+
+	OVTEST_CHECK(result.error <= maxError);
+	OVTEST_CHECK(result.indices.size() < sphere.indices.size());
+	OVTEST_CHECK(AreTrianglesValid(result.indices, sphere.positions.size()));
+}
+
+OVTEST(SimplifyMeshCollapsesFlatAreasWithoutError)
+{
+	// Interior vertices of a plane can go, its border vertices are locked
+	const auto grid = CreateGrid(8);
+	const auto result = OvRendering::Utils::SimplifyMesh(grid.positions, grid.indices, 0, 0.0f);
+
+	OVTEST_CHECK(result.error == 0.0f);
+	OVTEST_CHECK(result.indices.size() < grid.indices.size());
+	OVTEST_CHECK(AreTrianglesValid(result.indices, grid.positions.size()));
+
+	std::vector<bool> used(grid.positions.size(), false);
+
+	for (const uint32_t index : result.indices)
+	{
+		used[index] = true;
+	}
+
+	for (size_t i = 0; i < grid.positions.size(); ++i)
+	{
+		const auto& position = grid.positions[i];
+		const bool onBorder = position.x == 0.0f || position.x == 8.0f || position.z == 0.0f || position.z == 8.0f;
+		OVTEST_CHECK(!onBorder || used[i]);
+	}
+}
+
+OVTEST(SimplifyMeshDropsOutOfRangeIndices)
+{
+	auto grid = CreateGrid(4);
+	grid.indices.insert(grid.indices.end(), { 0, 1, static_cast<uint32_t>(grid.positions.size()) });
+
+	const auto result = OvRendering::Utils::SimplifyMesh(grid.positions, grid.indices, grid.indices.size());
+
+	OVTEST_CHECK(result.indices.size() == grid.indices.size() - 3);
+	OVTEST_CHECK(AreTrianglesValid(result.indices, grid.positions.size()));
+}
+
+OVTEST(SelectLODWithoutLevels)
+{
+	OVTEST_CHECK(OvRendering::Resources::Mesh::SelectLOD({}, 0.0f, 0) == 0);
+	OVTEST_CHECK(OvRendering::Resources::Mesh::SelectLOD({}, 1.0f, 3) == 0);
+}
+
+OVTEST(SelectLODFollowsScreenSize)
+{
+	const std::array<float, 2> screenSizes{ 0.5f, 0.25f };
+
+	OVTEST_CHECK(OvRendering::Resources::Mesh::SelectLOD(screenSizes, 1.0f, 0) == 0);
+	OVTEST_CHECK(OvRendering::Resources::Mesh::SelectLOD(screenSizes, 0.3f, 0) == 1);
+	OVTEST_CHECK(OvRendering::Resources::Mesh::SelectLOD(screenSizes, 0.1f, 0) == 2);
+	OVTEST_CHECK(OvRendering::Resources::Mesh::SelectLOD(screenSizes, 1.0f, 2) == 0);
+	OVTEST_CHECK(OvRendering::Resources::Mesh::SelectLOD(screenSizes, 0.3f, 2) == 1);
+
+	// Out of range levels are clamped to the coarsest one
+	OVTEST_CHECK(OvRendering::Resources::Mesh::SelectLOD(screenSizes, 0.1f, 7) == 2);
+}
+
+OVTEST(SelectLODAppliesHysteresis)
+{
+	const std::array<float, 2> screenSizes{ 0.5f, 0.25f };
+	constexpr float hysteresis = OvRendering::Resources::Mesh::kLODHysteresis;
+
+	// Within the margin around a threshold, the current level is kept
+	OVTEST_CHECK(OvRendering::Resources::Mesh::SelectLOD(screenSizes, 0.5f * (1.0f - hysteresis * 0.5f), 0) == 0);
+	OVTEST_CHECK(OvRendering::Resources::Mesh::SelectLOD(screenSizes, 0.5f * (1.0f + hysteresis * 0.5f), 1) == 1);
+	OVTEST_CHECK(OvRendering::Resources::Mesh::SelectLOD(screenSizes, 0.25f * (1.0f + hysteresis * 0.5f), 2) == 2);
+
+	// Beyond it, the level changes
+	OVTEST_CHECK(OvRendering::Resources::Mesh::SelectLOD(screenSizes, 0.5f * (1.0f - hysteresis * 2.0f), 0) == 1);
+	OVTEST_CHECK(OvRendering::Resources::Mesh::SelectLOD(screenSizes, 0.5f * (1.0f + hysteresis * 2.0f), 1) == 0);
+	OVTEST_CHECK(OvRendering::Resources::Mesh::SelectLOD(screenSizes, 0.25f * (1.0f + hysteresis * 2.0f), 2) == 1);
+}
+
+OVBENCHMARK(SimplifyMeshBenchmark)
+{
+	const auto sphere = CreateSphere(7);
+	OvRendering::Utils::MeshSimplificationResult result;
+
+	const double duration = OvTests::MeasureMilliseconds([&]
+	{
+		result = OvRendering::Utils::SimplifyMesh(sphere.positions, sphere.indices, sphere.indices.size() / 4);
+	});
+
+	std::cout << "\t" << sphere.indices.size() / 3 << " -> " << result.indices.size() / 3 << " triangles in " << duration << " ms (Error: " << result.error << ")" << std::endl;
+
+	OVTEST_CHECK(AreTrianglesValid(result.indices, sphere.positions.size()));
+}
@@ -0,0 +1,288 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include <tinyxml2.h>
+
+#include <OvCore/SceneSystem/BinarySceneFormat.h>
+
+#include <OvTests/Test.h>
+
+namespace
+{
+	constexpr const char* kSceneXML = R"(<root>
+	<scene>
+		<actors>
+			<actor>
+				<name>Player &amp; "Camera" &lt;1&gt;</name>
+				<tag></tag>
+				<active>true</active>
+				<id>1</id>
+				<parent>0</parent>
+				<components>
+					<component>
+						<type>class OvCore::ECS::Components::CModelRenderer</type>
+						<data>
+							<model>Models/Characters/Knight.fbx</model>
+							<frustum_behaviour>1</frustum_behaviour>
+						</data>
+					</component>
+					<component>
+						<type>class OvCore::ECS::Components::CMaterialRenderer</type>
+						<data>
+							<materials>
+								<material>Materials/Knight.ovmat</material>
+								<material>Materials/Knight.ovmat</material>
+								<material>?</material>
+							</materials>
+						</data>
+					</component>
+				</components>
+				<behaviours/>
+			</actor>
+			<actor>
+				<name>Ünïcödé ★</name>
+				<id>2</id>
+				<parent>1</parent>
+				<position x="1.5" y="-2" z="3.25e-05"/>
+			</actor>
+		</actors>
+	</scene>
+</root>
+<settings version="2"/>)";
+
+	struct TemporaryFile
+	{
+		std::filesystem::path path;
+
+		TemporaryFile(const std::string& p_name) : path(std::filesystem::temp_directory_path() / p_name) {}
+		~TemporaryFile() { std::filesystem::remove(path); }
+	};
+
+	/**
+	* Returns true if both elements (And their descendants) have the same names, texts and attributes, in the same order
+	*/
+	bool AreElementsEqual(const tinyxml2::XMLElement* p_left, const tinyxml2::XMLElement* p_right)
+	{
+		if (std::strcmp(p_left->Name(), p_right->Name()) != 0)
+		{
+			return false;
+		}
+
+		const char* leftText = p_left->GetText();
+		const char* rightText = p_right->GetText();
+
+		if ((leftText == nullptr) != (rightText == nullptr) || (leftText && std::strcmp(leftText, rightText) != 0))
+		{
+			return false;
+		}
+
+		auto leftAttribute = p_left->FirstAttribute();
+		auto rightAttribute = p_right->FirstAttribute();
+
+		for (; leftAttribute && rightAttribute; leftAttribute = leftAttribute->Next(), rightAttribute = rightAttribute->Next())
+		{
+			if (std::strcmp(leftAttribute->Name(), rightAttribute->Name()) != 0 || std::strcmp(leftAttribute->Value(), rightAttribute->Value()) != 0)
+			{
+				return false;
+			}
+		}
+
+		if (leftAttribute || rightAttribute)
+		{
+			return false;
+		}
+
+		auto leftChild = p_left->FirstChildElement();
+		auto rightChild = p_right->FirstChildElement();
+
+		for (; leftChild && rightChild; leftChild = leftChild->NextSiblingElement(), rightChild = rightChild->NextSiblingElement())
+		{
+			if (!AreElementsEqual(leftChild, rightChild))
+			{
+				return false;
+			}
+		}
+
+		return !leftChild && !rightChild;
+	}
+
+	bool AreDocumentsEqual(const tinyxml2::XMLDocument& p_left, const tinyxml2::XMLDocument& p_right)
+	{
+		auto leftRoot = p_left.FirstChildElement();
+		auto rightRoot = p_right.FirstChildElement();
+
+		for (; leftRoot && rightRoot; leftRoot = leftRoot->NextSiblingElement(), rightRoot = rightRoot->NextSiblingElement())
+		{
+			if (!AreElementsEqual(leftRoot, rightRoot))
+			{
+				return false;
+			}
+		}
+
+		return !leftRoot && !rightRoot;
+	}
+
+	/**
+	* Scene document of the given number of actors, each having a few components
+	*/
+	std::string CreateLargeSceneXML(uint32_t p_actorCount)
+	{
+		std::string xml = "<root><scene><actors>";
+
+		for (uint32_t i = 1; i <= p_actorCount; ++i)
+		{
+			const std::string id = std::to_string(i);
+
+			xml +=
+				"<actor><name>Actor " + id + "</name><tag>Prop</tag><active>true</active>"
+				"<id>" + id + "</id><parent>" + std::to_string(i / 8) + "</parent><components>"
+				"<component><type>class OvCore::ECS::Components::CTransform</type><data>"
+				"<position><x>" + id + ".5</x><y>0</y><z>-" + id + "</z></position>"
+				"<rotation><x>0</x><y>0</y><z>0</z><w>1</w></rotation>"
+				"<scale><x>1</x><y>1</y><z>1</z></scale></data></component>"
+				"<component><type>class OvCore::ECS::Components::CModelRenderer</type><data>"
+				"<model>Models/Props/Prop_" + std::to_string(i % 50) + ".fbx</model><frustum_behaviour>1</frustum_behaviour></data></component>"
+				"<component><type>class OvCore::ECS::Components::CMaterialRenderer</type><data><materials>"
+				"<material>Materials/Prop_" + std::to_string(i % 20) + ".ovmat</material></materials></data></component>"
+				"</components><behaviours/></actor>";
+		}
+
+		return xml + "</actors></scene></root>";
+	}
+}
+
+OVTEST(BinarySceneRoundTrip)
+{
+	tinyxml2::XMLDocument source;
+	OVTEST_CHECK(source.Parse(kSceneXML) == tinyxml2::XML_SUCCESS);
+
+	TemporaryFile file("OvTestsRoundTrip.ovscene");
+	OVTEST_CHECK(OvCore::SceneSystem::BinarySceneFormat::Save(source, file.path));
+	OVTEST_CHECK(OvCore::SceneSystem::BinarySceneFormat::IsBinaryScene(file.path));
+
+	tinyxml2::XMLDocument decoded;
+	std::vector<std::string> assetReferences;
+	OVTEST_CHECK(OvCore::SceneSystem::BinarySceneFormat::Load(file.path, decoded, &assetReferences));
+	OVTEST_CHECK(AreDocumentsEqual(source, decoded));
+
+	// Printing the decoded document and parsing it back gives the same document again
+	tinyxml2::XMLPrinter printer;
+	decoded.Print(&printer);
+
+	tinyxml2::XMLDocument reparsed;
+	OVTEST_CHECK(reparsed.Parse(printer.CStr()) == tinyxml2::XML_SUCCESS);
+	OVTEST_CHECK(AreDocumentsEqual(source, reparsed));
+
+	// Asset paths are listed once, other strings aren't
+	std::ranges::sort(assetReferences);
+	OVTEST_CHECK((assetReferences == std::vector<std::string>{ "Materials/Knight.ovmat", "Models/Characters/Knight.fbx" }));
+}
+
+OVTEST(BinarySceneConversion)
+{
+	tinyxml2::XMLDocument source;
+	OVTEST_CHECK(source.Parse(kSceneXML) == tinyxml2::XML_SUCCESS);
+
+	TemporaryFile file("OvTestsConversion.ovscene");
+	OVTEST_CHECK(source.SaveFile(file.path.string().c_str()) == tinyxml2::XML_SUCCESS);
+	OVTEST_CHECK(!OvCore::SceneSystem::BinarySceneFormat::IsBinaryScene(file.path));
+
+	OVTEST_CHECK(OvCore::SceneSystem::BinarySceneFormat::ConvertToBinary(file.path));
+	OVTEST_CHECK(OvCore::SceneSystem::BinarySceneFormat::IsBinaryScene(file.path));
+
+	tinyxml2::XMLDocument decoded;
+	OVTEST_CHECK(OvCore::SceneSystem::BinarySceneFormat::Load(file.path, decoded));
+	OVTEST_CHECK(AreDocumentsEqual(source, decoded));
+}
+
+OVTEST(BinarySceneRejectsCorruptedFiles)
+{
+	tinyxml2::XMLDocument source;
+	OVTEST_CHECK(source.Parse(kSceneXML) == tinyxml2::XML_SUCCESS);
+
+	TemporaryFile file("OvTestsCorrupted.ovscene");
+	OVTEST_CHECK(OvCore::SceneSystem::BinarySceneFormat::Save(source, file.path));
+
+	std::vector<char> bytes(std::filesystem::file_size(file.path));
+	std::ifstream(file.path, std::ios::binary).read(bytes.data(), bytes.size());
+
+	const auto loadModified = [&](const std::vector<char>& p_bytes)
+	{
+		std::ofstream(file.path, std::ios::binary | std::ios::trunc).write(p_bytes.data(), p_bytes.size());
+
+		tinyxml2::XMLDocument decoded;
+		const bool loaded = OvCore::SceneSystem::BinarySceneFormat::Load(file.path, decoded);
+
+		// A failed load leaves the document empty
+		OVTEST_CHECK(loaded || decoded.FirstChild() == nullptr);
+		return loaded;
+	};
+
+	OVTEST_CHECK(loadModified(bytes));
+
+	// Every truncation is rejected
+	for (size_t size = 0; size < bytes.size(); size += 7)
+	{
+		OVTEST_CHECK(!loadModified({ bytes.begin(), bytes.begin() + size }));
+	}
+
+	// Incompatible format version (Stored right after the magic)
+	auto wrongVersion = bytes;
+	++wrongVersion[4];
+	OVTEST_CHECK(!loadModified(wrongVersion));
+
+	// Flipped bytes must never crash, whether they are detected or not
+	for (size_t i = 0; i < bytes.size(); i += 3)
+	{
+		auto flipped = bytes;
+		flipped[i] = static_cast<char>(~flipped[i]);
+		loadModified(flipped);
+	}
+
+	OVTEST_CHECK(!OvCore::SceneSystem::BinarySceneFormat::Load(file.path.string() + ".missing", source));
+}
+
+OVBENCHMARK(BinarySceneLoadBenchmark)
+{
+	constexpr uint32_t kLoadCount = 10;
+
+	tinyxml2::XMLDocument source;
+	OVTEST_CHECK(source.Parse(CreateLargeSceneXML(5000).c_str()) == tinyxml2::XML_SUCCESS);
+
+	TemporaryFile xmlFile("OvTestsBenchmark.xml");
+	TemporaryFile binaryFile("OvTestsBenchmark.ovscene");
+	OVTEST_CHECK(source.SaveFile(xmlFile.path.string().c_str()) == tinyxml2::XML_SUCCESS);
+	OVTEST_CHECK(OvCore::SceneSystem::BinarySceneFormat::Save(source, binaryFile.path));
+
+	const double xmlDuration = OvTests::MeasureMilliseconds([&]
+	{
+		for (uint32_t i = 0; i < kLoadCount; ++i)
+		{
+			tinyxml2::XMLDocument document;
+			OVTEST_CHECK(document.LoadFile(xmlFile.path.string().c_str()) == tinyxml2::XML_SUCCESS);
+		}
+	}) / kLoadCount;
+
+	const double binaryDuration = OvTests::MeasureMilliseconds([&]
+	{
+		for (uint32_t i = 0; i < kLoadCount; ++i)
+		{
+			tinyxml2::XMLDocument document;
+			OVTEST_CHECK(OvCore::SceneSystem::BinarySceneFormat::Load(binaryFile.path, document));
+		}
+	}) / kLoadCount;
+
+	std::cout
+		<< "\t5000 actors: XML " << std::filesystem::file_size(xmlFile.path) / 1024 << " KB loaded in " << xmlDuration << " ms, "
+		<< "binary " << std::filesystem::file_size(binaryFile.path) / 1024 << " KB loaded in " << binaryDuration << " ms" << std::endl;
+}
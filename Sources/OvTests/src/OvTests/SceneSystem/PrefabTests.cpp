@@ -0,0 +1,165 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+
+#include <OvCore/ECS/Actor.h>
+#include <OvCore/SceneSystem/PrefabOperations.h>
+#include <OvCore/SceneSystem/Scene.h>
+
+#include <OvTests/Test.h>
+
+namespace
+{
+	constexpr const char* kPrefabPath = "Enemy.ovprefab";
+
+	/**
+	* Temporary project folder holding a prefab of two actors (A root and its child), removed when destroyed
+	*/
+	struct PrefabProject
+	{
+		std::filesystem::path assetsPath = std::filesystem::temp_directory_path() / "OvTestsPrefabProject";
+
+		PrefabProject()
+		{
+			std::filesystem::create_directories(assetsPath);
+
+			OvCore::SceneSystem::Scene scene;
+			auto& root = scene.CreateActor("Enemy");
+			auto& child = scene.CreateActor("Weapon");
+			child.SetParent(root);
+			child.transform.SetLocalPosition({ 1.0f, 2.0f, 3.0f });
+
+			OvCore::SceneSystem::PrefabOperations::SaveToFile(root, assetsPath / kPrefabPath);
+		}
+
+		~PrefabProject()
+		{
+			OvCore::SceneSystem::PrefabOperations::ClearCache();
+			std::filesystem::remove_all(assetsPath);
+		}
+	};
+}
+
+OVTEST(PrefabInstantiation)
+{
+	PrefabProject project;
+	OvCore::SceneSystem::Scene scene(project.assetsPath);
+
+	auto* instance = scene.InstantiatePrefab(kPrefabPath);
+
+	OVTEST_CHECK(instance != nullptr);
+	OVTEST_CHECK(instance->GetName() == "Enemy");
+	OVTEST_CHECK(instance->GetPrefabSource() == kPrefabPath);
+	OVTEST_CHECK(instance->GetChildren().size() == 1);
+	OVTEST_CHECK(instance->GetChildren().front()->transform.GetLocalPosition().z == 3.0f);
+
+	// Cached instantiations create new actors with their own IDs
+	auto* other = scene.InstantiatePrefab(kPrefabPath);
+
+	OVTEST_CHECK(other != nullptr && other != instance);
+	OVTEST_CHECK(other->GetID() != instance->GetID());
+	OVTEST_CHECK(scene.GetActors().size() == 4);
+}
+
+OVTEST(PrefabCacheRevalidatedOnRequest)
+{
+	PrefabProject project;
+	OvCore::SceneSystem::Scene scene(project.assetsPath);
+
+	OVTEST_CHECK(scene.InstantiatePrefab(kPrefabPath)->GetChildren().size() == 1);
+
+	// Replaced by a prefab without child outside of the engine (SaveToFile would invalidate the cache itself)
+	{
+		OvCore::SceneSystem::Scene source;
+		OvCore::SceneSystem::PrefabOperations::SaveToFile(source.CreateActor("Boss"), project.assetsPath / "Boss.ovprefab");
+
+		const auto prefabPath = project.assetsPath / kPrefabPath;
+		const auto previousWriteTime = std::filesystem::last_write_time(prefabPath);
+		std::filesystem::copy_file(project.assetsPath / "Boss.ovprefab", prefabPath, std::filesystem::copy_options::overwrite_existing);
+		std::filesystem::last_write_time(prefabPath, previousWriteTime + std::chrono::hours(1));
+	}
+
+	// The file isn't checked again until the cache is revalidated (Once per frame)
+	OVTEST_CHECK(scene.InstantiatePrefab(kPrefabPath)->GetChildren().size() == 1);
+
+	OvCore::SceneSystem::PrefabOperations::RevalidateCache();
+	OVTEST_CHECK(scene.InstantiatePrefab(kPrefabPath)->GetChildren().empty());
+}
+
+OVTEST(PrefabPoolReusesReleasedInstances)
+{
+	PrefabProject project;
+	OvCore::SceneSystem::Scene scene(project.assetsPath);
+
+	auto* instance = scene.InstantiatePrefab(kPrefabPath);
+
+	// Only prefab instance roots can be pooled
+	OVTEST_CHECK(!scene.ReleaseToPool(*instance->GetChildren().front()));
+	OVTEST_CHECK(scene.ReleaseToPool(*instance));
+	OVTEST_CHECK(!scene.ReleaseToPool(*instance));
+	OVTEST_CHECK(!instance->IsSelfActive());
+	OVTEST_CHECK(scene.GetPooledInstanceCount(kPrefabPath) == 1);
+
+	auto& parent = scene.CreateActor("Spawner");
+	auto* reused = scene.InstantiatePrefab(kPrefabPath, parent);
+
+	OVTEST_CHECK(reused == instance);
+	OVTEST_CHECK(reused->IsSelfActive());
+	OVTEST_CHECK(reused->GetParent() == &parent);
+	OVTEST_CHECK(scene.GetPooledInstanceCount(kPrefabPath) == 0);
+
+	// Pooled instances are destroyed by ClearPools
+	scene.ReleaseToPool(*reused);
+	scene.ClearPools();
+	OVTEST_CHECK(!reused->IsAlive());
+	OVTEST_CHECK(scene.GetPooledInstanceCount(kPrefabPath) == 0);
+}
+
+OVBENCHMARK(PrefabSpawnBenchmark)
+{
+	constexpr size_t kSpawnCount = 10000;
+
+	PrefabProject project;
+
+	const auto spawn = [&](bool p_cached, bool p_pooled)
+	{
+		OvCore::SceneSystem::Scene scene(project.assetsPath);
+		size_t spawned = 0;
+
+		const double duration = OvTests::MeasureMilliseconds([&]
+		{
+			for (size_t i = 0; i < kSpawnCount; ++i)
+			{
+				if (!p_cached)
+				{
+					OvCore::SceneSystem::PrefabOperations::InvalidateCache(project.assetsPath / kPrefabPath);
+				}
+
+				if (auto* instance = scene.InstantiatePrefab(kPrefabPath))
+				{
+					++spawned;
+
+					if (p_pooled)
+					{
+						scene.ReleaseToPool(*instance);
+					}
+				}
+			}
+		});
+
+		OVTEST_CHECK(spawned == kSpawnCount);
+		return duration;
+	};
+
+	const double parsedDuration = spawn(false, false);
+	const double cachedDuration = spawn(true, false);
+	const double pooledDuration = spawn(true, true);
+
+	std::cout << "\t" << kSpawnCount << " spawns: " << parsedDuration << " ms (Parsed), " << cachedDuration << " ms (Cached), " << pooledDuration << " ms (Pooled)" << std::endl;
+}
@@ -0,0 +1,154 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <string>
+#include <vector>
+
+#include <OvCore/SceneSystem/SceneStreamer.h>
+
+#include <OvTests/Test.h>
+
+namespace
+{
+	constexpr const char* kChunkPath = "Chunk.ovscene";
+
+	/**
+	* Chunk centered at the origin, loaded within 10 units and unloaded beyond 15
+	*/
+	const OvCore::SceneSystem::SceneStreamer::Chunk kChunk{ { 0.0f, 0.0f, 0.0f }, 10.0f, 15.0f };
+
+	/**
+	* Counts the requests of a streamer following a camera path, every requested load succeeding (Like the SceneManager would)
+	*/
+	struct StreamingCounter
+	{
+		OvCore::SceneSystem::SceneStreamer& streamer;
+		uint32_t loads = 0;
+		uint32_t unloads = 0;
+
+		void Follow(const std::vector<float>& p_path)
+		{
+			for (const float x : p_path)
+			{
+				const auto requests = streamer.Update({ x, 0.0f, 0.0f });
+
+				for (const auto& path : requests.toLoad)
+				{
+					streamer.SetChunkLoadResult(path, true);
+				}
+
+				loads += static_cast<uint32_t>(requests.toLoad.size());
+				unloads += static_cast<uint32_t>(requests.toUnload.size());
+			}
+		}
+	};
+}
+
+OVTEST(SceneStreamerHysteresisAbsorbsJitter)
+{
+	OvCore::SceneSystem::SceneStreamer streamer;
+	streamer.AddChunk(kChunkPath, kChunk);
+
+	StreamingCounter counter{ streamer };
+
+	// Out of range, nothing happens
+	counter.Follow({ 20.0f, 18.0f });
+	OVTEST_CHECK(counter.loads == 0 && counter.unloads == 0);
+
+	// Jittering across the load distance only loads once
+	counter.Follow({ 10.5f, 9.5f, 10.5f, 9.5f, 10.5f, 9.5f, 10.5f, 9.5f });
+	OVTEST_CHECK(counter.loads == 1 && counter.unloads == 0);
+	OVTEST_CHECK(streamer.IsChunkLoaded(kChunkPath));
+
+	// Between the load and unload distances, the chunk stays loaded
+	counter.Follow({ 12.0f, 14.5f, 11.0f, 14.9f });
+	OVTEST_CHECK(counter.loads == 1 && counter.unloads == 0);
+
+	// Jittering across the unload distance only unloads once
+	counter.Follow({ 15.5f, 14.5f, 15.5f, 14.5f, 15.5f, 14.5f });
+	OVTEST_CHECK(counter.loads == 1 && counter.unloads == 1);
+	OVTEST_CHECK(!streamer.IsChunkLoaded(kChunkPath));
+
+	// Coming back within the load distance loads it again
+	counter.Follow({ 9.5f, 10.5f, 9.5f, 0.0f });
+	OVTEST_CHECK(counter.loads == 2 && counter.unloads == 1);
+	OVTEST_CHECK(streamer.IsChunkLoaded(kChunkPath));
+}
+
+OVTEST(SceneStreamerLimitsLoadsPerUpdate)
+{
+	OvCore::SceneSystem::SceneStreamer streamer;
+	OVTEST_CHECK(streamer.GetMaxLoadsPerUpdate() == OvCore::SceneSystem::SceneStreamer::kDefaultMaxLoadsPerUpdate);
+
+	// Registered from the furthest to the nearest, so that the order comes from the distances
+	streamer.AddChunk("Far.ovscene", { { 0.0f, 0.0f, 9.0f }, 10.0f, 15.0f });
+	streamer.AddChunk("Middle.ovscene", { { 0.0f, 6.0f, 0.0f }, 10.0f, 15.0f });
+	streamer.AddChunk("Near.ovscene", { { 3.0f, 0.0f, 0.0f }, 10.0f, 15.0f });
+	streamer.AddChunk("Outside.ovscene", { { 30.0f, 0.0f, 0.0f }, 10.0f, 15.0f });
+
+	streamer.SetMaxLoadsPerUpdate(2);
+
+	const OvMaths::FVector3 anchor{ 0.0f, 0.0f, 0.0f };
+
+	auto requests = streamer.Update(anchor);
+	OVTEST_CHECK(requests.toLoad == std::vector<std::string>({ "Near.ovscene", "Middle.ovscene" }));
+
+	// Unreported loads are requested again, still nearest first
+	requests = streamer.Update(anchor);
+	OVTEST_CHECK(requests.toLoad == std::vector<std::string>({ "Near.ovscene", "Middle.ovscene" }));
+
+	streamer.SetChunkLoadResult("Near.ovscene", true);
+	streamer.SetChunkLoadResult("Middle.ovscene", true);
+
+	requests = streamer.Update(anchor);
+	OVTEST_CHECK(requests.toLoad == std::vector<std::string>({ "Far.ovscene" }));
+	streamer.SetChunkLoadResult("Far.ovscene", true);
+
+	OVTEST_CHECK(streamer.Update(anchor).toLoad.empty());
+
+	// No limit requests every chunk in range at once
+	OvCore::SceneSystem::SceneStreamer unlimited;
+	unlimited.SetMaxLoadsPerUpdate(0);
+	unlimited.AddChunk("Far.ovscene", { { 0.0f, 0.0f, 9.0f }, 10.0f, 15.0f });
+	unlimited.AddChunk("Near.ovscene", { { 3.0f, 0.0f, 0.0f }, 10.0f, 15.0f });
+	unlimited.AddChunk("Middle.ovscene", { { 0.0f, 6.0f, 0.0f }, 10.0f, 15.0f });
+
+	OVTEST_CHECK(unlimited.Update(anchor).toLoad == std::vector<std::string>({ "Near.ovscene", "Middle.ovscene", "Far.ovscene" }));
+}
+
+OVTEST(SceneStreamerRetriesFailedLoadAfterLeaving)
+{
+	OvCore::SceneSystem::SceneStreamer streamer;
+	streamer.AddChunk(kChunkPath, kChunk);
+
+	const auto update = [&streamer](float p_x)
+	{
+		return streamer.Update({ p_x, 0.0f, 0.0f });
+	};
+
+	OVTEST_CHECK(update(0.0f).toLoad == std::vector<std::string>({ kChunkPath }));
+	streamer.SetChunkLoadResult(kChunkPath, false);
+	OVTEST_CHECK(!streamer.IsChunkLoaded(kChunkPath));
+
+	// Not retried while the anchor stays within the unload distance, even going back and forth
+	for (const float x : { 0.0f, 5.0f, 12.0f, 14.9f, 15.0f, 9.0f, 0.0f })
+	{
+		const auto requests = update(x);
+		OVTEST_CHECK(requests.toLoad.empty() && requests.toUnload.empty());
+	}
+
+	// Leaving doesn't request anything (The chunk isn't loaded), but allows a new attempt
+	const auto leaving = update(15.5f);
+	OVTEST_CHECK(leaving.toLoad.empty() && leaving.toUnload.empty());
+
+	// Between the distances, the chunk isn't in range yet
+	OVTEST_CHECK(update(12.0f).toLoad.empty());
+
+	OVTEST_CHECK(update(9.5f).toLoad == std::vector<std::string>({ kChunkPath }));
+	streamer.SetChunkLoadResult(kChunkPath, true);
+	OVTEST_CHECK(streamer.IsChunkLoaded(kChunkPath));
+	OVTEST_CHECK(update(0.0f).toLoad.empty());
+}
@@ -0,0 +1,195 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <OvCore/Scripting/Common/CoroutineScheduler.h>
+
+#include <OvTests/Test.h>
+
+namespace
+{
+	using TaskList = std::vector<OvCore::Scripting::CoroutineScheduler::TaskID>;
+}
+
+OVTEST(CoroutineWaitForSecondsOrder)
+{
+	OvCore::Scripting::CoroutineScheduler scheduler;
+	const auto late = scheduler.AddTask();
+	const auto early = scheduler.AddTask();
+	const auto tied = scheduler.AddTask();
+
+	scheduler.WaitForSeconds(late, 2.0);
+	scheduler.WaitForSeconds(early, 1.0);
+	scheduler.WaitForSeconds(tied, 1.0);
+
+	OVTEST_CHECK(scheduler.Update(0.5).empty());
+
+	// Expired delays come earliest first, then in the order they started waiting
+	OVTEST_CHECK((scheduler.Update(0.5) == TaskList{ early, tied }));
+	OVTEST_CHECK(scheduler.Update(0.75).empty());
+	OVTEST_CHECK((scheduler.Update(0.25) == TaskList{ late }));
+
+	// A single update expiring several delays returns them earliest first
+	scheduler.WaitForSeconds(late, 3.0);
+	scheduler.WaitForSeconds(early, 1.0);
+	OVTEST_CHECK((scheduler.Update(5.0) == TaskList{ early, late }));
+
+	// A resumed task doesn't wait anymore
+	OVTEST_CHECK(scheduler.Update(10.0).empty());
+	OVTEST_CHECK(scheduler.GetTime() == 17.0);
+	OVTEST_CHECK(scheduler.GetTaskCount() == 3);
+}
+
+OVTEST(CoroutineWaitForFrames)
+{
+	OvCore::Scripting::CoroutineScheduler scheduler;
+	const auto twoFrames = scheduler.AddTask();
+	const auto oneFrame = scheduler.AddTask();
+	const auto noFrame = scheduler.AddTask();
+
+	scheduler.WaitForFrames(twoFrames, 2);
+	scheduler.WaitForFrames(oneFrame, 1);
+	scheduler.WaitForFrames(noFrame, 0);
+
+	// Waiting for 0 frames waits for the next one, frames don't depend on the elapsed time
+	OVTEST_CHECK((scheduler.Update(0.0) == TaskList{ oneFrame, noFrame }));
+	OVTEST_CHECK((scheduler.Update(0.0) == TaskList{ twoFrames }));
+	OVTEST_CHECK(scheduler.Update(100.0).empty());
+	OVTEST_CHECK(scheduler.GetFrame() == 3);
+}
+
+OVTEST(CoroutineWaitForFixedUpdate)
+{
+	OvCore::Scripting::CoroutineScheduler scheduler;
+	const auto first = scheduler.AddTask();
+	const auto second = scheduler.AddTask();
+
+	scheduler.WaitForFixedUpdate(first);
+	scheduler.WaitForFixedUpdate(second);
+
+	// Updates don't resume tasks waiting for a fixed update
+	OVTEST_CHECK(scheduler.Update(1.0).empty());
+	OVTEST_CHECK(scheduler.Update(1.0).empty());
+
+	OVTEST_CHECK((scheduler.FixedUpdate() == TaskList{ first, second }));
+	OVTEST_CHECK(scheduler.FixedUpdate().empty());
+}
+
+OVTEST(CoroutineWaitUntil)
+{
+	OvCore::Scripting::CoroutineScheduler scheduler;
+	const auto task = scheduler.AddTask();
+
+	int polls = 0;
+	bool fulfilled = false;
+
+	scheduler.WaitUntil(task, [&] { ++polls; return fulfilled; });
+
+	// The condition is polled once per update, and never by fixed updates
+	OVTEST_CHECK(scheduler.Update(0.1).empty());
+	OVTEST_CHECK(scheduler.Update(0.1).empty());
+	OVTEST_CHECK(scheduler.FixedUpdate().empty());
+	OVTEST_CHECK(polls == 2);
+
+	fulfilled = true;
+	OVTEST_CHECK((scheduler.Update(0.1) == TaskList{ task }));
+	OVTEST_CHECK(polls == 3);
+
+	// Once resumed, the condition isn't polled anymore
+	OVTEST_CHECK(scheduler.Update(0.1).empty());
+	OVTEST_CHECK(polls == 3);
+}
+
+OVTEST(CoroutineResumeOrderAcrossWaits)
+{
+	OvCore::Scripting::CoroutineScheduler scheduler;
+	const auto condition = scheduler.AddTask();
+	const auto frame = scheduler.AddTask();
+	const auto timer = scheduler.AddTask();
+
+	scheduler.WaitUntil(condition, [] { return true; });
+	scheduler.WaitForFrames(frame, 1);
+	scheduler.WaitForSeconds(timer, 0.5);
+
+	// Delays first, then frames, then conditions, whatever order they started waiting in
+	OVTEST_CHECK((scheduler.Update(1.0) == TaskList{ timer, frame, condition }));
+}
+
+OVTEST(CoroutineNewWaitCancelsPrevious)
+{
+	OvCore::Scripting::CoroutineScheduler scheduler;
+	const auto task = scheduler.AddTask();
+
+	bool polled = false;
+
+	scheduler.WaitUntil(task, [&] { polled = true; return true; });
+	scheduler.WaitForSeconds(task, 1.0);
+	scheduler.WaitForFrames(task, 3);
+
+	OVTEST_CHECK(scheduler.Update(2.0).empty());
+	OVTEST_CHECK(!polled);
+	OVTEST_CHECK(scheduler.Update(0.0).empty());
+	OVTEST_CHECK((scheduler.Update(0.0) == TaskList{ task }));
+
+	// The task waited for a fixed update, then for a delay: the fixed update doesn't resume it
+	scheduler.WaitForFixedUpdate(task);
+	scheduler.WaitForSeconds(task, 1.0);
+	OVTEST_CHECK(scheduler.FixedUpdate().empty());
+	OVTEST_CHECK((scheduler.Update(1.0) == TaskList{ task }));
+}
+
+OVTEST(CoroutineTaskRemoval)
+{
+	OvCore::Scripting::CoroutineScheduler scheduler;
+	const int ownerA = 0;
+	const int ownerB = 0;
+
+	const auto first = scheduler.AddTask(&ownerA);
+	const auto second = scheduler.AddTask(&ownerB);
+	const auto third = scheduler.AddTask(&ownerA);
+
+	OVTEST_CHECK(scheduler.GetOwner(second) == &ownerB);
+
+	scheduler.WaitForSeconds(first, 1.0);
+	scheduler.WaitForSeconds(second, 1.0);
+	scheduler.WaitForSeconds(third, 1.0);
+
+	OVTEST_CHECK(scheduler.RemoveTask(second));
+	OVTEST_CHECK(!scheduler.RemoveTask(second));
+	OVTEST_CHECK(!scheduler.HasTask(second));
+	OVTEST_CHECK(scheduler.GetOwner(second) == nullptr);
+
+	// Removed tasks are never resumed
+	OVTEST_CHECK((scheduler.RemoveTasks(&ownerA) == TaskList{ first, third }));
+	OVTEST_CHECK(scheduler.GetTaskCount() == 0);
+	OVTEST_CHECK(scheduler.Update(2.0).empty());
+}
+
+OVTEST(CoroutineConditionRemovingTasks)
+{
+	OvCore::Scripting::CoroutineScheduler scheduler;
+	const auto timer = scheduler.AddTask();
+	const auto remover = scheduler.AddTask();
+	const auto removed = scheduler.AddTask();
+
+	scheduler.WaitForSeconds(timer, 0.0);
+
+	// A condition can remove tasks that are already ready, or that wait after it
+	scheduler.WaitUntil(remover, [&]
+	{
+		scheduler.RemoveTask(timer);
+		scheduler.RemoveTask(removed);
+		return true;
+	});
+
+	scheduler.WaitUntil(removed, [] { return true; });
+
+	OVTEST_CHECK((scheduler.Update(0.1) == TaskList{ remover }));
+
+	// A condition can remove its own task
+	scheduler.WaitUntil(remover, [&] { scheduler.RemoveTask(remover); return true; });
+	OVTEST_CHECK(scheduler.Update(0.1).empty());
+	OVTEST_CHECK(scheduler.GetTaskCount() == 0);
+}
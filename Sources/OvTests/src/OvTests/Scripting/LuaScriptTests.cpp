@@ -0,0 +1,146 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#if defined(LUA_SCRIPTING)
+
+#include <iostream>
+#include <memory>
+
+#include <sol/sol.hpp>
+
+#include <OvCore/Scripting/Lua/LuaScript.h>
+
+#include <OvTests/Test.h>
+
+OVTEST(LuaScriptResolvesImplementedCallbacks)
+{
+	using OvCore::Scripting::EScriptCallback;
+
+	sol::state lua;
+	lua.open_libraries(sol::lib::base);
+
+	const sol::table table = lua.script(R"(
+		local Behaviour = { OnUpdate = 5, speed = 2 }
+		function Behaviour:OnStart() end
+		function Behaviour:OnTriggerExit(other) end
+		function Behaviour:OnSceneLoaded(sceneName) end
+		return Behaviour
+	)");
+
+	const OvCore::Scripting::LuaScript script(table);
+
+	OVTEST_CHECK(script.IsValid());
+	OVTEST_CHECK(script.HasCallback(EScriptCallback::ON_START));
+	OVTEST_CHECK(script.HasCallback(EScriptCallback::ON_TRIGGER_EXIT));
+	OVTEST_CHECK(script.HasCallback(EScriptCallback::ON_SCENE_LOADED));
+
+	// Fields that aren't functions aren't callbacks
+	OVTEST_CHECK(!script.HasCallback(EScriptCallback::ON_UPDATE));
+	OVTEST_CHECK(!script.HasCallback(EScriptCallback::ON_AWAKE));
+
+	for (size_t i = 0; i < static_cast<size_t>(EScriptCallback::COUNT); ++i)
+	{
+		OVTEST_CHECK((script.GetContext().callbacks[i] != nullptr) == script.HasCallback(static_cast<EScriptCallback>(i)));
+	}
+}
+
+OVTEST(LuaScriptCallsResolvedCallbacks)
+{
+	sol::state lua;
+	lua.open_libraries(sol::lib::base);
+
+	const sol::table table = lua.script(R"(
+		local Behaviour = { elapsed = 0 }
+		function Behaviour:OnUpdate(deltaTime) self.elapsed = self.elapsed + deltaTime end
+		return Behaviour
+	)");
+
+	const OvCore::Scripting::LuaScript script(table);
+	const auto& context = script.GetContext();
+	const auto& onUpdate = *context.callbacks[static_cast<size_t>(OvCore::Scripting::EScriptCallback::ON_UPDATE)];
+
+	OVTEST_CHECK(onUpdate.call(*context.table, 0.25f).valid());
+	OVTEST_CHECK(onUpdate.call(*context.table, 0.5f).valid());
+	OVTEST_CHECK(table.get<float>("elapsed") == 0.75f);
+}
+
+OVTEST(LuaScriptWithoutTable)
+{
+	const OvCore::Scripting::LuaScript script(sol::table{});
+
+	OVTEST_CHECK(!script.IsValid());
+	OVTEST_CHECK(!script.HasCallback(OvCore::Scripting::EScriptCallback::ON_UPDATE));
+}
+
+OVBENCHMARK(LuaCallbackDispatchBenchmark)
+{
+	using OvCore::Scripting::EScriptCallback;
+
+	constexpr size_t kBehaviourCount = 10000;
+	constexpr size_t kFrameCount = 100;
+
+	sol::state lua;
+	lua.open_libraries(sol::lib::base);
+
+	// Half of the behaviours implement OnUpdate
+	const sol::protected_function createBehaviour = lua.script(R"(
+		return function(withUpdate)
+			local Behaviour = { elapsed = 0 }
+			function Behaviour:OnStart() end
+			if withUpdate then
+				function Behaviour:OnUpdate(deltaTime) self.elapsed = self.elapsed + deltaTime end
+			end
+			return Behaviour
+		end
+	)");
+
+	std::vector<std::unique_ptr<OvCore::Scripting::LuaScript>> scripts;
+	scripts.reserve(kBehaviourCount);
+
+	for (size_t i = 0; i < kBehaviourCount; ++i)
+	{
+		scripts.push_back(std::make_unique<OvCore::Scripting::LuaScript>(createBehaviour(i % 2 == 0).get<sol::table>()));
+	}
+
+	// Looking the callback up by name on every call, as scripts used to
+	const double lookupDuration = OvTests::MeasureMilliseconds([&]
+	{
+		for (size_t frame = 0; frame < kFrameCount; ++frame)
+		{
+			for (const auto& script : scripts)
+			{
+				const auto& table = *script->GetContext().table;
+
+				if (sol::protected_function callback = table["OnUpdate"]; callback.valid())
+				{
+					callback.call(table, 0.016f);
+				}
+			}
+		}
+	}) / kFrameCount;
+
+	const double resolvedDuration = OvTests::MeasureMilliseconds([&]
+	{
+		for (size_t frame = 0; frame < kFrameCount; ++frame)
+		{
+			for (const auto& script : scripts)
+			{
+				if (script->HasCallback(EScriptCallback::ON_UPDATE))
+				{
+					const auto& context = script->GetContext();
+					context.callbacks[static_cast<size_t>(EScriptCallback::ON_UPDATE)]->call(*context.table, 0.016f);
+				}
+			}
+		}
+	}) / kFrameCount;
+
+	std::cout << "\t" << kBehaviourCount << " behaviours, OnUpdate per frame: " << lookupDuration << " ms (Lookup by name), " << resolvedDuration << " ms (Resolved)" << std::endl;
+
+	OVTEST_CHECK(scripts.front()->GetContext().table->get<float>("elapsed") > 0.0f);
+	OVTEST_CHECK(scripts.back()->GetContext().table->get<float>("elapsed") == 0.0f);
+}
+
+#endif
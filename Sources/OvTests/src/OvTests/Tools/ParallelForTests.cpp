@@ -0,0 +1,94 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <vector>
+
+#include <OvTools/Utils/ParallelFor.h>
+#include <OvTools/Utils/ThreadPool.h>
+
+#include <OvTests/Test.h>
+
+OVTEST(ParallelForCallsEveryIndexOnce)
+{
+	constexpr size_t kCount = 1000;
+
+	std::vector<std::atomic<uint32_t>> calls(kCount);
+
+	OvTools::Utils::ParallelFor(kCount, [&](size_t p_index) { ++calls[p_index]; }, 4);
+
+	for (const auto& callCount : calls)
+	{
+		OVTEST_CHECK(callCount == 1);
+	}
+}
+
+OVTEST(ParallelForRethrowsExceptions)
+{
+	bool thrown = false;
+
+	try
+	{
+		OvTools::Utils::ParallelFor(100, [](size_t p_index)
+		{
+			if (p_index == 42)
+			{
+				throw std::runtime_error("ParallelFor");
+			}
+		}, 4);
+	}
+	catch (const std::runtime_error&)
+	{
+		thrown = true;
+	}
+
+	OVTEST_CHECK(thrown);
+}
+
+OVTEST(ParallelForInPoolTaskOnlyUsesPoolWorkers)
+{
+	OvTools::Utils::ThreadPool pool(3);
+	std::atomic<uint32_t> foreignCalls = 0;
+
+	auto result = pool.Submit([&]
+	{
+		OvTools::Utils::ParallelFor(200, [&](size_t)
+		{
+			foreignCalls += OvTools::Utils::ThreadPool::GetCurrent() != &pool;
+		}, 4);
+	});
+
+	OVTEST_CHECK(result.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+	OVTEST_CHECK(foreignCalls == 0);
+	OVTEST_CHECK(OvTools::Utils::ThreadPool::GetCurrent() == nullptr);
+}
+
+OVTEST(ParallelForInSaturatedPoolDoesNotDeadlock)
+{
+	OvTools::Utils::ThreadPool pool(2);
+	std::atomic<uint32_t> callCount = 0;
+
+	// Every worker runs a ParallelFor, so their helper tasks can only start once the calls are done
+	std::vector<std::future<void>> results;
+
+	for (uint32_t i = 0; i < pool.GetWorkerCount(); ++i)
+	{
+		results.push_back(pool.Submit([&]
+		{
+			OvTools::Utils::ParallelFor(100, [&](size_t) { ++callCount; }, 4);
+		}));
+	}
+
+	for (auto& result : results)
+	{
+		OVTEST_CHECK(result.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+	}
+
+	OVTEST_CHECK(callCount == 100 * pool.GetWorkerCount());
+}
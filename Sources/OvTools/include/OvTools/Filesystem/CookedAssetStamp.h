@@ -0,0 +1,47 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+
+namespace OvTools::Filesystem
+{
+	/**
+	* Identifies the source a cooked asset (.ovmesh, .ovtex, .ovcol, .ovluac) has been generated from
+	*/
+	struct CookedAssetStamp
+	{
+		uint64_t sourceSize = 0;
+		int64_t sourceWriteTime = 0;
+		uint64_t sourceHash = 0;
+		uint64_t settingsHash = 0;
+	};
+
+	/**
+	* Returns the hash of the given bytes, as used by the stamps (Cooked assets can use it to verify their own data)
+	* @param p_bytes
+	*/
+	uint64_t ComputeCookedAssetHash(std::span<const uint8_t> p_bytes);
+
+	/**
+	* Returns the stamp of the given source file (Its content is hashed, which reads the whole file)
+	* @param p_sourcePath
+	* @param p_settingsHash
+	*/
+	CookedAssetStamp ComputeCookedAssetStamp(const std::filesystem::path& p_sourcePath, uint64_t p_settingsHash);
+
+	/**
+	* Returns true if the given stamp matches the current source file and settings.
+	* A missing source (Shipped build without raw assets) is considered up-to-date
+	* @param p_stamp
+	* @param p_sourcePath
+	* @param p_settingsHash
+	*/
+	bool IsCookedAssetUpToDate(const CookedAssetStamp& p_stamp, const std::filesystem::path& p_sourcePath, uint64_t p_settingsHash);
+}
@@ -0,0 +1,50 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+
+namespace OvTools::Filesystem
+{
+	/**
+	* Read-only view of a file mapped in memory.
+	* The file content is paged in by the OS on access, and stays valid as long as the MappedFile lives
+	*/
+	class MappedFile
+	{
+	public:
+		/**
+		* Maps the given file in memory. Check IsValid() to know if the mapping succeeded
+		* @param p_path
+		*/
+		MappedFile(const std::filesystem::path& p_path);
+
+		/**
+		* Unmaps the file
+		*/
+		~MappedFile();
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		/**
+		* Returns true if the file has been mapped (Empty files can't be mapped)
+		*/
+		bool IsValid() const;
+
+		/**
+		* Returns the content of the file
+		*/
+		std::span<const uint8_t> GetData() const;
+
+	private:
+		const uint8_t* m_data = nullptr;
+		size_t m_size = 0;
+	};
+}
@@ -0,0 +1,26 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace OvTools::Utils
+{
+	/**
+	* Call the given function for every index of [0, p_count), spread over the calling thread and helpers.
+	* From a ThreadPool task, the helpers are tasks of the same pool. Otherwise, they are short-lived threads,
+	* limited to one per hardware thread for the whole process.
+	* Returns once every call is done, rethrowing the first exception thrown by the calls, if any.
+	* The calling thread never waits on a helper that hasn't started, so it can safely be used from a ThreadPool task
+	* @param p_count
+	* @param p_function
+	* @param p_maxThreadCount (0 = one thread per hardware thread)
+	*/
+	void ParallelFor(size_t p_count, const std::function<void(size_t)>& p_function, uint32_t p_maxThreadCount = 0);
+}
@@ -0,0 +1,85 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace OvTools::Utils
+{
+	/**
+	* Fixed set of worker threads executing submitted tasks in submission order
+	*/
+	class ThreadPool
+	{
+	public:
+		/**
+		* Starts the worker threads
+		* @param p_workerCount (0 = one worker per hardware thread, minus the calling thread)
+		*/
+		ThreadPool(uint32_t p_workerCount = 0);
+
+		/**
+		* Waits for the running tasks to finish and stops the workers.
+		* Tasks that haven't started yet are discarded (Their futures report a broken promise)
+		*/
+		~ThreadPool();
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+		/**
+		* Queues a task and returns a future to its result
+		* @param p_task
+		*/
+		template<typename TTask>
+		std::future<std::invoke_result_t<TTask>> Submit(TTask&& p_task)
+		{
+			using TResult = std::invoke_result_t<TTask>;
+
+			// std::function requires copyable callables, hence the shared packaged_task
+			auto task = std::make_shared<std::packaged_task<TResult()>>(std::forward<TTask>(p_task));
+			auto future = task->get_future();
+
+			{
+				std::scoped_lock lock(m_mutex);
+				m_tasks.emplace_back([task] { (*task)(); });
+			}
+
+			m_condition.notify_one();
+			return future;
+		}
+
+		/**
+		* Returns the number of worker threads
+		*/
+		uint32_t GetWorkerCount() const;
+
+		/**
+		* Returns the pool the calling thread is a worker of, or nullptr if it isn't a worker thread
+		*/
+		static ThreadPool* GetCurrent();
+
+	private:
+		void WorkerLoop();
+
+	private:
+		std::vector<std::thread> m_workers;
+		std::deque<std::function<void()>> m_tasks;
+		std::mutex m_mutex;
+		std::condition_variable m_condition;
+		bool m_stopping = false;
+	};
+}
@@ -0,0 +1,62 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <OvTools/Filesystem/CookedAssetStamp.h>
+#include <OvTools/Filesystem/MappedFile.h>
+
+uint64_t OvTools::Filesystem::ComputeCookedAssetHash(std::span<const uint8_t> p_bytes)
+{
+	uint64_t hash = 14695981039346656037ull;
+
+	for (const uint8_t byte : p_bytes)
+	{
+		hash = (hash ^ byte) * 1099511628211ull;
+	}
+
+	return hash;
+}
+
+OvTools::Filesystem::CookedAssetStamp OvTools::Filesystem::ComputeCookedAssetStamp(const std::filesystem::path& p_sourcePath, uint64_t p_settingsHash)
+{
+	CookedAssetStamp stamp;
+	stamp.settingsHash = p_settingsHash;
+
+	std::error_code error;
+	const auto size = std::filesystem::file_size(p_sourcePath, error);
+	stamp.sourceSize = error ? 0 : size;
+	const auto lastWrite = std::filesystem::last_write_time(p_sourcePath, error);
+	stamp.sourceWriteTime = error ? 0 : static_cast<int64_t>(lastWrite.time_since_epoch().count());
+
+	if (const MappedFile source(p_sourcePath); source.IsValid())
+	{
+		stamp.sourceHash = ComputeCookedAssetHash(source.GetData());
+	}
+
+	return stamp;
+}
+
+bool OvTools::Filesystem::IsCookedAssetUpToDate(const CookedAssetStamp& p_stamp, const std::filesystem::path& p_sourcePath, uint64_t p_settingsHash)
+{
+	if (p_stamp.settingsHash != p_settingsHash)
+		return false;
+
+	std::error_code error;
+
+	if (!std::filesystem::exists(p_sourcePath, error))
+		return true;
+
+	const auto size = std::filesystem::file_size(p_sourcePath, error);
+	if (error || size != p_stamp.sourceSize)
+		return false;
+
+	const auto lastWrite = std::filesystem::last_write_time(p_sourcePath, error);
+	if (!error && static_cast<int64_t>(lastWrite.time_since_epoch().count()) == p_stamp.sourceWriteTime)
+		return true;
+
+	// Copying files around (e.g. when building the game) changes their write time, so fall back to the content
+	const MappedFile source(p_sourcePath);
+	return source.IsValid() && ComputeCookedAssetHash(source.GetData()) == p_stamp.sourceHash;
+}
@@ -0,0 +1,90 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <OvTools/Filesystem/MappedFile.h>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+OvTools::Filesystem::MappedFile::MappedFile(const std::filesystem::path& p_path)
+{
+#ifdef _WIN32
+	const HANDLE file = CreateFileW(p_path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		return;
+	}
+
+	LARGE_INTEGER size;
+	if (GetFileSizeEx(file, &size) && size.QuadPart > 0)
+	{
+		// The view keeps the mapping alive, so both handles can be closed right away
+		if (const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr))
+		{
+			if (void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0))
+			{
+				m_data = static_cast<const uint8_t*>(view);
+				m_size = static_cast<size_t>(size.QuadPart);
+			}
+
+			CloseHandle(mapping);
+		}
+	}
+
+	CloseHandle(file);
+#else
+	const int file = open(p_path.c_str(), O_RDONLY);
+
+	if (file == -1)
+	{
+		return;
+	}
+
+	struct stat status;
+	if (fstat(file, &status) == 0 && status.st_size > 0)
+	{
+		// The mapping stays valid after the file descriptor is closed
+		void* view = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+
+		if (view != MAP_FAILED)
+		{
+			m_data = static_cast<const uint8_t*>(view);
+			m_size = static_cast<size_t>(status.st_size);
+		}
+	}
+
+	close(file);
+#endif
+}
+
+OvTools::Filesystem::MappedFile::~MappedFile()
+{
+	if (m_data)
+	{
+#ifdef _WIN32
+		UnmapViewOfFile(m_data);
+#else
+		munmap(const_cast<uint8_t*>(m_data), m_size);
+#endif
+	}
+}
+
+bool OvTools::Filesystem::MappedFile::IsValid() const
+{
+	return m_data != nullptr;
+}
+
+std::span<const uint8_t> OvTools::Filesystem::MappedFile::GetData() const
+{
+	return { m_data, m_size };
+}
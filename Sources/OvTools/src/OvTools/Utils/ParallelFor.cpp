@@ -0,0 +1,156 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "OvTools/Utils/ParallelFor.h"
+#include "OvTools/Utils/ThreadPool.h"
+
+namespace
+{
+	/**
+	* State shared by the calling thread and its helpers.
+	* A helper submitted to a thread pool can start after the call returned, hence the shared ownership
+	*/
+	struct ParallelForState
+	{
+		ParallelForState(size_t p_count, const std::function<void(size_t)>& p_function) :
+			count(p_count),
+			function(p_function)
+		{
+		}
+
+		const size_t count;
+		const std::function<void(size_t)>& function; // Only called for a valid index, so while the caller waits
+		std::atomic<size_t> nextIndex = 0;
+
+		std::mutex mutex;
+		std::condition_variable condition;
+		size_t completedCount = 0;
+		std::exception_ptr exception;
+	};
+
+	// Indices are handed out one by one, as the calls usually have very different costs (e.g. meshes of a model)
+	void Work(ParallelForState& p_state)
+	{
+		for (size_t i = p_state.nextIndex++; i < p_state.count; i = p_state.nextIndex++)
+		{
+			std::exception_ptr exception;
+
+			try
+			{
+				p_state.function(i);
+			}
+			catch (...)
+			{
+				exception = std::current_exception();
+			}
+
+			std::scoped_lock lock(p_state.mutex);
+
+			if (exception && !p_state.exception)
+			{
+				p_state.exception = exception;
+			}
+
+			if (++p_state.completedCount == p_state.count)
+			{
+				p_state.condition.notify_all();
+			}
+		}
+	}
+
+	// Helper threads currently alive in the process, whichever ParallelFor call started them
+	std::atomic<uint32_t> helperThreadCount = 0;
+
+	/**
+	* Reserve up to the given number of helper threads, without exceeding one thread per hardware thread in the
+	* whole process. Returns the number of reserved threads
+	*/
+	uint32_t ReserveHelperThreads(uint32_t p_count, uint32_t p_hardwareThreadCount)
+	{
+		const uint32_t maxHelperThreadCount = p_hardwareThreadCount - 1;
+		uint32_t current = helperThreadCount.load();
+		uint32_t reserved = 0;
+
+		do
+		{
+			reserved = std::min(p_count, maxHelperThreadCount - std::min(current, maxHelperThreadCount));
+		}
+		while (reserved > 0 && !helperThreadCount.compare_exchange_weak(current, current + reserved));
+
+		return reserved;
+	}
+}
+
+void OvTools::Utils::ParallelFor(size_t p_count, const std::function<void(size_t)>& p_function, uint32_t p_maxThreadCount)
+{
+	const uint32_t hardwareThreadCount = std::max(1u, std::thread::hardware_concurrency());
+	const size_t threadCount = std::min<size_t>(p_count, p_maxThreadCount > 0 ? p_maxThreadCount : hardwareThreadCount);
+
+	if (threadCount <= 1)
+	{
+		for (size_t i = 0; i < p_count; ++i)
+		{
+			p_function(i);
+		}
+
+		return;
+	}
+
+	auto state = std::make_shared<ParallelForState>(p_count, p_function);
+	std::vector<std::thread> helpers;
+
+	if (auto pool = ThreadPool::GetCurrent())
+	{
+		// Called from a pool task: the pool workers help instead of new threads. The caller works on its own
+		// meanwhile, and only waits for the calls already started, so it never waits on queued tasks
+		const size_t helperCount = std::min<size_t>(threadCount - 1, pool->GetWorkerCount() - 1);
+
+		for (size_t i = 0; i < helperCount; ++i)
+		{
+			pool->Submit([state] { Work(*state); });
+		}
+	}
+	else
+	{
+		const uint32_t helperCount = ReserveHelperThreads(static_cast<uint32_t>(threadCount - 1), hardwareThreadCount);
+		helpers.reserve(helperCount);
+
+		for (uint32_t i = 0; i < helperCount; ++i)
+		{
+			helpers.emplace_back([state]
+			{
+				Work(*state);
+				--helperThreadCount;
+			});
+		}
+	}
+
+	Work(*state);
+
+	{
+		std::unique_lock lock(state->mutex);
+		state->condition.wait(lock, [&state] { return state->completedCount == state->count; });
+	}
+
+	for (auto& helper : helpers)
+	{
+		helper.join();
+	}
+
+	if (state->exception)
+	{
+		std::rethrow_exception(state->exception);
+	}
+}
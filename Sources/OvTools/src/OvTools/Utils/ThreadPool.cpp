@@ -0,0 +1,77 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+
+#include "OvTools/Utils/ThreadPool.h"
+
+namespace
+{
+	thread_local OvTools::Utils::ThreadPool* currentPool = nullptr;
+}
+
+OvTools::Utils::ThreadPool::ThreadPool(uint32_t p_workerCount)
+{
+	const uint32_t workerCount = p_workerCount > 0 ?
+		p_workerCount :
+		std::max(2u, std::thread::hardware_concurrency()) - 1;
+
+	m_workers.reserve(workerCount);
+
+	for (uint32_t i = 0; i < workerCount; ++i)
+	{
+		m_workers.emplace_back(&ThreadPool::WorkerLoop, this);
+	}
+}
+
+OvTools::Utils::ThreadPool::~ThreadPool()
+{
+	{
+		std::scoped_lock lock(m_mutex);
+		m_stopping = true;
+		m_tasks.clear();
+	}
+
+	m_condition.notify_all();
+
+	for (auto& worker : m_workers)
+	{
+		worker.join();
+	}
+}
+
+uint32_t OvTools::Utils::ThreadPool::GetWorkerCount() const
+{
+	return static_cast<uint32_t>(m_workers.size());
+}
+
+OvTools::Utils::ThreadPool* OvTools::Utils::ThreadPool::GetCurrent()
+{
+	return currentPool;
+}
+
+void OvTools::Utils::ThreadPool::WorkerLoop()
+{
+	currentPool = this;
+
+	while (true)
+	{
+		std::function<void()> task;
+
+		{
+			std::unique_lock lock(m_mutex);
+			m_condition.wait(lock, [this] { return m_stopping || !m_tasks.empty(); });
+
+			if (m_stopping)
+				return;
+
+			task = std::move(m_tasks.front());
+			m_tasks.pop_front();
+		}
+
+		task();
+	}
+}
@@ -82,4 +82,8 @@ group "Overload Apps"
 	include "Sources/OvGame"
 group ""
 
+group "Overload Tests"
+	include "Sources/OvTests"
+group ""
+
 include "Resources"